@@ -198,6 +198,10 @@ PyAPI_FUNC(int) _PyStack_UnpackDict(
     PyObject *const **p_stack,
     PyObject **p_kwnames);
 
+PyAPI_FUNC(PyObject *) _Py_CheckFunctionResult(PyObject *callable,
+                                               PyObject *result,
+                                               const char *where);
+
 /* Suggested size (number of positional arguments) for arrays of PyObject*
    allocated on a C stack to avoid allocating memory on the heap memory. Such
    array is used to pass positional arguments to call functions of the
@@ -249,6 +253,65 @@ PyAPI_FUNC(PyObject *) _PyObject_FastCallKeywords(
     Py_ssize_t nargs,
     PyObject *kwnames);
 
+/* Flag OR'ed into the nargsf argument of a vectorcallfunc: the caller
+   allows the callee to temporarily overwrite args[-1], for example to
+   prepend "self" without copying the arguments. The callee must restore
+   args[-1] before returning. */
+#define PY_VECTORCALL_ARGUMENTS_OFFSET ((size_t)1 << (8 * sizeof(size_t) - 1))
+
+/* Extract the number of positional arguments from nargsf */
+static inline Py_ssize_t
+PyVectorcall_NARGS(size_t nargsf)
+{
+    return (Py_ssize_t)(nargsf & ~PY_VECTORCALL_ARGUMENTS_OFFSET);
+}
+
+/* Return the vectorcall function of callable, or NULL if its type does not
+   support the vectorcall protocol or the object has no entry point set */
+static inline vectorcallfunc
+_PyVectorcall_Function(PyObject *callable)
+{
+    PyTypeObject *tp = Py_TYPE(callable);
+    if (!PyType_HasFeature(tp, _Py_TPFLAGS_HAVE_VECTORCALL)) {
+        return NULL;
+    }
+    assert(tp->tp_vectorcall_offset > 0);
+    return *(vectorcallfunc *)(((char *)callable) + tp->tp_vectorcall_offset);
+}
+
+/* Call the callable object 'callable' with the vectorcall calling
+   convention: same arguments as _PyObject_FastCallKeywords(), except that
+   nargsf may have the PY_VECTORCALL_ARGUMENTS_OFFSET flag set.
+
+   Use the vectorcall entry point of callable if it has one, or fall back
+   to _PyObject_FastCallKeywords(). */
+static inline PyObject *
+_PyObject_Vectorcall(PyObject *callable, PyObject *const *args,
+                     size_t nargsf, PyObject *kwnames)
+{
+    PyObject *res;
+    vectorcallfunc func;
+    assert(kwnames == NULL || PyTuple_Check(kwnames));
+    assert(args != NULL || PyVectorcall_NARGS(nargsf) == 0);
+    func = _PyVectorcall_Function(callable);
+    if (func == NULL) {
+        Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+        return _PyObject_FastCallKeywords(callable, args, nargs, kwnames);
+    }
+    res = func(callable, args, nargsf, kwnames);
+    return _Py_CheckFunctionResult(callable, res, NULL);
+}
+
+/* Call callable(obj, *args) using the vectorcall calling convention.
+   Use args[-1] to store obj if nargsf has the PY_VECTORCALL_ARGUMENTS_OFFSET
+   flag set, otherwise copy the arguments into a temporary array. */
+PyAPI_FUNC(PyObject *) _PyObject_Vectorcall_Prepend(
+    PyObject *callable,
+    PyObject *obj,
+    PyObject *const *args,
+    size_t nargsf,
+    PyObject *kwnames);
+
 #define _PyObject_FastCall(func, args, nargs) \
     _PyObject_FastCallDict((func), (args), (nargs), NULL)
 
@@ -267,9 +330,6 @@ PyAPI_FUNC(PyObject *) _PyObject_FastCall_Prepend(
     PyObject *const *args,
     Py_ssize_t nargs);
 
-PyAPI_FUNC(PyObject *) _Py_CheckFunctionResult(PyObject *callable,
-                                               PyObject *result,
-                                               const char *where);
 #endif   /* Py_LIMITED_API */
 
 
@@ -202,6 +202,31 @@ PyAPI_FUNC(void) PyEval_ReInitThreads(void);
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(void) _PyEval_SetSwitchInterval(unsigned long microseconds);
 PyAPI_FUNC(unsigned long) _PyEval_GetSwitchInterval(void);
+PyAPI_FUNC(void) _PyEval_SetIOPriority(int enabled);
+PyAPI_FUNC(int) _PyEval_GetIOPriority(void);
+/* Enable or disable the opcode counters of code objects, see
+   sys._set_opcode_profiling().  Return 0 on success, or raise an exception
+   and return -1. */
+PyAPI_FUNC(int) _PyEval_SetOpcodeProfiling(int enabled);
+PyAPI_FUNC(int) _PyEval_GetOpcodeProfiling(void);
+#endif
+
+#if !defined(Py_LIMITED_API) && defined(Py_GIL_STATS)
+/* Events of the GIL reported to the hook set by _PyEval_SetGILStatsHook().
+   The duration is the time waited for the GIL for _PyGIL_EVENT_TAKE, and
+   the time the GIL was held otherwise.  A forced drop is one requested by
+   another thread. */
+#define _PyGIL_EVENT_TAKE 0
+#define _PyGIL_EVENT_DROP 1
+#define _PyGIL_EVENT_FORCED_DROP 2
+
+/* The hook is called by the thread owning tstate while it holds the GIL,
+   right after taking it or right before dropping it.  It must be fast and
+   must not call into Python. */
+typedef void (*_PyGILStatsHook)(PyThreadState *tstate, int event,
+                                _PyTime_t duration, void *data);
+PyAPI_FUNC(void) _PyEval_SetGILStatsHook(_PyGILStatsHook hook, void *data);
+PyAPI_FUNC(_PyGILStatsHook) _PyEval_GetGILStatsHook(void **data);
 #endif
 
 #ifndef Py_LIMITED_API
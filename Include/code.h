@@ -9,6 +9,9 @@ extern "C" {
 
 typedef uint16_t _Py_CODEUNIT;
 
+typedef struct _PyOpcache _PyOpcache;
+typedef struct _PyOpcodeProfile _PyOpcodeProfile;
+
 #ifdef WORDS_BIGENDIAN
 #  define _Py_OPCODE(word) ((word) >> 8)
 #  define _Py_OPARG(word) ((word) & 255)
@@ -48,6 +51,25 @@ typedef struct {
        Type is a void* to keep the format private in codeobject.c to force
        people to go through the proper APIs. */
     void *co_extra;
+
+    /* Per opcodes just-in-time cache
+
+       To reduce the cache size, opcodes are mapped to cache entries
+       indirectly:
+
+           cache = co_opcache[co_opcache_map[next_instr - first_instr] - 1]
+
+       co_opcache_map is indexed by (next_instr - first_instr):
+       0 means there is no cache for this opcode, n > 0 means the cache is
+       co_opcache[n-1]. */
+    unsigned char *co_opcache_map;
+    _PyOpcache *co_opcache;
+    int co_opcache_flag;            /* used to decide when to create a cache */
+    unsigned char co_opcache_size;  /* length of co_opcache */
+
+    /* Opcode execution counts, NULL unless the code object ran while
+       opcode profiling was enabled (see sys._set_opcode_profiling()) */
+    _PyOpcodeProfile *co_opprofile;
 } PyCodeObject;
 
 /* Masks for co_flags above */
@@ -96,6 +96,9 @@ PyAPI_FUNC(int) PyDict_Next(
     PyObject *mp, Py_ssize_t *pos, PyObject **key, PyObject **value);
 #ifndef Py_LIMITED_API
 PyDictKeysObject *_PyDict_NewKeysForClass(void);
+void _PyDict_ClearKeysForClass(PyTypeObject *);
+Py_ssize_t _PyDict_KeysForClassSize(PyTypeObject *);
+PyObject *_PyDict_SharedKeysStats(void);
 PyAPI_FUNC(PyObject *) PyObject_GenericGetDict(PyObject *, void *);
 PyAPI_FUNC(int) _PyDict_Next(
     PyObject *mp, Py_ssize_t *pos, PyObject **key, PyObject **value, Py_hash_t *hash);
@@ -115,6 +118,8 @@ PyAPI_FUNC(PyObject *) _PyDict_NewPresized(Py_ssize_t minused);
 PyAPI_FUNC(void) _PyDict_MaybeUntrack(PyObject *mp);
 PyAPI_FUNC(int) _PyDict_HasOnlyStringKeys(PyObject *mp);
 Py_ssize_t _PyDict_KeysSize(PyDictKeysObject *keys);
+Py_ssize_t _PyDict_KeysNEntries(PyDictKeysObject *keys);
+Py_ssize_t _PyDict_KeysIndex(PyDictKeysObject *keys, PyObject *key);
 PyAPI_FUNC(Py_ssize_t) _PyDict_SizeOf(PyDictObject *);
 PyAPI_FUNC(PyObject *) _PyDict_Pop(PyObject *, PyObject *, PyObject *);
 PyObject *_PyDict_Pop_KnownHash(PyObject *, PyObject *, Py_hash_t, PyObject *);
@@ -171,6 +176,8 @@ PyAPI_FUNC(void) _PyDict_DebugMallocStats(FILE *out);
 
 int _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr, PyObject *name, PyObject *value);
 PyObject *_PyDict_LoadGlobal(PyDictObject *, PyDictObject *, PyObject *);
+Py_ssize_t _PyDict_GetSplitIndex(PyDictObject *, PyObject *);
+int _PyDict_SetSplitItemAt(PyDictObject *, Py_ssize_t, PyObject *);
 #endif
 
 #ifdef __cplusplus
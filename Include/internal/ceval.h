@@ -12,10 +12,6 @@ struct _pending_calls {
     PyThread_type_lock lock;
     /* Request for running pending calls. */
     _Py_atomic_int calls_to_do;
-    /* Request for looking at the `async_exc` field of the current
-       thread state.
-       Guarded by the GIL. */
-    int async_exc;
 #define NPENDINGCALLS 32
     struct {
         int (*func)(void *);
@@ -35,17 +31,37 @@ struct _ceval_runtime_state {
        c_tracefunc.  This speeds up the if statement in
        PyEval_EvalFrameEx() after fast_next_opcode. */
     int tracing_possible;
-    /* This single variable consolidates all requests to break out of
-       the fast path in the eval loop. */
-    _Py_atomic_int eval_breaker;
-    /* Request for dropping the GIL */
-    _Py_atomic_int gil_drop_request;
+    /* Non-zero if the opcodes run are counted per code object, see
+       _PyEval_SetOpcodeProfiling() */
+    int opcode_profiling;
     struct _pending_calls pending;
+    /* The GIL of the main interpreter, also used by subinterpreters
+       which don't have their own (see PyInterpreterState.gil). */
     struct _gil_runtime_state gil;
+#ifdef Py_GIL_STATS
+    /* See _PyEval_SetGILStatsHook() */
+    _PyGILStatsHook gil_stats_hook;
+    void *gil_stats_hook_data;
+#endif
 };
 
 PyAPI_FUNC(void) _PyEval_Initialize(struct _ceval_runtime_state *);
 
+/* Give a subinterpreter, none of whose threads is running, its own GIL.
+   Return 0 on success, or raise an exception and return -1. */
+PyAPI_FUNC(int) _PyEval_InitInterpreterGIL(PyInterpreterState *);
+/* Undo _PyEval_InitInterpreterGIL(): move a subinterpreter, none of whose
+   threads is running, to the GIL of the current thread, before the current
+   thread finalizes it. */
+PyAPI_FUNC(void) _PyEval_FiniInterpreterGIL(PyInterpreterState *);
+/* Like PyThreadState_Swap(), but also move the current thread to the GIL
+   of the new thread state's interpreter.  Neither the current nor the new
+   thread state may be NULL. */
+PyAPI_FUNC(PyThreadState *) _PyEval_SwitchThreadState(PyThreadState *);
+/* Like PyEval_ReleaseLock(), for a thread whose thread state of the
+   interpreter was just deleted: release the GIL of that interpreter. */
+PyAPI_FUNC(void) _PyEval_ReleaseInterpreterLock(PyInterpreterState *);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,92 @@
+#ifndef Py_INTERNAL_CODE_H
+#define Py_INTERNAL_CODE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Per-opcode inline caches, see _PyCode_InitOpcache() */
+
+typedef struct {
+    PyObject *ptr;  /* Cached pointer (borrowed reference) */
+    uint64_t globals_ver;  /* ma_version_tag of the globals dict */
+    uint64_t builtins_ver; /* ma_version_tag of the builtins dict */
+} _PyOpcache_LoadGlobal;
+
+/* LOAD_ATTR and STORE_ATTR of an attribute stored in a split-table instance
+   dict sharing the keys of its type.  While the type keeps its version tag,
+   it also keeps its shared keys, so ma_keys can be compared to keys. */
+typedef struct {
+    PyTypeObject *type;     /* Type of the instance (borrowed reference) */
+    unsigned int tp_version_tag;
+    PyDictKeysObject *keys; /* Shared keys of type (borrowed reference) */
+    Py_ssize_t index;       /* Index of the attribute name in keys */
+} _PyOpcache_Attr;
+
+/* LOAD_METHOD of a function or method descriptor found on the type.  The
+   type version tag vouches for meth.  An instance dict sharing keys can
+   only shadow the method once the name is added to keys: the name was
+   missing from the nentries keys of keys when the entry was filled, and
+   shared keys only grow by appending keys. */
+typedef struct {
+    PyTypeObject *type;     /* Type of the instance (borrowed reference) */
+    unsigned int tp_version_tag;
+    PyObject *meth;         /* Unbound method (borrowed reference) */
+    PyDictKeysObject *keys; /* Shared keys of type, may be NULL */
+    Py_ssize_t nentries;
+} _PyOpcache_LoadMethod;
+
+struct _PyOpcache {
+    union {
+        _PyOpcache_LoadGlobal lg;
+        _PyOpcache_Attr la;
+        _PyOpcache_LoadMethod lm;
+    } u;
+    /* 0 until the entry is first filled.  Attribute caches count down the
+       misses they tolerate and are disabled for good once it drops below
+       zero. */
+    char optimized;
+};
+
+/* Opcode execution counts of a code object, see _PyCode_CountOpcode().
+   The counts outlive the code object: they are kept, with its name, in a
+   list of all the profiles until _PyCode_ClearOpcodeProfiles(). */
+
+typedef struct {
+    uint16_t key;       /* (previous opcode << 8) | opcode, 0 if unused */
+    uint64_t count;
+} _PyOpcodeProfile_Pair;
+
+struct _PyOpcodeProfile {
+    _PyOpcodeProfile *next;
+    PyCodeObject *code;     /* Borrowed reference, NULL once deallocated */
+    PyObject *filename;
+    PyObject *name;
+    int firstlineno;
+    uint64_t counts[256];
+    /* Open addressing hash table of the pairs of consecutive opcodes run
+       in a frame of the code object */
+    Py_ssize_t pairs_used;
+    Py_ssize_t pairs_size;  /* 0 or a power of 2 */
+    _PyOpcodeProfile_Pair *pairs;
+};
+
+/* Private API */
+/* Allocate the inline caches of co.  Return 0 on success, or raise
+   MemoryError and return -1. */
+PyAPI_FUNC(int) _PyCode_InitOpcache(PyCodeObject *co);
+
+/* Prepare the opcode profiles before opcode profiling is first enabled.
+   Return 0 on success, or raise an exception and return -1. */
+PyAPI_FUNC(int) _PyCode_InitOpcodeProfiles(void);
+/* Count an execution of opcode by co, after lastopcode in the same frame
+   (0 at the start of the frame). */
+PyAPI_FUNC(void) _PyCode_CountOpcode(PyCodeObject *co,
+                                     int lastopcode, int opcode);
+/* Return a list of (filename, firstlineno, name, counts, pairs) tuples */
+PyAPI_FUNC(PyObject *) _PyCode_GetOpcodeProfiles(void);
+PyAPI_FUNC(void) _PyCode_ClearOpcodeProfiles(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_CODE_H */
@@ -27,6 +27,26 @@ struct _gil_runtime_state {
     _Py_atomic_int locked;
     /* Number of GIL switches since the beginning. */
     unsigned long switch_number;
+    /* This single variable consolidates all requests to break out of
+       the fast path in the eval loop of the thread holding this GIL. */
+    _Py_atomic_int eval_breaker;
+    /* Request for dropping the GIL */
+    _Py_atomic_int gil_drop_request;
+    /* Request for looking at the `async_exc` field of the current
+       thread state.
+       Guarded by the GIL. */
+    int async_exc;
+    /* Whether threads coming back from a blocking call (see
+       PyEval_RestoreThread()) preempt the GIL holder at once rather than
+       after `interval`. */
+    int io_priority;
+    /* Number of such threads waiting for the GIL; the other waiters let
+       them go first.  Protected by `mutex`. */
+    int priority_requests;
+#ifdef Py_GIL_STATS
+    /* When the GIL was last taken.  Guarded by the GIL. */
+    _PyTime_t hold_start;
+#endif
     /* This condition variable allows one or several threads to wait
        until the GIL is released. In addition, the mutex also protects
        the above variables. */
@@ -0,0 +1,42 @@
+#ifndef Py_INTERNAL_LONG_H
+#define Py_INTERNAL_LONG_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "longintrepr.h"
+
+/* Fast paths for ints of at most two digits, used by the int type and by
+   the eval loop.  The value of such an int fits in a stwodigits, and so do
+   the sum and the difference of two of them. */
+
+#define _PyLong_IsTwoDigits(op) (Py_ABS(Py_SIZE(op)) <= 2)
+
+static inline stwodigits
+_PyLong_TwoDigitsValue(PyLongObject *op)
+{
+    assert(_PyLong_IsTwoDigits(op));
+    switch (Py_SIZE(op)) {
+    case -2:
+        return -(((stwodigits)op->ob_digit[1] << PyLong_SHIFT) |
+                 op->ob_digit[0]);
+    case -1:
+        return -(stwodigits)op->ob_digit[0];
+    case 0:
+        return 0;
+    case 1:
+        return op->ob_digit[0];
+    default:
+        return ((stwodigits)op->ob_digit[1] << PyLong_SHIFT) |
+               op->ob_digit[0];
+    }
+}
+
+/* Return a new int from a stwodigits value, taken from the small ints or
+   the free list when it fits in one digit. */
+PyAPI_FUNC(PyObject *) _PyLong_FromSTwoDigits(stwodigits x);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_LONG_H */
@@ -95,8 +95,14 @@ struct gc_generation {
     int threshold; /* collection threshold */
     int count; /* count of allocations or collections of younger
                   generations */
+    int effective_threshold; /* threshold in use: the adaptive mode scales
+                                it between threshold and
+                                threshold * GC_ADAPTIVE_MAX_SCALE */
 };
 
+/* Largest factor by which the adaptive mode raises a threshold */
+#define GC_ADAPTIVE_MAX_SCALE 64
+
 /* Running stats per generation */
 struct gc_generation_stats {
     /* total number of collections */
@@ -105,6 +111,10 @@ struct gc_generation_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* total number of objects which survived the collections */
+    Py_ssize_t survivors;
+    /* total duration of the collections */
+    _PyTime_t duration;
 };
 
 struct _gc_runtime_state {
@@ -139,11 +149,49 @@ struct _gc_runtime_state {
        collections, and are awaiting to undergo a full collection for
        the first time. */
     Py_ssize_t long_lived_pending;
+
+    /* Incremental collection of the oldest generation, see
+       gc.set_pause_target().  0 if disabled, else the target duration of
+       an increment. */
+    _PyTime_t pause_target;
+    /* true if a pass over the oldest generation is in progress */
+    int incremental_pass;
+    /* objects of the oldest generation already visited by the pass */
+    PyGC_Head incremental_visited;
+    /* value of the _PyGC_REFS_MASK_VISITED bit of the visited objects,
+       flipped at the end of every pass */
+    int visited_space;
+    /* estimated duration of an increment per object, in nanoseconds */
+    double increment_cost;
+    /* number of objects of the oldest generation after the last full
+       collection */
+    Py_ssize_t full_collection_size;
+
+    /* true if the thresholds adapt to the survival rate of the young
+       generations, see gc.set_adaptive() */
+    int adaptive;
+    /* bytes of gc objects allocated since the last collection */
+    size_t allocated_bytes;
 };
 
 PyAPI_FUNC(void) _PyGC_Initialize(struct _gc_runtime_state *);
 
-#define _PyGC_generation0 _PyRuntime.gc.generation0
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+/* Every interpreter has its own collector (see PyInterpreterState.gc),
+   since interpreters with their own GIL run in parallel. */
+PyAPI_FUNC(struct _gc_runtime_state *) _PyGC_GetState(void);
+PyAPI_FUNC(struct _gc_runtime_state *) _PyGC_NewState(void);
+PyAPI_FUNC(void) _PyGC_DeleteState(struct _gc_runtime_state *);
+#  define _PyGC_STATE() _PyGC_GetState()
+#else
+#  define _PyGC_STATE() (&_PyRuntime.gc)
+#endif
+
+/* Give the free blocks cached by a thread state back to pymalloc.
+   Must be called with the GIL held. */
+PyAPI_FUNC(void) _PyObject_ClearThreadCache(PyThreadState *tstate);
+
+#define _PyGC_generation0 (_PyGC_STATE()->generation0)
 
 #ifdef __cplusplus
 }
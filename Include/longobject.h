@@ -212,6 +212,11 @@ PyAPI_FUNC(PyObject *) _PyLong_GCD(PyObject *, PyObject *);
 #ifndef Py_LIMITED_API
 PyAPI_DATA(PyObject *) _PyLong_Zero;
 PyAPI_DATA(PyObject *) _PyLong_One;
+
+/* free list api */
+PyAPI_FUNC(int) PyLong_ClearFreeList(void);
+
+PyAPI_FUNC(void) _PyLong_DebugMallocStats(FILE* out);
 #endif
 
 #ifdef __cplusplus
@@ -339,6 +339,10 @@ typedef int (*descrsetfunc) (PyObject *, PyObject *, PyObject *);
 typedef int (*initproc)(PyObject *, PyObject *, PyObject *);
 typedef PyObject *(*newfunc)(struct _typeobject *, PyObject *, PyObject *);
 typedef PyObject *(*allocfunc)(struct _typeobject *, Py_ssize_t);
+#ifndef Py_LIMITED_API
+typedef PyObject *(*vectorcallfunc)(PyObject *callable, PyObject *const *args,
+                                    size_t nargsf, PyObject *kwnames);
+#endif
 
 #ifdef Py_LIMITED_API
 typedef struct _typeobject PyTypeObject; /* opaque */
@@ -351,7 +355,9 @@ typedef struct _typeobject {
     /* Methods to implement standard operations */
 
     destructor tp_dealloc;
-    printfunc tp_print;
+    /* Offset of a vectorcallfunc pointer inside instances, used when the
+       type has the _Py_TPFLAGS_HAVE_VECTORCALL flag (formerly tp_print) */
+    Py_ssize_t tp_vectorcall_offset;
     getattrfunc tp_getattr;
     setattrfunc tp_setattr;
     PyAsyncMethods *tp_as_async; /* formerly known as tp_compare (Python 2)
@@ -423,6 +429,8 @@ typedef struct _typeobject {
     unsigned int tp_version_tag;
 
     destructor tp_finalize;
+    /* Vectorcall entry point used when calling the type object itself */
+    vectorcallfunc tp_vectorcall;
 
 #ifdef COUNT_ALLOCS
     /* these must be last and never explicitly initialized */
@@ -473,6 +481,9 @@ typedef struct _heaptypeobject {
     PyBufferProcs as_buffer;
     PyObject *ht_name, *ht_slots, *ht_qualname;
     struct _dictkeysobject *ht_cached_keys;
+    /* Other key layouts shared by instances which set their attributes in
+       another order, see dictobject.c */
+    struct _dictkeysobject **ht_cached_keys_variants;
     /* here are optional user slots, followed by the members. */
 } PyHeapTypeObject;
 
@@ -634,6 +645,12 @@ given type object has a specified feature.
 /* Set if the type allows subclassing */
 #define Py_TPFLAGS_BASETYPE (1UL << 10)
 
+/* Set if instances support the vectorcall protocol: see
+   tp_vectorcall_offset */
+#ifndef Py_LIMITED_API
+#define _Py_TPFLAGS_HAVE_VECTORCALL (1UL << 11)
+#endif
+
 /* Set if the type is 'ready' -- fully initialized */
 #define Py_TPFLAGS_READY (1UL << 12)
 
@@ -761,6 +778,19 @@ PyAPI_FUNC(void) dec_count(PyTypeObject *);
 #define _Py_COUNT_ALLOCS_COMMA
 #endif /* COUNT_ALLOCS */
 
+#ifndef Py_LIMITED_API
+/* Memory block just traced by tracemalloc, if it may hold the next object
+ * to be initialized: _Py_NewReference() then gives its type to tracemalloc.
+ */
+PyAPI_DATA(void *) _PyTraceMalloc_NewBlock;
+PyAPI_FUNC(void) _PyTraceMalloc_NewReference(PyObject *);
+#define _Py_TRACEMALLOC_NEWREF(op) \
+    (_PyTraceMalloc_NewBlock != NULL ? \
+     _PyTraceMalloc_NewReference((PyObject *)(op)) : (void)0)
+#else
+#define _Py_TRACEMALLOC_NEWREF(op) ((void)0)
+#endif
+
 #ifdef Py_TRACE_REFS
 /* Py_TRACE_REFS is such major surgery that we call external routines. */
 PyAPI_FUNC(void) _Py_NewReference(PyObject *);
@@ -775,6 +805,7 @@ PyAPI_FUNC(void) _Py_AddToAllObjects(PyObject *, int force);
  * inline.
  */
 #define _Py_NewReference(op) (                          \
+    _Py_TRACEMALLOC_NEWREF(op),                         \
     _Py_INC_TPALLOCS(op) _Py_COUNT_ALLOCS_COMMA         \
     _Py_INC_REFTOTAL  _Py_REF_DEBUG_COMMA               \
     Py_REFCNT(op) = 1)
@@ -790,6 +821,49 @@ PyAPI_FUNC(void) _Py_Dealloc(PyObject *);
 #endif
 #endif /* !Py_TRACE_REFS */
 
+#ifdef Py_IMMORTAL_OBJECTS
+/* An object whose reference count has the _Py_IMMORTAL_BIT set is immortal:
+ * Py_INCREF() and Py_DECREF() don't touch it anymore, so that the memory
+ * page holding the object stays clean (and shared with the parent process
+ * after a fork()), and the object is never deallocated.  gc.freeze() makes
+ * the objects it freezes immortal.
+ *
+ * The bit is far above any real reference count, so code compiled without
+ * Py_IMMORTAL_OBJECTS, which still increments and decrements the reference
+ * count, can't make it drop to 0.  It is still low enough for the garbage
+ * collector to copy the reference count to gc_refs (see _PyGC_REFS_SHIFT).
+ */
+#define _Py_IMMORTAL_BIT ((Py_ssize_t)1 << (8 * SIZEOF_SIZE_T - 5))
+#define _Py_IsImmortal(op) \
+    ((((PyObject *)(op))->ob_refcnt & _Py_IMMORTAL_BIT) != 0)
+#define _Py_SetImmortal(op) \
+    (((PyObject *)(op))->ob_refcnt |= _Py_IMMORTAL_BIT)
+
+static inline void
+_Py_IncRefMortal(PyObject *op)
+{
+    if (_Py_IsImmortal(op))
+        return;
+    _Py_INC_REFTOTAL;
+    op->ob_refcnt++;
+}
+
+static inline void
+_Py_DecRefMortal(PyObject *op)
+{
+    if (_Py_IsImmortal(op))
+        return;
+    _Py_DEC_REFTOTAL;
+    if (--op->ob_refcnt != 0)
+        _Py_CHECK_REFCNT(op)
+    else
+        _Py_Dealloc(op);
+}
+
+#define Py_INCREF(op) _Py_IncRefMortal((PyObject *)(op))
+#define Py_DECREF(op) _Py_DecRefMortal((PyObject *)(op))
+
+#else
 #define Py_INCREF(op) (                         \
     _Py_INC_REFTOTAL  _Py_REF_DEBUG_COMMA       \
     ((PyObject *)(op))->ob_refcnt++)
@@ -803,6 +877,7 @@ PyAPI_FUNC(void) _Py_Dealloc(PyObject *);
         else                                            \
             _Py_Dealloc(_py_decref_tmp);                \
     } while (0)
+#endif /* Py_IMMORTAL_OBJECTS */
 
 /* Safely decref `op` and set `op` to NULL, especially useful in tp_clear
  * and tp_dealloc implementations.
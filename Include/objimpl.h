@@ -264,8 +264,12 @@ extern PyGC_Head *_PyGC_generation0;
 
 /* Bit 0 is set when tp_finalize is called */
 #define _PyGC_REFS_MASK_FINALIZED  (1 << 0)
-/* The (N-1) most significant bits contain the gc state / refcount */
-#define _PyGC_REFS_SHIFT           (1)
+/* Bits 1 and 2 are used by the incremental collection of the oldest
+   generation: see Modules/gcmodule.c */
+#define _PyGC_REFS_MASK_VISITED    (1 << 1)
+#define _PyGC_REFS_MASK_FROZEN     (1 << 2)
+/* The (N-3) most significant bits contain the gc state / refcount */
+#define _PyGC_REFS_SHIFT           (3)
 #define _PyGC_REFS_MASK            (((size_t) -1) << _PyGC_REFS_SHIFT)
 
 #define _PyGCHead_REFS(g) ((g)->gc.gc_refs >> _PyGC_REFS_SHIFT)
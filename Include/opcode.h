@@ -128,6 +128,10 @@ extern "C" {
 #define CALL_METHOD             161
 #define CALL_FINALLY            162
 #define POP_FINALLY             163
+#define LOAD_FAST__LOAD_FAST    165
+#define LOAD_FAST__LOAD_ATTR    166
+#define COMPARE_AND_BRANCH      167
+#define LOAD_CONST__RETURN      168
 
 /* EXCEPT_HANDLER is a special, implicit block type which is created when
    entering an except handler. It is not an opcode but we define it here
@@ -24,6 +24,10 @@ PyAPI_FUNC(int) _PyMem_SetupAllocators(const char *opt);
 /* Try to get the allocators name set by _PyMem_SetupAllocators(). */
 PyAPI_FUNC(const char*) _PyMem_GetAllocatorsName(void);
 
+/* Set the size of the pymalloc arenas (PYTHONMALLOCARENASIZE).  Return -1
+   if opt is not a valid size. */
+PyAPI_FUNC(int) _PyObject_SetArenaSize(const char *opt);
+
 /* Track an allocated memory block in the tracemalloc module.
    Return 0 on success, return -1 on error (failed to allocate memory to store
    the trace).
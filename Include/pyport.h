@@ -773,6 +773,21 @@ extern _invalid_parameter_handler _Py_silent_invalid_parameter_handler;
 #endif /* _MSC_VER >= 1900 */
 #endif /* Py_BUILD_CORE */
 
+#if defined(Py_BUILD_CORE) && defined(EXPERIMENTAL_ISOLATED_SUBINTERPRETERS)
+/* The free lists of the object implementations are shared by all
+   interpreters, including those with their own GIL, so disable them. */
+#define PyTuple_MAXSAVESIZE 0
+#define PyList_MAXFREELIST 0
+#define PyDict_MAXFREELIST 0
+#define PyFloat_MAXFREELIST 0
+#define PyLong_MAXFREELIST 0
+#define PyFrame_MAXFREELIST 0
+#define PyMethod_MAXFREELIST 0
+#define PyCFunction_MAXFREELIST 0
+#define _PyAsyncGen_MAXFREELIST 0
+#define PySlice_MAXFREELIST 0
+#endif
+
 #ifdef __ANDROID__
 /* The Android langinfo.h header is not used. */
 #undef HAVE_LANGINFO_H
@@ -33,6 +33,8 @@ typedef struct {
     int use_hash_seed;      /* PYTHONHASHSEED=x */
     unsigned long hash_seed;
     const char *allocator;  /* Memory allocator: _PyMem_SetupAllocators() */
+    const char *arena_size; /* PYTHONMALLOCARENASIZE:
+                               _PyObject_SetArenaSize() */
     int dev_mode;           /* PYTHONDEVMODE, -X dev */
     int faulthandler;       /* PYTHONFAULTHANDLER, -X faulthandler */
     int tracemalloc;        /* PYTHONTRACEMALLOC, -X tracemalloc=N */
@@ -163,6 +165,16 @@ typedef struct _is {
     PyObject *pyexitmodule;
 
     uint64_t tstate_next_unique_id;
+
+    /* The GIL of this interpreter's threads: the GIL of the main
+       interpreter unless _PyEval_InitInterpreterGIL() gave it its own.
+       Used in Python/ceval.c. */
+    struct _gil_runtime_state *gil;
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+    /* The state of the garbage collector of this interpreter.  Used in
+       Modules/gcmodule.c. */
+    struct _gc_runtime_state *gc;
+#endif
 } PyInterpreterState;
 #endif   /* !Py_LIMITED_API */
 
@@ -296,6 +308,28 @@ typedef struct _ts {
     /* Unique thread state id. */
     uint64_t id;
 
+    /* GIL statistics (see sys._gil_stats()): the time spent waiting for
+       the GIL, and the number of times the GIL was handed over to this
+       thread from another one. */
+    _PyTime_t gil_wait_time;
+    uint64_t gil_handoffs;
+#ifdef Py_GIL_STATS
+    /* The time spent holding the GIL, the number of times this thread took
+       the GIL, and dropped it because another thread asked for it. */
+    _PyTime_t gil_hold_time;
+    uint64_t gil_acquisitions;
+    uint64_t gil_forced_drops;
+#endif
+
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    /* Free blocks of pymalloc cached for this thread (Objects/obmalloc.c) */
+    struct _obmalloc_cache *obmalloc_cache;
+#endif
+
+    /* The _pylong functions running in this thread, one bit each
+       (Objects/longobject.c) */
+    int pylong_active;
+
     /* XXX signal handlers should also be here */
 
 } PyThreadState;
@@ -357,7 +391,10 @@ PyAPI_FUNC(int) PyThreadState_SetAsyncExc(unsigned long, PyObject *);
 
 /* Assuming the current thread holds the GIL, this is the
    PyThreadState for the current thread. */
-#ifdef Py_BUILD_CORE
+#if defined(Py_BUILD_CORE) && defined(EXPERIMENTAL_ISOLATED_SUBINTERPRETERS)
+   /* The current thread state is thread-local, see Python/pystate.c */
+#  define PyThreadState_GET() _PyThreadState_UncheckedGet()
+#elif defined(Py_BUILD_CORE)
 #  define _PyThreadState_Current _PyRuntime.gilstate.tstate_current
 #  define PyThreadState_GET() \
              ((PyThreadState*)_Py_atomic_load_relaxed(&_PyThreadState_Current))
@@ -434,6 +471,20 @@ PyAPI_FUNC(PyInterpreterState *) _PyGILState_GetInterpreterStateUnsafe(void);
 PyAPI_FUNC(PyObject *) _PyThread_CurrentFrames(void);
 #endif
 
+/* Used by the _sampleprof module: returns a list of the current frames of
+   the threads of an interpreter.
+*/
+#ifndef Py_LIMITED_API
+PyAPI_FUNC(PyObject *) _PyInterpreterState_GetFrames(PyInterpreterState *);
+#endif
+
+/* The implementation of sys._gil_stats()  Returns a dict mapping thread id
+   to that thread's GIL statistics.
+*/
+#ifndef Py_LIMITED_API
+PyAPI_FUNC(PyObject *) _PyThread_GILStats(void);
+#endif
+
 /* Routines for advanced debuggers, requested by David Beazley.
    Don't use unless you know what you are doing! */
 #ifndef Py_LIMITED_API
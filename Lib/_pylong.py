@@ -0,0 +1,297 @@
+"""Python implementations of some algorithms for use by longobject.c.
+
+The goal is to provide asymptotically faster algorithms that can be used
+for operations on very large integers.  The builtin int code uses them
+above size limits where they beat its own quadratic algorithms (see the
+PYLONG_*_CUTOFF constants in Objects/longobject.c):
+
+- int_to_decimal_string() is used by str() and repr() of ints,
+- int_from_string() is used by int() on decimal strings,
+- int_divmod() is used by //, % and divmod().
+
+Their complexity follows the one of int multiplication, which uses the
+Toom-Cook algorithm for large operands: the divide-and-conquer algorithms
+below split their work into multiplications of balanced sizes.
+
+This module is not meant to be used directly: it's an implementation
+detail of the int type and its API may change without notice.
+"""
+
+try:
+    import _decimal
+except ImportError:
+    _decimal = None
+
+
+# Sizes (in bits, or in decimal digits for the *_DIGIT_LIMIT ones) below
+# which the recursions stop and let the builtin algorithms do the work.  They
+# stay below the limits of longobject.c (_DIV_LIMIT below the 4500 bits of
+# PYLONG_DIVMOD_QUOTIENT_CUTOFF, whatever the digit size), so that the pieces
+# are handled by the quadratic algorithms.  longobject.c also never calls a
+# function of this module again while it runs in the same thread.
+_DIV_LIMIT = 4000
+_DEC_BIT_LIMIT = 128
+_STR_DIGIT_LIMIT = 1000
+_INT_DIGIT_LIMIT = 2048
+
+
+def int_to_decimal(n):
+    """Asymptotically fast conversion of an int to a Decimal.
+
+    The bits of n are split in two halves which are converted recursively,
+    and recombined with decimal arithmetic, whose multiplication is fast
+    for large numbers (it uses a number theoretic transform).
+    """
+    D = _decimal.Decimal
+    D2 = D(2)
+    mem = {}
+
+    def w2pow(w):
+        """Return D(2)**w and store the result.  Also possibly save some
+        intermediate results: they are likely to be reused across the
+        levels of the conversion."""
+        result = mem.get(w)
+        if result is None:
+            if w <= _DEC_BIT_LIMIT:
+                result = D2 ** w
+            elif w - 1 in mem:
+                t = mem[w - 1]
+                result = t + t
+            else:
+                w2 = w >> 1
+                # If w is odd, w - w2 is one larger than w2.  Recurse on
+                # the smaller first, so that the larger is handled by the
+                # cheaper "w - 1 in mem" branch.
+                result = w2pow(w2) * w2pow(w - w2)
+            mem[w] = result
+        return result
+
+    def inner(n, w):
+        if w <= _DEC_BIT_LIMIT:
+            return D(n)
+        w2 = w >> 1
+        hi = n >> w2
+        lo = n - (hi << w2)
+        return inner(lo, w2) + inner(hi, w - w2) * w2pow(w2)
+
+    with _decimal.localcontext() as ctx:
+        ctx.prec = _decimal.MAX_PREC
+        ctx.Emax = _decimal.MAX_EMAX
+        ctx.Emin = _decimal.MIN_EMIN
+        ctx.traps[_decimal.Inexact] = 1
+
+        if n < 0:
+            result = -inner(-n, (-n).bit_length())
+        else:
+            result = inner(n, n.bit_length())
+    return result
+
+
+def _int_to_decimal_string_inner(n):
+    """Convert a nonnegative int to a decimal string by recursive division
+    by powers of 10.  It's slower than int_to_decimal(), but doesn't need
+    the C implementation of the decimal module."""
+    mem = {}
+
+    def w10pow(w):
+        """Return 10**w and store the result."""
+        result = mem.get(w)
+        if result is None:
+            if w <= _STR_DIGIT_LIMIT:
+                result = 10 ** w
+            else:
+                w2 = w >> 1
+                result = w10pow(w2) * w10pow(w - w2)
+            mem[w] = result
+        return result
+
+    def inner(n, w):
+        # Return the w decimal digits of n < 10**w, with leading zeros.
+        if w <= _STR_DIGIT_LIMIT:
+            return str(n).zfill(w)
+        w2 = w >> 1
+        hi, lo = divmod(n, w10pow(w2))
+        return inner(hi, w - w2) + inner(lo, w2)
+
+    # log10(2) < 0.30103, so n < 10**w.  The extra leading zeros are
+    # stripped.
+    w = n.bit_length() * 30103 // 100000 + 1
+    return inner(n, w).lstrip('0') or '0'
+
+
+def int_to_decimal_string(n):
+    """Asymptotically fast conversion of an int to a decimal string."""
+    if _decimal is not None:
+        return str(int_to_decimal(n))
+    if n < 0:
+        return '-' + _int_to_decimal_string_inner(-n)
+    return _int_to_decimal_string_inner(n)
+
+
+def _str_to_int_inner(s):
+    """Asymptotically fast conversion of a string of decimal digits to an
+    int.
+
+    The string is split in two halves which are converted recursively, and
+    recombined as hi * 10**w + lo, computed as (hi * 5**w) << w since the
+    shift is cheap and 5**w is smaller than 10**w.
+    """
+    mem = {}
+
+    def w5pow(w):
+        """Return 5**w and store the result.  Also possibly save some
+        intermediate results: they are likely to be reused across the
+        levels of the conversion."""
+        result = mem.get(w)
+        if result is None:
+            if w <= _INT_DIGIT_LIMIT:
+                result = 5 ** w
+            elif w - 1 in mem:
+                result = mem[w - 1] * 5
+            else:
+                w2 = w >> 1
+                # If w is odd, w - w2 is one larger than w2.  Recurse on
+                # the smaller first, so that the larger is handled by the
+                # cheaper "w - 1 in mem" branch.
+                result = w5pow(w2) * w5pow(w - w2)
+            mem[w] = result
+        return result
+
+    def inner(a, b):
+        if b - a <= _INT_DIGIT_LIMIT:
+            return int(s[a:b])
+        mid = (a + b + 1) >> 1
+        return inner(mid, b) + ((inner(a, mid) * w5pow(b - mid)) << (b - mid))
+
+    return inner(0, len(s))
+
+
+def int_from_string(s):
+    """Asymptotically fast version of PyLong_FromString(), the conversion
+    of a string of decimal digits to an int.
+
+    PyLong_FromString() has already removed the leading whitespace and sign,
+    and checked that the string is made of digits and single underscores
+    between digits: only the underscores and the trailing whitespace are
+    left to remove here.
+    """
+    s = s.rstrip().replace('_', '')
+    return _str_to_int_inner(s)
+
+
+def _div2n1n(a, b, n):
+    """Divide a 2n-bit nonnegative integer a by an n-bit positive integer
+    b, using a recursive divide-and-conquer algorithm.
+
+    Inputs:
+      n is a positive integer
+      b is a positive integer with exactly n bits
+      a is a nonnegative integer such that a < 2**n * b
+
+    Output:
+      (q, r) such that a = b*q+r and 0 <= r < b.
+    """
+    if a.bit_length() - n <= _DIV_LIMIT:
+        return divmod(a, b)
+    pad = n & 1
+    if pad:
+        a <<= 1
+        b <<= 1
+        n += 1
+    half_n = n >> 1
+    mask = (1 << half_n) - 1
+    b1, b2 = b >> half_n, b & mask
+    q1, r = _div3n2n(a >> n, (a >> half_n) & mask, b, b1, b2, half_n)
+    q2, r = _div3n2n(r, a & mask, b, b1, b2, half_n)
+    if pad:
+        r >>= 1
+    return q1 << half_n | q2, r
+
+
+def _div3n2n(a12, a3, b, b1, b2, n):
+    """Helper function for _div2n1n; not intended to be called directly."""
+    if a12 >> n == b1:
+        q, r = (1 << n) - 1, a12 - (b1 << n) + b1
+    else:
+        q, r = _div2n1n(a12, b1, n)
+    r = (r << n | a3) - q * b2
+    while r < 0:
+        q -= 1
+        r += b
+    return q, r
+
+
+def _int2digits(a, n):
+    """Decompose a nonnegative int a into base 2**n.
+
+    Return the list of the digits of a in little-endian order: the most
+    significant digit is last, and is not zero.  If a is 0, the list is
+    empty.
+    """
+    a_digits = [0] * ((a.bit_length() + n - 1) // n)
+
+    def inner(x, L, R):
+        if L + 1 == R:
+            a_digits[L] = x
+            return
+        mid = (L + R) >> 1
+        shift = (mid - L) * n
+        upper = x >> shift
+        lower = x ^ (upper << shift)
+        inner(lower, L, mid)
+        inner(upper, mid, R)
+
+    if a:
+        inner(a, 0, len(a_digits))
+    return a_digits
+
+
+def _digits2int(digits, n):
+    """Combine base 2**n digits into an int.  This function is the
+    inverse of _int2digits()."""
+
+    def inner(L, R):
+        if L + 1 == R:
+            return digits[L]
+        mid = (L + R) >> 1
+        shift = (mid - L) * n
+        return (inner(mid, R) << shift) + inner(L, mid)
+
+    return inner(0, len(digits)) if digits else 0
+
+
+def _divmod_pos(a, b):
+    """Divide a nonnegative integer a by a positive integer b, giving the
+    quotient and the remainder."""
+    # Use the grade-school algorithm in base 2**n, n = nbits(b), with the
+    # recursive division of Burnikel and Ziegler for each digit.
+    n = b.bit_length()
+    a_digits = _int2digits(a, n)
+
+    r = 0
+    q_digits = []
+    for a_digit in reversed(a_digits):
+        q_digit, r = _div2n1n((r << n) + a_digit, b, n)
+        q_digits.append(q_digit)
+    q_digits.reverse()
+    q = _digits2int(q_digits, n)
+    return q, r
+
+
+def int_divmod(a, b):
+    """Asymptotically fast replacement for divmod, for ints.
+
+    This is the recursive division of Burnikel and Ziegler ("Fast Recursive
+    Division", 1998): its complexity is the one of multiplication, times a
+    logarithm.
+    """
+    if b == 0:
+        raise ZeroDivisionError("integer division or modulo by zero")
+    elif b < 0:
+        q, r = int_divmod(-a, -b)
+        return q, -r
+    elif a < 0:
+        q, r = int_divmod(~a, b)
+        return ~q, b + ~r
+    else:
+        return _divmod_pos(a, b)
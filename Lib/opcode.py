@@ -6,7 +6,7 @@ operate on bytecodes (e.g. peephole optimizers).
 
 __all__ = ["cmp_op", "hasconst", "hasname", "hasjrel", "hasjabs",
            "haslocal", "hascompare", "hasfree", "opname", "opmap",
-           "HAVE_ARGUMENT", "EXTENDED_ARG", "hasnargs"]
+           "HAVE_ARGUMENT", "EXTENDED_ARG", "hasnargs", "superinstructions"]
 
 # It's a chicken-and-egg I'm afraid:
 # We're imported before _opcode's made.
@@ -32,6 +32,7 @@ haslocal = []
 hascompare = []
 hasfree = []
 hasnargs = [] # unused
+superinstructions = {}
 
 opmap = {}
 opname = ['<%r>' % (op,) for op in range(256)]
@@ -52,6 +53,15 @@ def jabs_op(name, op):
     def_op(name, op)
     hasjabs.append(op)
 
+def super_op(name, op, first, second):
+    # A superinstruction replaces the first instruction of a pair and takes
+    # its argument; the second instruction is left in place after it.
+    def_op(name, op)
+    for table in (hasconst, hasname, haslocal, hascompare, hasfree):
+        if opmap[first] in table:
+            table.append(op)
+    superinstructions[op] = (opmap[first], opmap[second])
+
 # Instruction opcodes for compiled code
 # Blank lines correspond to available opcodes
 
@@ -213,4 +223,10 @@ def_op('CALL_METHOD', 161)
 jrel_op('CALL_FINALLY', 162)
 def_op('POP_FINALLY', 163)
 
-del def_op, name_op, jrel_op, jabs_op
+# Superinstructions generated by the peephole optimizer
+super_op('LOAD_FAST__LOAD_FAST', 165, 'LOAD_FAST', 'LOAD_FAST')
+super_op('LOAD_FAST__LOAD_ATTR', 166, 'LOAD_FAST', 'LOAD_ATTR')
+super_op('COMPARE_AND_BRANCH', 167, 'COMPARE_OP', 'POP_JUMP_IF_FALSE')
+super_op('LOAD_CONST__RETURN', 168, 'LOAD_CONST', 'RETURN_VALUE')
+
+del def_op, name_op, jrel_op, jabs_op, super_op
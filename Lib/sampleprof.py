@@ -0,0 +1,147 @@
+"""Statistical profiler sampling the Python stacks of all threads.
+
+The sampling is done by a native thread (see the _sampleprof module) which
+wakes up every interval seconds.  Unlike cProfile, nothing is done on
+function calls, so the overhead only depends on the sampling rate.
+
+Samples are written in the "collapsed stack" format read by flame graph
+tools: one line per distinct stack, with the frames from the outermost to
+the innermost separated by semicolons, followed by the number of samples.
+"""
+
+import atexit
+from _sampleprof import (start, stop, is_running, get_samples,
+                         get_sample_count, clear_samples)
+
+__all__ = ["start", "stop", "is_running", "get_samples", "get_sample_count",
+           "clear_samples", "frame_label", "collapsed_stacks",
+           "write_collapsed", "Profile"]
+
+
+def frame_label(code):
+    """Label of a frame running code in a collapsed stack."""
+    return '%s (%s:%d)' % (code.co_name, code.co_filename,
+                           code.co_firstlineno)
+
+
+def collapsed_stacks(samples=None):
+    """Return the list of the lines of the collapsed stacks of samples.
+
+    samples defaults to get_samples().  Lines are sorted by stack.
+    """
+    if samples is None:
+        samples = get_samples()
+    lines = []
+    for stack, count in samples.items():
+        # ';' separates the frames: a label cannot contain it.  Flame graph
+        # tools split the count at the last space, so spaces are fine.
+        frames = ';'.join(frame_label(code).replace(';', ':')
+                          for code in stack)
+        lines.append('%s %d' % (frames, count))
+    lines.sort()
+    return lines
+
+
+def write_collapsed(file, samples=None):
+    """Write the collapsed stacks of samples to file.
+
+    file is a filename or a text file object.
+    """
+    if isinstance(file, str):
+        with open(file, 'w', encoding='utf-8') as fp:
+            write_collapsed(fp, samples)
+        return
+    for line in collapsed_stacks(samples):
+        file.write(line + '\n')
+
+
+class Profile:
+    """Profile(interval=0.01)
+
+    Context manager sampling the Python stacks while its block runs.  The
+    samples taken are stored in the samples attribute when it exits.
+    """
+
+    def __init__(self, interval=0.01):
+        self.interval = interval
+        self.samples = {}
+
+    def __enter__(self):
+        clear_samples()
+        start(self.interval)
+        return self
+
+    def __exit__(self, *exc_info):
+        stop()
+        self.samples = get_samples()
+        clear_samples()
+
+    def collapsed_stacks(self):
+        return collapsed_stacks(self.samples)
+
+    def write_collapsed(self, file):
+        write_collapsed(file, self.samples)
+
+
+def main():
+    import os
+    import sys
+    import runpy
+    from optparse import OptionParser
+    usage = ("sampleprof.py [-o output_file_path] [-i interval] "
+             "[-m module | scriptfile] [arg] ...")
+    parser = OptionParser(usage=usage)
+    parser.allow_interspersed_args = False
+    parser.add_option('-o', '--outfile', dest="outfile",
+        help="Write the collapsed stacks to <outfile>", default=None)
+    parser.add_option('-i', '--interval', dest="interval", type="float",
+        help="Sampling interval in seconds (default: 0.01)", default=0.01)
+    parser.add_option('-m', dest="module", action="store_true",
+        help="Profile a library module", default=False)
+
+    if not sys.argv[1:]:
+        parser.print_usage()
+        sys.exit(2)
+
+    (options, args) = parser.parse_args()
+    sys.argv[:] = args
+
+    if len(args) > 0:
+        if options.module:
+            code = "run_module(modname, run_name='__main__')"
+            globs = {
+                'run_module': runpy.run_module,
+                'modname': args[0]
+            }
+        else:
+            progname = args[0]
+            sys.path.insert(0, os.path.dirname(progname))
+            with open(progname, 'rb') as fp:
+                code = compile(fp.read(), progname, 'exec')
+            globs = {
+                '__file__': progname,
+                '__name__': '__main__',
+                '__package__': None,
+                '__cached__': None,
+            }
+        prof = Profile(options.interval)
+        try:
+            with prof:
+                exec(code, globs, None)
+        except SystemExit:
+            pass
+        if options.outfile is not None:
+            prof.write_collapsed(options.outfile)
+        else:
+            prof.write_collapsed(sys.stdout)
+    else:
+        parser.print_usage()
+    return parser
+
+# The sampler thread reads the frames of the interpreter: it must be gone
+# before the interpreter is finalized.
+atexit.register(stop)
+
+# When invoked as main program, invoke the profiler on a script
+if __name__ == '__main__':
+    main()
@@ -1,6 +1,8 @@
+import array
 import contextlib
 import os
 import pickle
+import sys
 from textwrap import dedent, indent
 import threading
 import time
@@ -11,6 +13,10 @@ from test.support import script_helper
 
 interpreters = support.import_module('_xxsubinterpreters')
 
+# create(isolated=True) is refused in every build until the objects shared
+# between interpreters are immortal and pymalloc is per interpreter.
+ISOLATED_SUPPORTED = False
+
 
 def _captured_script(script):
     r, w = os.pipe()
@@ -59,6 +65,10 @@ class IsShareableTests(unittest.TestCase):
                 None,
                 # builtin objects
                 b'spam',
+                # buffers
+                bytearray(b'spam'),
+                memoryview(b'spam'),
+                array.array('i', [1, 2, 3]),
                 ]
         for obj in shareables:
             with self.subTest(obj):
@@ -366,6 +376,113 @@ class CreateTests(TestBase):
         id = interpreters.create()
         self.assertEqual(set(interpreters.list_all()), before | {id, id2})
 
+    @unittest.skipIf(ISOLATED_SUPPORTED, 'isolated interpreters supported')
+    def test_isolated_unsupported(self):
+        before = set(interpreters.list_all())
+        id1 = interpreters.create()
+        with self.assertRaises(RuntimeError):
+            interpreters.create(isolated=True)
+        # No interpreter was created, not even temporarily.
+        id2 = interpreters.create()
+        self.assertEqual(int(id2), int(id1) + 1)
+        interpreters.destroy(id1)
+        interpreters.destroy(id2)
+        self.assertEqual(set(interpreters.list_all()), before)
+
+    @unittest.skipUnless(ISOLATED_SUPPORTED, 'isolated interpreters unsupported')
+    def test_isolated(self):
+        id = interpreters.create(isolated=True)
+        out = _run_output(id, dedent("""
+            import _xxsubinterpreters as _interpreters
+            try:
+                _interpreters.create()
+            except RuntimeError:
+                print('refused')
+            """))
+        self.assertEqual(out.strip(), 'refused')
+        interpreters.destroy(id)
+        self.assertNotIn(id, interpreters.list_all())
+
+    @unittest.skipUnless(ISOLATED_SUPPORTED, 'isolated interpreters unsupported')
+    def test_isolated_in_parallel(self):
+        ids = [interpreters.create(isolated=True) for _ in range(3)]
+        cid = interpreters.channel_create()
+        script = dedent(f"""
+            import _xxsubinterpreters as _interpreters
+            total = sum(i * i for i in range(100_000))
+            _interpreters.channel_send({int(cid)}, str(total).encode())
+            """)
+        threads = [threading.Thread(target=interpreters.run_string,
+                                    args=(id, script))
+                   for id in ids]
+        # Run the main interpreter concurrently too.
+        for t in threads:
+            t.start()
+        total = sum(i * i for i in range(100_000))
+        for t in threads:
+            t.join()
+        results = [interpreters.channel_recv(cid) for _ in ids]
+        self.assertEqual(results, [str(total).encode()] * len(ids))
+
+    @unittest.skipUnless(ISOLATED_SUPPORTED, 'isolated interpreters unsupported')
+    def test_isolated_threads(self):
+        # A thread exiting releases the GIL of its interpreter.
+        id = interpreters.create(isolated=True)
+        out = _run_output(id, dedent("""
+            import threading
+            results = []
+            threads = [threading.Thread(target=results.append, args=(i,))
+                       for i in range(5)]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            print(sorted(results))
+            """))
+        self.assertEqual(out.strip(), '[0, 1, 2, 3, 4]')
+        interpreters.destroy(id)
+
+    @unittest.skipUnless(ISOLATED_SUPPORTED, 'isolated interpreters unsupported')
+    def test_isolated_gil_io_priority(self):
+        # The I/O priority is a setting of the GIL of the interpreter: a
+        # thread coming back from sleep() preempts a CPU-bound thread of
+        # the same interpreter at once, despite the long switch interval.
+        id = interpreters.create(isolated=True)
+        interval = sys.getswitchinterval()
+        sys.setswitchinterval(0.1)
+        try:
+            out = _run_output(id, dedent("""
+                import sys, threading, time
+                sys._set_gil_io_priority(True)
+                done = threading.Event()
+                elapsed = []
+                def cpu_bound():
+                    while not done.is_set():
+                        sum(range(100))
+                def io_bound():
+                    start = time.monotonic()
+                    for i in range(10):
+                        time.sleep(0.001)
+                    elapsed.append(time.monotonic() - start)
+                    done.set()
+                threads = [threading.Thread(target=io_bound),
+                           threading.Thread(target=cpu_bound)]
+                for t in threads:
+                    t.start()
+                for t in threads:
+                    t.join()
+                print(elapsed[0] < 0.5, sys._get_gil_io_priority())
+                """))
+        finally:
+            sys.setswitchinterval(interval)
+        self.assertEqual(out.strip(), 'True True')
+        self.assertFalse(sys._get_gil_io_priority())
+        interpreters.destroy(id)
+
+    def test_isolated_keyword_only(self):
+        with self.assertRaises(TypeError):
+            interpreters.create(True)
+
 
 class DestroyTests(TestBase):
 
@@ -1196,6 +1313,65 @@ class ChannelTests(TestBase):
 
         self.assertEqual(obj, b'eggs')
 
+    def test_send_recv_buffer(self):
+        cid = interpreters.channel_create()
+        data = bytearray(b'spam')
+        interpreters.channel_send(cid, data)
+        id1 = interpreters.create()
+        out = _run_output(id1, dedent(f"""
+            import _xxsubinterpreters as _interpreters
+            view = _interpreters.channel_recv({int(cid)})
+            print(type(view).__name__, bytes(view))
+            view[0] = ord('S')
+            """))
+
+        self.assertEqual(out.strip(), "memoryview b'spam'")
+        # The memory is shared, not copied.
+        self.assertEqual(data, b'Spam')
+
+    def test_send_recv_buffer_format(self):
+        cid = interpreters.channel_create()
+        interpreters.channel_send(cid, array.array('d', [1.0, 2.5]))
+        interpreters.channel_send(cid, memoryview(b'eggs'))
+        view1 = interpreters.channel_recv(cid)
+        view2 = interpreters.channel_recv(cid)
+
+        self.assertEqual(view1.format, 'd')
+        self.assertEqual(view1.tolist(), [1.0, 2.5])
+        self.assertTrue(view2.readonly)
+        self.assertEqual(view2, b'eggs')
+
+    def test_send_buffer_pinned(self):
+        cid = interpreters.channel_create()
+        data = bytearray(b'spam')
+        interpreters.channel_send(cid, data)
+        # Pinned by the channel.
+        with self.assertRaises(BufferError):
+            data.extend(b'eggs')
+
+        id1 = interpreters.create()
+        interpreters.run_string(id1, dedent(f"""
+            import _xxsubinterpreters as _interpreters
+            view = _interpreters.channel_recv({int(cid)})
+            sliced = view[1:]
+            del view
+            """))
+        # Pinned by the memoryview in the other interpreter.
+        with self.assertRaises(BufferError):
+            data.extend(b'eggs')
+
+        interpreters.run_string(id1, 'sliced.release()')
+        data.extend(b'eggs')
+        self.assertEqual(data, b'spameggs')
+
+    def test_send_buffer_unpinned_on_destroy(self):
+        cid = interpreters.channel_create()
+        data = bytearray(b'spam')
+        interpreters.channel_send(cid, data)
+        interpreters.channel_destroy(cid)
+        data.extend(b'eggs')
+        self.assertEqual(data, b'spameggs')
+
     def test_send_not_found(self):
         with self.assertRaises(interpreters.ChannelNotFoundError):
             interpreters.channel_send(10, b'spam')
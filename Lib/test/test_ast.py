@@ -1059,7 +1059,7 @@ class ConstantTests(unittest.TestCase):
         co = compile(tree, '<string>', 'exec')
         consts = []
         for instr in dis.get_instructions(co):
-            if instr.opname == 'LOAD_CONST':
+            if instr.opname in ('LOAD_CONST', 'LOAD_CONST__RETURN'):
                 consts.append(instr.argval)
         return consts
 
@@ -1,4 +1,7 @@
+import abc
 import datetime
+import functools
+import sys
 import unittest
 from test.support import cpython_only
 try:
@@ -279,6 +282,27 @@ class PythonClass:
 PYTHON_INSTANCE = PythonClass()
 
 
+class PythonInit:
+    def __init__(self, arg1, arg2=None):
+        self.args = [arg1, arg2]
+
+    def __eq__(self, other):
+        return type(self) is type(other) and self.args == other.args
+
+
+class EmptyClass:
+    def __eq__(self, other):
+        return type(self) is type(other)
+
+
+PARTIAL_NOARG = functools.partial(pyfunc)
+PARTIAL_ONEARG = functools.partial(pyfunc, 1)
+PARTIAL_TWOARGS = functools.partial(pyfunc, 1, 2)
+PARTIAL_KWARG = functools.partial(pyfunc, arg2=2)
+FROMKEYS_DESCR = dict.__dict__['fromkeys']
+FROMBYTES_DESCR = int.__dict__['from_bytes']
+
+
 IGNORE_RESULT = object()
 
 
@@ -325,6 +349,20 @@ class FastCallTests(unittest.TestCase):
         # bpo-30524: Test that calling a C type static method with no argument
         # doesn't crash (ignore the result): METH_FASTCALL | METH_CLASS
         (datetime.datetime.now, (), IGNORE_RESULT),
+
+        # classmethod descriptor
+        (FROMKEYS_DESCR, (dict, 'ab'), {'a': None, 'b': None}),
+
+        # Python classes: __init__ written in Python, object.__init__()
+        (PythonInit, (1, 2), PythonInit(1, 2)),
+        (PythonInit, (1,), PythonInit(1)),
+        (EmptyClass, (), EmptyClass()),
+
+        # functools.partial
+        (PARTIAL_NOARG, (1, 2), [1, 2]),
+        (PARTIAL_ONEARG, (2,), [1, 2]),
+        (PARTIAL_TWOARGS, (), [1, 2]),
+        (PARTIAL_KWARG, (1,), [1, 2]),
     )
 
     # Test calls with positional and keyword arguments
@@ -345,6 +383,18 @@ class FastCallTests(unittest.TestCase):
         # C type static method: METH_FASTCALL | METH_CLASS
         (int.from_bytes, (b'\x01\x00',), {'byteorder': 'little'}, 1),
         (int.from_bytes, (), {'bytes': b'\x01\x00', 'byteorder': 'little'}, 1),
+
+        # classmethod descriptor
+        (FROMBYTES_DESCR, (int, b'\x01\x00'), {'byteorder': 'little'}, 1),
+
+        # Python class
+        (PythonInit, (1,), {'arg2': 2}, PythonInit(1, 2)),
+        (PythonInit, (), {'arg1': 1, 'arg2': 2}, PythonInit(1, 2)),
+
+        # functools.partial
+        (PARTIAL_ONEARG, (), {'arg2': 2}, [1, 2]),
+        (PARTIAL_KWARG, (), {'arg1': 1}, [1, 2]),
+        (PARTIAL_KWARG, (1,), {'arg2': 3}, [1, 3]),
     )
 
     def check_result(self, result, expected):
@@ -422,5 +472,121 @@ class FastCallTests(unittest.TestCase):
                 self.check_result(result, expected)
 
 
+class VectorcallTests(unittest.TestCase):
+    # Calls which use the vectorcall entry point of the callable
+
+    def test_method(self):
+        class A:
+            def f(self, *args, **kwargs):
+                return self, args, kwargs
+        a = A()
+        many = tuple(range(20))
+        self.assertEqual(a.f(), (a, (), {}))
+        self.assertEqual(a.f(*many), (a, many, {}))
+        self.assertEqual(a.f(*many, x=1), (a, many, {'x': 1}))
+        # callers which don't unpack bound methods themselves
+        self.assertEqual(list(map(a.f, 'ab')),
+                         [(a, ('a',), {}), (a, ('b',), {})])
+        self.assertEqual(sorted([3, 1, 2], key=[1, 2, 3].index), [1, 2, 3])
+        m = a.f
+        self.assertEqual(functools.partial(m, 1)(2, y=3),
+                         (a, (1, 2), {'y': 3}))
+
+    def test_class_instantiation(self):
+        class A:
+            def __init__(self, *args, **kwargs):
+                self.args = args
+                self.kwargs = kwargs
+        many = tuple(range(20))
+        a = A(*many, x=1)
+        self.assertEqual(a.args, many)
+        self.assertEqual(a.kwargs, {'x': 1})
+
+        class B(A):
+            pass
+        self.assertEqual(B(1).args, (1,))
+
+    def test_class_init_not_none(self):
+        class A:
+            def __init__(self):
+                return 1
+        with self.assertRaisesRegex(TypeError,
+                                    r"__init__\(\) should return None"):
+            A()
+
+    def test_class_no_init(self):
+        class A:
+            pass
+        self.assertIsInstance(A(), A)
+        with self.assertRaisesRegex(TypeError, r"A\(\) takes no arguments"):
+            A(1)
+        with self.assertRaisesRegex(TypeError, r"A\(\) takes no arguments"):
+            A(x=1)
+
+    def test_class_init_changes(self):
+        class A:
+            def __init__(self, x):
+                self.x = x
+        self.assertEqual(A(1).x, 1)
+        A.__init__ = lambda self: None
+        self.assertFalse(hasattr(A(), 'x'))
+        A.__new__ = lambda cls: 42
+        self.assertEqual(A(), 42)
+
+    def test_abstract_class(self):
+        class A(abc.ABC):
+            @abc.abstractmethod
+            def f(self):
+                pass
+            def __init__(self):
+                pass
+        with self.assertRaisesRegex(TypeError, "abstract"):
+            A()
+
+    def test_metaclass_call(self):
+        class Meta(type):
+            def __call__(cls, *args, **kwargs):
+                return ('meta', args, kwargs)
+        class A(metaclass=Meta):
+            def __init__(self, x):
+                self.x = x
+        self.assertEqual(A(1, y=2), ('meta', (1,), {'y': 2}))
+
+    def test_partial_keywords_mutated(self):
+        p = functools.partial(pyfunc, 1)
+        self.assertEqual(p(2), [1, 2])
+        p.keywords['arg2'] = 3
+        self.assertEqual(p(), [1, 3])
+        p.keywords.clear()
+        self.assertEqual(p(4), [1, 4])
+
+    def test_partial_subclass(self):
+        class P(functools.partial):
+            def __call__(self, *args, **kwargs):
+                return 'override'
+        self.assertEqual(P(pyfunc, 1)(2), 'override')
+
+        class Q(functools.partial):
+            pass
+        self.assertEqual(Q(pyfunc, 1)(2), [1, 2])
+
+    def test_partial_recursion(self):
+        p = functools.partial(pyfunc)
+        p.__setstate__((p, (), {}, None))
+        try:
+            self.assertRaises(RecursionError, p)
+        finally:
+            p.__setstate__((pyfunc, (), {}, None))
+
+    def test_classmethod_descriptor(self):
+        descr = FROMKEYS_DESCR
+        self.assertEqual(descr(dict, 'a'), {'a': None})
+        self.assertRaises(TypeError, descr, dict, 'a', value=1)
+        self.assertEqual(FROMBYTES_DESCR(int, b'\x02', byteorder='big'), 2)
+        self.assertRaises(TypeError, descr)
+        self.assertRaises(TypeError, descr, 1, 'a')
+        self.assertRaises(TypeError, descr, int, 'a')
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -395,6 +395,30 @@ class TestPendingCalls(unittest.TestCase):
         self.pendingcalls_wait(l, n)
 
 
+@unittest.skipUnless(hasattr(_testcapi, 'start_gil_stats_hook'),
+                     'need Python built --with-gil-stats')
+class GILStatsHookTest(unittest.TestCase):
+
+    def test_gil_stats_hook(self):
+        def spin():
+            deadline = time.monotonic() + 0.2
+            while time.monotonic() < deadline:
+                pass
+
+        _testcapi.start_gil_stats_hook()
+        try:
+            threads = [threading.Thread(target=spin) for _ in range(2)]
+            with support.start_threads(threads):
+                pass
+        finally:
+            take, drop, forced_drop = _testcapi.stop_gil_stats_hook()
+        self.assertGreater(take, 0)
+        self.assertGreater(drop, 0)
+        # Two threads competing for the GIL force the switch interval to
+        # kick in.
+        self.assertGreater(forced_drop, 0)
+
+
 class SubinterpreterTest(unittest.TestCase):
 
     def test_subinterps(self):
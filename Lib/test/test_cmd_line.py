@@ -683,6 +683,33 @@ class CmdLineTest(unittest.TestCase):
             with self.subTest(env_var=env_var, name=name):
                 self.check_pythonmalloc(env_var, name)
 
+    @unittest.skipUnless(support.with_pymalloc(), 'need pymalloc')
+    def test_pythonmallocarenasize(self):
+        # Test the PYTHONMALLOCARENASIZE environment variable
+        code = 'import sys; sys._debugmallocstats()'
+        for env_var, size in (('1M', 1 << 20), ('2m', 2 << 20),
+                              ('524288', 512 << 10)):
+            with self.subTest(env_var=env_var):
+                rc, out, err = assert_python_ok(
+                    '-c', code, PYTHONMALLOC='pymalloc',
+                    PYTHONMALLOCARENASIZE=env_var)
+                self.assertIn(b' * %d bytes/arena' % size, err)
+
+        for env_var in ('3M', '64K', '512M', '1G', 'x', '1Mx'):
+            with self.subTest(env_var=env_var):
+                rc, out, err = assert_python_failure(
+                    '-c', 'pass', PYTHONMALLOCARENASIZE=env_var)
+                self.assertIn(b'PYTHONMALLOCARENASIZE', err)
+
+        # -E and -I ignore the variable, like the other ones
+        for opt in ('-E', '-I'):
+            with self.subTest(opt=opt):
+                rc, out, err = assert_python_ok(
+                    opt, '-c', code, PYTHONMALLOCARENASIZE='1M')
+                self.assertIn(b' * %d bytes/arena' % (256 << 10), err)
+                assert_python_ok(opt, '-c', 'pass',
+                                 PYTHONMALLOCARENASIZE='3M')
+
     def test_pythondevmode_env(self):
         # Test the PYTHONDEVMODE environment variable
         code = "import sys; print(sys.flags.dev_mode)"
@@ -355,10 +355,163 @@ if check_impl_detail(cpython=True) and ctypes is not None:
             tt.join()
             self.assertEqual(LAST_FREED, 500)
 
+# Number of executions after which a code object gets its inline caches
+# (OPCACHE_MIN_RUNS in Python/ceval.c).
+OPCACHE_MIN_RUNS = 1024
+
+class OpcacheTest(unittest.TestCase):
+
+    def warm_up(self, func, *args):
+        for _ in range(OPCACHE_MIN_RUNS + 1):
+            func(*args)
+
+    def test_load_global(self):
+        builtins = {'len': len}
+        ns = {'__builtins__': builtins, 'x': 1}
+        exec("def f(): return x, len", ns)
+        f = ns['f']
+        self.warm_up(f)
+        self.assertEqual(f(), (1, len))
+
+        ns['x'] = 2
+        self.assertEqual(f(), (2, len))
+        builtins['len'] = abs
+        self.assertEqual(f(), (2, abs))
+        # globals shadow builtins
+        ns['len'] = 3
+        self.assertEqual(f(), (2, 3))
+        del ns['len']
+        self.assertEqual(f(), (2, abs))
+        del ns['x']
+        self.assertRaises(NameError, f)
+
+    def test_load_global_other_globals(self):
+        ns1 = {'x': 1}
+        exec("def f(): return x", ns1)
+        f = ns1['f']
+        self.warm_up(f)
+        # The same code object run with different globals
+        ns2 = {'x': 2}
+        g = type(f)(f.__code__, ns2)
+        self.assertEqual(f(), 1)
+        self.assertEqual(g(), 2)
+        self.assertEqual(f(), 1)
+
+    def test_load_attr(self):
+        class C:
+            def __init__(self, x):
+                self.x = x
+        def f(o):
+            return o.x
+        objs = [C(i) for i in range(10)]
+        for o in objs:
+            self.warm_up(f, o)
+            self.assertEqual(f(o), o.x)
+
+        o = C(1)
+        o.x = 2
+        self.assertEqual(f(o), 2)
+        # A class attribute is used once the instance attribute is gone
+        C.x = 3
+        del o.x
+        self.assertEqual(f(o), 3)
+        # A data descriptor takes precedence over the instance dict
+        C.x = property(lambda self: 4)
+        self.assertEqual(f(objs[0]), 4)
+        del C.x
+        self.assertEqual(f(objs[0]), 0)
+
+        class D:
+            def __init__(self, x):
+                self.x = x
+        o = C(5)
+        o.__class__ = D
+        self.assertEqual(f(o), 5)
+        self.assertEqual(f(D(6)), 6)
+        self.assertRaises(AttributeError, f, object())
+
+    def test_store_attr(self):
+        class C:
+            pass
+        def f(o, x):
+            o.x = x
+            o.y = x + 1
+        for i in range(OPCACHE_MIN_RUNS + 1):
+            o = C()
+            f(o, i)
+            self.assertEqual(o.__dict__, {'x': i, 'y': i + 1})
+        o = C()
+        o.y = 1
+        f(o, 2)
+        self.assertEqual(o.__dict__, {'y': 3, 'x': 2})
+
+        stored = []
+        C.y = property(lambda self: 42, lambda self, v: stored.append(v))
+        o = C()
+        f(o, 10)
+        self.assertEqual(o.x, 10)
+        self.assertEqual(o.y, 42)
+        self.assertEqual(stored, [11])
+        self.assertNotIn('y', o.__dict__)
+
+    def test_load_method(self):
+        class C:
+            def __init__(self):
+                self.a = 1
+            def m(self):
+                return 'C.m'
+        def f(o):
+            return o.m()
+        o = C()
+        self.warm_up(f, o)
+        self.assertEqual(f(o), 'C.m')
+
+        # Shadowed by the instance dict, after the method was cached
+        o.b = 2
+        o.m = lambda: 'o.m'
+        self.assertEqual(f(o), 'o.m')
+        self.assertEqual(f(C()), 'C.m')
+        # A new attribute name appended to the shared keys
+        o = C()
+        o.m = lambda: 'o.m'
+        self.assertEqual(f(o), 'o.m')
+        self.assertEqual(f(C()), 'C.m')
+        # The method is replaced on the class
+        C.m = lambda self: 'C.m2'
+        self.assertEqual(f(C()), 'C.m2')
+
+    def test_load_method_pending(self):
+        class C:
+            def m(self):
+                return 'C.m'
+        def f(o):
+            return o.m()
+        o = C()
+        o.a = 1
+        self.warm_up(f, o)
+        # The instance dict has no value for 'a' but shadows the method
+        o = C()
+        o.m = lambda: 'o.m'
+        self.assertEqual(f(o), 'o.m')
+        o = C()
+        o.a = 1
+        self.assertEqual(f(o), 'C.m')
+
+    def test_load_method_builtin(self):
+        def f(o):
+            return o.count(1)
+        self.warm_up(f, [1, 1])
+        self.assertEqual(f([1, 1, 2]), 2)
+        self.assertEqual(f((1,)), 1)
+        class L(list):
+            def count(self, x):
+                return -1
+        self.assertEqual(f(L([1])), -1)
+
 def test_main(verbose=None):
     from test import test_code
     run_doctest(test_code, verbose)
-    tests = [CodeTest, CodeConstsTest, CodeWeakRefTest]
+    tests = [CodeTest, CodeConstsTest, CodeWeakRefTest, OpcacheTest]
     if check_impl_detail(cpython=True) and ctypes is not None:
         tests.append(CoExtra)
     run_unittest(*tests)
@@ -840,6 +840,43 @@ class UTF8Test(ReadTest, unittest.TestCase):
         with self.assertRaises(UnicodeDecodeError):
             b"abc\xed\xa0z".decode(self.encoding, "surrogatepass")
 
+    def test_long_runs(self):
+        # Runs of characters encoded in 1 to 4 bytes, longer than the blocks
+        # of the SIMD encoder and decoder, broken at every position by
+        # another character or by an invalid sequence
+        chars = ('a', '\xe9', 'ж', '中', '\U0001f600')
+        for run in chars:
+            encoded_run = run.encode('utf-8')
+            for i in range(40):
+                for other in chars + ('\ud800',):
+                    s = run * i + other + run * (40 - i)
+                    with self.subTest(run=run, other=other, i=i):
+                        expected = b''.join(c.encode('utf-8', 'surrogatepass')
+                                            for c in s)
+                        if other == '\ud800':
+                            with self.assertRaises(UnicodeEncodeError) as cm:
+                                s.encode(self.encoding)
+                            self.assertEqual(cm.exception.start, i)
+                            self.assertEqual(
+                                s.encode(self.encoding, 'surrogatepass'),
+                                self.BOM + expected)
+                            continue
+                        self.assertEqual(s.encode(self.encoding),
+                                         self.BOM + expected)
+                        self.assertEqual(expected.decode(self.encoding), s)
+                for bad in (b'\x80', b'\xc0\x80', b'\xc3\xc3', b'\xe4\xb8',
+                            b'\xed\xa0\x80', b'\xf4\x90\x80\x80', b'\xff'):
+                    data = encoded_run * i + bad + encoded_run * (40 - i)
+                    with self.subTest(run=run, bad=bad, i=i):
+                        with self.assertRaises(UnicodeDecodeError) as cm:
+                            data.decode(self.encoding)
+                        self.assertEqual(cm.exception.start,
+                                         len(encoded_run) * i)
+                        self.assertEqual(
+                            data.decode(self.encoding, 'replace'),
+                            run * i + bad.decode('utf-8', 'replace')
+                            + run * (40 - i))
+
 
 @unittest.skipUnless(sys.platform == 'win32',
                      'cp65001 is a Windows-only codec')
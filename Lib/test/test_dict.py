@@ -766,6 +766,59 @@ class DictTest(unittest.TestCase):
         resizing = True
         d[9] = 6
 
+    def test_resize_compact(self):
+        # Small dicts are scanned linearly and converted to hash tables when
+        # they grow.  Check every size around the limit, with deletions.
+        for keys in (['k%d' % i for i in range(20)], list(range(20)),
+                     [1.5, 'a', (1, 2), None, b'b'] * 4):
+            for n in range(1, 20):
+                d = {}
+                for i, k in enumerate(keys[:n]):
+                    d[k] = i
+                self.assertEqual(len(d), len(set(keys[:n])))
+                for i, k in enumerate(keys[:n]):
+                    self.assertIn(k, d)
+                self.assertNotIn('missing', d)
+                deleted = keys[:n:2]
+                for k in set(deleted):
+                    del d[k]
+                for k in set(deleted):
+                    self.assertNotIn(k, d)
+                    self.assertRaises(KeyError, d.__getitem__, k)
+                # reinserted keys go to the end
+                for k in deleted:
+                    d[k] = None
+                self.assertEqual(list(d)[-len(set(deleted)):],
+                                 list(dict.fromkeys(deleted)))
+                while d:
+                    k, v = d.popitem()
+                    self.assertNotIn(k, d)
+                d[keys[0]] = 0
+                self.assertEqual(d, {keys[0]: 0})
+
+    def test_compact_mutating_lookup(self):
+        # The dict is resized while a key of a compact dict is compared
+        class Key:
+            def __hash__(self):
+                return 1
+            def __eq__(self, other):
+                if not d.get('resized'):
+                    d['resized'] = True
+                    for i in range(2, 20):
+                        d[i] = i
+                return False
+        d = {Key(): 1}
+        self.assertNotIn(Key(), d)
+        self.assertEqual(len(d), 20)
+
+    @support.cpython_only
+    def test_sizeof_compact(self):
+        # Dicts are presized for their exact number of entries up to 8
+        sizes = [sys.getsizeof(dict.fromkeys({str(i) for i in range(n)}))
+                 for n in range(1, 10)]
+        self.assertEqual(sizes, sorted(set(sizes)))
+        self.assertLess(sys.getsizeof({'a': 1}), sys.getsizeof({}))
+
     def test_empty_presized_dict_in_freelist(self):
         # Bug #3537: if an empty but presized dict with a size larger
         # than 7 was in the freelist, it triggered an assertion failure
@@ -912,51 +965,54 @@ class DictTest(unittest.TestCase):
         a['a'] = 1
         size_a = sys.getsizeof(a)
         a['b'] = 2
+        # no key after 'b' has a value in b
         b.setdefault('b', 2)
-        size_b = sys.getsizeof(b)
-        b['a'] = 1
+        self.assertEqual(sys.getsizeof(b), size_a)
+        b.setdefault('a', 1)
 
-        self.assertGreater(size_b, size_a)
+        self.assertGreater(sys.getsizeof(b), size_a)
         self.assertEqual(list(a), ['x', 'y', 'z', 'a', 'b'])
         self.assertEqual(list(b), ['x', 'y', 'z', 'b', 'a'])
 
     @support.cpython_only
     def test_splittable_del(self):
-        """split table must be combined when del d[k]"""
+        """split table is kept when del d[k]"""
         a, b = self.make_shared_key_dict(2)
 
         orig_size = sys.getsizeof(a)
 
-        del a['y']  # split table is combined
+        del a['y']
         with self.assertRaises(KeyError):
             del a['y']
 
-        self.assertGreater(sys.getsizeof(a), orig_size)
+        self.assertEqual(sys.getsizeof(a), orig_size)
         self.assertEqual(list(a), ['x', 'z'])
         self.assertEqual(list(b), ['x', 'y', 'z'])
 
-        # Two dicts have different insertion order.
+        # Two dicts have different insertion order: a is combined.
         a['y'] = 42
+        self.assertGreater(sys.getsizeof(a), orig_size)
         self.assertEqual(list(a), ['x', 'z', 'y'])
         self.assertEqual(list(b), ['x', 'y', 'z'])
 
     @support.cpython_only
     def test_splittable_pop(self):
-        """split table must be combined when d.pop(k)"""
+        """split table is kept when d.pop(k)"""
         a, b = self.make_shared_key_dict(2)
 
         orig_size = sys.getsizeof(a)
 
-        a.pop('y')  # split table is combined
+        self.assertEqual(a.pop('y'), 2)
         with self.assertRaises(KeyError):
             a.pop('y')
 
-        self.assertGreater(sys.getsizeof(a), orig_size)
+        self.assertEqual(sys.getsizeof(a), orig_size)
         self.assertEqual(list(a), ['x', 'z'])
         self.assertEqual(list(b), ['x', 'y', 'z'])
 
-        # Two dicts have different insertion order.
+        # Two dicts have different insertion order: a is combined.
         a['y'] = 42
+        self.assertGreater(sys.getsizeof(a), orig_size)
         self.assertEqual(list(a), ['x', 'z', 'y'])
         self.assertEqual(list(b), ['x', 'y', 'z'])
 
@@ -998,15 +1054,15 @@ class DictTest(unittest.TestCase):
         a.a = 1
         self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
 
-        # dict.pop() convert it to combined table
+        # dict.pop() keeps the split table
         a.__dict__.pop('a')
-        self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
-
-        # But C should not convert a.__dict__ to split table again.
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
         a.a = 1
-        self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertEqual(a.__dict__, {'a': 1})
 
-        # Same for popitem()
+        # dict.popitem() converts it to combined table, but C should not
+        # convert a.__dict__ to split table again.
         a = C()
         a.a = 2
         self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
@@ -1015,6 +1071,109 @@ class DictTest(unittest.TestCase):
         a.a = 3
         self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
 
+    @support.cpython_only
+    def test_splittable_pending(self):
+        """split tables don't need a value for every shared key"""
+        import _testcapi
+
+        class C:
+            def __init__(self, a, b=None, c=None):
+                self.a = a
+                if b is not None:
+                    self.b = b
+                if c is not None:
+                    self.c = c
+
+        objs = [C(1, 2, 3), C(1, c=3), C(1, b=2), C(1)]
+        for o in objs:
+            self.assertTrue(_testcapi.dict_hassplittable(o.__dict__))
+        self.assertEqual([o.__dict__ for o in objs],
+                         [{'a': 1, 'b': 2, 'c': 3}, {'a': 1, 'c': 3},
+                          {'a': 1, 'b': 2}, {'a': 1}])
+        d = objs[1].__dict__
+        self.assertEqual(list(d), ['a', 'c'])
+        self.assertEqual(list(d.values()), [1, 3])
+        self.assertEqual(list(d.items()), [('a', 1), ('c', 3)])
+        self.assertEqual(list(reversed(list(d))), ['c', 'a'])
+        self.assertEqual(repr(d), "{'a': 1, 'c': 3}")
+        self.assertEqual(d.copy(), {'a': 1, 'c': 3})
+        self.assertEqual(len(d), 2)
+        self.assertNotIn('b', d)
+        self.assertEqual(dict(d), d)
+        self.assertEqual(vars(C(*[1, 2, 3])), objs[0].__dict__)
+
+        # Deleting an attribute keeps the dict and its class sharing keys
+        del objs[0].b
+        self.assertTrue(_testcapi.dict_hassplittable(objs[0].__dict__))
+        self.assertEqual(list(objs[0].__dict__), ['a', 'c'])
+        self.assertTrue(_testcapi.dict_hassplittable(C(1).__dict__))
+        # A value can be set for a key only if no later key has a value:
+        # the dict moves to a variant of the keys in its order
+        objs[1].b = 2
+        self.assertEqual(list(objs[1].__dict__), ['a', 'c', 'b'])
+        self.assertEqual(list(objs[2].__dict__), ['a', 'b'])
+        objs[3].c = 3
+        objs[3].d = 4
+        self.assertTrue(_testcapi.dict_hassplittable(objs[3].__dict__))
+        self.assertEqual(list(objs[3].__dict__), ['a', 'c', 'd'])
+
+    @support.cpython_only
+    def test_splittable_variants(self):
+        """instances setting their attributes in another order share keys"""
+        import _testcapi
+
+        class C:
+            def __init__(self, swap):
+                if swap:
+                    self.y = 2
+                    self.x = 1
+                else:
+                    self.x = 1
+                    self.y = 2
+
+        stats = sys._shared_keys_stats()
+        objs = [C(i % 2) for i in range(10)]
+        for o in objs:
+            self.assertTrue(_testcapi.dict_hassplittable(o.__dict__))
+        self.assertEqual([list(o.__dict__) for o in objs[:2]],
+                         [['x', 'y'], ['y', 'x']])
+        self.assertEqual(sys.getsizeof(objs[1].__dict__),
+                         sys.getsizeof(objs[3].__dict__))
+        new_stats = sys._shared_keys_stats()
+        self.assertEqual(new_stats['variants'], stats['variants'] + 1)
+        self.assertEqual(new_stats['types_lost'], stats['types_lost'])
+        # The keys of the variant grow like the other shared keys
+        for o in objs:
+            o.z = 3
+        for o in objs:
+            self.assertTrue(_testcapi.dict_hassplittable(o.__dict__))
+            self.assertEqual(o.__dict__, {'x': 1, 'y': 2, 'z': 3})
+
+    @support.cpython_only
+    def test_splittable_types_lost(self):
+        """a class stops sharing keys once its instances need too many
+        layouts"""
+        import _testcapi
+        import itertools
+
+        class C:
+            pass
+
+        stats = sys._shared_keys_stats()
+        objs = []
+        for names in itertools.permutations('abc'):
+            o = C()
+            for name in names:
+                setattr(o, name, name)
+            self.assertEqual(list(o.__dict__), list(names))
+            objs.append(o)
+        self.assertEqual(sys._shared_keys_stats()['types_lost'],
+                         stats['types_lost'] + 1)
+        self.assertTrue(_testcapi.dict_hassplittable(objs[0].__dict__))
+        o = C()
+        o.a = 1
+        self.assertFalse(_testcapi.dict_hassplittable(o.__dict__))
+
     def test_iterator_pickling(self):
         for proto in range(pickle.HIGHEST_PROTOCOL + 1):
             data = {1:"a", 2:"b", 3:"c"}
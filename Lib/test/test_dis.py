@@ -43,7 +43,7 @@ dis_c_instance_method = """\
               4 COMPARE_OP               2 (==)
               6 LOAD_FAST                0 (self)
               8 STORE_ATTR               0 (x)
-             10 LOAD_CONST               0 (None)
+             10 LOAD_CONST__RETURN       0 (None)
              12 RETURN_VALUE
 """ % (_C.__init__.__code__.co_firstlineno + 1,)
 
@@ -53,7 +53,7 @@ dis_c_instance_method_bytes = """\
           4 COMPARE_OP               2 (==)
           6 LOAD_FAST                0 (0)
           8 STORE_ATTR               0 (0)
-         10 LOAD_CONST               0 (0)
+         10 LOAD_CONST__RETURN       0 (0)
          12 RETURN_VALUE
 """
 
@@ -63,7 +63,7 @@ dis_c_class_method = """\
               4 COMPARE_OP               2 (==)
               6 LOAD_FAST                0 (cls)
               8 STORE_ATTR               0 (x)
-             10 LOAD_CONST               0 (None)
+             10 LOAD_CONST__RETURN       0 (None)
              12 RETURN_VALUE
 """ % (_C.cm.__code__.co_firstlineno + 2,)
 
@@ -72,7 +72,7 @@ dis_c_static_method = """\
               2 LOAD_CONST               1 (1)
               4 COMPARE_OP               2 (==)
               6 STORE_FAST               0 (x)
-              8 LOAD_CONST               0 (None)
+              8 LOAD_CONST__RETURN       0 (None)
              10 RETURN_VALUE
 """ % (_C.sm.__code__.co_firstlineno + 2,)
 
@@ -98,7 +98,7 @@ dis_f = """\
               4 CALL_FUNCTION            1
               6 POP_TOP
 
-%3d           8 LOAD_CONST               1 (1)
+%3d           8 LOAD_CONST__RETURN       1 (1)
              10 RETURN_VALUE
 """ % (_f.__code__.co_firstlineno + 1,
        _f.__code__.co_firstlineno + 2)
@@ -109,7 +109,7 @@ dis_f_co_code = """\
           2 LOAD_FAST                0 (0)
           4 CALL_FUNCTION            1
           6 POP_TOP
-          8 LOAD_CONST               1 (1)
+          8 LOAD_CONST__RETURN       1 (1)
          10 RETURN_VALUE
 """
 
@@ -130,7 +130,7 @@ dis_bug708901 = """\
              12 STORE_FAST               0 (res)
 
 %3d          14 JUMP_ABSOLUTE           10
-        >>   16 LOAD_CONST               0 (None)
+        >>   16 LOAD_CONST__RETURN       0 (None)
              18 RETURN_VALUE
 """ % (bug708901.__code__.co_firstlineno + 1,
        bug708901.__code__.co_firstlineno + 2,
@@ -158,7 +158,7 @@ dis_bug1333982 = """\
              22 CALL_FUNCTION            1
              24 RAISE_VARARGS            1
 
-%3d     >>   26 LOAD_CONST               0 (None)
+%3d     >>   26 LOAD_CONST__RETURN       0 (None)
              28 RETURN_VALUE
 """ % (bug1333982.__code__.co_firstlineno + 1,
        __file__,
@@ -169,24 +169,24 @@ dis_bug1333982 = """\
 _BIG_LINENO_FORMAT = """\
 %3d           0 LOAD_GLOBAL              0 (spam)
               2 POP_TOP
-              4 LOAD_CONST               0 (None)
+              4 LOAD_CONST__RETURN       0 (None)
               6 RETURN_VALUE
 """
 
 _BIG_LINENO_FORMAT2 = """\
 %4d           0 LOAD_GLOBAL              0 (spam)
                2 POP_TOP
-               4 LOAD_CONST               0 (None)
+               4 LOAD_CONST__RETURN       0 (None)
                6 RETURN_VALUE
 """
 
 dis_module_expected_results = """\
 Disassembly of f:
-  4           0 LOAD_CONST               0 (None)
+  4           0 LOAD_CONST__RETURN       0 (None)
               2 RETURN_VALUE
 
 Disassembly of g:
-  5           0 LOAD_CONST               0 (None)
+  5           0 LOAD_CONST__RETURN       0 (None)
               2 RETURN_VALUE
 
 """
@@ -207,7 +207,7 @@ dis_simple_stmt_str = """\
               2 LOAD_CONST               0 (1)
               4 BINARY_ADD
               6 STORE_NAME               0 (x)
-              8 LOAD_CONST               1 (None)
+              8 LOAD_CONST__RETURN       1 (None)
              10 RETURN_VALUE
 """
 
@@ -243,7 +243,7 @@ dis_annot_stmt_str = """\
              36 STORE_SUBSCR
              38 LOAD_NAME                1 (int)
              40 POP_TOP
-             42 LOAD_CONST               4 (None)
+             42 LOAD_CONST__RETURN       4 (None)
              44 RETURN_VALUE
 """
 
@@ -262,7 +262,7 @@ dis_compound_stmt_str = """\
               8 INPLACE_ADD
              10 STORE_NAME               0 (x)
              12 JUMP_ABSOLUTE            4
-             14 LOAD_CONST               2 (None)
+             14 LOAD_CONST__RETURN       2 (None)
              16 RETURN_VALUE
 """
 
@@ -278,14 +278,14 @@ dis_traceback = """\
 
 %3d     >>   14 DUP_TOP
              16 LOAD_GLOBAL              0 (Exception)
-             18 COMPARE_OP              10 (exception match)
+             18 COMPARE_AND_BRANCH      10 (exception match)
              20 POP_JUMP_IF_FALSE       52
              22 POP_TOP
              24 STORE_FAST               0 (e)
              26 POP_TOP
              28 SETUP_FINALLY           10 (to 40)
 
-%3d          30 LOAD_FAST                0 (e)
+%3d          30 LOAD_FAST__LOAD_ATTR     0 (e)
              32 LOAD_ATTR                1 (__traceback__)
              34 STORE_FAST               1 (tb)
              36 POP_BLOCK
@@ -905,11 +905,11 @@ expected_opinfo_inner = [
   Instruction(opname='LOAD_DEREF', opcode=136, arg=1, argval='b', argrepr='b', offset=4, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_DEREF', opcode=136, arg=2, argval='c', argrepr='c', offset=6, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_DEREF', opcode=136, arg=3, argval='d', argrepr='d', offset=8, starts_line=None, is_jump_target=False),
-  Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='e', argrepr='e', offset=10, starts_line=None, is_jump_target=False),
+  Instruction(opname='LOAD_FAST__LOAD_FAST', opcode=165, arg=0, argval='e', argrepr='e', offset=10, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=1, argval='f', argrepr='f', offset=12, starts_line=None, is_jump_target=False),
   Instruction(opname='CALL_FUNCTION', opcode=131, arg=6, argval=6, argrepr='', offset=14, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=16, starts_line=None, is_jump_target=False),
-  Instruction(opname='LOAD_CONST', opcode=100, arg=0, argval=None, argrepr='None', offset=18, starts_line=None, is_jump_target=False),
+  Instruction(opname='LOAD_CONST__RETURN', opcode=168, arg=0, argval=None, argrepr='None', offset=18, starts_line=None, is_jump_target=False),
   Instruction(opname='RETURN_VALUE', opcode=83, arg=None, argval=None, argrepr='', offset=20, starts_line=None, is_jump_target=False),
 ]
 
@@ -926,12 +926,12 @@ expected_opinfo_jumpy = [
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=18, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='i', argrepr='i', offset=20, starts_line=5, is_jump_target=False),
   Instruction(opname='LOAD_CONST', opcode=100, arg=2, argval=4, argrepr='4', offset=22, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=0, argval='<', argrepr='<', offset=24, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_AND_BRANCH', opcode=167, arg=0, argval='<', argrepr='<', offset=24, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=30, argval=30, argrepr='', offset=26, starts_line=None, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=8, argval=8, argrepr='', offset=28, starts_line=6, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='i', argrepr='i', offset=30, starts_line=7, is_jump_target=True),
   Instruction(opname='LOAD_CONST', opcode=100, arg=3, argval=6, argrepr='6', offset=32, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=4, argval='>', argrepr='>', offset=34, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_AND_BRANCH', opcode=167, arg=4, argval='>', argrepr='>', offset=34, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=8, argval=8, argrepr='', offset=36, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=38, starts_line=8, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=52, argval=52, argrepr='', offset=40, starts_line=None, is_jump_target=False),
@@ -952,12 +952,12 @@ expected_opinfo_jumpy = [
   Instruction(opname='STORE_FAST', opcode=125, arg=0, argval='i', argrepr='i', offset=70, starts_line=None, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='i', argrepr='i', offset=72, starts_line=14, is_jump_target=False),
   Instruction(opname='LOAD_CONST', opcode=100, arg=3, argval=6, argrepr='6', offset=74, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=4, argval='>', argrepr='>', offset=76, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_AND_BRANCH', opcode=167, arg=4, argval='>', argrepr='>', offset=76, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=82, argval=82, argrepr='', offset=78, starts_line=None, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=52, argval=52, argrepr='', offset=80, starts_line=15, is_jump_target=False),
   Instruction(opname='LOAD_FAST', opcode=124, arg=0, argval='i', argrepr='i', offset=82, starts_line=16, is_jump_target=True),
   Instruction(opname='LOAD_CONST', opcode=100, arg=2, argval=4, argrepr='4', offset=84, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=0, argval='<', argrepr='<', offset=86, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_AND_BRANCH', opcode=167, arg=0, argval='<', argrepr='<', offset=86, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=52, argval=52, argrepr='', offset=88, starts_line=None, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=102, argval=102, argrepr='', offset=90, starts_line=17, is_jump_target=False),
   Instruction(opname='JUMP_ABSOLUTE', opcode=113, arg=52, argval=52, argrepr='', offset=92, starts_line=None, is_jump_target=False),
@@ -975,7 +975,7 @@ expected_opinfo_jumpy = [
   Instruction(opname='JUMP_FORWARD', opcode=110, arg=28, argval=146, argrepr='to 146', offset=116, starts_line=None, is_jump_target=False),
   Instruction(opname='DUP_TOP', opcode=4, arg=None, argval=None, argrepr='', offset=118, starts_line=22, is_jump_target=True),
   Instruction(opname='LOAD_GLOBAL', opcode=116, arg=2, argval='ZeroDivisionError', argrepr='ZeroDivisionError', offset=120, starts_line=None, is_jump_target=False),
-  Instruction(opname='COMPARE_OP', opcode=107, arg=10, argval='exception match', argrepr='exception match', offset=122, starts_line=None, is_jump_target=False),
+  Instruction(opname='COMPARE_AND_BRANCH', opcode=167, arg=10, argval='exception match', argrepr='exception match', offset=122, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_JUMP_IF_FALSE', opcode=114, arg=144, argval=144, argrepr='', offset=124, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=126, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=128, starts_line=None, is_jump_target=False),
@@ -1006,14 +1006,14 @@ expected_opinfo_jumpy = [
   Instruction(opname='CALL_FUNCTION', opcode=131, arg=1, argval=1, argrepr='', offset=178, starts_line=None, is_jump_target=False),
   Instruction(opname='POP_TOP', opcode=1, arg=None, argval=None, argrepr='', offset=180, starts_line=None, is_jump_target=False),
   Instruction(opname='END_FINALLY', opcode=88, arg=None, argval=None, argrepr='', offset=182, starts_line=None, is_jump_target=False),
-  Instruction(opname='LOAD_CONST', opcode=100, arg=0, argval=None, argrepr='None', offset=184, starts_line=None, is_jump_target=False),
+  Instruction(opname='LOAD_CONST__RETURN', opcode=168, arg=0, argval=None, argrepr='None', offset=184, starts_line=None, is_jump_target=False),
   Instruction(opname='RETURN_VALUE', opcode=83, arg=None, argval=None, argrepr='', offset=186, starts_line=None, is_jump_target=False),
 ]
 
 # One last piece of inspect fodder to check the default line number handling
 def simple(): pass
 expected_opinfo_simple = [
-  Instruction(opname='LOAD_CONST', opcode=100, arg=0, argval=None, argrepr='None', offset=0, starts_line=simple.__code__.co_firstlineno, is_jump_target=False),
+  Instruction(opname='LOAD_CONST__RETURN', opcode=168, arg=0, argval=None, argrepr='None', offset=0, starts_line=simple.__code__.co_firstlineno, is_jump_target=False),
   Instruction(opname='RETURN_VALUE', opcode=83, arg=None, argval=None, argrepr='', offset=2, starts_line=None, is_jump_target=False)
 ]
 
@@ -5,6 +5,7 @@ from test.support import (verbose, refcount_test, run_unittest,
 from test.support.script_helper import assert_python_ok, make_script
 
 import sys
+import sysconfig
 import time
 import gc
 import weakref
@@ -714,10 +715,14 @@ class GCTests(unittest.TestCase):
         for st in stats:
             self.assertIsInstance(st, dict)
             self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+                             {"collected", "collections", "uncollectable",
+                              "survivors", "duration"})
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
+            self.assertGreaterEqual(st["survivors"], 0)
+            self.assertIsInstance(st["duration"], float)
+            self.assertGreaterEqual(st["duration"], 0)
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -733,13 +738,175 @@ class GCTests(unittest.TestCase):
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
+        # A full collection examines at least the objects kept alive here
+        self.assertGreaterEqual(new[2]["survivors"],
+                                old[2]["survivors"] + len(stats))
+        self.assertGreater(new[2]["duration"], old[2]["duration"])
+        # Generation 0 is only timed when someone is watching
+        gc.collect(0)
+        self.assertEqual(gc.get_stats()[0]["duration"], new[0]["duration"])
+        gc.callbacks.append(lambda phase, info: None)
+        try:
+            gc.collect(0)
+        finally:
+            gc.callbacks.pop()
+        self.assertGreater(gc.get_stats()[0]["duration"], new[0]["duration"])
+
+    def test_adaptive(self):
+        self.assertFalse(gc.get_adaptive())
+
+        def count_collections(adaptive):
+            gc.collect()
+            gc.set_adaptive(adaptive)
+            try:
+                old = gc.get_stats()[0]["collections"]
+                # A large acyclic structure: the collections of the young
+                # generations find no garbage
+                data = [[i] for i in range(200000)]
+                return gc.get_stats()[0]["collections"] - old
+            finally:
+                gc.set_adaptive(False)
+
+        if not gc.isenabled():
+            self.addCleanup(gc.disable)
+            gc.enable()
+        fixed = count_collections(False)
+        adaptive = count_collections(True)
+        self.assertLess(adaptive * 4, fixed)
+        self.assertFalse(gc.get_adaptive())
+
+        # Cycles make the thresholds drop back
+        class C:
+            pass
+        gc.set_adaptive(True)
+        try:
+            data = [[i] for i in range(200000)]
+            del data
+            refs = []
+            for i in range(100000):
+                c = C()
+                c.c = c
+                if i % 1000 == 0:
+                    refs.append(weakref.ref(c))
+            del c
+            live = sum(r() is not None for r in refs)
+        finally:
+            gc.set_adaptive(False)
+        self.assertLess(live, len(refs) // 2)
+
+    def test_pause_target(self):
+        self.assertEqual(gc.get_pause_target(), 0)
+        try:
+            gc.set_pause_target(1.5)
+            self.assertEqual(gc.get_pause_target(), 1.5)
+            self.assertRaises(ValueError, gc.set_pause_target, -1)
+            self.assertRaises(ValueError, gc.set_pause_target, float('nan'))
+            self.assertRaises(OverflowError, gc.set_pause_target, 1e300)
+            self.assertEqual(gc.get_pause_target(), 1.5)
+        finally:
+            gc.set_pause_target(0)
+        self.assertEqual(gc.get_pause_target(), 0)
+
+    def test_incremental_collection(self):
+        # With a pause target, the cycles which reached the oldest
+        # generation are collected by increments instead of a full
+        # collection.
+        code = """if 1:
+            import gc, weakref
+
+            class Node:
+                pass
+
+            frozen = Node()
+            frozen.other = Node()
+            frozen.other.other = frozen
+            frozen_ref = weakref.ref(frozen)
+            del frozen
+            gc.freeze()
+
+            gc.set_pause_target(1)
+            gc.set_threshold(100, 2, 1)
+            cycles = []
+            for i in range(10000):
+                a = Node()
+                a.other = Node()
+                a.other.other = a
+                cycles.append(a)
+            refs = [weakref.ref(a) for a in cycles]
+            gc.collect()
+            del cycles, a
+
+            gc.set_debug(gc.DEBUG_STATS)
+            keep = []
+            for i in range(10**6):
+                keep.append([])
+                if i % 1000 == 0 and all(r() is None for r in refs):
+                    break
+            gc.set_debug(0)
+            print(sum(r() is not None for r in refs))
+            # Increments don't take frozen objects
+            print(frozen_ref() is not None)
+            # The objects visited by a pass are still tracked
+            print(len(gc.get_objects()) > len(keep))
+            """
+        rc, out, err = assert_python_ok('-c', code)
+        self.assertEqual(out.split(), [b'0', b'True', b'True'])
+        self.assertIn(b'gc: collecting an increment of', err)
+        self.assertNotIn(b'gc: collecting generation 2', err)
 
     def test_freeze(self):
+        if sysconfig.get_config_var('Py_IMMORTAL_OBJECTS'):
+            # Frozen objects stay immortal: don't leak the objects of the
+            # test process, which would confuse the reference counting
+            # checks of the other tests.
+            assert_python_ok('-c', """if 1:
+                import gc
+                gc.freeze()
+                assert gc.get_freeze_count() > 0
+                gc.unfreeze()
+                assert gc.get_freeze_count() == 0
+                """)
+            return
         gc.freeze()
         self.assertGreater(gc.get_freeze_count(), 0)
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    @unittest.skipUnless(sysconfig.get_config_var('Py_IMMORTAL_OBJECTS'),
+                         'need Python built --with-immortal-objects')
+    def test_freeze_immortal(self):
+        # Frozen objects and the objects they refer to become immortal:
+        # their reference count doesn't change anymore and they are never
+        # deallocated, even once unfrozen.
+        code = """if 1:
+            import gc, sys, weakref
+
+            class C:
+                pass
+
+            obj = C()
+            obj.attr = 'x' * 100
+            wr = weakref.ref(obj)
+            gc.freeze()
+            rc_obj = sys.getrefcount(obj)
+            rc_attr = sys.getrefcount(obj.attr)
+            refs = [obj, obj.attr] * 10
+            assert sys.getrefcount(obj) == rc_obj
+            assert sys.getrefcount(obj.attr) == rc_attr
+            del refs
+            gc.unfreeze()
+            del obj
+            gc.collect()
+            assert wr() is not None
+
+            # Objects created after the freeze are mortal.
+            new = C()
+            rc_new = sys.getrefcount(new)
+            ref = new
+            assert sys.getrefcount(new) == rc_new + 1
+            """
+        assert_python_ok('-c', code)
+
 
 class GCCallbackTests(unittest.TestCase):
     def setUp(self):
@@ -12,6 +12,7 @@ SHIFT = sys.int_info.bits_per_digit
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+TOOM3_CUTOFF = 300      # from longobject.c
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -229,6 +230,114 @@ class LongTest(unittest.TestCase):
                          1)
                     self.assertEqual(x, y)
 
+    def test_toom_cook(self):
+        digits = [TOOM3_CUTOFF, TOOM3_CUTOFF + 1, TOOM3_CUTOFF + 2,
+                  TOOM3_CUTOFF * 3 // 2, TOOM3_CUTOFF * 2 + 1,
+                  TOOM3_CUTOFF * 10]
+        bits = [digit * SHIFT for digit in digits]
+
+        # Products of long strings of 1 bits, as in test_karatsuba().
+        for abits in bits:
+            a = (1 << abits) - 1
+            for bbits in bits:
+                if bbits < abits:
+                    continue
+                with self.subTest(abits=abits, bbits=bbits):
+                    b = (1 << bbits) - 1
+                    x = a * b
+                    y = ((1 << (abits + bbits)) -
+                         (1 << abits) -
+                         (1 << bbits) +
+                         1)
+                    self.assertEqual(x, y)
+
+        # Compare with products of slices of a: slices smaller than
+        # KARATSUBA_CUTOFF digits are multiplied by k_lopsided_mul() and
+        # the grade school algorithm.
+        for adigits, bdigits in [(400, 400), (400, 550), (1000, 1200),
+                                 (3000, 3000)]:
+            with self.subTest(adigits=adigits, bdigits=bdigits):
+                a = self.getran(adigits)
+                b = self.getran(bdigits)
+                for x, y in [(a, b), (-a, b), (a, -b), (a, a)]:
+                    expected = 0
+                    for i in range(0, adigits, KARATSUBA_CUTOFF // 2):
+                        piece = (abs(x) >> (i * SHIFT)) & ((1 << (
+                            KARATSUBA_CUTOFF // 2 * SHIFT)) - 1)
+                        expected += (piece * abs(y)) << (i * SHIFT)
+                    if (x < 0) != (y < 0):
+                        expected = -expected
+                    self.assertEqual(x * y, expected)
+
+    def test_huge_division(self):
+        # Large divisors and quotients use the recursive division of
+        # _pylong.int_divmod().
+        for lenx, leny in [(1000, 400), (2000, 1000), (3000, 310),
+                           (5000, 2500)]:
+            x = self.getran(lenx)
+            y = self.getran(leny) or 1
+            self.check_division(x, y)
+        x = (1 << (3000 * SHIFT)) - 1
+        y = (1 << (1000 * SHIFT)) - 1
+        self.check_division(x, y)
+        self.assertEqual(x // y, (1 << (2000 * SHIFT)) + (1 << (1000 * SHIFT)) + 1)
+        self.assertEqual(x % y, 0)
+
+    def test_huge_decimal_conversion(self):
+        # str() and int() of large numbers use _pylong; the results must be
+        # the same as those of the quadratic algorithms.
+        for n in [7 ** 12000, -(3 ** 25000), 10 ** 40000, 10 ** 40000 - 1,
+                  self.getran(5000)]:
+            s = str(n)
+            with support.swap_item(sys.modules, '_pylong', None):
+                self.assertEqual(str(n), s)
+                self.assertEqual(int(s), n)
+            self.assertEqual(int(s), n)
+            self.assertEqual(repr(n), s)
+            self.assertEqual('%d' % n, s)
+            self.assertEqual(b'%d' % n, s.encode('ascii'))
+            self.assertEqual(format(n, 'd'), s)
+            self.assertEqual(int(' %s\n' % s), n)
+            self.assertEqual(int(s.encode('ascii')), n)
+
+        s = '1_234' * 5000
+        self.assertEqual(int(s), int(s.replace('_', '')))
+        self.assertEqual(int('-' + '0' * 7000), 0)
+
+    def test_huge_subclass(self):
+        # _pylong works on exact ints: the methods of int subclasses must
+        # not change the results of str() and divmod().
+        class N(int):
+            __neg__ = lambda self: 0
+            __abs__ = lambda self: 0
+        class R(int):
+            __rshift__ = lambda self, other: 0
+            __and__ = lambda self, other: 0
+        n = -7 ** 40000
+        self.assertEqual(str(N(n)), str(n))
+        a = 7 ** 40000
+        b = 3 ** 20000
+        self.assertEqual(divmod(R(a), b), divmod(a, b))
+        self.assertEqual(divmod(a, R(b)), divmod(a, b))
+        self.assertEqual(R(a) // b, a // b)
+        self.assertEqual(R(a) % b, a % b)
+
+    def test_huge_division_small_quotient(self):
+        # The pieces divided by _pylong.int_divmod() never come back to it,
+        # whatever the size of the digits.
+        b = 3 ** 3200
+        for a in [b * 7 ** 1200 + 12345, b * 7 ** 2000 - 1]:
+            q, r = divmod(a, b)
+            self.assertEqual(q * b + r, a)
+            self.assertTrue(0 <= r < b)
+        self.assertEqual(int('-' + '0' * 6999 + '1'), -1)
+        self.assertEqual(int('0' * 6999 + '1'), 1)
+        self.assertEqual(int('0' * 7000, 0), 0)
+        for s in ['1' * 7000 + '_', '1' * 7000 + '__1', '1' * 7000 + 'x',
+                  '0' + '1' * 7000]:
+            with self.assertRaises(ValueError):
+                int(s, 0)
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
@@ -967,6 +1076,44 @@ class LongTest(unittest.TestCase):
         self.assertIs(i - i, 0)
         self.assertIs(0 * i, 0)
 
+    def test_small_digit_arithmetic(self):
+        # Ints of at most two digits have fast paths for +, - and
+        # comparisons, in the int type and in the eval loop.  Check them
+        # around the digit boundaries against the generic algorithms, used
+        # on ints offset by a huge value.
+        huge = 1 << 200
+        values = set()
+        for x in (0, 1, 5, 256, 257, MASK, BASE, BASE * MASK, BASE**2 - 1,
+                  BASE**2, BASE**3):
+            for d in (-1, 0, 1):
+                values.add(x + d)
+                values.add(-x + d)
+        values = sorted(values)
+        for a in values:
+            for b in values:
+                s = (a + huge) + (b + huge) - 2 * huge
+                d = (a + huge) - (b + huge)
+                self.assertEqual(a + b, s)
+                self.assertEqual(a - b, d)
+                x = a
+                x += b
+                self.assertEqual(x, s)
+                x = a
+                x -= b
+                self.assertEqual(x, d)
+                self.assertEqual(a < b, d < 0)
+                self.assertEqual(a <= b, d <= 0)
+                self.assertEqual(a == b, d == 0)
+                self.assertEqual(a != b, d != 0)
+                self.assertEqual(a > b, d > 0)
+                self.assertEqual(a >= b, d >= 0)
+                # Small results are the cached small ints.
+                if abs(a) < BASE**2 and abs(b) < BASE**2:
+                    if -5 <= s <= 256:
+                        self.assertIs(a + b, int(str(s)))
+                    if -5 <= d <= 256:
+                        self.assertIs(a - b, int(str(d)))
+
     def test_bit_length(self):
         tiny = 1e-10
         for x in range(-65000, 65000):
@@ -1346,5 +1493,42 @@ class LongTest(unittest.TestCase):
                 self.assertEqual(type(value >> shift), int)
 
 
+class PyLongModuleTests(unittest.TestCase):
+    # Tests of the functions of the _pylong module, against the builtin
+    # algorithms for sizes where int doesn't use them.
+
+    def setUp(self):
+        self._pylong = support.import_module('_pylong')
+
+    def test_int_to_decimal_string(self):
+        _pylong = self._pylong
+        for n in [0, 1, -1, 2 ** 128, -(2 ** 129 + 1), 10 ** 100,
+                  10 ** 100 - 1, 7 ** 3000, -(3 ** 4000)]:
+            with self.subTest(n=n):
+                self.assertEqual(_pylong.int_to_decimal_string(n), str(n))
+                self.assertEqual(_pylong._int_to_decimal_string_inner(abs(n)),
+                                 str(abs(n)))
+        n = 10 ** 5000 - 1
+        self.assertEqual(_pylong._int_to_decimal_string_inner(n), '9' * 5000)
+
+    def test_int_from_string(self):
+        _pylong = self._pylong
+        for s in ['0', '1', '0001', '1_000', '9' * 3000, '12345' * 1000,
+                  '1_2' * 2000 + ' \n']:
+            with self.subTest(s=s[:20]):
+                self.assertEqual(_pylong.int_from_string(s), int(s))
+
+    def test_int_divmod(self):
+        _pylong = self._pylong
+        a = 7 ** 8000
+        b = 3 ** 4000
+        for x, y in [(a, b), (-a, b), (a, -b), (-a, -b), (b, a), (0, b),
+                     (a, 1), (a * b, b), (a * b - 1, b)]:
+            with self.subTest(x=x % 1000, y=y % 1000):
+                self.assertEqual(_pylong.int_divmod(x, y), divmod(x, y))
+        with self.assertRaises(ZeroDivisionError):
+            _pylong.int_divmod(a, 0)
+
+
 if __name__ == "__main__":
     unittest.main()
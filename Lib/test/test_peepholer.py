@@ -1,4 +1,6 @@
 import dis
+import opcode
+import sys
 import unittest
 
 from test.bytecode_helper import BytecodeTestCase
@@ -59,7 +61,7 @@ class TestTranforms(BytecodeTestCase):
             return None
 
         self.assertNotInBytecode(f, 'LOAD_GLOBAL')
-        self.assertInBytecode(f, 'LOAD_CONST', None)
+        self.assertInBytecode(f, 'LOAD_CONST__RETURN', None)
 
     def test_while_one(self):
         # Skip over:  LOAD_CONST trueconst  POP_JUMP_IF_FALSE xx
@@ -74,7 +76,7 @@ class TestTranforms(BytecodeTestCase):
 
     def test_pack_unpack(self):
         for line, elem in (
-            ('a, = a,', 'LOAD_CONST',),
+            ('a, = a,', 'LOAD_CONST__RETURN',),
             ('a, b = a, b', 'ROT_TWO',),
             ('a, b, c = a, b, c', 'ROT_THREE',),
             ):
@@ -100,7 +102,8 @@ class TestTranforms(BytecodeTestCase):
         self.assertNotInBytecode(code, 'BUILD_TUPLE')
         # One LOAD_CONST for the tuple, one for the None return value
         load_consts = [instr for instr in dis.get_instructions(code)
-                              if instr.opname == 'LOAD_CONST']
+                              if instr.opname in ('LOAD_CONST',
+                                                  'LOAD_CONST__RETURN')]
         self.assertEqual(len(load_consts), 2)
 
         # Bug 1053819:  Tuple of constants misidentified when presented with:
@@ -335,6 +338,67 @@ class TestTranforms(BytecodeTestCase):
                 pass
         self.assertEqual(count_instr_recursively(forloop, 'BUILD_LIST'), 0)
 
+    def test_superinstructions(self):
+        def f(a, b):
+            if a < b:
+                return a.real
+            return 42
+        self.assertInBytecode(f, 'LOAD_FAST__LOAD_FAST', 'a')
+        self.assertInBytecode(f, 'COMPARE_AND_BRANCH', '<')
+        self.assertInBytecode(f, 'LOAD_FAST__LOAD_ATTR', 'a')
+        self.assertInBytecode(f, 'LOAD_CONST__RETURN', 42)
+        self.assertEqual(f(1, 2), 1)
+        self.assertEqual(f(2, 1), 42)
+        # The second half of each pair is left in place after its
+        # superinstruction.
+        instrs = list(dis.get_instructions(f))
+        for instr, following in zip(instrs, instrs[1:]):
+            if instr.opcode in opcode.superinstructions:
+                first, second = opcode.superinstructions[instr.opcode]
+                self.assertEqual(following.opcode, second)
+
+    def test_superinstruction_unbound_local(self):
+        def f():
+            a = 1
+            if 0:
+                b = 2
+            return a + b
+        self.assertInBytecode(f, 'LOAD_FAST__LOAD_FAST', 'a')
+        try:
+            f()
+        except UnboundLocalError as exc:
+            self.assertIn("'b'", str(exc))
+            tb = exc.__traceback__
+        else:
+            self.fail("UnboundLocalError not raised")
+        # The error is reported at the second LOAD_FAST.
+        instrs = list(dis.get_instructions(f))
+        while tb.tb_next is not None:
+            tb = tb.tb_next
+        offsets = [i.offset for i in instrs if i.argval == 'b'
+                   and i.opname == 'LOAD_FAST']
+        self.assertEqual(offsets, [tb.tb_lasti])
+
+    def test_superinstruction_tracing(self):
+        # Under tracing, both halves of a pair are reported separately.
+        def f(a, b):
+            return a + b
+        offsets = []
+        def tracer(frame, event, arg):
+            if frame.f_code is f.__code__:
+                frame.f_trace_opcodes = True
+                if event == 'opcode':
+                    offsets.append(frame.f_lasti)
+            return tracer
+        old = sys.gettrace()
+        sys.settrace(tracer)
+        try:
+            self.assertEqual(f(1, 2), 3)
+        finally:
+            sys.settrace(old)
+        self.assertEqual(offsets,
+                         [i.offset for i in dis.get_instructions(f)])
+
 
 class TestBuglets(unittest.TestCase):
 
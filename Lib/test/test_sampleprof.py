@@ -0,0 +1,171 @@
+import io
+import os
+import textwrap
+import threading
+import time
+import unittest
+from test import support
+from test.support.script_helper import assert_python_ok
+
+sampleprof = support.import_module('sampleprof')
+
+
+def busy_loop(duration):
+    deadline = time.monotonic() + duration
+    while time.monotonic() < deadline:
+        pass
+
+
+def spin_until(event):
+    while not event.is_set():
+        pass
+
+
+class SampleProfTests(unittest.TestCase):
+    def setUp(self):
+        sampleprof.clear_samples()
+
+    def tearDown(self):
+        sampleprof.stop()
+        sampleprof.clear_samples()
+
+    def wait_samples(self, count):
+        deadline = time.monotonic() + 30.0
+        while sampleprof.get_sample_count() < count:
+            if time.monotonic() > deadline:
+                self.fail("no sample taken")
+            busy_loop(0.001)
+
+    def test_start_stop(self):
+        self.assertFalse(sampleprof.is_running())
+        sampleprof.start(0.001)
+        self.assertTrue(sampleprof.is_running())
+        with self.assertRaises(RuntimeError):
+            sampleprof.start()
+        sampleprof.stop()
+        self.assertFalse(sampleprof.is_running())
+        # stop() can be called twice
+        sampleprof.stop()
+
+    def test_invalid_interval(self):
+        with self.assertRaises(ValueError):
+            sampleprof.start(0)
+        with self.assertRaises(ValueError):
+            sampleprof.start(-1.0)
+        with self.assertRaises(TypeError):
+            sampleprof.start("1")
+        self.assertFalse(sampleprof.is_running())
+
+    def test_samples(self):
+        sampleprof.start(0.001)
+        self.wait_samples(5)
+        sampleprof.stop()
+
+        samples = sampleprof.get_samples()
+        self.assertEqual(sum(samples.values()),
+                         sampleprof.get_sample_count())
+        names = [[code.co_name for code in stack] for stack in samples]
+        self.assertTrue(any(stack[-2:] == ['wait_samples', 'busy_loop']
+                            for stack in names), names)
+
+        # samples are kept after stop(), but no new one is added
+        count = sampleprof.get_sample_count()
+        busy_loop(0.05)
+        self.assertEqual(sampleprof.get_sample_count(), count)
+
+        sampleprof.clear_samples()
+        self.assertEqual(sampleprof.get_samples(), {})
+        self.assertEqual(sampleprof.get_sample_count(), 0)
+
+    def test_threads(self):
+        event = threading.Event()
+        thread = threading.Thread(target=spin_until, args=(event,))
+        thread.start()
+        try:
+            sampleprof.start(0.001)
+            self.wait_samples(10)
+            sampleprof.stop()
+        finally:
+            event.set()
+            thread.join()
+
+        names = {code.co_name
+                 for stack in sampleprof.get_samples() for code in stack}
+        self.assertIn('spin_until', names)
+
+    def test_profile(self):
+        with sampleprof.Profile(0.001) as prof:
+            self.wait_samples(5)
+        self.assertFalse(sampleprof.is_running())
+        self.assertEqual(sampleprof.get_sample_count(), 0)
+        self.assertGreaterEqual(sum(prof.samples.values()), 5)
+
+    def test_collapsed_stacks(self):
+        def f(): pass
+        def g(): pass
+        samples = {(f.__code__, g.__code__): 3, (f.__code__,): 2}
+        label_f = sampleprof.frame_label(f.__code__)
+        label_g = sampleprof.frame_label(g.__code__)
+        self.assertEqual(label_f, 'f (%s:%d)' % (__file__,
+                                                 f.__code__.co_firstlineno))
+        self.assertEqual(sampleprof.collapsed_stacks(samples),
+                         ['%s %d' % (label_f, 2),
+                          '%s;%s %d' % (label_f, label_g, 3)])
+
+        out = io.StringIO()
+        sampleprof.write_collapsed(out, samples)
+        self.assertEqual(out.getvalue(),
+                         '%s 2\n%s;%s 3\n' % (label_f, label_f, label_g))
+
+        self.addCleanup(support.unlink, support.TESTFN)
+        sampleprof.write_collapsed(support.TESTFN, samples)
+        with open(support.TESTFN, encoding='utf-8') as fp:
+            self.assertEqual(fp.read(), out.getvalue())
+
+    def test_exit_while_running(self):
+        # The sampler thread must be stopped before the interpreter is
+        # finalized, even if other threads are running
+        code = textwrap.dedent("""
+            import sampleprof, threading, time
+            sampleprof.start(0.0001)
+            def work():
+                deadline = time.monotonic() + 0.05
+                while time.monotonic() < deadline:
+                    pass
+            for i in range(4):
+                threading.Thread(target=work).start()
+        """)
+        for i in range(5):
+            assert_python_ok('-c', code)
+
+    @unittest.skipUnless(hasattr(os, 'fork'), 'need os.fork()')
+    def test_fork_while_running(self):
+        sampleprof.start(0.001)
+        pid = os.fork()
+        if pid == 0:
+            # The sampler thread only runs in the parent process
+            code = 0 if not sampleprof.is_running() else 1
+            sampleprof.stop()
+            sampleprof.start(0.001)
+            sampleprof.stop()
+            os._exit(code)
+        pid2, status = os.waitpid(pid, 0)
+        self.assertEqual(status, 0)
+        self.assertTrue(sampleprof.is_running())
+
+    def test_command_line(self):
+        self.addCleanup(support.unlink, support.TESTFN)
+        with open(support.TESTFN, 'w') as fp:
+            fp.write('import time\n'
+                     'def work():\n'
+                     '    deadline = time.monotonic() + 0.2\n'
+                     '    while time.monotonic() < deadline:\n'
+                     '        pass\n'
+                     'work()\n')
+        rc, out, err = assert_python_ok('-m', 'sampleprof', '-i', '0.001',
+                                        support.TESTFN)
+        self.assertIn(b'work (', out)
+
+
+if __name__ == "__main__":
+    unittest.main()
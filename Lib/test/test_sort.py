@@ -1,5 +1,6 @@
 from test import support
 import random
+import sys
 import unittest
 from functools import cmp_to_key
 
@@ -373,6 +374,111 @@ class TestOptimizedCompares(unittest.TestCase):
         check_against_PyObject_RichCompareBool(self, [float('nan')]*100)
         check_against_PyObject_RichCompareBool(self, [float('nan') for
                                                       _ in range(100)])
+
+class TestRadixSort(unittest.TestCase):
+    # Large random lists of ints of up to 63 bits and of floats are sorted by
+    # a radix sort.  Compare with the sort of the same keys in 1-tuples.
+    size = 5000
+
+    def check(self, data):
+        for reverse in False, True:
+            expected = sorted(range(len(data)), key=lambda i: (data[i],),
+                              reverse=reverse)
+            self.assertEqual(sorted(range(len(data)), key=data.__getitem__,
+                                    reverse=reverse),
+                             expected)
+            self.assertEqual(sorted(data, reverse=reverse),
+                             [data[i] for i in expected])
+
+    def test_ints(self):
+        for bits in (8, 30, 31, 60, 61, 63):
+            self.check([random.randrange(-2**bits + 1, 2**bits)
+                        for _ in range(self.size)])
+        self.check([random.choice([-2**63 + 1, 2**63 - 1, -2**62, 2**62,
+                                   -2**30, 2**30, -1, 0, 1])
+                    for _ in range(self.size)])
+        self.check([random.randrange(10) for _ in range(self.size)])
+        # Too large for the radix sort
+        self.check([random.randrange(2**64) for _ in range(self.size)])
+        self.check([random.randrange(-2**63, 0) for _ in range(self.size)])
+
+    def test_floats(self):
+        self.check([random.random() - 0.5 for _ in range(self.size)])
+        self.check([random.uniform(-1e300, 1e300) for _ in range(self.size)])
+        specials = [0.0, -0.0, 1.5, -1.5, 5e-324, -5e-324, 1e308, -1e308,
+                    float('inf'), float('-inf')]
+        self.check([random.choice(specials) for _ in range(self.size)])
+
+    def test_nan(self):
+        data = [random.random() for _ in range(self.size)]
+        data[self.size // 2] = float('nan')
+        result = sorted(data)
+        self.assertEqual(len(result), self.size)
+        self.assertTrue(any(x != x for x in result))
+
+    def test_partly_sorted(self):
+        # Timsort is used, with the same result
+        data = list(range(self.size))
+        data[100], data[200] = data[200], data[100]
+        self.check(data)
+        self.check([float(x) for x in data])
+
+
+class TestParallelSort(unittest.TestCase):
+    # Enough items for 3 threads: one of the slices is left out of the
+    # first round of merges.
+    size = 300001
+
+    def setUp(self):
+        self.addCleanup(sys._set_sort_threads, sys._get_sort_threads())
+
+    def check(self, data, **kwargs):
+        sys._set_sort_threads(1)
+        expected = sorted(data, **kwargs)
+        for n in (2, 3, 4):
+            sys._set_sort_threads(n)
+            self.assertEqual(sorted(data, **kwargs), expected)
+
+    def runs(self, data):
+        # Random ints and floats are sorted by the radix sort: give them
+        # sorted runs of 100 items, which are sorted by timsort.
+        return [x for i in range(0, len(data), 100)
+                for x in sorted(data[i:i+100])]
+
+    def test_set_sort_threads(self):
+        sys._set_sort_threads(4)
+        self.assertEqual(sys._get_sort_threads(), 4)
+        self.assertRaises(ValueError, sys._set_sort_threads, 0)
+        self.assertRaises(TypeError, sys._set_sort_threads, 2.0)
+        self.assertEqual(sys._get_sort_threads(), 4)
+
+    def test_ints(self):
+        self.check(self.runs([random.randrange(-2**29, 2**29)
+                              for _ in range(self.size)]))
+        self.check(list(range(self.size)))
+        self.check(list(range(self.size)), reverse=True)
+
+    def test_floats(self):
+        self.check(self.runs([random.random() for _ in range(self.size)]))
+
+    def test_strings(self):
+        self.check([str(random.random()) for _ in range(self.size)])
+
+    def test_stability(self):
+        keys = [str(random.randrange(100)) for _ in range(self.size)]
+        for reverse in False, True:
+            sys._set_sort_threads(4)
+            result = sorted(range(self.size), key=keys.__getitem__,
+                            reverse=reverse)
+            # Items of equal keys keep their order, reversed or not
+            for i, j in zip(result, result[1:]):
+                if keys[i] == keys[j]:
+                    self.assertLess(i, j)
+
+    def test_other_types(self):
+        # These are sorted by the calling thread alone
+        self.check([(random.random(),) for _ in range(self.size)])
+        self.check([random.random() for _ in range(self.size)] + [1])
 #==============================================================================
 
 if __name__ == "__main__":
@@ -11,6 +11,7 @@ import gc
 import sysconfig
 import locale
 import threading
+import time
 
 # count the number of test runs, used to create unique
 # strings to intern in test_intern()
@@ -184,6 +185,178 @@ class SysModuleTest(unittest.TestCase):
         finally:
             sys.setswitchinterval(orig)
 
+    @test.support.cpython_only
+    def test_gil_io_priority(self):
+        self.assertRaises(TypeError, sys._set_gil_io_priority)
+        orig = sys._get_gil_io_priority()
+        self.assertFalse(orig)
+        try:
+            sys._set_gil_io_priority(True)
+            self.assertIs(sys._get_gil_io_priority(), True)
+            self.run_gil_contention()
+            sys._set_gil_io_priority(0)
+            self.assertIs(sys._get_gil_io_priority(), False)
+        finally:
+            sys._set_gil_io_priority(orig)
+
+    @test.support.cpython_only
+    @test.support.reap_threads
+    def test_gil_io_priority_latency(self):
+        # With a long switch interval, a thread coming back from sleep()
+        # only has to wait for the CPU-bound thread without the priority.
+        interval = sys.getswitchinterval()
+        orig = sys._get_gil_io_priority()
+        try:
+            sys.setswitchinterval(0.1)
+            sys._set_gil_io_priority(True)
+            elapsed = self.run_gil_contention(10)
+        finally:
+            sys._set_gil_io_priority(orig)
+            sys.setswitchinterval(interval)
+        self.assertLess(elapsed, 0.5)
+
+    def run_gil_contention(self, n=20):
+        # A CPU-bound thread and an I/O-bound one compete for the GIL.
+        # Return the time taken by the n sleeps of the I/O-bound thread.
+        done = threading.Event()
+        elapsed = []
+        def cpu_bound():
+            while not done.is_set():
+                sum(range(100))
+        def io_bound():
+            start = time.monotonic()
+            for i in range(n):
+                time.sleep(0.001)
+            elapsed.append(time.monotonic() - start)
+            done.set()
+        threads = [threading.Thread(target=io_bound),
+                   threading.Thread(target=cpu_bound)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        return elapsed[0]
+
+    @test.support.cpython_only
+    @test.support.reap_threads
+    def test_gil_stats(self):
+        stats = sys._gil_stats()
+        self.assertIsInstance(stats, dict)
+        main = stats[threading.get_ident()]
+        keys = {'wait_time', 'handoffs'}
+        if sysconfig.get_config_var('Py_GIL_STATS'):
+            keys |= {'hold_time', 'acquisitions', 'forced_drops'}
+        self.assertEqual(set(main), keys)
+        self.assertGreaterEqual(main['wait_time'], 0.0)
+        if sysconfig.get_config_var('Py_GIL_STATS'):
+            self.assertGreater(main['hold_time'], 0.0)
+
+        thread_stats = {}
+        def get_stats():
+            self.run_gil_contention()
+            thread_stats.update(sys._gil_stats()[threading.get_ident()])
+        t = threading.Thread(target=get_stats)
+        t.start()
+        t.join()
+        self.assertGreater(thread_stats['handoffs'], 0)
+        after = sys._gil_stats()[threading.get_ident()]
+        self.assertGreater(after['handoffs'], main['handoffs'])
+        self.assertGreaterEqual(after['wait_time'], main['wait_time'])
+        if sysconfig.get_config_var('Py_GIL_STATS'):
+            self.assertGreaterEqual(thread_stats['acquisitions'],
+                                    thread_stats['handoffs'])
+            self.assertGreater(after['acquisitions'], main['acquisitions'])
+            # The main thread is blocked in join(), so it can't be forced
+            # to drop the GIL by then.
+            self.assertGreaterEqual(after['forced_drops'],
+                                    main['forced_drops'])
+
+    def profile_opcodes(self, func, *args):
+        sys._clear_opcode_profile()
+        self.addCleanup(sys._clear_opcode_profile)
+        sys._set_opcode_profiling(True)
+        try:
+            func(*args)
+        finally:
+            sys._set_opcode_profiling(False)
+        code = func.__code__
+        label = (code.co_filename, code.co_firstlineno, code.co_name)
+        return [item[3:] for item in sys._opcode_profile()
+                if item[:3] == label]
+
+    @test.support.cpython_only
+    def test_opcode_profiling(self):
+        import opcode
+        self.assertRaises(TypeError, sys._set_opcode_profiling)
+        self.assertIs(sys._get_opcode_profiling(), False)
+
+        def loop(n):
+            total = 0
+            for i in range(n):
+                total += i
+            return total
+        profile = self.profile_opcodes(loop, 100)
+        self.assertIs(sys._get_opcode_profiling(), False)
+        self.assertEqual(len(profile), 1)
+        counts, pairs = profile[0]
+        named_counts = {opcode.opname[op]: count
+                        for op, count in counts.items()}
+        self.assertEqual(named_counts['FOR_ITER'], 101)
+        self.assertEqual(named_counts['INPLACE_ADD'], 100)
+        self.assertEqual(named_counts['RETURN_VALUE'], 1)
+        named_pairs = {(opcode.opname[op1], opcode.opname[op2]): count
+                       for (op1, op2), count in pairs.items()}
+        self.assertEqual(named_pairs['FOR_ITER', 'STORE_FAST'], 100)
+        self.assertEqual(named_pairs['JUMP_ABSOLUTE', 'FOR_ITER'], 100)
+        # Each instruction but the first one of the frame follows another
+        self.assertEqual(sum(pairs.values()), sum(counts.values()) - 1)
+
+        # Nothing is counted while profiling is disabled
+        before = sys._opcode_profile()
+        loop(100)
+        self.assertEqual(sys._opcode_profile(), before)
+        sys._clear_opcode_profile()
+        self.assertEqual(sys._opcode_profile(), [])
+
+    @test.support.cpython_only
+    def test_opcode_profile_outlives_code(self):
+        ns = {}
+        exec("def temp(n):\n    return n + 1\n", ns)
+        code = ns['temp'].__code__
+        label = (code.co_filename, code.co_firstlineno, code.co_name)
+        self.profile_opcodes(ns['temp'], 1)
+        del ns, code
+        gc.collect()
+        profile = [item for item in sys._opcode_profile()
+                   if item[:3] == label]
+        self.assertEqual(len(profile), 1)
+        self.assertEqual(sum(profile[0][3].values()), 4)
+
+    @test.support.cpython_only
+    def test_opcode_profile_cleared_while_read(self):
+        # Reading the profiles allocates objects, which can trigger a
+        # collection whose callbacks clear the profiles
+        ns = {}
+        for i in range(20):
+            exec("def f%d():\n    return %d\n" % (i, i), ns)
+        self.addCleanup(sys._clear_opcode_profile)
+        sys._set_opcode_profiling(True)
+        try:
+            for i in range(20):
+                ns['f%d' % i]()
+        finally:
+            sys._set_opcode_profiling(False)
+
+        def clear(phase, info):
+            sys._clear_opcode_profile()
+        gc.callbacks.append(clear)
+        self.addCleanup(gc.callbacks.remove, clear)
+        self.addCleanup(gc.set_threshold, *gc.get_threshold())
+        gc.set_threshold(1)
+        profile = sys._opcode_profile()
+        names = {item[2] for item in profile}
+        self.assertLessEqual({'f%d' % i for i in range(20)}, names)
+
     def test_recursionlimit(self):
         self.assertRaises(TypeError, sys.getrecursionlimit, 42)
         oldlimit = sys.getrecursionlimit()
@@ -750,6 +923,9 @@ class SysModuleTest(unittest.TestCase):
         args = ['-c', 'import sys; sys._debugmallocstats()']
         ret, out, err = assert_python_ok(*args)
         self.assertIn(b"free PyDictObjects", err)
+        if sysconfig.get_config_var('WITH_PYMALLOC_THREAD_CACHE'):
+            self.assertIn(b"# thread cache hits", err)
+            self.assertIn(b"# bytes in thread caches", err)
 
         # The function has no parameter
         self.assertRaises(TypeError, sys._debugmallocstats, True)
@@ -954,7 +1130,7 @@ class SizeofTest(unittest.TestCase):
         # complex
         check(complex(0,1), size('2d'))
         # method_descriptor (descriptor object)
-        check(str.lower, size('3PP'))
+        check(str.lower, size('3P2P'))
         # classmethod_descriptor (descriptor object)
         # XXX
         # member_descriptor (descriptor object)
@@ -968,8 +1144,12 @@ class SizeofTest(unittest.TestCase):
         # method-wrapper (descriptor object)
         check({}.__iter__, size('2P'))
         # dict
-        check({}, size('nQ2P') + calcsize('2nP2n') + 8 + (8*2//3)*calcsize('n2P'))
-        longdict = {1:1, 2:2, 3:3, 4:4, 5:5, 6:6, 7:7, 8:8}
+        # small dicts are compact: no indices and all entries are usable
+        check({}, size('nQ2P') + calcsize('2nP2n') + 5*calcsize('n2P'))
+        check({1:1}, size('nQ2P') + calcsize('2nP2n') + calcsize('n2P'))
+        smalldict = {1:1, 2:2, 3:3, 4:4, 5:5, 6:6, 7:7, 8:8}
+        check(smalldict, size('nQ2P') + calcsize('2nP2n') + 8*calcsize('n2P'))
+        longdict = {1:1, 2:2, 3:3, 4:4, 5:5, 6:6, 7:7, 8:8, 9:9}
         check(longdict, size('nQ2P') + calcsize('2nP2n') + 16 + (16*2//3)*calcsize('n2P'))
         # dictionary-keyview
         check({}.keys(), size('P'))
@@ -1116,7 +1296,7 @@ class SizeofTest(unittest.TestCase):
         check((1,2,3), vsize('') + 3*self.P)
         # type
         # static type: PyTypeObject
-        fmt = 'P2n15Pl4Pn9Pn11PIP'
+        fmt = 'P2nPn13Pl4Pn9Pn11PIPP'
         if hasattr(sys, 'getcounts'):
             fmt += '3n2P'
         s = vsize(fmt)
@@ -1128,14 +1308,19 @@ class SizeofTest(unittest.TestCase):
                   '3P'                  # PyMappingMethods
                   '10P'                 # PySequenceMethods
                   '2P'                  # PyBufferProcs
-                  '4P')
+                  '5P')
         class newstyleclass(object): pass
-        # Separate block for PyDictKeysObject with 8 keys and 5 entries
-        check(newstyleclass, s + calcsize("2nP2n0P") + 8 + 5*calcsize("n2P"))
+        # Separate block for compact PyDictKeysObject with 5 entries
+        check(newstyleclass, s + calcsize("2nP2n0P") + 5*calcsize("n2P"))
         # dict with shared keys
         check(newstyleclass().__dict__, size('nQ2P') + 5*self.P)
         o = newstyleclass()
         o.a = o.b = o.c = o.d = o.e = o.f = o.g = o.h = 1
+        # Separate block for compact PyDictKeysObject with 8 entries
+        check(newstyleclass, s + calcsize("2nP2n0P") + 8*calcsize("n2P"))
+        # dict with shared keys
+        check(newstyleclass().__dict__, size('nQ2P') + 8*self.P)
+        o.i = 1
         # Separate block for PyDictKeysObject with 16 keys and 10 entries
         check(newstyleclass, s + calcsize("2nP2n0P") + 16 + 10*calcsize("n2P"))
         # dict with shared keys
@@ -1193,7 +1378,7 @@ class SizeofTest(unittest.TestCase):
         check(BA(), bytearray(), '3P')
         class D(dict):
             __slots__ = 'a', 'b', 'c'
-        check(D(x=[]), {'x': []}, '3P')
+        check(D(x=[]), dict(x=[]), '3P')
         class L(list):
             __slots__ = 'a', 'b', 'c'
         check(L(), [], '3P')
@@ -0,0 +1,71 @@
+"""Tests for the opcode_profile script in the Tools directory."""
+
+import io
+import os
+import sys
+import unittest
+from test import support
+from test.support.script_helper import assert_python_ok
+
+from test.test_tools import scriptsdir, import_tool, skip_if_missing
+
+skip_if_missing()
+
+def loop(n):
+    total = 0
+    for i in range(n):
+        total += i
+    return total
+
+
+@support.cpython_only
+class OpcodeProfileTests(unittest.TestCase):
+    script = os.path.join(scriptsdir, 'opcode_profile.py')
+
+    def setUp(self):
+        self.opcode_profile = import_tool('opcode_profile')
+        sys._clear_opcode_profile()
+        self.addCleanup(sys._clear_opcode_profile)
+
+    def test_collect(self):
+        sys._set_opcode_profiling(True)
+        try:
+            loop(10)
+            loop(20)
+        finally:
+            sys._set_opcode_profiling(False)
+        profile = self.opcode_profile.collect()
+
+        code = loop.__code__
+        label = (code.co_filename, code.co_firstlineno, code.co_name)
+        self.assertIn(label, profile)
+        hot = self.opcode_profile.hot_code(profile, 1)
+        self.assertEqual(hot[0][1], label)
+        counts, pairs = profile[label]
+        self.assertEqual(hot[0][0], sum(counts.values()))
+
+        pairs = dict(self.opcode_profile.hot_pairs(profile))
+        self.assertEqual(pairs['FOR_ITER', 'STORE_FAST'], 30)
+
+        out = io.StringIO()
+        self.opcode_profile.report(profile, 5, out)
+        self.assertIn('loop', out.getvalue())
+        self.assertIn('FOR_ITER STORE_FAST', out.getvalue())
+
+    def test_script(self):
+        self.addCleanup(support.unlink, support.TESTFN)
+        with open(support.TESTFN, 'w') as fp:
+            fp.write('def work():\n'
+                     '    for i in range(1000):\n'
+                     '        pass\n'
+                     'work()\n')
+        rc, out, err = assert_python_ok(self.script, '-n', '3',
+                                        support.TESTFN)
+        lines = out.decode().splitlines()
+        self.assertIn('Hot code objects:', lines)
+        self.assertIn('Hot pairs:', lines)
+        self.assertTrue(lines[3].endswith(':1(work)'), lines)
+
+
+if __name__ == '__main__':
+    unittest.main()
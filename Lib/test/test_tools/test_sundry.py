@@ -19,7 +19,8 @@ class TestSundryScripts(unittest.TestCase):
     # added for a script it should be added to the whitelist below.
 
     # scripts that have independent tests.
-    whitelist = ['reindent', 'pdeps', 'gprof2html', 'md5sum']
+    whitelist = ['reindent', 'pdeps', 'gprof2html', 'md5sum',
+                 'opcode_profile']
     # scripts that can't be imported without running
     blacklist = ['make_ctype']
     # scripts that use windows-only modules
@@ -41,11 +42,12 @@ class TestSundryScripts(unittest.TestCase):
             import_tool(name)
 
     def test_analyze_dxp_import(self):
-        if hasattr(sys, 'getdxp'):
-            import_tool('analyze_dxp')
-        else:
-            with self.assertRaises(RuntimeError):
-                import_tool('analyze_dxp')
+        # Importing analyze_dxp enables opcode profiling
+        self.addCleanup(sys._clear_opcode_profile)
+        self.addCleanup(sys._set_opcode_profiling,
+                        sys._get_opcode_profiling())
+        import_tool('analyze_dxp')
+        self.assertTrue(sys._get_opcode_profiling())
 
 
 if __name__ == '__main__':
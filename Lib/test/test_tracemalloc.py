@@ -146,9 +146,10 @@ class TestTracemallocEnabled(unittest.TestCase):
         trace = self.find_trace(traces, obj_traceback)
 
         self.assertIsInstance(trace, tuple)
-        domain, size, traceback = trace
+        domain, size, traceback, type = trace
         self.assertEqual(size, obj_size)
         self.assertEqual(traceback, obj_traceback._frames)
+        self.assertEqual(type, 'bytes')
 
         tracemalloc.stop()
         self.assertEqual(tracemalloc._get_traces(), [])
@@ -176,9 +177,56 @@ class TestTracemallocEnabled(unittest.TestCase):
 
         trace1 = self.find_trace(traces, obj1_traceback)
         trace2 = self.find_trace(traces, obj2_traceback)
-        domain1, size1, traceback1 = trace1
-        domain2, size2, traceback2 = trace2
+        domain1, size1, traceback1, type1 = trace1
+        domain2, size2, traceback2, type2 = trace2
         self.assertIs(traceback2, traceback1)
+        self.assertIs(type2, type1)
+
+    def test_get_traces_type(self):
+        class Point:
+            pass
+
+        tracemalloc.clear_traces()
+        points = [Point() for i in range(1000)]
+        snapshot = tracemalloc.take_snapshot()
+        types = [trace.type for trace in snapshot.traces]
+        name = __name__ + '.' + Point.__qualname__
+        self.assertGreaterEqual(types.count(name), 1000)
+
+        stats = {stat.type: stat for stat in snapshot.statistics('type')}
+        self.assertGreaterEqual(stats[name].count, 1000)
+        self.assertIsNone(stats[name].traceback)
+        self.assertIn(None, stats)
+
+    def test_sampling(self):
+        self.assertEqual(tracemalloc.get_sampling_interval(), 0)
+        tracemalloc.stop()
+        self.assertRaises(ValueError, tracemalloc.start,
+                          sampling_interval=-1)
+
+        interval = 64 * 1024
+        tracemalloc.start(sampling_interval=interval)
+        self.assertEqual(tracemalloc.get_sampling_interval(), interval)
+
+        # The sizes of the sampled traces estimate the memory usage
+        obj_size = 1000
+        total = 10 * 1024 * 1024
+        data = [allocate_bytes(obj_size)[0]
+                for i in range(total // obj_size)]
+        size = tracemalloc.get_traced_memory()[0]
+        self.assertGreater(size, total // 2)
+        self.assertLess(size, total * 2)
+
+        snapshot = tracemalloc.take_snapshot()
+        self.assertEqual(snapshot.sampling_interval, interval)
+        self.assertLess(len(snapshot.traces), total // obj_size // 10)
+        stats = {stat.type: stat for stat in snapshot.statistics('type')}
+        self.assertGreater(stats['bytes'].size, total // 2)
+        self.assertLess(stats['bytes'].size, total * 2)
+
+        tracemalloc.stop()
+        tracemalloc.start()
+        self.assertEqual(tracemalloc.get_sampling_interval(), 0)
 
     def test_get_traced_memory(self):
         # Python allocates some internals objects, so the test must tolerate
@@ -537,6 +585,42 @@ class TestSnapshot(unittest.TestCase):
             tracemalloc.Statistic(tb_a_5, 2, 1),
         ])
 
+    def test_snapshot_group_by_type(self):
+        raw_traces = [
+            (0, 10, (('a.py', 2),), 'dict'),
+            (0, 20, (('a.py', 3),), 'dict'),
+            (0, 5, (('b.py', 1),), 'str'),
+            (0, 7, (('b.py', 1),), None),
+            (0, 2, (('b.py', 1),)),
+        ]
+        snapshot = tracemalloc.Snapshot(raw_traces, 1)
+        stats = snapshot.statistics('type')
+        self.assertEqual(stats, [
+            tracemalloc.Statistic(None, 30, 2, 'dict'),
+            tracemalloc.Statistic(None, 9, 2, None),
+            tracemalloc.Statistic(None, 5, 1, 'str'),
+        ])
+        self.assertEqual(snapshot.traces[0].type, 'dict')
+        self.assertIsNone(snapshot.traces[4].type)
+        self.assertEqual(str(stats[0]),
+                         'dict: size=30 B, count=2, average=15 B')
+        self.assertEqual(str(stats[1]),
+                         '<unknown>: size=9 B, count=2, average=4 B')
+        self.assertRaises(ValueError, snapshot.statistics, 'type', True)
+
+        raw_traces2 = raw_traces[1:] + [(0, 100, (('c.py', 1),), 'list')]
+        snapshot2 = tracemalloc.Snapshot(raw_traces2, 1)
+        stats = snapshot2.compare_to(snapshot, 'type')
+        self.assertEqual(stats, [
+            tracemalloc.StatisticDiff(None, 100, 100, 1, 1, 'list'),
+            tracemalloc.StatisticDiff(None, 20, -10, 1, -1, 'dict'),
+            tracemalloc.StatisticDiff(None, 9, 0, 2, 0, None),
+            tracemalloc.StatisticDiff(None, 5, 0, 1, 0, 'str'),
+        ])
+        self.assertEqual(str(stats[1]),
+                         'dict: size=20 B (-10 B), count=1 (-1), '
+                         'average=20 B')
+
     def test_trace_format(self):
         snapshot, snapshot2 = create_snapshots()
         trace = snapshot.traces[0]
@@ -27,29 +27,41 @@ def _format_size(size, sign):
         size /= 1024
 
 
+def _format_type(type):
+    if type is None:
+        return '<unknown>'
+    return type
+
+
 class Statistic:
     """
     Statistic difference on memory allocations between two Snapshot instance.
     """
 
-    __slots__ = ('traceback', 'size', 'count')
+    __slots__ = ('traceback', 'size', 'count', 'type')
 
-    def __init__(self, traceback, size, count):
+    def __init__(self, traceback, size, count, type=None):
         self.traceback = traceback
         self.size = size
         self.count = count
+        self.type = type
 
     def __hash__(self):
-        return hash((self.traceback, self.size, self.count))
+        return hash((self.traceback, self.size, self.count, self.type))
 
     def __eq__(self, other):
         return (self.traceback == other.traceback
                 and self.size == other.size
-                and self.count == other.count)
+                and self.count == other.count
+                and self.type == other.type)
 
     def __str__(self):
+        if self.traceback is not None:
+            key = self.traceback
+        else:
+            key = _format_type(self.type)
         text = ("%s: size=%s, count=%i"
-                 % (self.traceback,
+                 % (key,
                     _format_size(self.size, False),
                     self.count))
         if self.count:
@@ -58,11 +70,14 @@ class Statistic:
         return text
 
     def __repr__(self):
+        if self.traceback is None:
+            return ('<Statistic type=%r size=%i count=%i>'
+                    % (self.type, self.size, self.count))
         return ('<Statistic traceback=%r size=%i count=%i>'
                 % (self.traceback, self.size, self.count))
 
     def _sort_key(self):
-        return (self.size, self.count, self.traceback)
+        return (self.size, self.count, self.traceback, self.type or '')
 
 
 class StatisticDiff:
@@ -70,29 +85,37 @@ class StatisticDiff:
     Statistic difference on memory allocations between an old and a new
     Snapshot instance.
     """
-    __slots__ = ('traceback', 'size', 'size_diff', 'count', 'count_diff')
+    __slots__ = ('traceback', 'size', 'size_diff', 'count', 'count_diff',
+                 'type')
 
-    def __init__(self, traceback, size, size_diff, count, count_diff):
+    def __init__(self, traceback, size, size_diff, count, count_diff,
+                 type=None):
         self.traceback = traceback
         self.size = size
         self.size_diff = size_diff
         self.count = count
         self.count_diff = count_diff
+        self.type = type
 
     def __hash__(self):
         return hash((self.traceback, self.size, self.size_diff,
-                     self.count, self.count_diff))
+                     self.count, self.count_diff, self.type))
 
     def __eq__(self, other):
         return (self.traceback == other.traceback
                 and self.size == other.size
                 and self.size_diff == other.size_diff
                 and self.count == other.count
-                and self.count_diff == other.count_diff)
+                and self.count_diff == other.count_diff
+                and self.type == other.type)
 
     def __str__(self):
+        if self.traceback is not None:
+            key = self.traceback
+        else:
+            key = _format_type(self.type)
         text = ("%s: size=%s (%s), count=%i (%+i)"
-                % (self.traceback,
+                % (key,
                    _format_size(self.size, False),
                    _format_size(self.size_diff, True),
                    self.count,
@@ -103,6 +126,10 @@ class StatisticDiff:
         return text
 
     def __repr__(self):
+        if self.traceback is None:
+            return ('<StatisticDiff type=%r size=%i (%+i) count=%i (%+i)>'
+                    % (self.type, self.size, self.size_diff,
+                       self.count, self.count_diff))
         return ('<StatisticDiff traceback=%r size=%i (%+i) count=%i (%+i)>'
                 % (self.traceback, self.size, self.size_diff,
                    self.count, self.count_diff))
@@ -110,25 +137,28 @@ class StatisticDiff:
     def _sort_key(self):
         return (abs(self.size_diff), self.size,
                 abs(self.count_diff), self.count,
-                self.traceback)
+                self.traceback, self.type or '')
 
 
 def _compare_grouped_stats(old_group, new_group):
     statistics = []
-    for traceback, stat in new_group.items():
-        previous = old_group.pop(traceback, None)
+    for key, stat in new_group.items():
+        previous = old_group.pop(key, None)
         if previous is not None:
-            stat = StatisticDiff(traceback,
+            stat = StatisticDiff(stat.traceback,
                                  stat.size, stat.size - previous.size,
-                                 stat.count, stat.count - previous.count)
+                                 stat.count, stat.count - previous.count,
+                                 stat.type)
         else:
-            stat = StatisticDiff(traceback,
+            stat = StatisticDiff(stat.traceback,
                                  stat.size, stat.size,
-                                 stat.count, stat.count)
+                                 stat.count, stat.count,
+                                 stat.type)
         statistics.append(stat)
 
-    for traceback, stat in old_group.items():
-        stat = StatisticDiff(traceback, 0, -stat.size, 0, -stat.count)
+    for key, stat in old_group.items():
+        stat = StatisticDiff(stat.traceback, 0, -stat.size, 0, -stat.count,
+                             stat.type)
         statistics.append(stat)
     return statistics
 
@@ -254,8 +284,9 @@ class Trace:
     __slots__ = ("_trace",)
 
     def __init__(self, trace):
-        # trace is a tuple: (domain: int, size: int, traceback: tuple).
-        # See Traceback constructor for the format of the traceback tuple.
+        # trace is a tuple: (domain: int, size: int, traceback: tuple,
+        # type: str).  See Traceback constructor for the format of the
+        # traceback tuple.  type is optional.
         self._trace = trace
 
     @property
@@ -270,6 +301,12 @@ class Trace:
     def traceback(self):
         return Traceback(self._trace[2])
 
+    @property
+    def type(self):
+        if len(self._trace) > 3:
+            return self._trace[3]
+        return None
+
     def __eq__(self, other):
         return (self._trace == other._trace)
 
@@ -280,6 +317,10 @@ class Trace:
         return "%s: %s" % (self.traceback, _format_size(self.size, False))
 
     def __repr__(self):
+        if self.type is not None:
+            return ("<Trace domain=%s size=%s, traceback=%r, type=%s>"
+                    % (self.domain, _format_size(self.size, False),
+                       self.traceback, self.type))
         return ("<Trace domain=%s size=%s, traceback=%r>"
                 % (self.domain, _format_size(self.size, False), self.traceback))
 
@@ -362,8 +403,8 @@ class Filter(BaseFilter):
             return self._match_frame(filename, lineno)
 
     def _match(self, trace):
-        domain, size, traceback = trace
-        res = self._match_traceback(traceback)
+        domain = trace[0]
+        res = self._match_traceback(trace[2])
         if self.domain is not None:
             if self.inclusive:
                 return res and (domain == self.domain)
@@ -382,8 +423,7 @@ class DomainFilter(BaseFilter):
         return self._domain
 
     def _match(self, trace):
-        domain, size, traceback = trace
-        return (domain == self.domain) ^ (not self.inclusive)
+        return (trace[0] == self.domain) ^ (not self.inclusive)
 
 
 class Snapshot:
@@ -391,11 +431,15 @@ class Snapshot:
     Snapshot of traces of memory blocks allocated by Python.
     """
 
-    def __init__(self, traces, traceback_limit):
+    # default for the snapshots dumped by older versions
+    sampling_interval = 0
+
+    def __init__(self, traces, traceback_limit, sampling_interval=0):
         # traces is a tuple of trace tuples: see _Traces constructor for
         # the exact format
         self.traces = _Traces(traces)
         self.traceback_limit = traceback_limit
+        self.sampling_interval = sampling_interval
 
     def dump(self, filename):
         """
@@ -446,10 +490,11 @@ class Snapshot:
                                                 trace)]
         else:
             new_traces = self.traces._traces.copy()
-        return Snapshot(new_traces, self.traceback_limit)
+        return Snapshot(new_traces, self.traceback_limit,
+                        self.sampling_interval)
 
     def _group_by(self, key_type, cumulative):
-        if key_type not in ('traceback', 'filename', 'lineno'):
+        if key_type not in ('traceback', 'filename', 'lineno', 'type'):
             raise ValueError("unknown key_type: %r" % (key_type,))
         if cumulative and key_type not in ('lineno', 'filename'):
             raise ValueError("cumulative mode cannot by used "
@@ -457,9 +502,20 @@ class Snapshot:
 
         stats = {}
         tracebacks = {}
-        if not cumulative:
+        if key_type == 'type':
+            for trace in self.traces._traces:
+                size = trace[1]
+                type = trace[3] if len(trace) > 3 else None
+                try:
+                    stat = stats[type]
+                    stat.size += size
+                    stat.count += 1
+                except KeyError:
+                    stats[type] = Statistic(None, size, 1, type)
+        elif not cumulative:
             for trace in self.traces._traces:
-                domain, size, trace_traceback = trace
+                size = trace[1]
+                trace_traceback = trace[2]
                 try:
                     traceback = tracebacks[trace_traceback]
                 except KeyError:
@@ -480,7 +536,8 @@ class Snapshot:
         else:
             # cumulative statistics
             for trace in self.traces._traces:
-                domain, size, trace_traceback = trace
+                size = trace[1]
+                trace_traceback = trace[2]
                 for frame in trace_traceback:
                     try:
                         traceback = tracebacks[frame]
@@ -531,4 +588,4 @@ def take_snapshot():
                            "allocations to take a snapshot")
     traces = _get_traces()
     traceback_limit = get_traceback_limit()
-    return Snapshot(traces, traceback_limit)
+    return Snapshot(traces, traceback_limit, get_sampling_interval())
@@ -21,10 +21,15 @@ typedef struct {
     PyObject *dict;
     PyObject *weakreflist; /* List of weak references */
     int use_fastcall;
+    vectorcallfunc vectorcall;
 } partialobject;
 
 static PyTypeObject partial_type;
 
+static PyObject *
+partial_vectorcall(partialobject *pto, PyObject *const *args,
+                   size_t nargsf, PyObject *kwnames);
+
 static PyObject *
 partial_new(PyTypeObject *type, PyObject *args, PyObject *kw)
 {
@@ -108,6 +113,7 @@ partial_new(PyTypeObject *type, PyObject *args, PyObject *kw)
     }
 
     pto->use_fastcall = _PyObject_HasFastCall(func);
+    pto->vectorcall = (vectorcallfunc)partial_vectorcall;
 
     return (PyObject *)pto;
 }
@@ -233,6 +239,104 @@ partial_call(partialobject *pto, PyObject *args, PyObject *kwargs)
     return res;
 }
 
+/* Fall back to partial_call() when the partial object has keyword
+   arguments: they must be merged into a new dictionary anyway */
+static PyObject *
+partial_vectorcall_fallback(partialobject *pto, PyObject *const *args,
+                            Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *argstuple, *kwdict = NULL, *res;
+
+    argstuple = _PyStack_AsTuple(args, nargs);
+    if (argstuple == NULL) {
+        return NULL;
+    }
+    if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) > 0) {
+        kwdict = _PyStack_AsDict(args + nargs, kwnames);
+        if (kwdict == NULL) {
+            Py_DECREF(argstuple);
+            return NULL;
+        }
+    }
+    res = partial_call(pto, argstuple, kwdict);
+    Py_DECREF(argstuple);
+    Py_XDECREF(kwdict);
+    return res;
+}
+
+static PyObject *
+partial_vectorcall_impl(partialobject *pto, PyObject *const *args,
+                        size_t nargsf, PyObject *kwnames)
+{
+    PyObject *small_stack[_PY_FASTCALL_SMALL_STACK];
+    PyObject **stack;
+    PyObject *res;
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    Py_ssize_t nkwargs, total, pto_nargs;
+    PyObject **pto_args;
+
+    /* pto->kw is mutable, so check it at each call */
+    if (PyDict_GET_SIZE(pto->kw)) {
+        return partial_vectorcall_fallback(pto, args, nargs, kwnames);
+    }
+
+    pto_nargs = PyTuple_GET_SIZE(pto->args);
+    if (pto_nargs == 0) {
+        return _PyObject_Vectorcall(pto->fn, args, nargsf, kwnames);
+    }
+
+    pto_args = &PyTuple_GET_ITEM(pto->args, 0);
+    if (pto_nargs == 1) {
+        return _PyObject_Vectorcall_Prepend(pto->fn, pto_args[0],
+                                            args, nargsf, kwnames);
+    }
+
+    nkwargs = (kwnames == NULL) ? 0 : PyTuple_GET_SIZE(kwnames);
+    total = pto_nargs + nargs + nkwargs;
+    /* Reserve a leading slot for PY_VECTORCALL_ARGUMENTS_OFFSET */
+    if (total + 1 <= (Py_ssize_t)Py_ARRAY_LENGTH(small_stack)) {
+        stack = small_stack;
+    }
+    else {
+        stack = PyMem_Malloc((total + 1) * sizeof(PyObject *));
+        if (stack == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+    }
+
+    /* use borrowed references */
+    memcpy(stack + 1, pto_args, pto_nargs * sizeof(PyObject *));
+    if (nargs + nkwargs > 0) {
+        memcpy(stack + 1 + pto_nargs, args,
+               (nargs + nkwargs) * sizeof(PyObject *));
+    }
+
+    res = _PyObject_Vectorcall(pto->fn, stack + 1,
+                               (pto_nargs + nargs) |
+                               PY_VECTORCALL_ARGUMENTS_OFFSET,
+                               kwnames);
+    if (stack != small_stack) {
+        PyMem_Free(stack);
+    }
+    return res;
+}
+
+static PyObject *
+partial_vectorcall(partialobject *pto, PyObject *const *args,
+                   size_t nargsf, PyObject *kwnames)
+{
+    PyObject *res;
+
+    /* __setstate__() can make a partial object call itself */
+    if (Py_EnterRecursiveCall(" while calling a Python object")) {
+        return NULL;
+    }
+    res = partial_vectorcall_impl(pto, args, nargsf, kwnames);
+    Py_LeaveRecursiveCall();
+    return res;
+}
+
 static int
 partial_traverse(partialobject *pto, visitproc visit, void *arg)
 {
@@ -386,7 +490,7 @@ static PyTypeObject partial_type = {
     0,                                  /* tp_itemsize */
     /* methods */
     (destructor)partial_dealloc,        /* tp_dealloc */
-    0,                                  /* tp_print */
+    offsetof(partialobject, vectorcall),/* tp_vectorcall_offset */
     0,                                  /* tp_getattr */
     0,                                  /* tp_setattr */
     0,                                  /* tp_reserved */
@@ -401,7 +505,7 @@ static PyTypeObject partial_type = {
     PyObject_GenericSetAttr,            /* tp_setattro */
     0,                                  /* tp_as_buffer */
     Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
-        Py_TPFLAGS_BASETYPE,            /* tp_flags */
+        Py_TPFLAGS_BASETYPE | _Py_TPFLAGS_HAVE_VECTORCALL, /* tp_flags */
     partial_doc,                        /* tp_doc */
     (traverseproc)partial_traverse,     /* tp_traverse */
     0,                                  /* tp_clear */
@@ -0,0 +1,438 @@
+/* Statistical profiler: a thread samples the Python call stacks of all
+   threads of an interpreter at a fixed interval.
+
+   The sampler thread has a thread state of its own.  Between two samples it
+   sleeps without holding the GIL, so that a low sampling rate has a
+   negligible cost.  To take a sample it takes the GIL: the other threads of
+   the interpreter are then waiting for the GIL, and their frames can be read
+   safely. */
+
+#include "Python.h"
+#include "frameobject.h"
+#include "pythread.h"
+#include <signal.h>
+#if defined(HAVE_PTHREAD_SIGMASK) && !defined(HAVE_BROKEN_PTHREAD_SIGMASK)
+#  include <pthread.h>
+#endif
+
+#include "clinic/_sampleprof.c.h"
+
+/*[clinic input]
+module _sampleprof
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=e73f6cf49b76d7fd]*/
+
+/* Default sampling interval in microseconds */
+#define DEFAULT_INTERVAL_US 10000
+
+/* Variables protected by the GIL, except the locks */
+static struct {
+    /* Is the sampler thread running? */
+    int running;
+
+    /* interpreter of the sampled threads */
+    PyInterpreterState *interp;
+
+    /* thread state of the sampler thread */
+    PyThreadState *tstate;
+
+    /* interval between two samples in microseconds */
+    PY_TIMEOUT_T interval_us;
+
+    /* held by the thread calling start() until stop() releases it to ask
+       the sampler thread to exit */
+    PyThread_type_lock cancel_event;
+
+    /* held while the sampler thread is running */
+    PyThread_type_lock running_lock;
+
+    /* dict: tuple of code objects, outermost frame first => number of
+       samples */
+    PyObject *samples;
+
+    /* number of sampled stacks */
+    Py_ssize_t nsample;
+
+#ifdef HAVE_FORK
+    /* process in which the sampler thread runs */
+    pid_t pid;
+#endif
+} sampler = {0, NULL, NULL, DEFAULT_INTERVAL_US, NULL, NULL, NULL, 0};
+
+
+/* Add the stack of frame to the samples */
+static int
+sampler_add_stack(PyFrameObject *frame)
+{
+    PyFrameObject *f;
+    Py_ssize_t depth, i;
+    PyObject *stack, *count;
+    int res;
+
+    depth = 0;
+    for (f = frame; f != NULL; f = f->f_back)
+        depth++;
+
+    stack = PyTuple_New(depth);
+    if (stack == NULL)
+        return -1;
+    i = depth;
+    for (f = frame; f != NULL; f = f->f_back) {
+        i--;
+        Py_INCREF(f->f_code);
+        PyTuple_SET_ITEM(stack, i, (PyObject *)f->f_code);
+    }
+
+    count = PyDict_GetItemWithError(sampler.samples, stack);
+    if (count != NULL) {
+        Py_ssize_t n = PyLong_AsSsize_t(count);
+        if (n == -1 && PyErr_Occurred()) {
+            Py_DECREF(stack);
+            return -1;
+        }
+        count = PyLong_FromSsize_t(n + 1);
+    }
+    else if (!PyErr_Occurred()) {
+        count = PyLong_FromLong(1);
+    }
+    if (count == NULL) {
+        Py_DECREF(stack);
+        return -1;
+    }
+
+    res = PyDict_SetItem(sampler.samples, stack, count);
+    Py_DECREF(stack);
+    Py_DECREF(count);
+    return res;
+}
+
+
+/* Sample the stacks of the threads of the interpreter: called by the sampler
+   thread with the GIL held */
+static void
+sampler_take_sample(void)
+{
+    PyObject *frames;
+    Py_ssize_t i;
+
+    frames = _PyInterpreterState_GetFrames(sampler.interp);
+    if (frames == NULL)
+        goto error;
+
+    for (i = 0; i < PyList_GET_SIZE(frames); i++) {
+        PyFrameObject *frame = (PyFrameObject *)PyList_GET_ITEM(frames, i);
+        if (sampler_add_stack(frame) < 0) {
+            Py_DECREF(frames);
+            goto error;
+        }
+        sampler.nsample++;
+    }
+    Py_DECREF(frames);
+    return;
+
+error:
+    /* There is nobody to report the error to: lose the sample */
+    PyErr_Clear();
+}
+
+
+static void
+sampler_thread(void *unused)
+{
+    PyThreadState *tstate = sampler.tstate;
+    PyLockStatus st;
+#if defined(HAVE_PTHREAD_SIGMASK) && !defined(HAVE_BROKEN_PTHREAD_SIGMASK)
+    sigset_t set;
+
+    /* we don't want to receive any signal, except the fatal errors which
+       must reach faulthandler if this thread crashes */
+    sigfillset(&set);
+    sigdelset(&set, SIGSEGV);
+    sigdelset(&set, SIGFPE);
+    sigdelset(&set, SIGABRT);
+#ifdef SIGBUS
+    sigdelset(&set, SIGBUS);
+#endif
+#ifdef SIGILL
+    sigdelset(&set, SIGILL);
+#endif
+    pthread_sigmask(SIG_SETMASK, &set, NULL);
+#endif
+
+    tstate->thread_id = PyThread_get_thread_ident();
+    _PyThreadState_Init(tstate);
+    PyEval_AcquireThread(tstate);
+
+    for (;;) {
+        Py_BEGIN_ALLOW_THREADS
+        st = PyThread_acquire_lock_timed(sampler.cancel_event,
+                                         sampler.interval_us, 0);
+        Py_END_ALLOW_THREADS
+        if (st == PY_LOCK_ACQUIRED) {
+            PyThread_release_lock(sampler.cancel_event);
+            break;
+        }
+        /* Timeout => take a sample */
+        assert(st == PY_LOCK_FAILURE);
+        sampler_take_sample();
+    }
+
+    PyThreadState_Clear(tstate);
+    PyThreadState_DeleteCurrent();
+
+    /* The only way out */
+    PyThread_release_lock(sampler.running_lock);
+}
+
+
+/* Is the sampler thread running?  The thread doesn't survive fork(): in
+   the child process, forget it and get new locks, since the parent left
+   them acquired.  Its thread state was deleted by PyOS_AfterFork_Child(). */
+static int
+sampler_is_running(void)
+{
+#ifdef HAVE_FORK
+    if (sampler.running && sampler.pid != getpid()) {
+        sampler.running = 0;
+        sampler.tstate = NULL;
+        sampler.cancel_event = PyThread_allocate_lock();
+        sampler.running_lock = PyThread_allocate_lock();
+        if (sampler.cancel_event == NULL || sampler.running_lock == NULL) {
+            Py_FatalError("_sampleprof: failed to create new locks "
+                          "after fork");
+        }
+        PyThread_acquire_lock(sampler.cancel_event, 1);
+    }
+#endif
+    return sampler.running;
+}
+
+
+static void
+sampler_stop(void)
+{
+    if (!sampler_is_running())
+        return;
+    sampler.running = 0;
+
+    /* Notify cancellation */
+    PyThread_release_lock(sampler.cancel_event);
+
+    /* Wait for thread to join: it needs the GIL to exit */
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(sampler.running_lock, 1);
+    Py_END_ALLOW_THREADS
+    PyThread_release_lock(sampler.running_lock);
+
+    /* The thread calling start() should always hold the cancel_event lock */
+    PyThread_acquire_lock(sampler.cancel_event, 1);
+    sampler.tstate = NULL;
+}
+
+
+/*[clinic input]
+_sampleprof.start
+
+    interval as interval_obj: object(c_default="NULL") = 0.01
+
+Start sampling the Python stacks of all threads every interval seconds.
+
+Samples are added to the previous ones: see clear_samples().
+[clinic start generated code]*/
+
+static PyObject *
+_sampleprof_start_impl(PyObject *module, PyObject *interval_obj)
+/*[clinic end generated code: output=f43e93a3d599fb40 input=df5d901b4ef86b68]*/
+{
+    PY_TIMEOUT_T interval_us = DEFAULT_INTERVAL_US;
+    PyThreadState *tstate;
+
+    if (interval_obj != NULL) {
+        _PyTime_t interval, us;
+
+        if (_PyTime_FromSecondsObject(&interval, interval_obj,
+                                      _PyTime_ROUND_TIMEOUT) < 0) {
+            return NULL;
+        }
+        us = _PyTime_AsMicroseconds(interval, _PyTime_ROUND_TIMEOUT);
+        if (us <= 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "interval must be greater than 0");
+            return NULL;
+        }
+        if (us >= PY_TIMEOUT_MAX) {
+            PyErr_SetString(PyExc_OverflowError,
+                            "interval value is too large");
+            return NULL;
+        }
+        /* the downcast is safe: we check that 0 < us < PY_TIMEOUT_MAX */
+        interval_us = (PY_TIMEOUT_T)us;
+    }
+
+    if (sampler_is_running()) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "the sampling profiler is already running");
+        return NULL;
+    }
+
+    if (sampler.samples == NULL) {
+        sampler.samples = PyDict_New();
+        if (sampler.samples == NULL)
+            return NULL;
+    }
+
+    tstate = PyThreadState_GET();
+    sampler.interp = tstate->interp;
+    sampler.interval_us = interval_us;
+    sampler.tstate = _PyThreadState_Prealloc(sampler.interp);
+    if (sampler.tstate == NULL)
+        return PyErr_NoMemory();
+
+    /* Arm these locks to serve as events when released */
+    PyThread_acquire_lock(sampler.running_lock, 1);
+
+    PyEval_InitThreads();
+    if (PyThread_start_new_thread(sampler_thread, NULL)
+        == PYTHREAD_INVALID_THREAD_ID) {
+        PyThread_release_lock(sampler.running_lock);
+        PyThreadState_Clear(sampler.tstate);
+        PyThreadState_Delete(sampler.tstate);
+        sampler.tstate = NULL;
+        PyErr_SetString(PyExc_RuntimeError,
+                        "unable to start the sampler thread");
+        return NULL;
+    }
+    sampler.running = 1;
+#ifdef HAVE_FORK
+    sampler.pid = getpid();
+#endif
+
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_sampleprof.stop
+
+Stop sampling the Python stacks.
+
+Wait until the sampler thread exits.  The samples are kept.
+[clinic start generated code]*/
+
+static PyObject *
+_sampleprof_stop_impl(PyObject *module)
+/*[clinic end generated code: output=9db7d4760741412e input=853ed27d65b52668]*/
+{
+    sampler_stop();
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_sampleprof.is_running -> bool
+
+True if the Python stacks are being sampled.
+[clinic start generated code]*/
+
+static int
+_sampleprof_is_running_impl(PyObject *module)
+/*[clinic end generated code: output=0c3383639061af27 input=989297c739540c18]*/
+{
+    return sampler_is_running();
+}
+
+
+/*[clinic input]
+_sampleprof.get_samples
+
+Get the samples.
+
+Return a dictionary mapping a stack to its number of samples.  A stack is
+a tuple of code objects, from the outermost frame to the innermost one.
+[clinic start generated code]*/
+
+static PyObject *
+_sampleprof_get_samples_impl(PyObject *module)
+/*[clinic end generated code: output=a8e045e254262690 input=137edb34fbc017b7]*/
+{
+    if (sampler.samples == NULL)
+        return PyDict_New();
+    return PyDict_Copy(sampler.samples);
+}
+
+
+/*[clinic input]
+_sampleprof.get_sample_count -> Py_ssize_t
+
+Get the total number of sampled stacks.
+[clinic start generated code]*/
+
+static Py_ssize_t
+_sampleprof_get_sample_count_impl(PyObject *module)
+/*[clinic end generated code: output=6199d62bcf36807a input=5130877c7ebcf32f]*/
+{
+    return sampler.nsample;
+}
+
+
+/*[clinic input]
+_sampleprof.clear_samples
+
+Clear the samples.
+[clinic start generated code]*/
+
+static PyObject *
+_sampleprof_clear_samples_impl(PyObject *module)
+/*[clinic end generated code: output=a16f9be12b5968e3 input=e4a9771504895228]*/
+{
+    if (sampler.samples != NULL)
+        PyDict_Clear(sampler.samples);
+    sampler.nsample = 0;
+    Py_RETURN_NONE;
+}
+
+
+static PyMethodDef module_methods[] = {
+    _SAMPLEPROF_START_METHODDEF
+    _SAMPLEPROF_STOP_METHODDEF
+    _SAMPLEPROF_IS_RUNNING_METHODDEF
+    _SAMPLEPROF_GET_SAMPLES_METHODDEF
+    _SAMPLEPROF_GET_SAMPLE_COUNT_METHODDEF
+    _SAMPLEPROF_CLEAR_SAMPLES_METHODDEF
+    /* sentinel */
+    {NULL, NULL}
+};
+
+PyDoc_STRVAR(module_doc,
+"Statistical profiler sampling the Python stacks of all threads.");
+
+static struct PyModuleDef module_def = {
+    PyModuleDef_HEAD_INIT,
+    "_sampleprof",
+    module_doc,
+    0, /* non-negative size to be able to unload the module */
+    module_methods,
+    NULL,
+};
+
+PyMODINIT_FUNC
+PyInit__sampleprof(void)
+{
+    PyObject *m;
+
+    if (sampler.cancel_event == NULL) {
+        sampler.cancel_event = PyThread_allocate_lock();
+        sampler.running_lock = PyThread_allocate_lock();
+        if (sampler.cancel_event == NULL || sampler.running_lock == NULL) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "could not allocate locks");
+            return NULL;
+        }
+        PyThread_acquire_lock(sampler.cancel_event, 1);
+    }
+
+    m = PyModule_Create(&module_def);
+    if (m == NULL)
+        return NULL;
+    return m;
+}
@@ -4550,6 +4550,49 @@ new_hamt(PyObject *self, PyObject *args)
 }
 
 
+#ifdef Py_GIL_STATS
+/* Counts of the GIL events, indexed by _PyGIL_EVENT_xxx */
+static Py_ssize_t gil_stats_hook_counts[3];
+
+static void
+gil_stats_hook(PyThreadState *tstate, int event, _PyTime_t duration,
+               void *data)
+{
+    assert(data == gil_stats_hook_counts);
+    assert(duration >= 0);
+    gil_stats_hook_counts[event]++;
+}
+
+static PyObject *
+start_gil_stats_hook(PyObject *self, PyObject *args)
+{
+    if (_PyEval_GetGILStatsHook(NULL) != NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "a GIL stats hook is already set");
+        return NULL;
+    }
+    memset(gil_stats_hook_counts, 0, sizeof(gil_stats_hook_counts));
+    _PyEval_SetGILStatsHook(gil_stats_hook, gil_stats_hook_counts);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+stop_gil_stats_hook(PyObject *self, PyObject *args)
+{
+    void *data;
+    if (_PyEval_GetGILStatsHook(&data) != gil_stats_hook) {
+        PyErr_SetString(PyExc_RuntimeError, "the GIL stats hook is not set");
+        return NULL;
+    }
+    assert(data == gil_stats_hook_counts);
+    _PyEval_SetGILStatsHook(NULL, NULL);
+    return Py_BuildValue("nnn",
+                         gil_stats_hook_counts[_PyGIL_EVENT_TAKE],
+                         gil_stats_hook_counts[_PyGIL_EVENT_DROP],
+                         gil_stats_hook_counts[_PyGIL_EVENT_FORCED_DROP]);
+}
+#endif
+
+
 static PyMethodDef TestMethods[] = {
     {"raise_exception",         raise_exception,                 METH_VARARGS},
     {"raise_memoryerror",       raise_memoryerror,               METH_NOARGS},
@@ -4771,6 +4814,10 @@ static PyMethodDef TestMethods[] = {
     {"get_mapping_items", get_mapping_items, METH_O},
     {"test_pythread_tss_key_state", test_pythread_tss_key_state, METH_VARARGS},
     {"hamt", new_hamt, METH_NOARGS},
+#ifdef Py_GIL_STATS
+    {"start_gil_stats_hook", start_gil_stats_hook, METH_NOARGS},
+    {"stop_gil_stats_hook", stop_gil_stats_hook, METH_NOARGS},
+#endif
     {NULL, NULL} /* sentinel */
 };
 
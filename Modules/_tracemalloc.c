@@ -5,6 +5,10 @@
 #include "osdefs.h"
 
 #include "clinic/_tracemalloc.c.h"
+
+_Py_IDENTIFIER(__module__);
+_Py_IDENTIFIER(builtins);
+
 /*[clinic input]
 module _tracemalloc
 [clinic start generated code]*/
@@ -49,7 +53,12 @@ static struct {
     /* use domain in trace key?
        Variable protected by the GIL. */
     int use_domain;
-} tracemalloc_config = {TRACEMALLOC_NOT_INITIALIZED, 0, 1, 0};
+
+    /* mean number of bytes allocated between two sampled memory blocks,
+       0 to trace all memory blocks.
+       Variable protected by the GIL. */
+    size_t sampling_interval;
+} tracemalloc_config = {TRACEMALLOC_NOT_INITIALIZED, 0, 1, 0, 0};
 
 #if defined(TRACE_RAW_MALLOC)
 /* This lock is needed because tracemalloc_free() is called without
@@ -119,6 +128,10 @@ typedef struct {
 
     /* Traceback where the memory block was allocated */
     traceback_t *traceback;
+
+    /* Name of the type of the object stored in the memory block, NULL if
+       unknown.  Borrowed reference: tracemalloc_type_names keeps it. */
+    PyObject *type_name;
 } trace_t;
 
 
@@ -148,6 +161,34 @@ static _Py_hashtable_t *tracemalloc_tracebacks = NULL;
    Protected by TABLES_LOCK(). */
 static _Py_hashtable_t *tracemalloc_traces = NULL;
 
+/* Hash table used as a set to intern type names:
+   PyObject* => PyObject*.
+   Protected by the GIL */
+static _Py_hashtable_t *tracemalloc_type_names = NULL;
+
+/* Name of a type.  The types themselves must not be kept alive by the
+   traces, so the names of heap types are only valid while their weak
+   reference is alive. */
+typedef struct {
+    /* weak reference to the type, NULL for static types */
+    PyObject *weakref;
+    /* borrowed reference: tracemalloc_type_names keeps it */
+    PyObject *name;
+} type_name_t;
+
+/* Cache of the names of the types of the traced objects:
+   PyTypeObject* => type_name_t.
+   Protected by the GIL */
+static _Py_hashtable_t *tracemalloc_types = NULL;
+
+/* Number of bytes to allocate before the next sampled memory block.
+   Protected by the GIL. */
+static size_t tracemalloc_sample_countdown = 0;
+
+/* State of the pseudo-random generator of the sampling intervals.
+   Protected by the GIL. */
+static uint64_t tracemalloc_sample_state = 0;
+
 
 #ifdef TRACE_DEBUG
 static void
@@ -633,11 +674,13 @@ tracemalloc_add_trace(unsigned int domain, uintptr_t ptr,
 
         trace.size = size;
         trace.traceback = traceback;
+        trace.type_name = NULL;
         _Py_HASHTABLE_ENTRY_WRITE_DATA(tracemalloc_traces, entry, trace);
     }
     else {
         trace.size = size;
         trace.traceback = traceback;
+        trace.type_name = NULL;
 
         if (tracemalloc_config.use_domain) {
             res = _Py_HASHTABLE_SET(tracemalloc_traces, key, trace);
@@ -661,11 +704,70 @@ tracemalloc_add_trace(unsigned int domain, uintptr_t ptr,
             tracemalloc_add_trace(DEFAULT_DOMAIN, (uintptr_t)(ptr), size)
 
 
+/* Get a pseudo-random number in the range (0; 1] (xorshift64*) */
+static double
+sample_random(void)
+{
+    uint64_t x = tracemalloc_sample_state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    tracemalloc_sample_state = x;
+    x *= UINT64_C(0x2545F4914F6CDD1D);
+    return (double)((x >> 11) + 1) / 9007199254740992.0;
+}
+
+
+/* Draw the number of bytes to allocate before the next sampled memory block.
+   It follows an exponential distribution, so that every allocated byte has
+   the same probability to be sampled whatever the size of its block: a
+   block of size bytes is sampled with the probability
+   1 - exp(-size / sampling_interval). */
+static void
+sample_reset_countdown(void)
+{
+    double bytes;
+
+    bytes = -log(sample_random()) * (double)tracemalloc_config.sampling_interval;
+    if (bytes >= (double)(SIZE_MAX - 1)) {
+        tracemalloc_sample_countdown = SIZE_MAX;
+    }
+    else {
+        tracemalloc_sample_countdown = (size_t)bytes + 1;
+    }
+}
+
+
+/* Decide if a new memory block of size bytes is sampled.  Return 0 if it is
+   not, or the size it accounts for in the traces: its size divided by its
+   probability to be sampled, so that the sums of the sizes of the traces
+   estimate the memory usage. */
+static size_t
+tracemalloc_sample(size_t size)
+{
+    double interval, estimate;
+
+    if (size < tracemalloc_sample_countdown) {
+        tracemalloc_sample_countdown -= size;
+        return 0;
+    }
+    sample_reset_countdown();
+
+    interval = (double)tracemalloc_config.sampling_interval;
+    estimate = (double)size / -expm1(-(double)size / interval);
+    if (estimate >= (double)SIZE_MAX / 2) {
+        return size;
+    }
+    return (size_t)estimate;
+}
+
+
 static void*
 tracemalloc_alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
 {
     PyMemAllocatorEx *alloc = (PyMemAllocatorEx *)ctx;
     void *ptr;
+    size_t size;
 
     assert(elsize == 0 || nelem <= SIZE_MAX / elsize);
 
@@ -676,14 +778,23 @@ tracemalloc_alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
     if (ptr == NULL)
         return NULL;
 
+    size = nelem * elsize;
+    if (tracemalloc_config.sampling_interval) {
+        size = tracemalloc_sample(size);
+        if (size == 0) {
+            return ptr;
+        }
+    }
+
     TABLES_LOCK();
-    if (ADD_TRACE(ptr, nelem * elsize) < 0) {
+    if (ADD_TRACE(ptr, size) < 0) {
         /* Failed to allocate a trace for the new memory block */
         TABLES_UNLOCK();
         alloc->free(alloc->ctx, ptr);
         return NULL;
     }
     TABLES_UNLOCK();
+    _PyTraceMalloc_NewBlock = ptr;
     return ptr;
 }
 
@@ -698,7 +809,25 @@ tracemalloc_realloc(void *ctx, void *ptr, size_t new_size)
     if (ptr2 == NULL)
         return NULL;
 
-    if (ptr != NULL) {
+    if (tracemalloc_config.sampling_interval) {
+        /* the resized memory block is sampled as a new one */
+        size_t size = tracemalloc_sample(new_size);
+
+        TABLES_LOCK();
+        if (ptr != NULL) {
+            REMOVE_TRACE(ptr);
+        }
+        if (size != 0 && ADD_TRACE(ptr2, size) < 0) {
+            /* The error cannot be reported to the caller, since the old
+               memory block may already be released: lose the sample. */
+            size = 0;
+        }
+        TABLES_UNLOCK();
+        if (size != 0) {
+            _PyTraceMalloc_NewBlock = ptr2;
+        }
+    }
+    else if (ptr != NULL) {
         /* an existing memory block has been resized */
 
         TABLES_LOCK();
@@ -722,6 +851,7 @@ tracemalloc_realloc(void *ctx, void *ptr, size_t new_size)
             Py_UNREACHABLE();
         }
         TABLES_UNLOCK();
+        _PyTraceMalloc_NewBlock = ptr2;
     }
     else {
         /* new allocation */
@@ -734,6 +864,7 @@ tracemalloc_realloc(void *ctx, void *ptr, size_t new_size)
             return NULL;
         }
         TABLES_UNLOCK();
+        _PyTraceMalloc_NewBlock = ptr2;
     }
     return ptr2;
 }
@@ -920,6 +1051,18 @@ tracemalloc_clear_filename(_Py_hashtable_t *ht, _Py_hashtable_entry_t *entry,
 }
 
 
+static int
+tracemalloc_clear_type(_Py_hashtable_t *ht, _Py_hashtable_entry_t *entry,
+                       void *user_data)
+{
+    type_name_t type_name;
+
+    _Py_HASHTABLE_ENTRY_READ_DATA(ht, entry, type_name);
+    Py_XDECREF(type_name.weakref);
+    return 0;
+}
+
+
 static int
 traceback_free_traceback(_Py_hashtable_t *ht, _Py_hashtable_entry_t *entry,
                          void *user_data)
@@ -950,6 +1093,14 @@ tracemalloc_clear_traces(void)
 
     _Py_hashtable_foreach(tracemalloc_filenames, tracemalloc_clear_filename, NULL);
     _Py_hashtable_clear(tracemalloc_filenames);
+
+    _PyTraceMalloc_NewBlock = NULL;
+    _Py_hashtable_foreach(tracemalloc_types, tracemalloc_clear_type, NULL);
+    _Py_hashtable_clear(tracemalloc_types);
+
+    _Py_hashtable_foreach(tracemalloc_type_names, tracemalloc_clear_filename,
+                          NULL);
+    _Py_hashtable_clear(tracemalloc_type_names);
 }
 
 
@@ -996,6 +1147,15 @@ tracemalloc_init(void)
                                            hashtable_hash_traceback,
                                            hashtable_compare_traceback);
 
+    tracemalloc_type_names = hashtable_new(sizeof(PyObject *), 0,
+                                           hashtable_hash_pyobject,
+                                           hashtable_compare_unicode);
+
+    tracemalloc_types = hashtable_new(sizeof(PyTypeObject *),
+                                      sizeof(type_name_t),
+                                      _Py_hashtable_hash_ptr,
+                                      _Py_hashtable_compare_direct);
+
     if (tracemalloc_config.use_domain) {
         tracemalloc_traces = hashtable_new(sizeof(pointer_t),
                                            sizeof(trace_t),
@@ -1010,7 +1170,8 @@ tracemalloc_init(void)
     }
 
     if (tracemalloc_filenames == NULL || tracemalloc_tracebacks == NULL
-       || tracemalloc_traces == NULL) {
+       || tracemalloc_traces == NULL || tracemalloc_type_names == NULL
+       || tracemalloc_types == NULL) {
         PyErr_NoMemory();
         return -1;
     }
@@ -1044,6 +1205,8 @@ tracemalloc_deinit(void)
     _Py_hashtable_destroy(tracemalloc_tracebacks);
     _Py_hashtable_destroy(tracemalloc_filenames);
     _Py_hashtable_destroy(tracemalloc_traces);
+    _Py_hashtable_destroy(tracemalloc_type_names);
+    _Py_hashtable_destroy(tracemalloc_types);
 
 #if defined(TRACE_RAW_MALLOC)
     if (tables_lock != NULL) {
@@ -1061,7 +1224,7 @@ tracemalloc_deinit(void)
 
 
 static int
-tracemalloc_start(int max_nframe)
+tracemalloc_start(int max_nframe, Py_ssize_t sampling_interval)
 {
     PyMemAllocatorEx alloc;
     size_t size;
@@ -1072,6 +1235,11 @@ tracemalloc_start(int max_nframe)
                      (int)MAX_NFRAME);
         return -1;
     }
+    if (sampling_interval < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "the sampling interval must be positive or 0");
+        return -1;
+    }
 
     if (tracemalloc_init() < 0) {
         return -1;
@@ -1085,6 +1253,16 @@ tracemalloc_start(int max_nframe)
     assert(1 <= max_nframe && max_nframe <= MAX_NFRAME);
     tracemalloc_config.max_nframe = max_nframe;
 
+    tracemalloc_config.sampling_interval = (size_t)sampling_interval;
+    if (sampling_interval) {
+        tracemalloc_sample_state = ((uint64_t)_PyTime_GetMonotonicClock()
+                                    ^ UINT64_C(0x9E3779B97F4A7C15));
+        if (tracemalloc_sample_state == 0) {
+            tracemalloc_sample_state = 1;
+        }
+        sample_reset_countdown();
+    }
+
     /* allocate a buffer to store a new traceback */
     size = TRACEBACK_SIZE(max_nframe);
     assert(tracemalloc_traceback == NULL);
@@ -1254,7 +1432,7 @@ trace_to_pyobject(unsigned int domain, trace_t *trace,
     PyObject *trace_obj = NULL;
     PyObject *obj;
 
-    trace_obj = PyTuple_New(3);
+    trace_obj = PyTuple_New(4);
     if (trace_obj == NULL)
         return NULL;
 
@@ -1279,6 +1457,10 @@ trace_to_pyobject(unsigned int domain, trace_t *trace,
     }
     PyTuple_SET_ITEM(trace_obj, 2, obj);
 
+    obj = trace->type_name != NULL ? trace->type_name : Py_None;
+    Py_INCREF(obj);
+    PyTuple_SET_ITEM(trace_obj, 3, obj);
+
     return trace_obj;
 }
 
@@ -1340,15 +1522,17 @@ _tracemalloc._get_traces
 
 Get traces of all memory blocks allocated by Python.
 
-Return a list of (size: int, traceback: tuple) tuples.
-traceback is a tuple of (filename: str, lineno: int) tuples.
+Return a list of (domain: int, size: int, traceback: tuple, type: str)
+tuples.  traceback is a tuple of (filename: str, lineno: int) tuples; type
+is the name of the type of the object stored in the memory block, or None
+if it is unknown.
 
 Return an empty list if the tracemalloc module is disabled.
 [clinic start generated code]*/
 
 static PyObject *
 _tracemalloc__get_traces_impl(PyObject *module)
-/*[clinic end generated code: output=e9929876ced4b5cc input=6c7d2230b24255aa]*/
+/*[clinic end generated code: output=e9929876ced4b5cc input=37347460beec424f]*/
 {
     get_traces_t get_traces;
     int err;
@@ -1510,18 +1694,23 @@ _tracemalloc.start
 
     nframe: int = 1
     /
+    *
+    sampling_interval: Py_ssize_t = 0
 
 Start tracing Python memory allocations.
 
 Also set the maximum number of frames stored in the traceback of a
-trace to nframe.
+trace to nframe.  If sampling_interval is not 0, only trace a sample
+of the memory blocks: one every sampling_interval bytes allocated on
+average.
 [clinic start generated code]*/
 
 static PyObject *
-_tracemalloc_start_impl(PyObject *module, int nframe)
-/*[clinic end generated code: output=caae05c23c159d3c input=40d849b5b29d1933]*/
+_tracemalloc_start_impl(PyObject *module, int nframe,
+                        Py_ssize_t sampling_interval)
+/*[clinic end generated code: output=f521f11b9fa9943e input=84cea0df14cf2eae]*/
 {
-    if (tracemalloc_start(nframe) < 0) {
+    if (tracemalloc_start(nframe, sampling_interval) < 0) {
         return NULL;
     }
     Py_RETURN_NONE;
@@ -1563,6 +1752,23 @@ _tracemalloc_get_traceback_limit_impl(PyObject *module)
 
 
 
+/*[clinic input]
+_tracemalloc.get_sampling_interval
+
+Get the mean number of bytes allocated between two traced memory blocks.
+
+0 means that all the memory blocks are traced.
+[clinic start generated code]*/
+
+static PyObject *
+_tracemalloc_get_sampling_interval_impl(PyObject *module)
+/*[clinic end generated code: output=5011d3b4ab086319 input=2e19b86ab416689d]*/
+{
+    return PyLong_FromSize_t(tracemalloc_config.sampling_interval);
+}
+
+
+
 /*[clinic input]
 _tracemalloc.get_tracemalloc_memory
 
@@ -1579,6 +1785,8 @@ _tracemalloc_get_tracemalloc_memory_impl(PyObject *module)
 
     size = _Py_hashtable_size(tracemalloc_tracebacks);
     size += _Py_hashtable_size(tracemalloc_filenames);
+    size += _Py_hashtable_size(tracemalloc_type_names);
+    size += _Py_hashtable_size(tracemalloc_types);
 
     TABLES_LOCK();
     size += _Py_hashtable_size(tracemalloc_traces);
@@ -1623,6 +1831,7 @@ static PyMethodDef module_methods[] = {
     _TRACEMALLOC_START_METHODDEF
     _TRACEMALLOC_STOP_METHODDEF
     _TRACEMALLOC_GET_TRACEBACK_LIMIT_METHODDEF
+    _TRACEMALLOC_GET_SAMPLING_INTERVAL_METHODDEF
     _TRACEMALLOC_GET_TRACEMALLOC_MEMORY_METHODDEF
     _TRACEMALLOC_GET_TRACED_MEMORY_METHODDEF
     /* sentinel */
@@ -1663,7 +1872,7 @@ _PyTraceMalloc_Init(int nframe)
     if (nframe == 0) {
         return 0;
     }
-    return tracemalloc_start(nframe);
+    return tracemalloc_start(nframe, 0);
 }
 
 
@@ -1724,3 +1933,143 @@ _PyTraceMalloc_GetTraceback(unsigned int domain, uintptr_t ptr)
 
     return traceback_to_pyobject(traceback, NULL);
 }
+
+
+/* Get the name of a type, interned in tracemalloc_type_names: module.qualname
+   for heap types, except builtins, tp_name for static types.
+   Return NULL on error. */
+static PyObject*
+tracemalloc_get_type_name(PyTypeObject *type)
+{
+    PyObject *name, *module;
+    _Py_hashtable_entry_t *entry;
+
+    if (type->tp_flags & Py_TPFLAGS_HEAPTYPE) {
+        PyHeapTypeObject *et = (PyHeapTypeObject *)type;
+        module = _PyDict_GetItemId(type->tp_dict, &PyId___module__);
+        if (module != NULL && PyUnicode_Check(module)
+            && !_PyUnicode_EqualToASCIIId(module, &PyId_builtins))
+        {
+            name = PyUnicode_FromFormat("%U.%U", module, et->ht_qualname);
+        }
+        else {
+            name = et->ht_qualname;
+            Py_INCREF(name);
+        }
+    }
+    else {
+        name = PyUnicode_FromString(type->tp_name);
+    }
+    if (name == NULL)
+        return NULL;
+
+    entry = _Py_HASHTABLE_GET_ENTRY(tracemalloc_type_names, name);
+    if (entry != NULL) {
+        Py_DECREF(name);
+        _Py_HASHTABLE_ENTRY_READ_KEY(tracemalloc_type_names, entry, name);
+        return name;
+    }
+    if (_Py_HASHTABLE_SET_NODATA(tracemalloc_type_names, name) < 0) {
+        Py_DECREF(name);
+        return NULL;
+    }
+    /* tracemalloc_type_names keeps the reference */
+    return name;
+}
+
+
+/* Called by _Py_NewReference() when an object is initialized after the
+   allocation of a traced memory block: if the object is stored in the
+   block, record the name of its type in the trace. */
+void
+_PyTraceMalloc_NewReference(PyObject *op)
+{
+    PyTypeObject *type = Py_TYPE(op);
+    uintptr_t ptr;
+    type_name_t type_name;
+    _Py_hashtable_entry_t *entry;
+    trace_t trace;
+
+    if (PyType_IS_GC(type))
+        ptr = (uintptr_t)((char *)op - sizeof(PyGC_Head));
+    else
+        ptr = (uintptr_t)op;
+
+    if (ptr != (uintptr_t)_PyTraceMalloc_NewBlock) {
+        /* the block didn't store an object, or another object was
+           initialized before the one it stores */
+        _PyTraceMalloc_NewBlock = NULL;
+        return;
+    }
+    _PyTraceMalloc_NewBlock = NULL;
+
+    if (!tracemalloc_config.tracing || get_reentrant())
+        return;
+
+    entry = _Py_HASHTABLE_GET_ENTRY(tracemalloc_types, type);
+    if (entry != NULL) {
+        _Py_HASHTABLE_ENTRY_READ_DATA(tracemalloc_types, entry, type_name);
+    }
+    if (entry == NULL
+        || (type_name.weakref != NULL
+            && PyWeakref_GET_OBJECT(type_name.weakref) != (PyObject *)type))
+    {
+        /* new type, or new type allocated at the address of a deallocated
+           type */
+        PyObject *exc, *val, *tb;
+        int res = -1;
+
+        /* Don't trace the memory allocated here, and don't lose the
+           current exception */
+        set_reentrant(1);
+        PyErr_Fetch(&exc, &val, &tb);
+
+        type_name.weakref = NULL;
+        type_name.name = tracemalloc_get_type_name(type);
+        if (type_name.name != NULL && (type->tp_flags & Py_TPFLAGS_HEAPTYPE)) {
+            type_name.weakref = PyWeakref_NewRef((PyObject *)type, NULL);
+        }
+        if (type_name.name != NULL
+            && (type_name.weakref != NULL
+                || !(type->tp_flags & Py_TPFLAGS_HEAPTYPE)))
+        {
+            if (entry != NULL) {
+                type_name_t old;
+                _Py_HASHTABLE_ENTRY_READ_DATA(tracemalloc_types, entry, old);
+                Py_XDECREF(old.weakref);
+                _Py_HASHTABLE_ENTRY_WRITE_DATA(tracemalloc_types, entry,
+                                               type_name);
+                res = 0;
+            }
+            else {
+                res = _Py_HASHTABLE_SET(tracemalloc_types, type, type_name);
+            }
+            if (res < 0) {
+                Py_XDECREF(type_name.weakref);
+            }
+        }
+
+        PyErr_Clear();
+        PyErr_Restore(exc, val, tb);
+        set_reentrant(0);
+        if (res < 0) {
+            /* leave the type of the trace unknown */
+            return;
+        }
+    }
+
+    TABLES_LOCK();
+    if (tracemalloc_config.use_domain) {
+        pointer_t key = {ptr, DEFAULT_DOMAIN};
+        entry = _Py_HASHTABLE_GET_ENTRY(tracemalloc_traces, key);
+    }
+    else {
+        entry = _Py_HASHTABLE_GET_ENTRY(tracemalloc_traces, ptr);
+    }
+    if (entry != NULL) {
+        _Py_HASHTABLE_ENTRY_READ_DATA(tracemalloc_traces, entry, trace);
+        trace.type_name = type_name.name;
+        _Py_HASHTABLE_ENTRY_WRITE_DATA(tracemalloc_traces, entry, trace);
+    }
+    TABLES_UNLOCK();
+}
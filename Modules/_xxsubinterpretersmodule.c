@@ -304,6 +304,243 @@ _sharedexception_apply(_sharedexception *exc, PyObject *wrapperclass)
 }
 
 
+/* shared buffers */
+
+/* An object which supports the buffer protocol is shared without copying
+   its data: the sending interpreter keeps a view of the object's buffer,
+   which pins it, and the receiving interpreter gets a memoryview of the
+   same memory.  The producer's view is released, in the producer's
+   interpreter, once the cross-interpreter data and all the consumers'
+   memoryviews are gone. */
+
+typedef struct _sharedbuffer {
+    Py_buffer view;
+    // The interpreter which owns view.obj.
+    int64_t interp;
+    // The number of references to this struct: one for the
+    // cross-interpreter data and one per SharedBuffer object.
+    Py_ssize_t refcount;
+    PyThread_type_lock mutex;
+} _sharedbuffer;
+
+static void
+_sharedbuffer_free(void *data)
+{
+    _sharedbuffer *buf = (_sharedbuffer *)data;
+    PyBuffer_Release(&buf->view);
+    PyThread_free_lock(buf->mutex);
+    PyMem_RawFree(buf);
+}
+
+static void
+_sharedbuffer_incref(_sharedbuffer *buf)
+{
+    PyThread_acquire_lock(buf->mutex, WAIT_LOCK);
+    buf->refcount += 1;
+    PyThread_release_lock(buf->mutex);
+}
+
+static void
+_sharedbuffer_decref(void *data)
+{
+    _sharedbuffer *buf = (_sharedbuffer *)data;
+    PyThread_acquire_lock(buf->mutex, WAIT_LOCK);
+    Py_ssize_t refcount = --buf->refcount;
+    PyThread_release_lock(buf->mutex);
+    if (refcount > 0) {
+        return;
+    }
+
+    // Release the view with its interpreter activated.
+    _PyCrossInterpreterData owner = {0};
+    owner.data = buf;
+    owner.interp = buf->interp;
+    owner.free = _sharedbuffer_free;
+    _PyCrossInterpreterData_Release(&owner);
+}
+
+typedef struct sharedbufferobject {
+    PyObject_HEAD
+    _sharedbuffer *buf;
+} sharedbufferobject;
+
+static PyTypeObject SharedBuffertype;
+
+static void
+sharedbuffer_dealloc(sharedbufferobject *self)
+{
+    _sharedbuffer_decref(self->buf);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int
+sharedbuffer_getbuffer(sharedbufferobject *self, Py_buffer *view, int flags)
+{
+    Py_buffer *src = &self->buf->view;
+
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && src->readonly) {
+        PyErr_SetString(PyExc_BufferError, "shared buffer is read-only");
+        return -1;
+    }
+    if ((flags & PyBUF_INDIRECT) != PyBUF_INDIRECT &&
+            src->suboffsets != NULL) {
+        PyErr_SetString(PyExc_BufferError, "shared buffer is indirect");
+        return -1;
+    }
+    if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES &&
+            !PyBuffer_IsContiguous(src, 'C')) {
+        PyErr_SetString(PyExc_BufferError,
+                        "shared buffer is not C-contiguous");
+        return -1;
+    }
+
+    *view = *src;
+    view->obj = (PyObject *)self;
+    Py_INCREF(self);
+    view->internal = NULL;
+    if ((flags & PyBUF_FORMAT) != PyBUF_FORMAT) {
+        view->format = NULL;
+    }
+    if ((flags & PyBUF_ND) != PyBUF_ND) {
+        view->ndim = 1;
+        view->shape = NULL;
+    }
+    if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES) {
+        view->strides = NULL;
+    }
+    return 0;
+}
+
+static PyBufferProcs sharedbuffer_as_buffer = {
+    (getbufferproc)sharedbuffer_getbuffer,  /* bf_getbuffer */
+    0,                                      /* bf_releasebuffer */
+};
+
+PyDoc_STRVAR(sharedbuffer_doc,
+"A buffer owned by another interpreter.\n\
+\n\
+The buffer of the original object is pinned until this object and all\n\
+the memoryviews of it are gone.");
+
+static PyTypeObject SharedBuffertype = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "_xxsubinterpreters.SharedBuffer",  /* tp_name */
+    sizeof(sharedbufferobject),         /* tp_size */
+    0,                                  /* tp_itemsize */
+    (destructor)sharedbuffer_dealloc,   /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_as_async */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    0,                                  /* tp_getattro */
+    0,                                  /* tp_setattro */
+    &sharedbuffer_as_buffer,            /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                 /* tp_flags */
+    sharedbuffer_doc,                   /* tp_doc */
+    // tp_new is NULL: instances only come from cross-interpreter data.
+};
+
+static PyObject *
+_sharedbuffer_new_object(_PyCrossInterpreterData *data)
+{
+    _sharedbuffer *buf = (_sharedbuffer *)data->data;
+    sharedbufferobject *self = PyObject_New(sharedbufferobject,
+                                            &SharedBuffertype);
+    if (self == NULL) {
+        return NULL;
+    }
+    _sharedbuffer_incref(buf);
+    self->buf = buf;
+
+    // The memoryview holds the only reference to the SharedBuffer, so
+    // releasing the memoryview unpins the producer's buffer.
+    PyObject *view = PyMemoryView_FromObject((PyObject *)self);
+    Py_DECREF(self);
+    return view;
+}
+
+static int
+_buffer_shared(PyObject *obj, _PyCrossInterpreterData *data)
+{
+    _sharedbuffer *buf = PyMem_RawMalloc(sizeof(_sharedbuffer));
+    if (buf == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    buf->mutex = PyThread_allocate_lock();
+    if (buf->mutex == NULL) {
+        PyMem_RawFree(buf);
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (PyObject_GetBuffer(obj, &buf->view, PyBUF_FULL_RO) != 0) {
+        PyThread_free_lock(buf->mutex);
+        PyMem_RawFree(buf);
+        return -1;
+    }
+    buf->interp = _get_current()->id;
+    buf->refcount = 1;
+
+    data->data = buf;
+    // data->obj remains NULL: the view holds a reference to obj.
+    data->new_object = _sharedbuffer_new_object;
+    data->free = _sharedbuffer_decref;
+    return 0;
+}
+
+/* The standard types whose instances are shared without copying.  Other
+   types which support the buffer protocol may be shared by wrapping them
+   in a memoryview. */
+static int
+_register_buffer_types(void)
+{
+    if (_PyCrossInterpreterData_Register_Class(&PyMemoryView_Type,
+                                               _buffer_shared) != 0) {
+        return -1;
+    }
+    if (_PyCrossInterpreterData_Register_Class(&PyByteArray_Type,
+                                               _buffer_shared) != 0) {
+        return -1;
+    }
+
+    static const char * const modules[][2] = {
+        {"array", "array"},
+        {"mmap", "mmap"},
+        {NULL, NULL},
+    };
+    for (int i = 0; modules[i][0] != NULL; i++) {
+        PyObject *mod = PyImport_ImportModule(modules[i][0]);
+        if (mod == NULL) {
+            if (!PyErr_ExceptionMatches(PyExc_ImportError)) {
+                return -1;
+            }
+            // The module isn't available on this platform.
+            PyErr_Clear();
+            continue;
+        }
+        PyObject *cls = PyObject_GetAttrString(mod, modules[i][1]);
+        Py_DECREF(mod);
+        if (cls == NULL) {
+            return -1;
+        }
+        int res = _PyCrossInterpreterData_Register_Class(
+                (PyTypeObject *)cls, _buffer_shared);
+        Py_DECREF(cls);
+        if (res != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
 /* channel-specific code ****************************************************/
 
 static PyObject *ChannelError;
@@ -1764,7 +2001,7 @@ _run_script_in_interpreter(PyInterpreterState *interp, const char *codestr,
         // XXX Using the "head" thread isn't strictly correct.
         PyThreadState *tstate = PyInterpreterState_ThreadHead(interp);
         // XXX Possible GILState issues?
-        save_tstate = PyThreadState_Swap(tstate);
+        save_tstate = _PyEval_SwitchThreadState(tstate);
     }
 
     // Run the script.
@@ -1773,7 +2010,7 @@ _run_script_in_interpreter(PyInterpreterState *interp, const char *codestr,
 
     // Switch back.
     if (save_tstate != NULL) {
-        PyThreadState_Swap(save_tstate);
+        _PyEval_SwitchThreadState(save_tstate);
     }
 
     // Propagate any exception out to the caller.
@@ -2077,9 +2314,32 @@ _global_channels(void) {
 }
 
 static PyObject *
-interp_create(PyObject *self, PyObject *args)
+interp_create(PyObject *self, PyObject *args, PyObject *kwds)
 {
-    if (!PyArg_UnpackTuple(args, "create", 0, 0)) {
+    static char *kwlist[] = {"isolated", NULL};
+    int isolated = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|$p:create", kwlist,
+                                     &isolated)) {
+        return NULL;
+    }
+
+    // Interpreters with their own GIL would still share None, the static
+    // types, the small ints and the interned strings, whose reference
+    // counts aren't atomic, and pymalloc isn't per interpreter.  Refuse
+    // them in every build until these are fixed, and fail before creating
+    // an interpreter which would have to be ended.
+    if (isolated) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "subinterpreters with their own GIL are not "
+                        "supported yet");
+        return NULL;
+    }
+
+    // Py_NewInterpreter() expects the caller to hold the main GIL.
+    if (_get_current()->gil != &_PyRuntime.ceval.gil) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "an interpreter with its own GIL can't create "
+                        "interpreters");
         return NULL;
     }
 
@@ -2109,9 +2369,13 @@ error:
 }
 
 PyDoc_STRVAR(create_doc,
-"create() -> ID\n\
+"create(*, isolated=False) -> ID\n\
+\n\
+Create a new interpreter and return a unique generated ID.\n\
 \n\
-Create a new interpreter and return a unique generated ID.");
+If isolated is true, the interpreter would get its own GIL, so that it\n\
+runs in parallel with the other interpreters.  This is not supported\n\
+yet: RuntimeError is raised.");
 
 
 static PyObject *
@@ -2152,6 +2416,7 @@ interp_destroy(PyObject *self, PyObject *args)
 
     // Destroy the interpreter.
     //PyInterpreterState_Delete(interp);
+    _PyEval_FiniInterpreterGIL(interp);
     PyThreadState *tstate = PyInterpreterState_ThreadHead(interp);
     // XXX Possible GILState issues?
     PyThreadState *save_tstate = PyThreadState_Swap(tstate);
@@ -2543,7 +2808,7 @@ channel__channel_id(PyObject *self, PyObject *args, PyObject *kwds)
 
 static PyMethodDef module_functions[] = {
     {"create",                    (PyCFunction)interp_create,
-     METH_VARARGS, create_doc},
+     METH_VARARGS | METH_KEYWORDS, create_doc},
     {"destroy",                   (PyCFunction)interp_destroy,
      METH_VARARGS, destroy_doc},
     {"list_all",                  interp_list_all,
@@ -2616,6 +2881,9 @@ PyInit__xxsubinterpreters(void)
     if (PyType_Ready(&InterpreterIDtype) != 0) {
         return NULL;
     }
+    if (PyType_Ready(&SharedBuffertype) != 0) {
+        return NULL;
+    }
 
     /* Create the module */
     PyObject *module = PyModule_Create(&interpretersmodule);
@@ -2645,6 +2913,9 @@ PyInit__xxsubinterpreters(void)
     if (_PyCrossInterpreterData_Register_Class(&ChannelIDtype, _channelid_shared)) {
         return NULL;
     }
+    if (_register_buffer_types() != 0) {
+        return NULL;
+    }
 
     return module;
 }
@@ -0,0 +1,151 @@
+/*[clinic input]
+preserve
+[clinic start generated code]*/
+
+PyDoc_STRVAR(_sampleprof_start__doc__,
+"start($module, /, interval=0.01)\n"
+"--\n"
+"\n"
+"Start sampling the Python stacks of all threads every interval seconds.\n"
+"\n"
+"Samples are added to the previous ones: see clear_samples().");
+
+#define _SAMPLEPROF_START_METHODDEF    \
+    {"start", (PyCFunction)_sampleprof_start, METH_FASTCALL|METH_KEYWORDS, _sampleprof_start__doc__},
+
+static PyObject *
+_sampleprof_start_impl(PyObject *module, PyObject *interval_obj);
+
+static PyObject *
+_sampleprof_start(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"interval", NULL};
+    static _PyArg_Parser _parser = {"|O:start", _keywords, 0};
+    PyObject *interval_obj = NULL;
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &interval_obj)) {
+        goto exit;
+    }
+    return_value = _sampleprof_start_impl(module, interval_obj);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_sampleprof_stop__doc__,
+"stop($module, /)\n"
+"--\n"
+"\n"
+"Stop sampling the Python stacks.\n"
+"\n"
+"Wait until the sampler thread exits.  The samples are kept.");
+
+#define _SAMPLEPROF_STOP_METHODDEF    \
+    {"stop", (PyCFunction)_sampleprof_stop, METH_NOARGS, _sampleprof_stop__doc__},
+
+static PyObject *
+_sampleprof_stop_impl(PyObject *module);
+
+static PyObject *
+_sampleprof_stop(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _sampleprof_stop_impl(module);
+}
+
+PyDoc_STRVAR(_sampleprof_is_running__doc__,
+"is_running($module, /)\n"
+"--\n"
+"\n"
+"True if the Python stacks are being sampled.");
+
+#define _SAMPLEPROF_IS_RUNNING_METHODDEF    \
+    {"is_running", (PyCFunction)_sampleprof_is_running, METH_NOARGS, _sampleprof_is_running__doc__},
+
+static int
+_sampleprof_is_running_impl(PyObject *module);
+
+static PyObject *
+_sampleprof_is_running(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = _sampleprof_is_running_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyBool_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_sampleprof_get_samples__doc__,
+"get_samples($module, /)\n"
+"--\n"
+"\n"
+"Get the samples.\n"
+"\n"
+"Return a dictionary mapping a stack to its number of samples.  A stack is\n"
+"a tuple of code objects, from the outermost frame to the innermost one.");
+
+#define _SAMPLEPROF_GET_SAMPLES_METHODDEF    \
+    {"get_samples", (PyCFunction)_sampleprof_get_samples, METH_NOARGS, _sampleprof_get_samples__doc__},
+
+static PyObject *
+_sampleprof_get_samples_impl(PyObject *module);
+
+static PyObject *
+_sampleprof_get_samples(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _sampleprof_get_samples_impl(module);
+}
+
+PyDoc_STRVAR(_sampleprof_get_sample_count__doc__,
+"get_sample_count($module, /)\n"
+"--\n"
+"\n"
+"Get the total number of sampled stacks.");
+
+#define _SAMPLEPROF_GET_SAMPLE_COUNT_METHODDEF    \
+    {"get_sample_count", (PyCFunction)_sampleprof_get_sample_count, METH_NOARGS, _sampleprof_get_sample_count__doc__},
+
+static Py_ssize_t
+_sampleprof_get_sample_count_impl(PyObject *module);
+
+static PyObject *
+_sampleprof_get_sample_count(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t _return_value;
+
+    _return_value = _sampleprof_get_sample_count_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_sampleprof_clear_samples__doc__,
+"clear_samples($module, /)\n"
+"--\n"
+"\n"
+"Clear the samples.");
+
+#define _SAMPLEPROF_CLEAR_SAMPLES_METHODDEF    \
+    {"clear_samples", (PyCFunction)_sampleprof_clear_samples, METH_NOARGS, _sampleprof_clear_samples__doc__},
+
+static PyObject *
+_sampleprof_clear_samples_impl(PyObject *module);
+
+static PyObject *
+_sampleprof_clear_samples(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _sampleprof_clear_samples_impl(module);
+}
+/*[clinic end generated code: output=c93cde6ba01bc680 input=a9049054013a1b77]*/
@@ -44,8 +44,10 @@ PyDoc_STRVAR(_tracemalloc__get_traces__doc__,
 "\n"
 "Get traces of all memory blocks allocated by Python.\n"
 "\n"
-"Return a list of (size: int, traceback: tuple) tuples.\n"
-"traceback is a tuple of (filename: str, lineno: int) tuples.\n"
+"Return a list of (domain: int, size: int, traceback: tuple, type: str)\n"
+"tuples.  traceback is a tuple of (filename: str, lineno: int) tuples; type\n"
+"is the name of the type of the object stored in the memory block, or None\n"
+"if it is unknown.\n"
 "\n"
 "Return an empty list if the tracemalloc module is disabled.");
 
@@ -75,31 +77,37 @@ PyDoc_STRVAR(_tracemalloc__get_object_traceback__doc__,
     {"_get_object_traceback", (PyCFunction)_tracemalloc__get_object_traceback, METH_O, _tracemalloc__get_object_traceback__doc__},
 
 PyDoc_STRVAR(_tracemalloc_start__doc__,
-"start($module, nframe=1, /)\n"
+"start($module, nframe=1, /, *, sampling_interval=0)\n"
 "--\n"
 "\n"
 "Start tracing Python memory allocations.\n"
 "\n"
 "Also set the maximum number of frames stored in the traceback of a\n"
-"trace to nframe.");
+"trace to nframe.  If sampling_interval is not 0, only trace a sample\n"
+"of the memory blocks: one every sampling_interval bytes allocated on\n"
+"average.");
 
 #define _TRACEMALLOC_START_METHODDEF    \
-    {"start", (PyCFunction)_tracemalloc_start, METH_FASTCALL, _tracemalloc_start__doc__},
+    {"start", (PyCFunction)_tracemalloc_start, METH_FASTCALL|METH_KEYWORDS, _tracemalloc_start__doc__},
 
 static PyObject *
-_tracemalloc_start_impl(PyObject *module, int nframe);
+_tracemalloc_start_impl(PyObject *module, int nframe,
+                        Py_ssize_t sampling_interval);
 
 static PyObject *
-_tracemalloc_start(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+_tracemalloc_start(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"", "sampling_interval", NULL};
+    static _PyArg_Parser _parser = {"|i$n:start", _keywords, 0};
     int nframe = 1;
+    Py_ssize_t sampling_interval = 0;
 
-    if (!_PyArg_ParseStack(args, nargs, "|i:start",
-        &nframe)) {
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &nframe, &sampling_interval)) {
         goto exit;
     }
-    return_value = _tracemalloc_start_impl(module, nframe);
+    return_value = _tracemalloc_start_impl(module, nframe, sampling_interval);
 
 exit:
     return return_value;
@@ -146,6 +154,26 @@ _tracemalloc_get_traceback_limit(PyObject *module, PyObject *Py_UNUSED(ignored))
     return _tracemalloc_get_traceback_limit_impl(module);
 }
 
+PyDoc_STRVAR(_tracemalloc_get_sampling_interval__doc__,
+"get_sampling_interval($module, /)\n"
+"--\n"
+"\n"
+"Get the mean number of bytes allocated between two traced memory blocks.\n"
+"\n"
+"0 means that all the memory blocks are traced.");
+
+#define _TRACEMALLOC_GET_SAMPLING_INTERVAL_METHODDEF    \
+    {"get_sampling_interval", (PyCFunction)_tracemalloc_get_sampling_interval, METH_NOARGS, _tracemalloc_get_sampling_interval__doc__},
+
+static PyObject *
+_tracemalloc_get_sampling_interval_impl(PyObject *module);
+
+static PyObject *
+_tracemalloc_get_sampling_interval(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _tracemalloc_get_sampling_interval_impl(module);
+}
+
 PyDoc_STRVAR(_tracemalloc_get_tracemalloc_memory__doc__,
 "get_tracemalloc_memory($module, /)\n"
 "--\n"
@@ -185,4 +213,4 @@ _tracemalloc_get_traced_memory(PyObject *module, PyObject *Py_UNUSED(ignored))
 {
     return _tracemalloc_get_traced_memory_impl(module);
 }
-/*[clinic end generated code: output=d98afded69c89d52 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=438c491398f8bffd input=a9049054013a1b77]*/
@@ -325,4 +325,127 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=21dc9270b10b7891 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(gc_set_pause_target__doc__,
+"set_pause_target($module, milliseconds, /)\n"
+"--\n"
+"\n"
+"Set the target duration of the collections of the oldest generation.\n"
+"\n"
+"If it is greater than 0, the oldest generation is collected in increments\n"
+"taking about that many milliseconds, together with the young generations.\n"
+"0 disables incremental collection.");
+
+#define GC_SET_PAUSE_TARGET_METHODDEF    \
+    {"set_pause_target", (PyCFunction)gc_set_pause_target, METH_O, gc_set_pause_target__doc__},
+
+static PyObject *
+gc_set_pause_target_impl(PyObject *module, double milliseconds);
+
+static PyObject *
+gc_set_pause_target(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    double milliseconds;
+
+    if (!PyArg_Parse(arg, "d:set_pause_target", &milliseconds)) {
+        goto exit;
+    }
+    return_value = gc_set_pause_target_impl(module, milliseconds);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_pause_target__doc__,
+"get_pause_target($module, /)\n"
+"--\n"
+"\n"
+"Return the target duration of the collections of the oldest generation.\n"
+"\n"
+"The duration is in milliseconds; 0 means that incremental collection is\n"
+"disabled.");
+
+#define GC_GET_PAUSE_TARGET_METHODDEF    \
+    {"get_pause_target", (PyCFunction)gc_get_pause_target, METH_NOARGS, gc_get_pause_target__doc__},
+
+static double
+gc_get_pause_target_impl(PyObject *module);
+
+static PyObject *
+gc_get_pause_target(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    double _return_value;
+
+    _return_value = gc_get_pause_target_impl(module);
+    if ((_return_value == -1.0) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyFloat_FromDouble(_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_set_adaptive__doc__,
+"set_adaptive($module, flag, /)\n"
+"--\n"
+"\n"
+"Enable or disable the adaptive collection thresholds.\n"
+"\n"
+"In adaptive mode, the thresholds of the young generations are raised, up\n"
+"to 64 times the values set with set_threshold(), while their collections\n"
+"find almost no garbage, and lowered back when they find some.  Generation\n"
+"0 is also collected once the objects allocated since its last collection\n"
+"take more than 128 bytes per object of its threshold.");
+
+#define GC_SET_ADAPTIVE_METHODDEF    \
+    {"set_adaptive", (PyCFunction)gc_set_adaptive, METH_O, gc_set_adaptive__doc__},
+
+static PyObject *
+gc_set_adaptive_impl(PyObject *module, int flag);
+
+static PyObject *
+gc_set_adaptive(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int flag;
+
+    if (!PyArg_Parse(arg, "p:set_adaptive", &flag)) {
+        goto exit;
+    }
+    return_value = gc_set_adaptive_impl(module, flag);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_adaptive__doc__,
+"get_adaptive($module, /)\n"
+"--\n"
+"\n"
+"Return true if the adaptive collection thresholds are enabled.");
+
+#define GC_GET_ADAPTIVE_METHODDEF    \
+    {"get_adaptive", (PyCFunction)gc_get_adaptive, METH_NOARGS, gc_get_adaptive__doc__},
+
+static int
+gc_get_adaptive_impl(PyObject *module);
+
+static PyObject *
+gc_get_adaptive(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = gc_get_adaptive_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyBool_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=705dfc55d1c73035 input=a9049054013a1b77]*/
@@ -54,7 +54,30 @@ static PyObject *gc_str = NULL;
                 DEBUG_UNCOLLECTABLE | \
                 DEBUG_SAVEALL
 
-#define GEN_HEAD(n) (&_PyRuntime.gc.generations[n].head)
+#define GEN_HEAD(n) (&_PyGC_STATE()->generations[n].head)
+
+/* Initial estimate of the duration of an increment per object, in
+   nanoseconds (see collect_increment()) */
+#define INITIAL_INCREMENT_COST 100.0
+
+/* In adaptive mode, the threshold of a young generation is doubled when
+   garbage makes less than ADAPTIVE_LOW_GARBAGE_PERCENT of the objects its
+   collection examined, and halved when it makes more than
+   ADAPTIVE_HIGH_GARBAGE_PERCENT. */
+#define ADAPTIVE_LOW_GARBAGE_PERCENT 1
+#define ADAPTIVE_HIGH_GARBAGE_PERCENT 10
+
+/* In adaptive mode, generation 0 is also collected once the gc objects
+   allocated since the last collection take more than
+   ADAPTIVE_BYTES_PER_OBJECT bytes per object of its threshold, so that
+   large objects are collected sooner. */
+#define ADAPTIVE_BYTES_PER_OBJECT 128
+
+#define ALLOCATED_BYTES_DUE(state) \
+    ((state)->adaptive \
+     && (state)->allocated_bytes > \
+        (size_t)(state)->generations[0].effective_threshold \
+        * ADAPTIVE_BYTES_PER_OBJECT)
 
 void
 _PyGC_Initialize(struct _gc_runtime_state *state)
@@ -63,19 +86,28 @@ _PyGC_Initialize(struct _gc_runtime_state *state)
 
 #define _GEN_HEAD(n) (&state->generations[n].head)
     struct gc_generation generations[NUM_GENERATIONS] = {
-        /* PyGC_Head,                                 threshold,      count */
-        {{{_GEN_HEAD(0), _GEN_HEAD(0), 0}},           700,            0},
-        {{{_GEN_HEAD(1), _GEN_HEAD(1), 0}},           10,             0},
-        {{{_GEN_HEAD(2), _GEN_HEAD(2), 0}},           10,             0},
+        /* PyGC_Head,                        threshold, count, effective */
+        {{{_GEN_HEAD(0), _GEN_HEAD(0), 0}},  700,       0,     700},
+        {{{_GEN_HEAD(1), _GEN_HEAD(1), 0}},  10,        0,     10},
+        {{{_GEN_HEAD(2), _GEN_HEAD(2), 0}},  10,        0,     10},
     };
     for (int i = 0; i < NUM_GENERATIONS; i++) {
         state->generations[i] = generations[i];
     };
-    state->generation0 = GEN_HEAD(0);
+    state->generation0 = _GEN_HEAD(0);
     struct gc_generation permanent_generation = {
           {{&state->permanent_generation.head, &state->permanent_generation.head, 0}}, 0, 0
     };
     state->permanent_generation = permanent_generation;
+    state->pause_target = 0;
+    state->incremental_pass = 0;
+    state->incremental_visited.gc.gc_next = &state->incremental_visited;
+    state->incremental_visited.gc.gc_prev = &state->incremental_visited;
+    state->visited_space = 0;
+    state->increment_cost = INITIAL_INCREMENT_COST;
+    state->full_collection_size = 0;
+    state->adaptive = 0;
+    state->allocated_bytes = 0;
 }
 
 /*--------------------------------------------------------------------------
@@ -209,6 +241,62 @@ gc_list_size(PyGC_Head *list)
     return n;
 }
 
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+/*** per-interpreter state ***/
+
+struct _gc_runtime_state *
+_PyGC_GetState(void)
+{
+    PyThreadState *tstate = _PyThreadState_UncheckedGet();
+    if (tstate == NULL) {
+        /* Runtime initialization and finalization */
+        return &_PyRuntime.gc;
+    }
+    return tstate->interp->gc;
+}
+
+struct _gc_runtime_state *
+_PyGC_NewState(void)
+{
+    struct _gc_runtime_state *state = PyMem_RawCalloc(1, sizeof(*state));
+    if (state != NULL) {
+        _PyGC_Initialize(state);
+    }
+    return state;
+}
+
+/* Called when the interpreter owning state is deleted.  Objects it leaked
+   are still tracked, so they are moved to a list which is never freed:
+   untracking them later must not touch freed memory. */
+void
+_PyGC_DeleteState(struct _gc_runtime_state *state)
+{
+    PyGC_Head *leaked = NULL;
+    int i;
+
+    gc_list_merge(&state->incremental_visited,
+                  &state->generations[NUM_GENERATIONS-1].head);
+    for (i = 0; i <= NUM_GENERATIONS; i++) {
+        PyGC_Head *head = (i < NUM_GENERATIONS ?
+                           &state->generations[i].head :
+                           &state->permanent_generation.head);
+        if (gc_list_is_empty(head)) {
+            continue;
+        }
+        if (leaked == NULL) {
+            leaked = PyMem_RawMalloc(sizeof(PyGC_Head));
+            if (leaked == NULL) {
+                /* Leak state itself instead */
+                return;
+            }
+            gc_list_init(leaked);
+        }
+        gc_list_merge(head, leaked);
+    }
+    PyMem_RawFree(state);
+}
+#endif /* EXPERIMENTAL_ISOLATED_SUBINTERPRETERS */
+
 /* Append objects in a GC list to a Python list.
  * Return 0 if all OK, < 0 if error (out of memory for list).
  */
@@ -656,16 +744,16 @@ handle_legacy_finalizers(PyGC_Head *finalizers, PyGC_Head *old)
 {
     PyGC_Head *gc = finalizers->gc.gc_next;
 
-    if (_PyRuntime.gc.garbage == NULL) {
-        _PyRuntime.gc.garbage = PyList_New(0);
-        if (_PyRuntime.gc.garbage == NULL)
+    if (_PyGC_STATE()->garbage == NULL) {
+        _PyGC_STATE()->garbage = PyList_New(0);
+        if (_PyGC_STATE()->garbage == NULL)
             Py_FatalError("gc couldn't create gc.garbage list");
     }
     for (; gc != finalizers; gc = gc->gc.gc_next) {
         PyObject *op = FROM_GC(gc);
 
-        if ((_PyRuntime.gc.debug & DEBUG_SAVEALL) || has_legacy_finalizer(op)) {
-            if (PyList_Append(_PyRuntime.gc.garbage, op) < 0)
+        if ((_PyGC_STATE()->debug & DEBUG_SAVEALL) || has_legacy_finalizer(op)) {
+            if (PyList_Append(_PyGC_STATE()->garbage, op) < 0)
                 return -1;
         }
     }
@@ -755,8 +843,8 @@ delete_garbage(PyGC_Head *collectable, PyGC_Head *old)
         PyGC_Head *gc = collectable->gc.gc_next;
         PyObject *op = FROM_GC(gc);
 
-        if (_PyRuntime.gc.debug & DEBUG_SAVEALL) {
-            PyList_Append(_PyRuntime.gc.garbage, op);
+        if (_PyGC_STATE()->debug & DEBUG_SAVEALL) {
+            PyList_Append(_PyGC_STATE()->garbage, op);
         }
         else {
             if ((clear = Py_TYPE(op)->tp_clear) != NULL) {
@@ -787,6 +875,7 @@ clear_freelists(void)
     (void)PyTuple_ClearFreeList();
     (void)PyUnicode_ClearFreeList();
     (void)PyFloat_ClearFreeList();
+    (void)PyLong_ClearFreeList();
     (void)PyList_ClearFreeList();
     (void)PyDict_ClearFreeList();
     (void)PySet_ClearFreeList();
@@ -794,6 +883,365 @@ clear_freelists(void)
     (void)PyContext_ClearFreeList();
 }
 
+/* Deal with the unreachable objects found by move_unreachable(): clear the
+ * weakrefs to them and call the finalizers, then break the reference cycles,
+ * unless the objects can't be collected or were resurrected.  The objects
+ * which survive are moved to old.  Return the number of collectable and
+ * uncollectable objects found in *n_collected and *n_uncollectable.
+ */
+static void
+handle_unreachable(PyGC_Head *unreachable, PyGC_Head *old,
+                   Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable)
+{
+    Py_ssize_t m = 0; /* # objects collected */
+    Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
+    PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
+    PyGC_Head *gc;
+
+    /* All objects in unreachable are trash, but objects reachable from
+     * legacy finalizers (e.g. tp_del) can't safely be deleted.
+     */
+    gc_list_init(&finalizers);
+    move_legacy_finalizers(unreachable, &finalizers);
+    /* finalizers contains the unreachable objects with a legacy finalizer;
+     * unreachable objects reachable *from* those are also uncollectable,
+     * and we move those into the finalizers list too.
+     */
+    move_legacy_finalizer_reachable(&finalizers);
+
+    /* Collect statistics on collectable objects found and print
+     * debugging information.
+     */
+    for (gc = unreachable->gc.gc_next; gc != unreachable;
+                    gc = gc->gc.gc_next) {
+        m++;
+        if (_PyGC_STATE()->debug & DEBUG_COLLECTABLE) {
+            debug_cycle("collectable", FROM_GC(gc));
+        }
+    }
+
+    /* Clear weakrefs and invoke callbacks as necessary. */
+    m += handle_weakrefs(unreachable, old);
+
+    /* Call tp_finalize on objects which have one. */
+    finalize_garbage(unreachable);
+
+    if (check_garbage(unreachable)) {
+        revive_garbage(unreachable);
+        gc_list_merge(unreachable, old);
+    }
+    else {
+        /* Call tp_clear on objects in the unreachable set.  This will cause
+         * the reference cycles to be broken.  It may also cause some objects
+         * in finalizers to be freed.
+         */
+        delete_garbage(unreachable, old);
+    }
+
+    /* Collect statistics on uncollectable objects found and print
+     * debugging information. */
+    for (gc = finalizers.gc.gc_next;
+         gc != &finalizers;
+         gc = gc->gc.gc_next) {
+        n++;
+        if (_PyGC_STATE()->debug & DEBUG_UNCOLLECTABLE)
+            debug_cycle("uncollectable", FROM_GC(gc));
+    }
+
+    /* Append instances in the uncollectable set to a Python
+     * reachable list of garbage.  The programmer has to deal with
+     * this if they insist on creating this type of structure.
+     */
+    (void)handle_legacy_finalizers(&finalizers, old);
+
+    *n_collected = m;
+    *n_uncollectable = n;
+}
+
+static void
+print_collection_done(Py_ssize_t m, Py_ssize_t n, _PyTime_t t1)
+{
+    _PyTime_t t2 = _PyTime_GetMonotonicClock();
+
+    if (m == 0 && n == 0)
+        PySys_WriteStderr("gc: done");
+    else
+        PySys_FormatStderr(
+            "gc: done, %zd unreachable, %zd uncollectable",
+            n+m, n);
+    PySys_WriteStderr(", %.4fs elapsed\n",
+                      _PyTime_AsSecondsDouble(t2 - t1));
+}
+
+static void
+check_collection_error(int nofail)
+{
+    if (PyErr_Occurred()) {
+        if (nofail) {
+            PyErr_Clear();
+        }
+        else {
+            if (gc_str == NULL)
+                gc_str = PyUnicode_FromString("garbage collection");
+            PyErr_WriteUnraisable(gc_str);
+            Py_FatalError("unexpected exception during garbage collection");
+        }
+    }
+}
+
+/* Incremental collection of the oldest generation
+ * ===============================================
+ *
+ * When a pause target is set (gc.set_pause_target()), the collections of
+ * the oldest generation are replaced with passes made of increments, each
+ * of which should take about the pause target.  An increment collects the
+ * young generations together with a part of the oldest one: objects taken
+ * from the head of the oldest generation, and the objects they refer to
+ * which the pass hasn't visited yet, so that a reference cycle ends up
+ * whole in the first increment reaching it.  As for the collection of a
+ * young generation, references from outside of the increment make its
+ * objects reachable, so collecting only a part of the heap is safe.
+ *
+ * The objects surviving an increment move to the incremental_visited list,
+ * which is still a part of the oldest generation, and the
+ * _PyGC_REFS_MASK_VISITED bit of their gc_refs is set to visited_space.
+ * Outside of a pass, all the objects of the oldest generation have the
+ * other value.  Once the oldest generation is empty, the pass is over: the
+ * visited objects move back to it, and flipping visited_space makes them
+ * unvisited again without touching them.  Frozen objects have the
+ * _PyGC_REFS_MASK_FROZEN bit set, so that an increment never takes them
+ * out of the permanent generation.
+ *
+ * An increment stops adding referred objects once it is twice as large as
+ * the budget derived from the pause target, so a cycle reaching more
+ * objects than that may be missed.  A full collection is still done when
+ * the oldest generation doubled since the last one.
+ */
+
+/* Smallest number of objects an increment takes */
+#define INCREMENT_MIN_SIZE 100
+
+#define VISITED_SPACE(gc) ((int)((gc)->gc.gc_refs & _PyGC_REFS_MASK_VISITED))
+#define SET_VISITED_SPACE(gc, space) \
+    ((gc)->gc.gc_refs = ((gc)->gc.gc_refs & ~_PyGC_REFS_MASK_VISITED) \
+                        | (space))
+#define IS_FROZEN(gc) (((gc)->gc.gc_refs & _PyGC_REFS_MASK_FROZEN) != 0)
+
+/* Set the visited space of all the objects of a list */
+static void
+set_visited_space(PyGC_Head *list, int space)
+{
+    PyGC_Head *gc;
+    for (gc = list->gc.gc_next; gc != list; gc = gc->gc.gc_next) {
+        SET_VISITED_SPACE(gc, space);
+    }
+}
+
+#define UNVISITED_SPACE() \
+    (_PyGC_STATE()->visited_space ^ _PyGC_REFS_MASK_VISITED)
+
+/* Move the visited objects back to the oldest generation, and end the pass
+   in progress, if any. */
+static void
+end_incremental_pass(void)
+{
+    struct _gc_runtime_state *state = _PyGC_STATE();
+
+    if (!state->incremental_pass)
+        return;
+    if (gc_list_is_empty(GEN_HEAD(NUM_GENERATIONS-1))) {
+        /* The pass is complete: all the objects are visited */
+        state->visited_space ^= _PyGC_REFS_MASK_VISITED;
+    }
+    else {
+        set_visited_space(&state->incremental_visited, UNVISITED_SPACE());
+    }
+    gc_list_merge(&state->incremental_visited, GEN_HEAD(NUM_GENERATIONS-1));
+    state->incremental_pass = 0;
+}
+
+typedef struct {
+    PyGC_Head *list;
+    Py_ssize_t size;
+    int space;
+} gc_increment;
+
+/* A traversal callback for expand_increment. */
+static int
+visit_add_to_increment(PyObject *op, gc_increment *increment)
+{
+    if (PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        /* Only tracked objects of the oldest generation which weren't
+           visited yet: the young generations are in the increment. */
+        if (_PyGCHead_REFS(gc) == GC_REACHABLE
+            && VISITED_SPACE(gc) != increment->space
+            && !IS_FROZEN(gc)) {
+            gc_list_move(gc, increment->list);
+            SET_VISITED_SPACE(gc, increment->space);
+            increment->size++;
+        }
+    }
+    return 0;
+}
+
+/* Add to the increment the objects referred to by its objects, from scan to
+ * the end of the list, until it has limit objects.  Return the first object
+ * which wasn't scanned, or the list head if all were.
+ */
+static PyGC_Head *
+expand_increment(gc_increment *increment, PyGC_Head *scan, Py_ssize_t limit)
+{
+    while (scan != increment->list && increment->size < limit) {
+        PyObject *op = FROM_GC(scan);
+        (void) Py_TYPE(op)->tp_traverse(op,
+                                        (visitproc)visit_add_to_increment,
+                                        increment);
+        scan = scan->gc.gc_next;
+    }
+    return scan;
+}
+
+/* Collect the young generations and a part of the oldest one. */
+static Py_ssize_t
+collect_increment(Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable)
+{
+    struct _gc_runtime_state *state = _PyGC_STATE();
+    PyGC_Head *oldest = GEN_HEAD(NUM_GENERATIONS-1);
+    PyGC_Head *visited = &state->incremental_visited;
+    PyGC_Head young;  /* the objects we are examining */
+    PyGC_Head unreachable;
+    PyGC_Head *gc, *scan;
+    gc_increment increment;
+    Py_ssize_t budget, size, m, n;
+    double cost;
+    int i, taken;
+    _PyTime_t t1 = _PyTime_GetMonotonicClock(), t2;
+
+    struct gc_generation_stats *stats = &state->generation_stats[NUM_GENERATIONS-1];
+
+    state->allocated_bytes = 0;
+    if (!state->incremental_pass) {
+        state->incremental_pass = 1;
+        state->generations[NUM_GENERATIONS-1].count = 0;
+        /* Counts the survivors of the increments of the pass */
+        state->long_lived_total = 0;
+    }
+
+    if (PyDTrace_GC_START_ENABLED())
+        PyDTrace_GC_START(NUM_GENERATIONS-1);
+
+    /* The number of objects the increment should take to last
+       pause_target */
+    cost = state->pause_target / state->increment_cost;
+    budget = cost < (double)(PY_SSIZE_T_MAX / 2) ? (Py_ssize_t)cost
+                                                 : PY_SSIZE_T_MAX / 2;
+    if (budget < INCREMENT_MIN_SIZE)
+        budget = INCREMENT_MIN_SIZE;
+
+    gc_list_init(&young);
+    increment.list = &young;
+    increment.size = 0;
+    increment.space = state->visited_space;
+    for (i = 0; i < NUM_GENERATIONS-1; i++) {
+        for (gc = GEN_HEAD(i)->gc.gc_next; gc != GEN_HEAD(i);
+             gc = gc->gc.gc_next) {
+            SET_VISITED_SPACE(gc, increment.space);
+            increment.size++;
+        }
+        gc_list_merge(GEN_HEAD(i), &young);
+        state->generations[i].count = 0;
+    }
+    scan = expand_increment(&increment, young.gc.gc_next, 2 * budget);
+    /* Always take at least one object of the oldest generation, so that
+       the pass makes progress. */
+    taken = 0;
+    while (!gc_list_is_empty(oldest) && (increment.size < budget || !taken)) {
+        gc = oldest->gc.gc_next;
+        gc_list_move(gc, &young);
+        SET_VISITED_SPACE(gc, increment.space);
+        increment.size++;
+        taken = 1;
+        if (scan == &young)
+            scan = gc;
+        scan = expand_increment(&increment, scan, 2 * budget);
+    }
+    size = increment.size;
+
+    if (state->debug & DEBUG_STATS) {
+        PySys_FormatStderr("gc: collecting an increment of %zd objects "
+                           "of generation %d...\n",
+                           size, NUM_GENERATIONS-1);
+    }
+
+    update_refs(&young);
+    subtract_refs(&young);
+    gc_list_init(&unreachable);
+    move_unreachable(&young, &unreachable);
+    gc_list_merge(&young, visited);
+
+    handle_unreachable(&unreachable, visited, &m, &n);
+    if (state->debug & DEBUG_STATS) {
+        print_collection_done(m, n, t1);
+    }
+
+    state->long_lived_total += size - m;
+    if (gc_list_is_empty(oldest)) {
+        end_incremental_pass();
+        state->long_lived_pending = 0;
+    }
+
+    check_collection_error(0);
+
+    /* Update the estimated cost of an object */
+    t2 = _PyTime_GetMonotonicClock();
+    if (size > 0) {
+        cost = (double)(t2 - t1) / size;
+        state->increment_cost = (state->increment_cost + cost) / 2;
+        if (state->increment_cost < 1.0)
+            state->increment_cost = 1.0;
+    }
+
+    /* Update stats */
+    *n_collected = m;
+    *n_uncollectable = n;
+    stats->collections++;
+    stats->collected += m;
+    stats->uncollectable += n;
+    stats->survivors += size - m;
+    stats->duration += t2 - t1;
+
+    if (PyDTrace_GC_DONE_ENABLED())
+        PyDTrace_GC_DONE(n+m);
+
+    return n+m;
+}
+
+/* Double or halve the effective threshold of a young generation, depending
+ * on the share of garbage among the objects its last collection examined.
+ */
+static void
+adapt_threshold(struct gc_generation *gen, Py_ssize_t survivors,
+                Py_ssize_t unreachable)
+{
+    Py_ssize_t examined = survivors + unreachable;
+    long long threshold = gen->effective_threshold;
+
+    if (unreachable * 100 <= examined * ADAPTIVE_LOW_GARBAGE_PERCENT) {
+        threshold *= 2;
+        if (threshold > (long long)gen->threshold * GC_ADAPTIVE_MAX_SCALE)
+            threshold = (long long)gen->threshold * GC_ADAPTIVE_MAX_SCALE;
+        if (threshold > INT_MAX)
+            threshold = INT_MAX;
+    }
+    else if (unreachable * 100 > examined * ADAPTIVE_HIGH_GARBAGE_PERCENT) {
+        threshold /= 2;
+        if (threshold < gen->threshold)
+            threshold = gen->threshold;
+    }
+    gen->effective_threshold = (int)threshold;
+}
+
 /* This is the main function.  Read this to understand how the
  * collection process works. */
 static Py_ssize_t
@@ -806,13 +1254,25 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
     PyGC_Head *young; /* the generation we are examining */
     PyGC_Head *old; /* next older generation */
     PyGC_Head unreachable; /* non-problematic unreachable trash */
-    PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
-    PyGC_Head *gc;
-    _PyTime_t t1 = 0;   /* initialize to prevent a compiler warning */
+    Py_ssize_t survivors;
+    _PyTime_t t1 = 0;
+    /* The youngest generation is collected too often to read the clock
+       twice per collection unless someone looks at the result. */
+    int timed = (generation > 0 ||
+                 (_PyGC_STATE()->debug & DEBUG_STATS) ||
+                 (_PyGC_STATE()->callbacks != NULL &&
+                  PyList_GET_SIZE(_PyGC_STATE()->callbacks) > 0));
+
+    struct gc_generation_stats *stats = &_PyGC_STATE()->generation_stats[generation];
+
+    if (timed)
+        t1 = _PyTime_GetMonotonicClock();
 
-    struct gc_generation_stats *stats = &_PyRuntime.gc.generation_stats[generation];
+    if (generation == NUM_GENERATIONS-1) {
+        end_incremental_pass();
+    }
 
-    if (_PyRuntime.gc.debug & DEBUG_STATS) {
+    if (_PyGC_STATE()->debug & DEBUG_STATS) {
         PySys_WriteStderr("gc: collecting generation %d...\n",
                           generation);
         PySys_WriteStderr("gc: objects in each generation:");
@@ -820,9 +1280,7 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
             PySys_FormatStderr(" %zd",
                               gc_list_size(GEN_HEAD(i)));
         PySys_WriteStderr("\ngc: objects in permanent generation: %zd",
-                         gc_list_size(&_PyRuntime.gc.permanent_generation.head));
-        t1 = _PyTime_GetMonotonicClock();
-
+                         gc_list_size(&_PyGC_STATE()->permanent_generation.head));
         PySys_WriteStderr("\n");
     }
 
@@ -831,9 +1289,10 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
 
     /* update collection and allocation counters */
     if (generation+1 < NUM_GENERATIONS)
-        _PyRuntime.gc.generations[generation+1].count += 1;
+        _PyGC_STATE()->generations[generation+1].count += 1;
     for (i = 0; i <= generation; i++)
-        _PyRuntime.gc.generations[i].count = 0;
+        _PyGC_STATE()->generations[i].count = 0;
+    _PyGC_STATE()->allocated_bytes = 0;
 
     /* merge younger generations with one we are currently collecting */
     for (i = 0; i < generation; i++) {
@@ -865,9 +1324,14 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
     move_unreachable(young, &unreachable);
 
     /* Move reachable objects to next generation. */
+    survivors = gc_list_size(young);
     if (young != old) {
         if (generation == NUM_GENERATIONS - 2) {
-            _PyRuntime.gc.long_lived_pending += gc_list_size(young);
+            _PyGC_STATE()->long_lived_pending += survivors;
+            if (_PyGC_STATE()->pause_target) {
+                /* The objects enter the oldest generation unvisited */
+                set_visited_space(young, UNVISITED_SPACE());
+            }
         }
         gc_list_merge(young, old);
     }
@@ -875,95 +1339,27 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
         /* We only untrack dicts in full collections, to avoid quadratic
            dict build-up. See issue #14775. */
         untrack_dicts(young);
-        _PyRuntime.gc.long_lived_pending = 0;
-        _PyRuntime.gc.long_lived_total = gc_list_size(young);
-    }
-
-    /* All objects in unreachable are trash, but objects reachable from
-     * legacy finalizers (e.g. tp_del) can't safely be deleted.
-     */
-    gc_list_init(&finalizers);
-    move_legacy_finalizers(&unreachable, &finalizers);
-    /* finalizers contains the unreachable objects with a legacy finalizer;
-     * unreachable objects reachable *from* those are also uncollectable,
-     * and we move those into the finalizers list too.
-     */
-    move_legacy_finalizer_reachable(&finalizers);
-
-    /* Collect statistics on collectable objects found and print
-     * debugging information.
-     */
-    for (gc = unreachable.gc.gc_next; gc != &unreachable;
-                    gc = gc->gc.gc_next) {
-        m++;
-        if (_PyRuntime.gc.debug & DEBUG_COLLECTABLE) {
-            debug_cycle("collectable", FROM_GC(gc));
+        _PyGC_STATE()->long_lived_pending = 0;
+        _PyGC_STATE()->long_lived_total = survivors;
+        _PyGC_STATE()->full_collection_size = _PyGC_STATE()->long_lived_total;
+        if (_PyGC_STATE()->pause_target) {
+            set_visited_space(young, UNVISITED_SPACE());
         }
     }
 
-    /* Clear weakrefs and invoke callbacks as necessary. */
-    m += handle_weakrefs(&unreachable, old);
-
-    /* Call tp_finalize on objects which have one. */
-    finalize_garbage(&unreachable);
-
-    if (check_garbage(&unreachable)) {
-        revive_garbage(&unreachable);
-        gc_list_merge(&unreachable, old);
-    }
-    else {
-        /* Call tp_clear on objects in the unreachable set.  This will cause
-         * the reference cycles to be broken.  It may also cause some objects
-         * in finalizers to be freed.
-         */
-        delete_garbage(&unreachable, old);
-    }
-
-    /* Collect statistics on uncollectable objects found and print
-     * debugging information. */
-    for (gc = finalizers.gc.gc_next;
-         gc != &finalizers;
-         gc = gc->gc.gc_next) {
-        n++;
-        if (_PyRuntime.gc.debug & DEBUG_UNCOLLECTABLE)
-            debug_cycle("uncollectable", FROM_GC(gc));
-    }
-    if (_PyRuntime.gc.debug & DEBUG_STATS) {
-        _PyTime_t t2 = _PyTime_GetMonotonicClock();
+    handle_unreachable(&unreachable, old, &m, &n);
 
-        if (m == 0 && n == 0)
-            PySys_WriteStderr("gc: done");
-        else
-            PySys_FormatStderr(
-                "gc: done, %zd unreachable, %zd uncollectable",
-                n+m, n);
-        PySys_WriteStderr(", %.4fs elapsed\n",
-                          _PyTime_AsSecondsDouble(t2 - t1));
+    if (_PyGC_STATE()->debug & DEBUG_STATS) {
+        print_collection_done(m, n, t1);
     }
 
-    /* Append instances in the uncollectable set to a Python
-     * reachable list of garbage.  The programmer has to deal with
-     * this if they insist on creating this type of structure.
-     */
-    (void)handle_legacy_finalizers(&finalizers, old);
-
     /* Clear free list only during the collection of the highest
      * generation */
     if (generation == NUM_GENERATIONS-1) {
         clear_freelists();
     }
 
-    if (PyErr_Occurred()) {
-        if (nofail) {
-            PyErr_Clear();
-        }
-        else {
-            if (gc_str == NULL)
-                gc_str = PyUnicode_FromString("garbage collection");
-            PyErr_WriteUnraisable(gc_str);
-            Py_FatalError("unexpected exception during garbage collection");
-        }
-    }
+    check_collection_error(nofail);
 
     /* Update stats */
     if (n_collected)
@@ -973,6 +1369,14 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
     stats->collections++;
     stats->collected += m;
     stats->uncollectable += n;
+    stats->survivors += survivors;
+    if (timed)
+        stats->duration += _PyTime_GetMonotonicClock() - t1;
+
+    if (_PyGC_STATE()->adaptive && generation < NUM_GENERATIONS-1) {
+        adapt_threshold(&_PyGC_STATE()->generations[generation],
+                        survivors, m + n);
+    }
 
     if (PyDTrace_GC_DONE_ENABLED())
         PyDTrace_GC_DONE(n+m);
@@ -991,11 +1395,11 @@ invoke_gc_callback(const char *phase, int generation,
     PyObject *info = NULL;
 
     /* we may get called very early */
-    if (_PyRuntime.gc.callbacks == NULL)
+    if (_PyGC_STATE()->callbacks == NULL)
         return;
     /* The local variable cannot be rebound, check it for sanity */
-    assert(_PyRuntime.gc.callbacks != NULL && PyList_CheckExact(_PyRuntime.gc.callbacks));
-    if (PyList_GET_SIZE(_PyRuntime.gc.callbacks) != 0) {
+    assert(_PyGC_STATE()->callbacks != NULL && PyList_CheckExact(_PyGC_STATE()->callbacks));
+    if (PyList_GET_SIZE(_PyGC_STATE()->callbacks) != 0) {
         info = Py_BuildValue("{sisnsn}",
             "generation", generation,
             "collected", collected,
@@ -1005,8 +1409,8 @@ invoke_gc_callback(const char *phase, int generation,
             return;
         }
     }
-    for (i=0; i<PyList_GET_SIZE(_PyRuntime.gc.callbacks); i++) {
-        PyObject *r, *cb = PyList_GET_ITEM(_PyRuntime.gc.callbacks, i);
+    for (i=0; i<PyList_GET_SIZE(_PyGC_STATE()->callbacks); i++) {
+        PyObject *r, *cb = PyList_GET_ITEM(_PyGC_STATE()->callbacks, i);
         Py_INCREF(cb); /* make sure cb doesn't go away */
         r = PyObject_CallFunction(cb, "sO", phase, info);
         Py_XDECREF(r);
@@ -1030,9 +1434,23 @@ collect_with_callback(int generation)
     return result;
 }
 
+/* Collect an increment of the oldest generation and invoke progress
+ * callbacks.
+ */
+static Py_ssize_t
+collect_increment_with_callback(void)
+{
+    Py_ssize_t result, collected, uncollectable;
+    invoke_gc_callback("start", NUM_GENERATIONS - 1, 0, 0);
+    result = collect_increment(&collected, &uncollectable);
+    invoke_gc_callback("stop", NUM_GENERATIONS - 1, collected, uncollectable);
+    return result;
+}
+
 static Py_ssize_t
 collect_generations(void)
 {
+    struct _gc_runtime_state *state = _PyGC_STATE();
     int i;
     Py_ssize_t n = 0;
 
@@ -1040,14 +1458,29 @@ collect_generations(void)
      * exceeds the threshold.  Objects in the that generation and
      * generations younger than it will be collected. */
     for (i = NUM_GENERATIONS-1; i >= 0; i--) {
-        if (_PyRuntime.gc.generations[i].count > _PyRuntime.gc.generations[i].threshold) {
+        if (state->generations[i].count > state->generations[i].effective_threshold
+            || (i == 0 && ALLOCATED_BYTES_DUE(state))) {
+            /* Once a pass over the oldest generation started, the
+               collections of the middle generations continue it. */
+            if (state->incremental_pass && i > 0) {
+                n = collect_increment_with_callback();
+                break;
+            }
             /* Avoid quadratic performance degradation in number
                of tracked objects. See comments at the beginning
                of this file, and issue #4074.
             */
             if (i == NUM_GENERATIONS - 1
-                && _PyRuntime.gc.long_lived_pending < _PyRuntime.gc.long_lived_total / 4)
+                && state->long_lived_pending < state->long_lived_total / 4)
                 continue;
+            /* Increments may miss large cycles: fall back to a full
+               collection once the oldest generation doubled. */
+            if (i == NUM_GENERATIONS - 1 && state->pause_target
+                && state->long_lived_total + state->long_lived_pending
+                   <= 2 * state->full_collection_size) {
+                n = collect_increment_with_callback();
+                break;
+            }
             n = collect_with_callback(i);
             break;
         }
@@ -1067,7 +1500,7 @@ static PyObject *
 gc_enable_impl(PyObject *module)
 /*[clinic end generated code: output=45a427e9dce9155c input=81ac4940ca579707]*/
 {
-    _PyRuntime.gc.enabled = 1;
+    _PyGC_STATE()->enabled = 1;
     Py_RETURN_NONE;
 }
 
@@ -1081,7 +1514,7 @@ static PyObject *
 gc_disable_impl(PyObject *module)
 /*[clinic end generated code: output=97d1030f7aa9d279 input=8c2e5a14e800d83b]*/
 {
-    _PyRuntime.gc.enabled = 0;
+    _PyGC_STATE()->enabled = 0;
     Py_RETURN_NONE;
 }
 
@@ -1095,7 +1528,7 @@ static int
 gc_isenabled_impl(PyObject *module)
 /*[clinic end generated code: output=1874298331c49130 input=30005e0422373b31]*/
 {
-    return _PyRuntime.gc.enabled;
+    return _PyGC_STATE()->enabled;
 }
 
 /*[clinic input]
@@ -1123,12 +1556,12 @@ gc_collect_impl(PyObject *module, int generation)
         return -1;
     }
 
-    if (_PyRuntime.gc.collecting)
+    if (_PyGC_STATE()->collecting)
         n = 0; /* already collecting, don't do anything */
     else {
-        _PyRuntime.gc.collecting = 1;
+        _PyGC_STATE()->collecting = 1;
         n = collect_with_callback(generation);
-        _PyRuntime.gc.collecting = 0;
+        _PyGC_STATE()->collecting = 0;
     }
 
     return n;
@@ -1156,7 +1589,7 @@ static PyObject *
 gc_set_debug_impl(PyObject *module, int flags)
 /*[clinic end generated code: output=7c8366575486b228 input=5e5ce15e84fbed15]*/
 {
-    _PyRuntime.gc.debug = flags;
+    _PyGC_STATE()->debug = flags;
 
     Py_RETURN_NONE;
 }
@@ -1171,7 +1604,7 @@ static int
 gc_get_debug_impl(PyObject *module)
 /*[clinic end generated code: output=91242f3506cd1e50 input=91a101e1c3b98366]*/
 {
-    return _PyRuntime.gc.debug;
+    return _PyGC_STATE()->debug;
 }
 
 PyDoc_STRVAR(gc_set_thresh__doc__,
@@ -1185,13 +1618,17 @@ gc_set_thresh(PyObject *self, PyObject *args)
 {
     int i;
     if (!PyArg_ParseTuple(args, "i|ii:set_threshold",
-                          &_PyRuntime.gc.generations[0].threshold,
-                          &_PyRuntime.gc.generations[1].threshold,
-                          &_PyRuntime.gc.generations[2].threshold))
+                          &_PyGC_STATE()->generations[0].threshold,
+                          &_PyGC_STATE()->generations[1].threshold,
+                          &_PyGC_STATE()->generations[2].threshold))
         return NULL;
     for (i = 2; i < NUM_GENERATIONS; i++) {
         /* generations higher than 2 get the same threshold */
-        _PyRuntime.gc.generations[i].threshold = _PyRuntime.gc.generations[2].threshold;
+        _PyGC_STATE()->generations[i].threshold = _PyGC_STATE()->generations[2].threshold;
+    }
+    /* the adaptive mode starts again from the new thresholds */
+    for (i = 0; i < NUM_GENERATIONS; i++) {
+        _PyGC_STATE()->generations[i].effective_threshold = _PyGC_STATE()->generations[i].threshold;
     }
 
     Py_RETURN_NONE;
@@ -1208,9 +1645,9 @@ gc_get_threshold_impl(PyObject *module)
 /*[clinic end generated code: output=7902bc9f41ecbbd8 input=286d79918034d6e6]*/
 {
     return Py_BuildValue("(iii)",
-                         _PyRuntime.gc.generations[0].threshold,
-                         _PyRuntime.gc.generations[1].threshold,
-                         _PyRuntime.gc.generations[2].threshold);
+                         _PyGC_STATE()->generations[0].threshold,
+                         _PyGC_STATE()->generations[1].threshold,
+                         _PyGC_STATE()->generations[2].threshold);
 }
 
 /*[clinic input]
@@ -1224,9 +1661,9 @@ gc_get_count_impl(PyObject *module)
 /*[clinic end generated code: output=354012e67b16398f input=a392794a08251751]*/
 {
     return Py_BuildValue("(iii)",
-                         _PyRuntime.gc.generations[0].count,
-                         _PyRuntime.gc.generations[1].count,
-                         _PyRuntime.gc.generations[2].count);
+                         _PyGC_STATE()->generations[0].count,
+                         _PyGC_STATE()->generations[1].count,
+                         _PyGC_STATE()->generations[2].count);
 }
 
 static int
@@ -1275,6 +1712,11 @@ gc_get_referrers(PyObject *self, PyObject *args)
             return NULL;
         }
     }
+    if (!(gc_referrers_for(args, &_PyGC_STATE()->incremental_visited,
+                           result))) {
+        Py_DECREF(result);
+        return NULL;
+    }
     return result;
 }
 
@@ -1337,6 +1779,10 @@ gc_get_objects_impl(PyObject *module)
             return NULL;
         }
     }
+    if (append_objects(result, &_PyGC_STATE()->incremental_visited)) {
+        Py_DECREF(result);
+        return NULL;
+    }
     return result;
 }
 
@@ -1357,7 +1803,7 @@ gc_get_stats_impl(PyObject *module)
     /* To get consistent values despite allocations while constructing
        the result list, we use a snapshot of the running stats. */
     for (i = 0; i < NUM_GENERATIONS; i++) {
-        stats[i] = _PyRuntime.gc.generation_stats[i];
+        stats[i] = _PyGC_STATE()->generation_stats[i];
     }
 
     result = PyList_New(0);
@@ -1367,10 +1813,12 @@ gc_get_stats_impl(PyObject *module)
     for (i = 0; i < NUM_GENERATIONS; i++) {
         PyObject *dict;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsn}",
+        dict = Py_BuildValue("{snsnsnsnsd}",
                              "collections", st->collections,
                              "collected", st->collected,
-                             "uncollectable", st->uncollectable
+                             "uncollectable", st->uncollectable,
+                             "survivors", st->survivors,
+                             "duration", _PyTime_AsSecondsDouble(st->duration)
                             );
         if (dict == NULL)
             goto error;
@@ -1413,6 +1861,84 @@ gc_is_tracked(PyObject *module, PyObject *obj)
     return result;
 }
 
+#ifdef Py_IMMORTAL_OBJECTS
+/* Untracked containers waiting to have their referents made immortal */
+typedef struct {
+    PyObject **items;
+    Py_ssize_t size;
+    Py_ssize_t allocated;
+} immortalize_stack;
+
+static int
+visit_immortalize(PyObject *op, void *arg)
+{
+    immortalize_stack *stack = (immortalize_stack *)arg;
+
+    if (_Py_IsImmortal(op))
+        return 0;
+    _Py_SetImmortal(op);
+    if (!PyObject_IS_GC(op) || _PyObject_GC_IS_TRACKED(op))
+        return 0;
+    /* An untracked container, like a tuple or a dict holding only strings
+       and numbers, isn't in any generation: its referents have to be
+       reached through it. */
+    if (stack->size == stack->allocated) {
+        Py_ssize_t allocated = stack->allocated * 2 + 64;
+        PyObject **items = PyMem_Realloc(stack->items,
+                                         allocated * sizeof(PyObject *));
+        if (items == NULL) {
+            /* Not fatal: the referents just stay mortal */
+            return 0;
+        }
+        stack->items = items;
+        stack->allocated = allocated;
+    }
+    stack->items[stack->size++] = op;
+    return 0;
+}
+
+/* Make the objects of the list immortal, and the objects they refer to,
+ * which catches the untracked objects (strings, numbers, ...) held by
+ * containers.  After that, handing out references to them doesn't write to
+ * their memory anymore.
+ */
+static void
+immortalize_list(PyGC_Head *list)
+{
+    immortalize_stack stack = {NULL, 0, 0};
+    PyGC_Head *gc;
+
+    for (gc = list->gc.gc_next; gc != list; gc = gc->gc.gc_next) {
+        PyObject *op = FROM_GC(gc);
+        _Py_SetImmortal(op);
+        (void) Py_TYPE(op)->tp_traverse(op, visit_immortalize, &stack);
+        while (stack.size > 0) {
+            op = stack.items[--stack.size];
+            (void) Py_TYPE(op)->tp_traverse(op, visit_immortalize, &stack);
+        }
+    }
+    PyMem_Free(stack.items);
+}
+#endif
+
+/* Set or clear the _PyGC_REFS_MASK_FROZEN bit of the objects of a list,
+   which keeps incremental collections away from them.  Unfrozen objects
+   enter the oldest generation unvisited. */
+static void
+set_frozen(PyGC_Head *list, int frozen)
+{
+    PyGC_Head *gc;
+    for (gc = list->gc.gc_next; gc != list; gc = gc->gc.gc_next) {
+        if (frozen) {
+            gc->gc.gc_refs |= _PyGC_REFS_MASK_FROZEN;
+        }
+        else {
+            gc->gc.gc_refs &= ~_PyGC_REFS_MASK_FROZEN;
+            SET_VISITED_SPACE(gc, UNVISITED_SPACE());
+        }
+    }
+}
+
 /*[clinic input]
 gc.freeze
 
@@ -1427,9 +1953,14 @@ static PyObject *
 gc_freeze_impl(PyObject *module)
 /*[clinic end generated code: output=502159d9cdc4c139 input=b602b16ac5febbe5]*/
 {
+    end_incremental_pass();
     for (int i = 0; i < NUM_GENERATIONS; ++i) {
-        gc_list_merge(GEN_HEAD(i), &_PyRuntime.gc.permanent_generation.head);
-        _PyRuntime.gc.generations[i].count = 0;
+#ifdef Py_IMMORTAL_OBJECTS
+        immortalize_list(GEN_HEAD(i));
+#endif
+        set_frozen(GEN_HEAD(i), 1);
+        gc_list_merge(GEN_HEAD(i), &_PyGC_STATE()->permanent_generation.head);
+        _PyGC_STATE()->generations[i].count = 0;
     }
     Py_RETURN_NONE;
 }
@@ -1446,7 +1977,10 @@ static PyObject *
 gc_unfreeze_impl(PyObject *module)
 /*[clinic end generated code: output=1c15f2043b25e169 input=2dd52b170f4cef6c]*/
 {
-    gc_list_merge(&_PyRuntime.gc.permanent_generation.head, GEN_HEAD(NUM_GENERATIONS-1));
+    /* With Py_IMMORTAL_OBJECTS, the objects stay immortal: their reference
+       counts weren't maintained while frozen. */
+    set_frozen(&_PyGC_STATE()->permanent_generation.head, 0);
+    gc_list_merge(&_PyGC_STATE()->permanent_generation.head, GEN_HEAD(NUM_GENERATIONS-1));
     Py_RETURN_NONE;
 }
 
@@ -1460,7 +1994,108 @@ static Py_ssize_t
 gc_get_freeze_count_impl(PyObject *module)
 /*[clinic end generated code: output=61cbd9f43aa032e1 input=45ffbc65cfe2a6ed]*/
 {
-    return gc_list_size(&_PyRuntime.gc.permanent_generation.head);
+    return gc_list_size(&_PyGC_STATE()->permanent_generation.head);
+}
+
+/*[clinic input]
+gc.set_pause_target
+
+    milliseconds: double
+    /
+
+Set the target duration of the collections of the oldest generation.
+
+If it is greater than 0, the oldest generation is collected in increments
+taking about that many milliseconds, together with the young generations.
+0 disables incremental collection.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_pause_target_impl(PyObject *module, double milliseconds)
+/*[clinic end generated code: output=b29543860f6a1620 input=2f749518cedb8f71]*/
+{
+    struct _gc_runtime_state *state = _PyGC_STATE();
+
+    if (!(milliseconds >= 0)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "pause target must be a positive number or 0");
+        return NULL;
+    }
+    if (milliseconds * 1e6 >= (double)_PyTime_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "pause target is too large");
+        return NULL;
+    }
+    if (milliseconds == 0) {
+        end_incremental_pass();
+    }
+    else if (!state->pause_target) {
+        /* Objects enter the oldest generation unvisited only while
+           incremental collection is enabled */
+        set_visited_space(GEN_HEAD(NUM_GENERATIONS-1), UNVISITED_SPACE());
+    }
+    state->pause_target = (_PyTime_t)(milliseconds * 1e6);
+    if (milliseconds > 0 && state->pause_target == 0) {
+        state->pause_target = 1;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_pause_target -> double
+
+Return the target duration of the collections of the oldest generation.
+
+The duration is in milliseconds; 0 means that incremental collection is
+disabled.
+[clinic start generated code]*/
+
+static double
+gc_get_pause_target_impl(PyObject *module)
+/*[clinic end generated code: output=f4f3c334d92a8021 input=0f5a5da49f8ebe84]*/
+{
+    return (double)_PyGC_STATE()->pause_target / 1e6;
+}
+
+/*[clinic input]
+gc.set_adaptive
+
+    flag: bool
+    /
+
+Enable or disable the adaptive collection thresholds.
+
+In adaptive mode, the thresholds of the young generations are raised, up
+to 64 times the values set with set_threshold(), while their collections
+find almost no garbage, and lowered back when they find some.  Generation
+0 is also collected once the objects allocated since its last collection
+take more than 128 bytes per object of its threshold.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_adaptive_impl(PyObject *module, int flag)
+/*[clinic end generated code: output=85771f5d216a7e3d input=7f27addeb7167146]*/
+{
+    struct _gc_runtime_state *state = _PyGC_STATE();
+    int i;
+
+    state->adaptive = flag;
+    for (i = 0; i < NUM_GENERATIONS; i++) {
+        state->generations[i].effective_threshold = state->generations[i].threshold;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_adaptive -> bool
+
+Return true if the adaptive collection thresholds are enabled.
+[clinic start generated code]*/
+
+static int
+gc_get_adaptive_impl(PyObject *module)
+/*[clinic end generated code: output=1f7d922ff8e3f6be input=49c0d8d51db02109]*/
+{
+    return _PyGC_STATE()->adaptive;
 }
 
 
@@ -1483,7 +2118,11 @@ PyDoc_STRVAR(gc__doc__,
 "get_referents() -- Return the list of objects that an object refers to.\n"
 "freeze() -- Freeze all tracked objects and ignore them for future collections.\n"
 "unfreeze() -- Unfreeze all objects in the permanent generation.\n"
-"get_freeze_count() -- Return the number of objects in the permanent generation.\n");
+"get_freeze_count() -- Return the number of objects in the permanent generation.\n"
+"set_pause_target() -- Set the target duration of the collections of the oldest generation.\n"
+"get_pause_target() -- Return the target duration of the collections of the oldest generation.\n"
+"set_adaptive() -- Enable or disable the adaptive collection thresholds.\n"
+"get_adaptive() -- Return true if the adaptive collection thresholds are enabled.\n");
 
 static PyMethodDef GcMethods[] = {
     GC_ENABLE_METHODDEF
@@ -1505,6 +2144,10 @@ static PyMethodDef GcMethods[] = {
     GC_FREEZE_METHODDEF
     GC_UNFREEZE_METHODDEF
     GC_GET_FREEZE_COUNT_METHODDEF
+    GC_SET_PAUSE_TARGET_METHODDEF
+    GC_GET_PAUSE_TARGET_METHODDEF
+    GC_SET_ADAPTIVE_METHODDEF
+    GC_GET_ADAPTIVE_METHODDEF
     {NULL,      NULL}           /* Sentinel */
 };
 
@@ -1530,22 +2173,22 @@ PyInit_gc(void)
     if (m == NULL)
         return NULL;
 
-    if (_PyRuntime.gc.garbage == NULL) {
-        _PyRuntime.gc.garbage = PyList_New(0);
-        if (_PyRuntime.gc.garbage == NULL)
+    if (_PyGC_STATE()->garbage == NULL) {
+        _PyGC_STATE()->garbage = PyList_New(0);
+        if (_PyGC_STATE()->garbage == NULL)
             return NULL;
     }
-    Py_INCREF(_PyRuntime.gc.garbage);
-    if (PyModule_AddObject(m, "garbage", _PyRuntime.gc.garbage) < 0)
+    Py_INCREF(_PyGC_STATE()->garbage);
+    if (PyModule_AddObject(m, "garbage", _PyGC_STATE()->garbage) < 0)
         return NULL;
 
-    if (_PyRuntime.gc.callbacks == NULL) {
-        _PyRuntime.gc.callbacks = PyList_New(0);
-        if (_PyRuntime.gc.callbacks == NULL)
+    if (_PyGC_STATE()->callbacks == NULL) {
+        _PyGC_STATE()->callbacks = PyList_New(0);
+        if (_PyGC_STATE()->callbacks == NULL)
             return NULL;
     }
-    Py_INCREF(_PyRuntime.gc.callbacks);
-    if (PyModule_AddObject(m, "callbacks", _PyRuntime.gc.callbacks) < 0)
+    Py_INCREF(_PyGC_STATE()->callbacks);
+    if (PyModule_AddObject(m, "callbacks", _PyGC_STATE()->callbacks) < 0)
         return NULL;
 
 #define ADD_INT(NAME) if (PyModule_AddIntConstant(m, #NAME, NAME) < 0) return NULL
@@ -1564,12 +2207,12 @@ PyGC_Collect(void)
 {
     Py_ssize_t n;
 
-    if (_PyRuntime.gc.collecting)
+    if (_PyGC_STATE()->collecting)
         n = 0; /* already collecting, don't do anything */
     else {
-        _PyRuntime.gc.collecting = 1;
+        _PyGC_STATE()->collecting = 1;
         n = collect_with_callback(NUM_GENERATIONS - 1);
-        _PyRuntime.gc.collecting = 0;
+        _PyGC_STATE()->collecting = 0;
     }
 
     return n;
@@ -1578,7 +2221,7 @@ PyGC_Collect(void)
 Py_ssize_t
 _PyGC_CollectIfEnabled(void)
 {
-    if (!_PyRuntime.gc.enabled)
+    if (!_PyGC_STATE()->enabled)
         return 0;
 
     return PyGC_Collect();
@@ -1595,12 +2238,12 @@ _PyGC_CollectNoFail(void)
        during interpreter shutdown (and then never finish it).
        See http://bugs.python.org/issue8713#msg195178 for an example.
        */
-    if (_PyRuntime.gc.collecting)
+    if (_PyGC_STATE()->collecting)
         n = 0;
     else {
-        _PyRuntime.gc.collecting = 1;
+        _PyGC_STATE()->collecting = 1;
         n = collect(NUM_GENERATIONS - 1, NULL, NULL, 1);
-        _PyRuntime.gc.collecting = 0;
+        _PyGC_STATE()->collecting = 0;
     }
     return n;
 }
@@ -1608,10 +2251,10 @@ _PyGC_CollectNoFail(void)
 void
 _PyGC_DumpShutdownStats(void)
 {
-    if (!(_PyRuntime.gc.debug & DEBUG_SAVEALL)
-        && _PyRuntime.gc.garbage != NULL && PyList_GET_SIZE(_PyRuntime.gc.garbage) > 0) {
+    if (!(_PyGC_STATE()->debug & DEBUG_SAVEALL)
+        && _PyGC_STATE()->garbage != NULL && PyList_GET_SIZE(_PyGC_STATE()->garbage) > 0) {
         const char *message;
-        if (_PyRuntime.gc.debug & DEBUG_UNCOLLECTABLE)
+        if (_PyGC_STATE()->debug & DEBUG_UNCOLLECTABLE)
             message = "gc: %zd uncollectable objects at " \
                 "shutdown";
         else
@@ -1622,13 +2265,13 @@ _PyGC_DumpShutdownStats(void)
            already. */
         if (PyErr_WarnExplicitFormat(PyExc_ResourceWarning, "gc", 0,
                                      "gc", NULL, message,
-                                     PyList_GET_SIZE(_PyRuntime.gc.garbage)))
+                                     PyList_GET_SIZE(_PyGC_STATE()->garbage)))
             PyErr_WriteUnraisable(NULL);
-        if (_PyRuntime.gc.debug & DEBUG_UNCOLLECTABLE) {
+        if (_PyGC_STATE()->debug & DEBUG_UNCOLLECTABLE) {
             PyObject *repr = NULL, *bytes = NULL;
-            repr = PyObject_Repr(_PyRuntime.gc.garbage);
+            repr = PyObject_Repr(_PyGC_STATE()->garbage);
             if (!repr || !(bytes = PyUnicode_EncodeFSDefault(repr)))
-                PyErr_WriteUnraisable(_PyRuntime.gc.garbage);
+                PyErr_WriteUnraisable(_PyGC_STATE()->garbage);
             else {
                 PySys_WriteStderr(
                     "      %s\n",
@@ -1644,7 +2287,7 @@ _PyGC_DumpShutdownStats(void)
 void
 _PyGC_Fini(void)
 {
-    Py_CLEAR(_PyRuntime.gc.callbacks);
+    Py_CLEAR(_PyGC_STATE()->callbacks);
 }
 
 /* for debugging */
@@ -1695,15 +2338,17 @@ _PyObject_GC_Alloc(int use_calloc, size_t basicsize)
         return PyErr_NoMemory();
     g->gc.gc_refs = 0;
     _PyGCHead_SET_REFS(g, GC_UNTRACKED);
-    _PyRuntime.gc.generations[0].count++; /* number of allocated GC objects */
-    if (_PyRuntime.gc.generations[0].count > _PyRuntime.gc.generations[0].threshold &&
-        _PyRuntime.gc.enabled &&
-        _PyRuntime.gc.generations[0].threshold &&
-        !_PyRuntime.gc.collecting &&
+    _PyGC_STATE()->generations[0].count++; /* number of allocated GC objects */
+    _PyGC_STATE()->allocated_bytes += size;
+    if ((_PyGC_STATE()->generations[0].count > _PyGC_STATE()->generations[0].effective_threshold ||
+         ALLOCATED_BYTES_DUE(_PyGC_STATE())) &&
+        _PyGC_STATE()->enabled &&
+        _PyGC_STATE()->generations[0].threshold &&
+        !_PyGC_STATE()->collecting &&
         !PyErr_Occurred()) {
-        _PyRuntime.gc.collecting = 1;
+        _PyGC_STATE()->collecting = 1;
         collect_generations();
-        _PyRuntime.gc.collecting = 0;
+        _PyGC_STATE()->collecting = 0;
     }
     op = FROM_GC(g);
     return op;
@@ -1768,8 +2413,8 @@ PyObject_GC_Del(void *op)
     PyGC_Head *g = AS_GC(op);
     if (IS_TRACKED(op))
         gc_list_remove(g);
-    if (_PyRuntime.gc.generations[0].count > 0) {
-        _PyRuntime.gc.generations[0].count--;
+    if (_PyGC_STATE()->generations[0].count > 0) {
+        _PyGC_STATE()->generations[0].count--;
     }
     PyObject_FREE(g);
 }
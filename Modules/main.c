@@ -1807,6 +1807,7 @@ static _PyInitError
 config_read_env_vars(_PyCoreConfig *config)
 {
     config->allocator = config_get_env_var("PYTHONMALLOC");
+    config->arena_size = config_get_env_var("PYTHONMALLOCARENASIZE");
 
     if (config_get_env_var("PYTHONDUMPREFS")) {
         config->dump_refs = 1;
@@ -2291,6 +2292,7 @@ _PyCoreConfig_Copy(_PyCoreConfig *config, const _PyCoreConfig *config2)
     COPY_ATTR(hash_seed);
     COPY_ATTR(_disable_importlib);
     COPY_ATTR(allocator);
+    COPY_ATTR(arena_size);
     COPY_ATTR(dev_mode);
     COPY_ATTR(faulthandler);
     COPY_ATTR(tracemalloc);
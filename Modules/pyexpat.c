@@ -1509,7 +1509,7 @@ static PyTypeObject Xmlparsetype = {
         0,                              /*tp_itemsize*/
         /* methods */
         (destructor)xmlparse_dealloc,   /*tp_dealloc*/
-        (printfunc)0,           /*tp_print*/
+        0,                      /*tp_print*/
         0,                      /*tp_getattr*/
         0,  /*tp_setattr*/
         0,                      /*tp_reserved*/
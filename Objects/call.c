@@ -80,6 +80,42 @@ _Py_CheckFunctionResult(PyObject *callable, PyObject *result, const char *where)
 
 /* --- Core PyObject call functions ------------------------------- */
 
+/* Call a vectorcall entry point with positional arguments in a C array and
+   keyword arguments in a dictionary */
+static PyObject *
+vectorcall_dict(vectorcallfunc func, PyObject *callable,
+                PyObject *const *args, Py_ssize_t nargs, PyObject *kwargs)
+{
+    PyObject *const *stack;
+    PyObject *kwnames;
+    PyObject *result;
+
+    if (kwargs != NULL && !PyDict_CheckExact(kwargs)) {
+        /* _PyStack_UnpackDict() only accepts exact dictionaries */
+        PyObject *copy = PyDict_Copy(kwargs);
+        if (copy == NULL) {
+            return NULL;
+        }
+        result = vectorcall_dict(func, callable, args, nargs, copy);
+        Py_DECREF(copy);
+        return result;
+    }
+
+    if (_PyStack_UnpackDict(args, nargs, kwargs, &stack, &kwnames) < 0) {
+        return NULL;
+    }
+
+    result = func(callable, stack, nargs, kwnames);
+
+    if (stack != args) {
+        PyMem_Free((PyObject **)stack);
+    }
+    Py_XDECREF(kwnames);
+
+    return _Py_CheckFunctionResult(callable, result, NULL);
+}
+
+
 PyObject *
 _PyObject_FastCallDict(PyObject *callable, PyObject *const *args, Py_ssize_t nargs,
                        PyObject *kwargs)
@@ -103,6 +139,12 @@ _PyObject_FastCallDict(PyObject *callable, PyObject *const *args, Py_ssize_t nar
     else {
         PyObject *argstuple, *result;
         ternaryfunc call;
+        vectorcallfunc func;
+
+        func = _PyVectorcall_Function(callable);
+        if (func != NULL) {
+            return vectorcall_dict(func, callable, args, nargs, kwargs);
+        }
 
         /* Slow-path: build a temporary tuple */
         call = callable->ob_type->tp_call;
@@ -160,6 +202,7 @@ _PyObject_FastCallKeywords(PyObject *callable, PyObject *const *stack, Py_ssize_
            temporary dictionary for keyword arguments (if any) */
 
         ternaryfunc call;
+        vectorcallfunc func;
         PyObject *argstuple;
         PyObject *kwdict, *result;
         Py_ssize_t nkwargs;
@@ -167,6 +210,12 @@ _PyObject_FastCallKeywords(PyObject *callable, PyObject *const *stack, Py_ssize_
         nkwargs = (kwnames == NULL) ? 0 : PyTuple_GET_SIZE(kwnames);
         assert((nargs == 0 && nkwargs == 0) || stack != NULL);
 
+        func = _PyVectorcall_Function(callable);
+        if (func != NULL) {
+            result = func(callable, stack, nargs, kwnames);
+            return _Py_CheckFunctionResult(callable, result, NULL);
+        }
+
         call = callable->ob_type->tp_call;
         if (call == NULL) {
             PyErr_Format(PyExc_TypeError, "'%.200s' object is not callable",
@@ -871,6 +920,60 @@ _PyObject_FastCall_Prepend(PyObject *callable, PyObject *obj,
 }
 
 
+PyObject *
+_PyObject_Vectorcall_Prepend(PyObject *callable, PyObject *obj,
+                             PyObject *const *args, size_t nargsf,
+                             PyObject *kwnames)
+{
+    PyObject *small_stack[_PY_FASTCALL_SMALL_STACK];
+    PyObject **stack;
+    PyObject *result;
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    Py_ssize_t nkwargs = (kwnames == NULL) ? 0 : PyTuple_GET_SIZE(kwnames);
+    Py_ssize_t total = nargs + nkwargs;
+
+    if (nargsf & PY_VECTORCALL_ARGUMENTS_OFFSET) {
+        /* The caller allows us to overwrite args[-1]: store obj there
+           instead of copying the arguments. args[-2] does not belong to
+           us, so don't forward the flag. */
+        PyObject **newargs = (PyObject **)args - 1;
+        PyObject *saved = newargs[0];
+
+        newargs[0] = obj;
+        result = _PyObject_Vectorcall(callable, newargs, nargs + 1, kwnames);
+        newargs[0] = saved;
+        return result;
+    }
+
+    /* Reserve one extra leading slot so that the callee can use
+       PY_VECTORCALL_ARGUMENTS_OFFSET itself */
+    if (total + 2 <= (Py_ssize_t)Py_ARRAY_LENGTH(small_stack)) {
+        stack = small_stack;
+    }
+    else {
+        stack = PyMem_Malloc((total + 2) * sizeof(PyObject *));
+        if (stack == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+    }
+
+    /* use borrowed references */
+    stack[1] = obj;
+    if (total > 0) {
+        memcpy(&stack[2], args, total * sizeof(PyObject *));
+    }
+
+    result = _PyObject_Vectorcall(callable, stack + 1,
+                                  (nargs + 1) | PY_VECTORCALL_ARGUMENTS_OFFSET,
+                                  kwnames);
+    if (stack != small_stack) {
+        PyMem_Free(stack);
+    }
+    return result;
+}
+
+
 /* Call callable(obj, *args, **kwargs). */
 PyObject *
 _PyObject_Call_Prepend(PyObject *callable,
@@ -2,7 +2,9 @@
 
 #include "Python.h"
 #include "code.h"
+#include "opcode.h"
 #include "structmember.h"
+#include "internal/code.h"
 
 /* Holder for co_extra information */
 typedef struct {
@@ -206,9 +208,391 @@ PyCode_New(int argcount, int kwonlyargcount,
     co->co_zombieframe = NULL;
     co->co_weakreflist = NULL;
     co->co_extra = NULL;
+
+    co->co_opcache_map = NULL;
+    co->co_opcache = NULL;
+    co->co_opcache_flag = 0;
+    co->co_opcache_size = 0;
+    co->co_opprofile = NULL;
     return co;
 }
 
+int
+_PyCode_InitOpcache(PyCodeObject *co)
+{
+    Py_ssize_t co_size = PyBytes_Size(co->co_code) / sizeof(_Py_CODEUNIT);
+    /* One extra slot: the map is indexed by next_instr, which is one past
+       the opcode being executed. */
+    co->co_opcache_map = (unsigned char *)PyMem_Calloc(co_size + 1, 1);
+    if (co->co_opcache_map == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    _Py_CODEUNIT *opcodes = (_Py_CODEUNIT*)PyBytes_AS_STRING(co->co_code);
+    Py_ssize_t opts = 0;
+
+    for (Py_ssize_t i = 0; i < co_size;) {
+        unsigned char opcode = _Py_OPCODE(opcodes[i]);
+        i++;  // 'i' is now aligned to (next_instr - first_instr)
+
+        if (opcode == LOAD_GLOBAL || opcode == LOAD_ATTR ||
+                opcode == STORE_ATTR || opcode == LOAD_METHOD) {
+            opts++;
+            co->co_opcache_map[i] = (unsigned char)opts;
+            if (opts > 254) {
+                break;
+            }
+        }
+    }
+
+    if (opts) {
+        co->co_opcache = (_PyOpcache *)PyMem_Calloc(opts, sizeof(_PyOpcache));
+        if (co->co_opcache == NULL) {
+            PyMem_FREE(co->co_opcache_map);
+            co->co_opcache_map = NULL;
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+    else {
+        PyMem_FREE(co->co_opcache_map);
+        co->co_opcache_map = NULL;
+        co->co_opcache = NULL;
+    }
+
+    co->co_opcache_size = (unsigned char)opts;
+    return 0;
+}
+
+/* Opcode profiles: the list of the opcode counts of all the code objects
+   which ran while opcode profiling was enabled, most recent first. */
+static _PyOpcodeProfile *opcode_profiles = NULL;
+
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+/* The list is shared by all interpreters, including those with their own
+   GIL: guard it with a lock of its own, allocated when opcode profiling is
+   first enabled.  Until then the list is empty, and the lock is NULL. */
+static PyThread_type_lock opcode_profiles_lock = NULL;
+#define OPPROFILES_LOCK() \
+    PyThread_acquire_lock(opcode_profiles_lock, WAIT_LOCK)
+#define OPPROFILES_UNLOCK() PyThread_release_lock(opcode_profiles_lock)
+#else
+#define OPPROFILES_LOCK()
+#define OPPROFILES_UNLOCK()
+#endif
+
+/* Initial size of the hash table of opcode pairs of a code object */
+#define OPPROFILE_MINPAIRS 32
+
+int
+_PyCode_InitOpcodeProfiles(void)
+{
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+    if (opcode_profiles_lock == NULL) {
+        opcode_profiles_lock = PyThread_allocate_lock();
+        if (opcode_profiles_lock == NULL) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "can't allocate the opcode profiles lock");
+            return -1;
+        }
+    }
+#endif
+    return 0;
+}
+
+static _PyOpcodeProfile *
+opprofile_new(PyCodeObject *co)
+{
+    _PyOpcodeProfile *prof;
+
+    prof = (_PyOpcodeProfile *)PyMem_Calloc(1, sizeof(_PyOpcodeProfile));
+    if (prof == NULL) {
+        return NULL;
+    }
+    prof->code = co;
+    Py_INCREF(co->co_filename);
+    prof->filename = co->co_filename;
+    Py_INCREF(co->co_name);
+    prof->name = co->co_name;
+    prof->firstlineno = co->co_firstlineno;
+
+    OPPROFILES_LOCK();
+    prof->next = opcode_profiles;
+    opcode_profiles = prof;
+    OPPROFILES_UNLOCK();
+
+    co->co_opprofile = prof;
+    return prof;
+}
+
+static _PyOpcodeProfile_Pair *
+opprofile_lookup_pair(_PyOpcodeProfile_Pair *pairs, Py_ssize_t size,
+                      uint16_t key)
+{
+    size_t mask = (size_t)size - 1;
+    /* Mix both opcodes into the low bits */
+    size_t i = ((size_t)(key >> 8) * 31 + (key & 0xff)) & mask;
+
+    while (pairs[i].key != key && pairs[i].key != 0) {
+        i = (i + 1) & mask;
+    }
+    return &pairs[i];
+}
+
+/* Double the size of the hash table of pairs: return -1 on memory error */
+static int
+opprofile_resize_pairs(_PyOpcodeProfile *prof)
+{
+    Py_ssize_t size, i;
+    _PyOpcodeProfile_Pair *pairs;
+
+    size = prof->pairs_size ? prof->pairs_size * 2 : OPPROFILE_MINPAIRS;
+    pairs = (_PyOpcodeProfile_Pair *)PyMem_Calloc(
+        size, sizeof(_PyOpcodeProfile_Pair));
+    if (pairs == NULL) {
+        return -1;
+    }
+    for (i = 0; i < prof->pairs_size; i++) {
+        _PyOpcodeProfile_Pair *old = &prof->pairs[i];
+        if (old->key != 0) {
+            *opprofile_lookup_pair(pairs, size, old->key) = *old;
+        }
+    }
+    PyMem_Free(prof->pairs);
+    prof->pairs = pairs;
+    prof->pairs_size = size;
+    return 0;
+}
+
+void
+_PyCode_CountOpcode(PyCodeObject *co, int lastopcode, int opcode)
+{
+    _PyOpcodeProfile *prof = co->co_opprofile;
+    _PyOpcodeProfile_Pair *pair;
+    uint16_t key;
+
+    if (prof == NULL) {
+        prof = opprofile_new(co);
+        if (prof == NULL) {
+            /* Lose the count rather than failing the frame */
+            return;
+        }
+    }
+    prof->counts[opcode]++;
+    if (lastopcode == 0) {
+        return;
+    }
+
+    /* Keep the table at most half full */
+    if (prof->pairs_used * 2 >= prof->pairs_size) {
+        if (opprofile_resize_pairs(prof) < 0) {
+            return;
+        }
+    }
+    key = (uint16_t)((lastopcode << 8) | opcode);
+    pair = opprofile_lookup_pair(prof->pairs, prof->pairs_size, key);
+    if (pair->key == 0) {
+        pair->key = key;
+        prof->pairs_used++;
+    }
+    pair->count++;
+}
+
+static PyObject *
+opprofile_as_tuple(_PyOpcodeProfile *prof)
+{
+    PyObject *counts = NULL, *pairs = NULL, *key, *value;
+    Py_ssize_t i;
+    int res;
+
+    counts = PyDict_New();
+    if (counts == NULL) {
+        goto error;
+    }
+    for (i = 0; i < 256; i++) {
+        if (prof->counts[i] == 0) {
+            continue;
+        }
+        key = PyLong_FromSsize_t(i);
+        if (key == NULL) {
+            goto error;
+        }
+        value = PyLong_FromUnsignedLongLong(prof->counts[i]);
+        if (value == NULL) {
+            Py_DECREF(key);
+            goto error;
+        }
+        res = PyDict_SetItem(counts, key, value);
+        Py_DECREF(key);
+        Py_DECREF(value);
+        if (res < 0) {
+            goto error;
+        }
+    }
+
+    pairs = PyDict_New();
+    if (pairs == NULL) {
+        goto error;
+    }
+    for (i = 0; i < prof->pairs_size; i++) {
+        _PyOpcodeProfile_Pair *pair = &prof->pairs[i];
+        if (pair->key == 0) {
+            continue;
+        }
+        key = Py_BuildValue("(ii)", pair->key >> 8, pair->key & 0xff);
+        if (key == NULL) {
+            goto error;
+        }
+        value = PyLong_FromUnsignedLongLong(pair->count);
+        if (value == NULL) {
+            Py_DECREF(key);
+            goto error;
+        }
+        res = PyDict_SetItem(pairs, key, value);
+        Py_DECREF(key);
+        Py_DECREF(value);
+        if (res < 0) {
+            goto error;
+        }
+    }
+
+    return Py_BuildValue("(OiONN)", prof->filename, prof->firstlineno,
+                         prof->name, counts, pairs);
+
+error:
+    Py_XDECREF(counts);
+    Py_XDECREF(pairs);
+    return NULL;
+}
+
+/* Release the names and the pairs of prof, but not prof itself */
+static void
+opprofile_clear(_PyOpcodeProfile *prof)
+{
+    Py_DECREF(prof->filename);
+    Py_DECREF(prof->name);
+    PyMem_Free(prof->pairs);
+}
+
+/* Copy the list of profiles into an array of n profiles.  Return 0 on
+   success, or -1 without an exception on memory error.  Nothing here runs
+   Python code, so the list can't change under our feet. */
+static int
+opprofile_snapshot(_PyOpcodeProfile **copies, Py_ssize_t *n)
+{
+    _PyOpcodeProfile *prof, *copy;
+    Py_ssize_t size = 0, i = 0;
+
+    for (prof = opcode_profiles; prof != NULL; prof = prof->next) {
+        size++;
+    }
+    *copies = NULL;
+    *n = 0;
+    if (size == 0) {
+        return 0;
+    }
+    *copies = PyMem_New(_PyOpcodeProfile, size);
+    if (*copies == NULL) {
+        return -1;
+    }
+    for (prof = opcode_profiles; prof != NULL; prof = prof->next, i++) {
+        copy = &(*copies)[i];
+        *copy = *prof;
+        copy->next = NULL;
+        copy->code = NULL;
+        if (prof->pairs_size > 0) {
+            copy->pairs = PyMem_New(_PyOpcodeProfile_Pair, prof->pairs_size);
+            if (copy->pairs == NULL) {
+                goto error;
+            }
+            memcpy(copy->pairs, prof->pairs,
+                   prof->pairs_size * sizeof(_PyOpcodeProfile_Pair));
+        }
+        Py_INCREF(copy->filename);
+        Py_INCREF(copy->name);
+        (*n)++;
+    }
+    return 0;
+
+error:
+    for (i = 0; i < *n; i++) {
+        opprofile_clear(&(*copies)[i]);
+    }
+    PyMem_Free(*copies);
+    *copies = NULL;
+    *n = 0;
+    return -1;
+}
+
+PyObject *
+_PyCode_GetOpcodeProfiles(void)
+{
+    PyObject *result = NULL, *item;
+    _PyOpcodeProfile *copies;
+    Py_ssize_t n, i;
+    int res;
+
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+    if (opcode_profiles_lock == NULL) {
+        return PyList_New(0);
+    }
+#endif
+    /* Building the tuples runs code which can profile new code objects or
+       clear the profiles: work on a copy of the list. */
+    OPPROFILES_LOCK();
+    res = opprofile_snapshot(&copies, &n);
+    OPPROFILES_UNLOCK();
+    if (res < 0) {
+        return PyErr_NoMemory();
+    }
+
+    result = PyList_New(n);
+    if (result == NULL) {
+        goto done;
+    }
+    for (i = 0; i < n; i++) {
+        item = opprofile_as_tuple(&copies[i]);
+        if (item == NULL) {
+            Py_CLEAR(result);
+            goto done;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+
+done:
+    for (i = 0; i < n; i++) {
+        opprofile_clear(&copies[i]);
+    }
+    PyMem_Free(copies);
+    return result;
+}
+
+void
+_PyCode_ClearOpcodeProfiles(void)
+{
+    _PyOpcodeProfile *prof, *next;
+
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+    if (opcode_profiles_lock == NULL) {
+        return;
+    }
+#endif
+    OPPROFILES_LOCK();
+    prof = opcode_profiles;
+    opcode_profiles = NULL;
+    OPPROFILES_UNLOCK();
+
+    for (; prof != NULL; prof = next) {
+        next = prof->next;
+        if (prof->code != NULL) {
+            prof->code->co_opprofile = NULL;
+        }
+        opprofile_clear(prof);
+        PyMem_Free(prof);
+    }
+}
+
 PyCodeObject *
 PyCode_NewEmpty(const char *filename, const char *funcname, int firstlineno)
 {
@@ -415,6 +799,19 @@ code_new(PyTypeObject *type, PyObject *args, PyObject *kw)
 static void
 code_dealloc(PyCodeObject *co)
 {
+    if (co->co_opcache != NULL) {
+        PyMem_FREE(co->co_opcache);
+    }
+    if (co->co_opcache_map != NULL) {
+        PyMem_FREE(co->co_opcache_map);
+    }
+    co->co_opcache_flag = 0;
+    co->co_opcache_size = 0;
+    if (co->co_opprofile != NULL) {
+        /* The counts are kept until _PyCode_ClearOpcodeProfiles() */
+        co->co_opprofile->code = NULL;
+    }
+
     if (co->co_extra != NULL) {
         PyInterpreterState *interp = PyThreadState_Get()->interp;
         _PyCodeObjectExtra *co_extra = co->co_extra;
@@ -461,6 +858,13 @@ code_sizeof(PyCodeObject *co, void *unused)
         res += sizeof(_PyCodeObjectExtra) +
                (co_extra->ce_size-1) * sizeof(co_extra->ce_extras[0]);
     }
+    if (co->co_opcache != NULL) {
+        assert(co->co_opcache_map != NULL);
+        // co_opcache_map
+        res += PyBytes_GET_SIZE(co->co_code) / sizeof(_Py_CODEUNIT) + 1;
+        // co_opcache
+        res += co->co_opcache_size * sizeof(_PyOpcache);
+    }
     return PyLong_FromSsize_t(res);
 }
 
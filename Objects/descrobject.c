@@ -292,24 +292,29 @@ _PyMethodDescr_FastCallKeywords(PyObject *descrobj,
 }
 
 static PyObject *
-classmethoddescr_call(PyMethodDescrObject *descr, PyObject *args,
-                      PyObject *kwds)
+methoddescr_vectorcall(PyObject *descr, PyObject *const *args,
+                       size_t nargsf, PyObject *kwnames)
 {
-    Py_ssize_t argc;
-    PyObject *self, *result;
+    return _PyMethodDescr_FastCallKeywords(descr, args,
+                                           PyVectorcall_NARGS(nargsf),
+                                           kwnames);
+}
 
-    /* Make sure that the first argument is acceptable as 'self' */
-    assert(PyTuple_Check(args));
-    argc = PyTuple_GET_SIZE(args);
-    if (argc < 1) {
+/* Make sure that the first argument is acceptable as 'self' of a
+   classmethod descriptor: return 0 on success, or raise an exception and
+   return -1 on error */
+static int
+classmethoddescr_check_self(PyMethodDescrObject *descr, Py_ssize_t nargs,
+                            PyObject *self)
+{
+    if (nargs < 1) {
         PyErr_Format(PyExc_TypeError,
                      "descriptor '%V' of '%.100s' "
                      "object needs an argument",
                      descr_name((PyDescrObject *)descr), "?",
                      PyDescr_TYPE(descr)->tp_name);
-        return NULL;
+        return -1;
     }
-    self = PyTuple_GET_ITEM(args, 0);
     if (!PyType_Check(self)) {
         PyErr_Format(PyExc_TypeError,
                      "descriptor '%V' requires a type "
@@ -317,7 +322,7 @@ classmethoddescr_call(PyMethodDescrObject *descr, PyObject *args,
                      descr_name((PyDescrObject *)descr), "?",
                      PyDescr_TYPE(descr)->tp_name,
                      self->ob_type->tp_name);
-        return NULL;
+        return -1;
     }
     if (!PyType_IsSubtype((PyTypeObject *)self, PyDescr_TYPE(descr))) {
         PyErr_Format(PyExc_TypeError,
@@ -327,6 +332,22 @@ classmethoddescr_call(PyMethodDescrObject *descr, PyObject *args,
                      descr_name((PyDescrObject *)descr), "?",
                      PyDescr_TYPE(descr)->tp_name,
                      self->ob_type->tp_name);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject *
+classmethoddescr_call(PyMethodDescrObject *descr, PyObject *args,
+                      PyObject *kwds)
+{
+    Py_ssize_t argc;
+    PyObject *self, *result;
+
+    assert(PyTuple_Check(args));
+    argc = PyTuple_GET_SIZE(args);
+    self = (argc > 0) ? PyTuple_GET_ITEM(args, 0) : NULL;
+    if (classmethoddescr_check_self(descr, argc, self) < 0) {
         return NULL;
     }
 
@@ -337,6 +358,22 @@ classmethoddescr_call(PyMethodDescrObject *descr, PyObject *args,
     return result;
 }
 
+// same to classmethoddescr_call(), but use the vectorcall convention.
+static PyObject *
+classmethoddescr_vectorcall(PyObject *descrobj, PyObject *const *args,
+                            size_t nargsf, PyObject *kwnames)
+{
+    PyMethodDescrObject *descr = (PyMethodDescrObject *)descrobj;
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    PyObject *self = (nargs > 0) ? args[0] : NULL;
+
+    if (classmethoddescr_check_self(descr, nargs, self) < 0) {
+        return NULL;
+    }
+    return _PyMethodDef_RawFastCallKeywords(descr->d_method, self,
+                                            args + 1, nargs - 1, kwnames);
+}
+
 Py_LOCAL_INLINE(PyObject *)
 wrapperdescr_raw_call(PyWrapperDescrObject *descr, PyObject *self,
                       PyObject *args, PyObject *kwds)
@@ -541,7 +578,7 @@ PyTypeObject PyMethodDescr_Type = {
     sizeof(PyMethodDescrObject),
     0,
     (destructor)descr_dealloc,                  /* tp_dealloc */
-    0,                                          /* tp_print */
+    offsetof(PyMethodDescrObject, vectorcall),  /* tp_vectorcall_offset */
     0,                                          /* tp_getattr */
     0,                                          /* tp_setattr */
     0,                                          /* tp_reserved */
@@ -555,7 +592,8 @@ PyTypeObject PyMethodDescr_Type = {
     PyObject_GenericGetAttr,                    /* tp_getattro */
     0,                                          /* tp_setattro */
     0,                                          /* tp_as_buffer */
-    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC, /* tp_flags */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+        _Py_TPFLAGS_HAVE_VECTORCALL,            /* tp_flags */
     0,                                          /* tp_doc */
     descr_traverse,                             /* tp_traverse */
     0,                                          /* tp_clear */
@@ -579,7 +617,7 @@ PyTypeObject PyClassMethodDescr_Type = {
     sizeof(PyMethodDescrObject),
     0,
     (destructor)descr_dealloc,                  /* tp_dealloc */
-    0,                                          /* tp_print */
+    offsetof(PyMethodDescrObject, vectorcall),  /* tp_vectorcall_offset */
     0,                                          /* tp_getattr */
     0,                                          /* tp_setattr */
     0,                                          /* tp_reserved */
@@ -593,7 +631,8 @@ PyTypeObject PyClassMethodDescr_Type = {
     PyObject_GenericGetAttr,                    /* tp_getattro */
     0,                                          /* tp_setattro */
     0,                                          /* tp_as_buffer */
-    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC, /* tp_flags */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+        _Py_TPFLAGS_HAVE_VECTORCALL,            /* tp_flags */
     0,                                          /* tp_doc */
     descr_traverse,                             /* tp_traverse */
     0,                                          /* tp_clear */
@@ -749,8 +788,10 @@ PyDescr_NewMethod(PyTypeObject *type, PyMethodDef *method)
 
     descr = (PyMethodDescrObject *)descr_new(&PyMethodDescr_Type,
                                              type, method->ml_name);
-    if (descr != NULL)
+    if (descr != NULL) {
         descr->d_method = method;
+        descr->vectorcall = methoddescr_vectorcall;
+    }
     return (PyObject *)descr;
 }
 
@@ -761,8 +802,10 @@ PyDescr_NewClassMethod(PyTypeObject *type, PyMethodDef *method)
 
     descr = (PyMethodDescrObject *)descr_new(&PyClassMethodDescr_Type,
                                              type, method->ml_name);
-    if (descr != NULL)
+    if (descr != NULL) {
         descr->d_method = method;
+        descr->vectorcall = classmethoddescr_vectorcall;
+    }
     return (PyObject *)descr;
 }
 
@@ -22,7 +22,9 @@ typedef Py_ssize_t (*dict_lookup_func)
 struct _dictkeysobject {
     Py_ssize_t dk_refcnt;
 
-    /* Size of the hash table (dk_indices). It must be a power of 2. */
+    /* Size of the hash table (dk_indices). It must be a power of 2.
+       Compact tables, of at most DK_COMPACT_MAXSIZE entries, have no hash
+       table: dk_size is their number of entries. */
     Py_ssize_t dk_size;
 
     /* Function to lookup in the hash table (dk_indices):
@@ -53,12 +55,13 @@ struct _dictkeysobject {
 
        The size in bytes of an indice depends on dk_size:
 
+       - 0 byte (no hash table) if the table is compact
        - 1 byte if dk_size <= 0xff (char*)
        - 2 bytes if dk_size <= 0xffff (int16_t*)
        - 4 bytes if dk_size <= 0xffffffff (int32_t*)
        - 8 bytes otherwise (int64_t*)
 
-       Dynamically sized, SIZEOF_VOID_P is minimum. */
+       Dynamically sized, empty for compact tables. */
     char dk_indices[];  /* char is required to avoid strict aliasing. */
 
     /* "PyDictKeyEntry dk_entries[dk_usable];" array follows:
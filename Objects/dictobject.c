@@ -42,6 +42,14 @@ Size of indices is dk_size.  Type of each index in indices is vary on dk_size:
 dk_entries is array of PyDictKeyEntry.  It's size is USABLE_FRACTION(dk_size).
 DK_ENTRIES(dk) can be used to get pointer to entries.
 
+Small tables, with dk_size <= DK_COMPACT_MAXSIZE, are "compact": they have no
+dk_indices at all, dk_size is the number of entries (not necessarily a power
+of 2) and lookups scan the entries linearly.  Most dicts are small (keyword
+arguments, instance dicts, records decoded from JSON), and for them comparing
+a few hashes is as fast as probing a hash table while the table does not have
+to be kept one third empty.  When a compact table is full, it is resized into
+a larger compact table and then into a hash table, like any other table.
+
 NOTE: Since negative value is used for DKIX_EMPTY and DKIX_DUMMY, type of
 dk_indices entry is signed integer and int16 is used for table which
 dk_size == 256.
@@ -60,7 +68,8 @@ Or:
     ma_values != NULL, dk_refcnt >= 1
     Values are stored in the ma_values array.
     Only string (unicode) keys are allowed.
-    All dicts sharing same key must have same insertion order.
+    All dicts sharing same key must have same insertion order, but a dict
+    doesn't need a value for every key.
 
 There are four kinds of slots in the table (slot is index, and
 DK_ENTRIES(keys)[index] if index >= 0):
@@ -82,7 +91,7 @@ DK_ENTRIES(keys)[index] if index >= 0):
    they were once active.
 
 4. Pending. index >= 0, key != NULL, and value == NULL  (split only)
-   Not yet inserted in split-table.
+   Not yet inserted in split-table, or deleted from it.
 */
 
 /*
@@ -96,19 +105,31 @@ dk_nentries to achieve amortized O(1).  Since there are DKIX_DUMMY remains in
 dk_indices, we can't increment dk_usable even though dk_nentries is
 decremented.
 
-In split table, inserting into pending entry is allowed only for dk_entries[ix]
-where ix == mp->ma_used. Inserting into other index and deleting item cause
-converting the dict to the combined table.
+In split table, the values are stored in the order of the shared keys, which
+have holes where the dict has no value for a key.  A new key is appended to
+the shared keys.  Inserting into a pending entry dk_entries[ix] is allowed only
+if no entry after ix has a value; otherwise, the dict is converted to the
+combined table.  Deleting an item makes its entry pending again.
+
+Heap types share the keys of their instance dicts (see _PyObjectDict_SetItem)
+and keep a few variants of them for instances which set their attributes in
+another order.
 */
 
 /* PyDict_MINSIZE is the starting size for any new dict.
- * 8 allows dicts with no more than 5 active entries; experiments suggested
- * this suffices for the majority of dicts (consisting mostly of usually-small
- * dicts created to pass keyword arguments).
- * Making this 8, rather than 4 reduces the number of resizes for most
- * dictionaries, without any significant extra memory use.
+ * Tables of this size are compact (see below): 5 allows dicts with no more
+ * than 5 active entries, like the hash table of 8 slots used before compact
+ * tables, in less memory.  The table then grows to 8 entries.
+ * Presized dicts (e.g. dicts created to pass keyword arguments) get exactly
+ * the number of entries they need, down to 1.
+ */
+#define PyDict_MINSIZE 5
+
+/* Tables of at most DK_COMPACT_MAXSIZE entries are compact: they have no
+ * hash table and are searched by a linear scan of their entries.  Larger
+ * tables are hash tables of at least 2*DK_COMPACT_MAXSIZE slots.
  */
-#define PyDict_MINSIZE 8
+#define DK_COMPACT_MAXSIZE 8
 
 #include "Python.h"
 #include "internal/pystate.h"
@@ -285,15 +306,18 @@ PyDict_Fini(void)
 }
 
 #define DK_SIZE(dk) ((dk)->dk_size)
+#define DK_IS_COMPACT(dk) (DK_SIZE(dk) <= DK_COMPACT_MAXSIZE)
 #if SIZEOF_VOID_P > 4
 #define DK_IXSIZE(dk)                          \
-    (DK_SIZE(dk) <= 0xff ?                     \
+    (DK_IS_COMPACT(dk) ?                       \
+        0 : DK_SIZE(dk) <= 0xff ?              \
         1 : DK_SIZE(dk) <= 0xffff ?            \
             2 : DK_SIZE(dk) <= 0xffffffff ?    \
                 4 : sizeof(int64_t))
 #else
 #define DK_IXSIZE(dk)                          \
-    (DK_SIZE(dk) <= 0xff ?                     \
+    (DK_IS_COMPACT(dk) ?                       \
+        0 : DK_SIZE(dk) <= 0xff ?              \
         1 : DK_SIZE(dk) <= 0xffff ?            \
             2 : sizeof(int32_t))
 #endif
@@ -315,6 +339,8 @@ dk_get_index(PyDictKeysObject *keys, Py_ssize_t i)
     Py_ssize_t s = DK_SIZE(keys);
     Py_ssize_t ix;
 
+    assert(!DK_IS_COMPACT(keys));
+
     if (s <= 0xff) {
         int8_t *indices = (int8_t*)(keys->dk_indices);
         ix = indices[i];
@@ -343,6 +369,7 @@ dk_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
 {
     Py_ssize_t s = DK_SIZE(keys);
 
+    assert(!DK_IS_COMPACT(keys));
     assert(ix >= DKIX_DUMMY);
 
     if (s <= 0xff) {
@@ -374,19 +401,22 @@ dk_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
  * collisions.  Decreasing it improves sparseness at the expense of spreading
  * indices over more cache lines and at the cost of total memory consumed.
  *
- * USABLE_FRACTION must obey the following:
- *     (0 < USABLE_FRACTION(n) < n) for all n >= 2
+ * USABLE_FRACTION must obey the following for hash tables:
+ *     (0 < USABLE_FRACTION(n) < n) for all n > DK_COMPACT_MAXSIZE
+ * Compact tables have no collisions: all their entries are usable.
  *
  * USABLE_FRACTION should be quick to calculate.
  * Fractions around 1/2 to 2/3 seem to work well in practice.
  */
-#define USABLE_FRACTION(n) (((n) << 1)/3)
+#define USABLE_FRACTION(n) \
+    ((n) <= DK_COMPACT_MAXSIZE ? (n) : ((n) << 1)/3)
 
 /* ESTIMATE_SIZE is reverse function of USABLE_FRACTION.
  * This can be used to reserve enough size to insert n entries without
  * resizing.
  */
-#define ESTIMATE_SIZE(n)  (((n)*3+1) >> 1)
+#define ESTIMATE_SIZE(n) \
+    ((n) <= DK_COMPACT_MAXSIZE ? (n) : ((n)*3+1) >> 1)
 
 /* Alternative fraction that is otherwise close enough to 2n/3 to make
  * little difference. 8 * 2/3 == 8 * 5/8 == 5. 16 * 2/3 == 16 * 5/8 == 10.
@@ -401,11 +431,22 @@ dk_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
  * but have more head room when the number of deletions is on a par with the
  * number of insertions.  See also bpo-17563 and bpo-33205.
  *
+ *
+ * Compact tables only grow by half (2 -> 3 -> 5 -> 8 entries) since every
+ * unused entry costs as much as the entries of the hash table of a
+ * larger dict.  A full compact table of 8 entries becomes a hash table of
+ * 16 slots (10 entries).
+ *
  * GROWTH_RATE was set to used*4 up to version 3.2.
  * GROWTH_RATE was set to used*2 in version 3.3.0
  * GROWTH_RATE was set to used*2 + capacity/2 in 3.4.0-3.6.0.
  */
-#define GROWTH_RATE(d) ((d)->ma_used*3)
+#define GROWTH_RATE(used) \
+    ((used) < DK_COMPACT_MAXSIZE ? \
+        Py_MIN((used) + ((used) + 1) / 2, DK_COMPACT_MAXSIZE) : \
+     (used) == DK_COMPACT_MAXSIZE ? \
+        2 * DK_COMPACT_MAXSIZE : \
+        (used)*3)
 
 #define ENSURE_ALLOWS_DELETIONS(d) \
     if ((d)->ma_keys->dk_lookup == lookdict_unicode_nodummy) { \
@@ -421,8 +462,6 @@ static PyDictKeysObject empty_keys_struct = {
         lookdict_split, /* dk_lookup */
         0, /* dk_usable (immutable) */
         0, /* dk_nentries */
-        {DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY,
-         DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY}, /* dk_indices */
 };
 
 static PyObject *empty_values[1] = { NULL };
@@ -446,7 +485,7 @@ _PyDict_CheckConsistency(PyDictObject *mp)
 #endif
 
     assert(0 <= mp->ma_used && mp->ma_used <= usable);
-    assert(IS_POWER_OF_2(keys->dk_size));
+    assert(DK_IS_COMPACT(keys) || IS_POWER_OF_2(keys->dk_size));
     assert(0 <= keys->dk_usable
            && keys->dk_usable <= usable);
     assert(0 <= keys->dk_nentries
@@ -459,7 +498,7 @@ _PyDict_CheckConsistency(PyDictObject *mp)
     }
 
 #ifdef DEBUG_PYDICT
-    for (i=0; i < keys->dk_size; i++) {
+    for (i=0; !DK_IS_COMPACT(keys) && i < keys->dk_size; i++) {
         Py_ssize_t ix = dk_get_index(keys, i);
         assert(DKIX_DUMMY <= ix && ix <= usable);
     }
@@ -490,9 +529,13 @@ _PyDict_CheckConsistency(PyDictObject *mp)
 
     if (splitted) {
         /* splitted table */
-        for (i=0; i < mp->ma_used; i++) {
-            assert(mp->ma_values[i] != NULL);
+        Py_ssize_t used = 0;
+        for (i=0; i < keys->dk_nentries; i++) {
+            if (mp->ma_values[i] != NULL) {
+                used++;
+            }
         }
+        assert(used == mp->ma_used);
     }
 #endif
 
@@ -506,11 +549,14 @@ static PyDictKeysObject *new_keys_object(Py_ssize_t size)
     PyDictKeysObject *dk;
     Py_ssize_t es, usable;
 
-    assert(size >= PyDict_MINSIZE);
-    assert(IS_POWER_OF_2(size));
+    assert(size >= 1);
+    assert(size <= DK_COMPACT_MAXSIZE || IS_POWER_OF_2(size));
 
     usable = USABLE_FRACTION(size);
-    if (size <= 0xff) {
+    if (size <= DK_COMPACT_MAXSIZE) {
+        es = 0;
+    }
+    else if (size <= 0xff) {
         es = 1;
     }
     else if (size <= 0xffff) {
@@ -672,6 +718,8 @@ PyDict_New(void)
 static Py_ssize_t
 lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
 {
+    assert(!DK_IS_COMPACT(k));
+
     size_t mask = DK_MASK(k);
     size_t perturb = (size_t)hash;
     size_t i = (size_t)hash & mask;
@@ -713,7 +761,77 @@ is string.  Otherwise, it falls back to lookdict().
 lookdict_unicode_nodummy is further specialized for string keys that cannot be
 the <dummy> value.
 For both, when the key isn't found a DKIX_EMPTY is returned.
+
+All of them handle compact tables with a linear scan of the entries:
+lookdict_compact() and lookdict_compact_unicode() below.
 */
+
+/* Linear search of a compact table.  Deleted entries have a NULL me_key. */
+static Py_ssize_t
+lookdict_compact(PyDictObject *mp, PyObject *key,
+                 Py_hash_t hash, PyObject **value_addr)
+{
+    PyDictKeysObject *dk = mp->ma_keys;
+    PyDictKeyEntry *ep0 = DK_ENTRIES(dk);
+
+    assert(DK_IS_COMPACT(dk));
+    for (Py_ssize_t ix = 0; ix < dk->dk_nentries; ix++) {
+        PyDictKeyEntry *ep = &ep0[ix];
+        /* Equal keys have equal hashes: compare hashes first, it is enough
+           to skip most entries */
+        if (ep->me_hash != hash) {
+            continue;
+        }
+        if (ep->me_key == key) {
+            *value_addr = ep->me_value;
+            return ix;
+        }
+        if (ep->me_key != NULL) {
+            PyObject *startkey = ep->me_key;
+            Py_INCREF(startkey);
+            int cmp = PyObject_RichCompareBool(startkey, key, Py_EQ);
+            Py_DECREF(startkey);
+            if (cmp < 0) {
+                *value_addr = NULL;
+                return DKIX_ERROR;
+            }
+            if (dk == mp->ma_keys && ep->me_key == startkey) {
+                if (cmp > 0) {
+                    *value_addr = ep->me_value;
+                    return ix;
+                }
+            }
+            else {
+                /* The dict was mutated, restart: it may not be compact
+                   anymore */
+                return lookdict(mp, key, hash, value_addr);
+            }
+        }
+    }
+    *value_addr = NULL;
+    return DKIX_EMPTY;
+}
+
+/* Linear search of a compact table of string keys for a string key.
+   Returns the index of the entry or DKIX_EMPTY: the caller gets the value. */
+static inline Py_ssize_t
+lookdict_compact_unicode(PyDictKeysObject *dk, PyObject *key, Py_hash_t hash)
+{
+    PyDictKeyEntry *ep0 = DK_ENTRIES(dk);
+
+    assert(DK_IS_COMPACT(dk));
+    for (Py_ssize_t ix = 0; ix < dk->dk_nentries; ix++) {
+        PyDictKeyEntry *ep = &ep0[ix];
+        if (ep->me_hash == hash &&
+            (ep->me_key == key ||
+             (ep->me_key != NULL && unicode_eq(ep->me_key, key)))) {
+            assert(PyUnicode_CheckExact(ep->me_key));
+            return ix;
+        }
+    }
+    return DKIX_EMPTY;
+}
+
 static Py_ssize_t _Py_HOT_FUNCTION
 lookdict(PyDictObject *mp, PyObject *key,
          Py_hash_t hash, PyObject **value_addr)
@@ -724,6 +842,9 @@ lookdict(PyDictObject *mp, PyObject *key,
 
 top:
     dk = mp->ma_keys;
+    if (DK_IS_COMPACT(dk)) {
+        return lookdict_compact(mp, key, hash, value_addr);
+    }
     ep0 = DK_ENTRIES(dk);
     mask = DK_MASK(dk);
     perturb = hash;
@@ -783,6 +904,11 @@ lookdict_unicode(PyDictObject *mp, PyObject *key,
         mp->ma_keys->dk_lookup = lookdict;
         return lookdict(mp, key, hash, value_addr);
     }
+    if (DK_IS_COMPACT(mp->ma_keys)) {
+        Py_ssize_t ix = lookdict_compact_unicode(mp->ma_keys, key, hash);
+        *value_addr = ix >= 0 ? DK_ENTRIES(mp->ma_keys)[ix].me_value : NULL;
+        return ix;
+    }
 
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
@@ -826,6 +952,11 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
         mp->ma_keys->dk_lookup = lookdict;
         return lookdict(mp, key, hash, value_addr);
     }
+    if (DK_IS_COMPACT(mp->ma_keys)) {
+        Py_ssize_t ix = lookdict_compact_unicode(mp->ma_keys, key, hash);
+        *value_addr = ix >= 0 ? DK_ENTRIES(mp->ma_keys)[ix].me_value : NULL;
+        return ix;
+    }
 
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
@@ -871,6 +1002,11 @@ lookdict_split(PyDictObject *mp, PyObject *key,
         }
         return ix;
     }
+    if (DK_IS_COMPACT(mp->ma_keys)) {
+        Py_ssize_t ix = lookdict_compact_unicode(mp->ma_keys, key, hash);
+        *value_addr = ix >= 0 ? mp->ma_values[ix] : NULL;
+        return ix;
+    }
 
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
@@ -982,7 +1118,29 @@ find_empty_slot(PyDictKeysObject *keys, Py_hash_t hash)
 static int
 insertion_resize(PyDictObject *mp)
 {
-    return dictresize(mp, GROWTH_RATE(mp));
+    return dictresize(mp, GROWTH_RATE(mp->ma_used));
+}
+
+static int grow_shared_keys(PyDictObject *mp);
+
+/* Return 1 if the pending entry ix of the split table mp can get a value
+   without breaking the insertion order, that is if no later entry has a
+   value. */
+static int
+split_can_fill(PyDictObject *mp, Py_ssize_t ix)
+{
+    PyObject **values = mp->ma_values;
+    Py_ssize_t i;
+
+    if (mp->ma_used == 0) {
+        return 1;
+    }
+    for (i = mp->ma_keys->dk_nentries - 1; i > ix; i--) {
+        if (values[i] != NULL) {
+            return 0;
+        }
+    }
+    return 1;
 }
 
 /*
@@ -1013,9 +1171,8 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
     /* When insertion order is different from shared key, we can't share
      * the key anymore.  Convert this instance to combine table.
      */
-    if (_PyDict_HasSplitTable(mp) &&
-        ((ix >= 0 && old_value == NULL && mp->ma_used != ix) ||
-         (ix == DKIX_EMPTY && mp->ma_used != mp->ma_keys->dk_nentries))) {
+    if (_PyDict_HasSplitTable(mp) && ix >= 0 && old_value == NULL &&
+        !split_can_fill(mp, ix)) {
         if (insertion_resize(mp) < 0)
             goto Fail;
         ix = DKIX_EMPTY;
@@ -1025,13 +1182,21 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
         /* Insert into new slot. */
         assert(old_value == NULL);
         if (mp->ma_keys->dk_usable <= 0) {
-            /* Need to resize. */
-            if (insertion_resize(mp) < 0)
+            /* Need to resize.  Keys still shared with other dicts stay
+               shared in a larger table. */
+            if (_PyDict_HasSplitTable(mp) && mp->ma_values != empty_values &&
+                mp->ma_keys->dk_refcnt > 1) {
+                if (grow_shared_keys(mp) < 0)
+                    goto Fail;
+            }
+            else if (insertion_resize(mp) < 0)
                 goto Fail;
         }
-        Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
+        if (!DK_IS_COMPACT(mp->ma_keys)) {
+            Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
+            dk_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+        }
         ep = &DK_ENTRIES(mp->ma_keys)[mp->ma_keys->dk_nentries];
-        dk_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
         ep->me_key = key;
         ep->me_hash = hash;
         if (mp->ma_values) {
@@ -1054,7 +1219,6 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
         mp->ma_values[ix] = value;
         if (old_value == NULL) {
             /* pending state */
-            assert(ix == mp->ma_used);
             mp->ma_used++;
         }
     }
@@ -1081,6 +1245,10 @@ Internal routine used by dictresize() to build a hashtable of entries.
 static void
 build_indices(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
 {
+    if (DK_IS_COMPACT(keys)) {
+        /* Compact tables have no indices */
+        return;
+    }
     size_t mask = (size_t)DK_SIZE(keys) - 1;
     for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
         Py_hash_t hash = ep->me_hash;
@@ -1093,6 +1261,23 @@ build_indices(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
     }
 }
 
+/* Find the smallest table size >= minsize: compact tables fit exactly,
+   hash tables have a power of 2 size.  Return 0 on overflow. */
+static Py_ssize_t
+calculate_keysize(Py_ssize_t minsize)
+{
+    Py_ssize_t size;
+
+    if (minsize <= DK_COMPACT_MAXSIZE) {
+        return Py_MAX(minsize, 1);
+    }
+    for (size = 2 * DK_COMPACT_MAXSIZE;
+         size < minsize && size > 0;
+         size <<= 1)
+        ;
+    return Py_MAX(size, 0);
+}
+
 /*
 Restructure the table by allocating a new table and reinserting all
 items again.  When entries have been deleted, the new table may
@@ -1111,11 +1296,7 @@ dictresize(PyDictObject *mp, Py_ssize_t minsize)
     PyObject **oldvalues;
     PyDictKeyEntry *oldentries, *newentries;
 
-    /* Find the smallest table size > minused. */
-    for (newsize = PyDict_MINSIZE;
-         newsize < minsize && newsize > 0;
-         newsize <<= 1)
-        ;
+    newsize = calculate_keysize(minsize);
     if (newsize <= 0) {
         PyErr_NoMemory();
         return -1;
@@ -1146,16 +1327,21 @@ dictresize(PyDictObject *mp, Py_ssize_t minsize)
     if (oldvalues != NULL) {
         /* Convert split table into new combined table.
          * We must incref keys; we can transfer values.
-         * Note that values of split table is always dense.
+         * Pending entries of the split table are skipped.
          */
-        for (Py_ssize_t i = 0; i < numentries; i++) {
-            assert(oldvalues[i] != NULL);
+        Py_ssize_t j = 0;
+        for (Py_ssize_t i = 0; j < numentries; i++) {
+            assert(i < oldkeys->dk_nentries);
+            if (oldvalues[i] == NULL) {
+                continue;
+            }
             PyDictKeyEntry *ep = &oldentries[i];
             PyObject *key = ep->me_key;
             Py_INCREF(key);
-            newentries[i].me_key = key;
-            newentries[i].me_hash = ep->me_hash;
-            newentries[i].me_value = oldvalues[i];
+            newentries[j].me_key = key;
+            newentries[j].me_hash = ep->me_hash;
+            newentries[j].me_value = oldvalues[i];
+            j++;
         }
 
         DK_DECREF(oldkeys);
@@ -1194,6 +1380,59 @@ dictresize(PyDictObject *mp, Py_ssize_t minsize)
     return 0;
 }
 
+/* Copy the full keys of the split table mp, which are shared with other
+ * dicts, into larger keys used by mp only.  Unlike dictresize(), mp stays
+ * split and keeps its pending entries, so that _PyObjectDict_SetItem() can
+ * share the larger keys with the other instances of the type.
+ */
+static int
+grow_shared_keys(PyDictObject *mp)
+{
+    PyDictKeysObject *oldkeys = mp->ma_keys, *newkeys;
+    PyObject **oldvalues = mp->ma_values, **newvalues;
+    PyDictKeyEntry *oldentries, *newentries;
+    Py_ssize_t i, size, numentries = oldkeys->dk_nentries;
+
+    assert(_PyDict_HasSplitTable(mp));
+    size = calculate_keysize(GROWTH_RATE(numentries));
+    if (size <= 0) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    newkeys = new_keys_object(size);
+    if (newkeys == NULL) {
+        return -1;
+    }
+    newvalues = new_values(USABLE_FRACTION(size));
+    if (newvalues == NULL) {
+        DK_DECREF(newkeys);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    oldentries = DK_ENTRIES(oldkeys);
+    newentries = DK_ENTRIES(newkeys);
+    for (i = 0; i < numentries; i++) {
+        Py_INCREF(oldentries[i].me_key);
+        newentries[i].me_key = oldentries[i].me_key;
+        newentries[i].me_hash = oldentries[i].me_hash;
+        newvalues[i] = oldvalues[i];
+    }
+    for (; i < USABLE_FRACTION(size); i++) {
+        newvalues[i] = NULL;
+    }
+    build_indices(newkeys, newentries, numentries);
+    newkeys->dk_lookup = lookdict_split;
+    newkeys->dk_usable -= numentries;
+    newkeys->dk_nentries = numentries;
+
+    mp->ma_keys = newkeys;
+    mp->ma_values = newvalues;
+    DK_DECREF(oldkeys);
+    free_values(oldvalues);
+    return 0;
+}
+
 /* Returns NULL if unable to split table.
  * A NULL return does not necessarily indicate an error */
 static PyDictKeysObject *
@@ -1252,14 +1491,20 @@ _PyDict_NewPresized(Py_ssize_t minused)
     if (minused > USABLE_FRACTION(max_presize)) {
         newsize = max_presize;
     }
+    else if (minused <= 0) {
+        newsize = PyDict_MINSIZE;
+    }
+    else if (minused <= DK_COMPACT_MAXSIZE) {
+        newsize = minused;
+    }
     else {
         Py_ssize_t minsize = ESTIMATE_SIZE(minused);
-        newsize = PyDict_MINSIZE;
+        newsize = 2 * DK_COMPACT_MAXSIZE;
         while (newsize < minsize) {
             newsize <<= 1;
         }
     }
-    assert(IS_POWER_OF_2(newsize));
+    assert(newsize <= DK_COMPACT_MAXSIZE || IS_POWER_OF_2(newsize));
 
     new_keys = new_keys_object(newsize);
     if (new_keys == NULL)
@@ -1424,6 +1669,61 @@ _PyDict_LoadGlobal(PyDictObject *globals, PyDictObject *builtins, PyObject *key)
     return value;
 }
 
+/* Return the index of key in the keys of the split table mp, for use as
+ * an attribute cache hint in ceval.c.  Return -1 if mp is not a split table
+ * or doesn't hold a value for key.  Never raises an exception.
+ */
+Py_ssize_t
+_PyDict_GetSplitIndex(PyDictObject *mp, PyObject *key)
+{
+    Py_ssize_t ix;
+    Py_hash_t hash;
+    PyObject *value;
+
+    if (!_PyDict_HasSplitTable(mp) || !PyUnicode_CheckExact(key) ||
+        (hash = ((PyASCIIObject *) key)->hash) == -1)
+    {
+        return -1;
+    }
+    ix = lookdict_split(mp, key, hash, &value);
+    if (ix < 0 || value == NULL) {
+        return -1;
+    }
+    return ix;
+}
+
+/* Store value at index ix of the split table mp, without looking up the
+ * key.  Used by the STORE_ATTR cache in ceval.c.  Return -1 if the store
+ * would break the insertion order shared by the split tables using these
+ * keys; the caller must then fall back to PyDict_SetItem().  Return 0 on
+ * success.
+ */
+int
+_PyDict_SetSplitItemAt(PyDictObject *mp, Py_ssize_t ix, PyObject *value)
+{
+    PyObject *old_value;
+
+    assert(_PyDict_HasSplitTable(mp));
+    assert(0 <= ix && ix < mp->ma_keys->dk_nentries);
+    old_value = mp->ma_values[ix];
+    if (old_value == NULL) {
+        /* A pending entry can only be filled if no later entry has a
+           value, see insertdict(). */
+        if (!split_can_fill(mp, ix)) {
+            return -1;
+        }
+        mp->ma_used++;
+    }
+
+    Py_INCREF(value);
+    MAINTAIN_TRACKING(mp, DK_ENTRIES(mp->ma_keys)[ix].me_key, value);
+    mp->ma_values[ix] = value;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
+    Py_XDECREF(old_value);
+    assert(_PyDict_CheckConsistency(mp));
+    return 0;
+}
+
 /* CAUTION: PyDict_SetItem() must guarantee that it won't resize the
  * dictionary if it's merely replacing the value for an existing key.
  * This means that it's safe to loop over a dictionary with PyDict_Next()
@@ -1480,13 +1780,25 @@ delitem_common(PyDictObject *mp, Py_hash_t hash, Py_ssize_t ix,
     PyObject *old_key;
     PyDictKeyEntry *ep;
 
-    Py_ssize_t hashpos = lookdict_index(mp->ma_keys, hash, ix);
-    assert(hashpos >= 0);
+    if (_PyDict_HasSplitTable(mp)) {
+        /* The key stays in the shared keys, its entry becomes pending */
+        mp->ma_values[ix] = NULL;
+        mp->ma_used--;
+        mp->ma_version_tag = DICT_NEXT_VERSION();
+        Py_DECREF(old_value);
+        assert(_PyDict_CheckConsistency(mp));
+        return 0;
+    }
+
+    if (!DK_IS_COMPACT(mp->ma_keys)) {
+        Py_ssize_t hashpos = lookdict_index(mp->ma_keys, hash, ix);
+        assert(hashpos >= 0);
+        dk_set_index(mp->ma_keys, hashpos, DKIX_DUMMY);
+    }
 
     mp->ma_used--;
     mp->ma_version_tag = DICT_NEXT_VERSION();
     ep = &DK_ENTRIES(mp->ma_keys)[ix];
-    dk_set_index(mp->ma_keys, hashpos, DKIX_DUMMY);
     ENSURE_ALLOWS_DELETIONS(mp);
     old_key = ep->me_key;
     ep->me_key = NULL;
@@ -1535,15 +1847,6 @@ _PyDict_DelItem_KnownHash(PyObject *op, PyObject *key, Py_hash_t hash)
         return -1;
     }
 
-    // Split table doesn't allow deletion.  Combine it.
-    if (_PyDict_HasSplitTable(mp)) {
-        if (dictresize(mp, DK_SIZE(mp->ma_keys))) {
-            return -1;
-        }
-        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &old_value);
-        assert(ix >= 0);
-    }
-
     return delitem_common(mp, hash, ix, old_value);
 }
 
@@ -1555,7 +1858,7 @@ int
 _PyDict_DelItemIf(PyObject *op, PyObject *key,
                   int (*predicate)(PyObject *value))
 {
-    Py_ssize_t hashpos, ix;
+    Py_ssize_t ix;
     PyDictObject *mp;
     Py_hash_t hash;
     PyObject *old_value;
@@ -1578,24 +1881,12 @@ _PyDict_DelItemIf(PyObject *op, PyObject *key,
         return -1;
     }
 
-    // Split table doesn't allow deletion.  Combine it.
-    if (_PyDict_HasSplitTable(mp)) {
-        if (dictresize(mp, DK_SIZE(mp->ma_keys))) {
-            return -1;
-        }
-        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &old_value);
-        assert(ix >= 0);
-    }
-
     res = predicate(old_value);
     if (res == -1)
         return -1;
 
-    hashpos = lookdict_index(mp->ma_keys, hash, ix);
-    assert(hashpos >= 0);
-
     if (res > 0)
-        return delitem_common(mp, hashpos, ix, old_value);
+        return delitem_common(mp, hash, ix, old_value);
     else
         return 0;
 }
@@ -1656,12 +1947,16 @@ _PyDict_Next(PyObject *op, Py_ssize_t *ppos, PyObject **pkey,
     mp = (PyDictObject *)op;
     i = *ppos;
     if (mp->ma_values) {
-        if (i < 0 || i >= mp->ma_used)
+        Py_ssize_t n = mp->ma_keys->dk_nentries;
+        if (i < 0 || i >= n)
+            return 0;
+        /* skip the pending entries of the split table */
+        while (i < n && mp->ma_values[i] == NULL)
+            i++;
+        if (i >= n)
             return 0;
-        /* values of split table is always dense */
         entry_ptr = &DK_ENTRIES(mp->ma_keys)[i];
         value = mp->ma_values[i];
-        assert(value != NULL);
     }
     else {
         Py_ssize_t n = mp->ma_keys->dk_nentries;
@@ -1742,21 +2037,23 @@ _PyDict_Pop_KnownHash(PyObject *dict, PyObject *key, Py_hash_t hash, PyObject *d
         return NULL;
     }
 
-    // Split table doesn't allow deletion.  Combine it.
     if (_PyDict_HasSplitTable(mp)) {
-        if (dictresize(mp, DK_SIZE(mp->ma_keys))) {
-            return NULL;
-        }
-        ix = (mp->ma_keys->dk_lookup)(mp, key, hash, &old_value);
-        assert(ix >= 0);
+        /* The entry of the key becomes pending, see delitem_common() */
+        mp->ma_values[ix] = NULL;
+        mp->ma_used--;
+        mp->ma_version_tag = DICT_NEXT_VERSION();
+        assert(_PyDict_CheckConsistency(mp));
+        return old_value;
     }
 
-    hashpos = lookdict_index(mp->ma_keys, hash, ix);
-    assert(hashpos >= 0);
+    if (!DK_IS_COMPACT(mp->ma_keys)) {
+        hashpos = lookdict_index(mp->ma_keys, hash, ix);
+        assert(hashpos >= 0);
+        dk_set_index(mp->ma_keys, hashpos, DKIX_DUMMY);
+    }
     assert(old_value != NULL);
     mp->ma_used--;
     mp->ma_version_tag = DICT_NEXT_VERSION();
-    dk_set_index(mp->ma_keys, hashpos, DKIX_DUMMY);
     ep = &DK_ENTRIES(mp->ma_keys)[ix];
     ENSURE_ALLOWS_DELETIONS(mp);
     old_key = ep->me_key;
@@ -2795,9 +3092,8 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
     if (ix == DKIX_ERROR)
         return NULL;
 
-    if (_PyDict_HasSplitTable(mp) &&
-        ((ix >= 0 && value == NULL && mp->ma_used != ix) ||
-         (ix == DKIX_EMPTY && mp->ma_used != mp->ma_keys->dk_nentries))) {
+    if (_PyDict_HasSplitTable(mp) && ix >= 0 && value == NULL &&
+        !split_can_fill(mp, ix)) {
         if (insertion_resize(mp) < 0) {
             return NULL;
         }
@@ -2808,14 +3104,23 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
         PyDictKeyEntry *ep, *ep0;
         value = defaultobj;
         if (mp->ma_keys->dk_usable <= 0) {
-            if (insertion_resize(mp) < 0) {
+            /* See insertdict() */
+            if (_PyDict_HasSplitTable(mp) && mp->ma_values != empty_values &&
+                mp->ma_keys->dk_refcnt > 1) {
+                if (grow_shared_keys(mp) < 0) {
+                    return NULL;
+                }
+            }
+            else if (insertion_resize(mp) < 0) {
                 return NULL;
             }
         }
-        Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
+        if (!DK_IS_COMPACT(mp->ma_keys)) {
+            Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
+            dk_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+        }
         ep0 = DK_ENTRIES(mp->ma_keys);
         ep = &ep0[mp->ma_keys->dk_nentries];
-        dk_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
         Py_INCREF(key);
         Py_INCREF(value);
         MAINTAIN_TRACKING(mp, key, value);
@@ -2837,7 +3142,6 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
     else if (value == NULL) {
         value = defaultobj;
         assert(_PyDict_HasSplitTable(mp));
-        assert(ix == mp->ma_used);
         Py_INCREF(value);
         MAINTAIN_TRACKING(mp, key, value);
         mp->ma_values[ix] = value;
@@ -2934,10 +3238,12 @@ dict_popitem(PyDictObject *mp, PyObject *Py_UNUSED(ignored))
     assert(i >= 0);
 
     ep = &ep0[i];
-    j = lookdict_index(mp->ma_keys, ep->me_hash, i);
-    assert(j >= 0);
-    assert(dk_get_index(mp->ma_keys, j) == i);
-    dk_set_index(mp->ma_keys, j, DKIX_DUMMY);
+    if (!DK_IS_COMPACT(mp->ma_keys)) {
+        j = lookdict_index(mp->ma_keys, ep->me_hash, i);
+        assert(j >= 0);
+        assert(dk_get_index(mp->ma_keys, j) == i);
+        dk_set_index(mp->ma_keys, j, DKIX_DUMMY);
+    }
 
     PyTuple_SET_ITEM(res, 0, ep->me_key);
     PyTuple_SET_ITEM(res, 1, ep->me_value);
@@ -3019,6 +3325,13 @@ _PyDict_KeysSize(PyDictKeysObject *keys)
             + USABLE_FRACTION(DK_SIZE(keys)) * sizeof(PyDictKeyEntry));
 }
 
+/* Number of keys in keys.  Shared keys only grow, by appending keys. */
+Py_ssize_t
+_PyDict_KeysNEntries(PyDictKeysObject *keys)
+{
+    return keys->dk_nentries;
+}
+
 static PyObject *
 dict_sizeof(PyDictObject *mp, PyObject *Py_UNUSED(ignored))
 {
@@ -3408,10 +3721,12 @@ dictiter_iternextkey(dictiterobject *di)
     k = d->ma_keys;
     assert(i >= 0);
     if (d->ma_values) {
-        if (i >= d->ma_used)
+        Py_ssize_t n = k->dk_nentries;
+        while (i < n && d->ma_values[i] == NULL)
+            i++;
+        if (i >= n)
             goto fail;
         key = DK_ENTRIES(k)[i].me_key;
-        assert(d->ma_values[i] != NULL);
     }
     else {
         Py_ssize_t n = k->dk_nentries;
@@ -3489,10 +3804,12 @@ dictiter_iternextvalue(dictiterobject *di)
     i = di->di_pos;
     assert(i >= 0);
     if (d->ma_values) {
-        if (i >= d->ma_used)
+        Py_ssize_t n = d->ma_keys->dk_nentries;
+        while (i < n && d->ma_values[i] == NULL)
+            i++;
+        if (i >= n)
             goto fail;
         value = d->ma_values[i];
-        assert(value != NULL);
     }
     else {
         Py_ssize_t n = d->ma_keys->dk_nentries;
@@ -3570,11 +3887,13 @@ dictiter_iternextitem(dictiterobject *di)
     i = di->di_pos;
     assert(i >= 0);
     if (d->ma_values) {
-        if (i >= d->ma_used)
+        Py_ssize_t n = d->ma_keys->dk_nentries;
+        while (i < n && d->ma_values[i] == NULL)
+            i++;
+        if (i >= n)
             goto fail;
         key = DK_ENTRIES(d->ma_keys)[i].me_key;
         value = d->ma_values[i];
-        assert(value != NULL);
     }
     else {
         Py_ssize_t n = d->ma_keys->dk_nentries;
@@ -4266,6 +4585,288 @@ _PyDict_NewKeysForClass(void)
 }
 
 #define CACHED_KEYS(tp) (((PyHeapTypeObject*)tp)->ht_cached_keys)
+#define CACHED_KEYS_VARIANTS(tp) \
+    (((PyHeapTypeObject*)tp)->ht_cached_keys_variants)
+
+/* Number of key layouts a heap type keeps, besides CACHED_KEYS(tp), for the
+   instances which set their attributes in another order.  A type whose
+   instances need more layouts stops sharing keys. */
+#define SHARED_KEYS_MAX_VARIANTS 3
+
+/* Statistics reported by sys._shared_keys_stats() */
+static Py_ssize_t shared_keys_variants = 0;
+static Py_ssize_t shared_keys_types_lost = 0;
+
+/* Release the shared keys of the heap type tp and their variants.  The
+   caller must call PyType_Modified(tp). */
+void
+_PyDict_ClearKeysForClass(PyTypeObject *tp)
+{
+    PyDictKeysObject *keys = CACHED_KEYS(tp);
+    PyDictKeysObject **variants = CACHED_KEYS_VARIANTS(tp);
+
+    CACHED_KEYS(tp) = NULL;
+    CACHED_KEYS_VARIANTS(tp) = NULL;
+    if (keys != NULL) {
+        DK_DECREF(keys);
+    }
+    if (variants != NULL) {
+        for (Py_ssize_t i = 0; i < SHARED_KEYS_MAX_VARIANTS; i++) {
+            if (variants[i] != NULL) {
+                DK_DECREF(variants[i]);
+            }
+        }
+        PyMem_Free(variants);
+    }
+}
+
+/* Memory used by the shared keys of the heap type tp and their variants */
+Py_ssize_t
+_PyDict_KeysForClassSize(PyTypeObject *tp)
+{
+    PyDictKeysObject **variants = CACHED_KEYS_VARIANTS(tp);
+    Py_ssize_t size = 0;
+
+    if (CACHED_KEYS(tp) != NULL) {
+        size += _PyDict_KeysSize(CACHED_KEYS(tp));
+    }
+    if (variants != NULL) {
+        size += SHARED_KEYS_MAX_VARIANTS * sizeof(PyDictKeysObject *);
+        for (Py_ssize_t i = 0; i < SHARED_KEYS_MAX_VARIANTS; i++) {
+            if (variants[i] != NULL) {
+                size += _PyDict_KeysSize(variants[i]);
+            }
+        }
+    }
+    return size;
+}
+
+PyObject *
+_PyDict_SharedKeysStats(void)
+{
+    return Py_BuildValue("{snsn}",
+                         "variants", shared_keys_variants,
+                         "types_lost", shared_keys_types_lost);
+}
+
+/* Index of the string key in the shared keys dk, or DKIX_EMPTY */
+static Py_ssize_t
+shared_keys_index(PyDictKeysObject *dk, PyObject *key, Py_hash_t hash)
+{
+    PyDictKeyEntry *ep0 = DK_ENTRIES(dk);
+    size_t mask, perturb, i;
+
+    if (DK_IS_COMPACT(dk)) {
+        return lookdict_compact_unicode(dk, key, hash);
+    }
+    mask = DK_MASK(dk);
+    perturb = (size_t)hash;
+    i = (size_t)hash & mask;
+    for (;;) {
+        Py_ssize_t ix = dk_get_index(dk, i);
+        if (ix == DKIX_EMPTY) {
+            return DKIX_EMPTY;
+        }
+        PyDictKeyEntry *ep = &ep0[ix];
+        if (ep->me_key == key ||
+            (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+            return ix;
+        }
+        perturb >>= PERTURB_SHIFT;
+        i = mask & (i*5 + perturb + 1);
+    }
+}
+
+/* Return 1 if the combined table mp can use the shared keys dk: dk holds
+   all the keys of mp, in the same order. */
+static int
+dict_fits_shared_keys(PyDictObject *mp, PyDictKeysObject *dk)
+{
+    PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
+    Py_ssize_t i, ix, last = -1;
+
+    assert(!_PyDict_HasSplitTable(mp));
+    if (mp->ma_keys->dk_lookup == lookdict || mp->ma_used > dk->dk_nentries) {
+        return 0;
+    }
+    for (i = 0; i < mp->ma_keys->dk_nentries; i++) {
+        if (ep0[i].me_value == NULL) {
+            continue;
+        }
+        ix = shared_keys_index(dk, ep0[i].me_key, ep0[i].me_hash);
+        if (ix <= last) {
+            return 0;
+        }
+        last = ix;
+    }
+    return 1;
+}
+
+/* Convert the combined table mp into a split table using the shared keys
+   dk, which dict_fits_shared_keys() accepted. */
+static int
+dict_use_shared_keys(PyDictObject *mp, PyDictKeysObject *dk)
+{
+    PyDictKeysObject *oldkeys = mp->ma_keys;
+    PyDictKeyEntry *ep0 = DK_ENTRIES(oldkeys);
+    PyObject **values;
+    Py_ssize_t i, size = USABLE_FRACTION(DK_SIZE(dk));
+
+    values = new_values(size);
+    if (values == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < size; i++) {
+        values[i] = NULL;
+    }
+    for (i = 0; i < oldkeys->dk_nentries; i++) {
+        PyObject *value = ep0[i].me_value;
+        if (value != NULL) {
+            Py_ssize_t ix = shared_keys_index(dk, ep0[i].me_key,
+                                              ep0[i].me_hash);
+            assert(ix >= 0);
+            Py_INCREF(value);
+            values[ix] = value;
+        }
+    }
+    DK_INCREF(dk);
+    mp->ma_keys = dk;
+    mp->ma_values = values;
+    /* Only the references to the keys and values are released */
+    DK_DECREF(oldkeys);
+    assert(_PyDict_CheckConsistency(mp));
+    return 0;
+}
+
+/* Store keys, a new reference, in the layout slot of the heap type tp.
+ *
+ * The attribute caches of ceval.c only record the address of CACHED_KEYS(tp)
+ * and the version tag of tp: the version tag is invalidated when the primary
+ * layout changes identity, since the old keys may be freed and their memory
+ * reused by other keys.  The variants are never cached, and storing the same
+ * keys again keeps the caches valid.
+ */
+static void
+set_shared_keys_slot(PyTypeObject *tp, PyDictKeysObject **slot,
+                     PyDictKeysObject *keys)
+{
+    PyDictKeysObject *oldkeys = *slot;
+
+    *slot = keys;
+    if (oldkeys != keys && slot == &CACHED_KEYS(tp)) {
+        PyType_Modified(tp);
+    }
+    if (oldkeys != NULL) {
+        DK_DECREF(oldkeys);
+    }
+}
+
+/* Called by _PyObjectDict_SetItem() when the instance dict mp of a type tp
+ * doesn't use the shared keys oldkeys anymore after PyDict_SetItem().
+ *
+ * Either grow_shared_keys() copied the keys into larger ones, which are then
+ * shared instead of them, or the new key broke the insertion order of the
+ * keys and mp was converted to a combined table.  mp then moves to another
+ * key layout of tp which fits its order, or gets a new one.
+ */
+static int
+shared_keys_changed(PyTypeObject *tp, PyDictObject *mp,
+                    PyDictKeysObject *oldkeys)
+{
+    PyDictKeysObject **variants = CACHED_KEYS_VARIANTS(tp);
+    PyDictKeysObject **slot = NULL;
+    PyDictKeysObject *keys;
+    Py_ssize_t i;
+
+    if (CACHED_KEYS(tp) == NULL) {
+        return 0;
+    }
+    /* oldkeys may have been freed: only compare it to the layouts of tp */
+    if (oldkeys == CACHED_KEYS(tp)) {
+        slot = &CACHED_KEYS(tp);
+    }
+    for (i = 0; variants != NULL && i < SHARED_KEYS_MAX_VARIANTS; i++) {
+        if (variants[i] == oldkeys) {
+            slot = &variants[i];
+        }
+    }
+
+    if (_PyDict_HasSplitTable(mp)) {
+        if (slot != NULL) {
+            DK_INCREF(mp->ma_keys);
+            set_shared_keys_slot(tp, slot, mp->ma_keys);
+        }
+        return 0;
+    }
+
+    if (dict_fits_shared_keys(mp, CACHED_KEYS(tp))) {
+        return dict_use_shared_keys(mp, CACHED_KEYS(tp));
+    }
+    for (i = 0; variants != NULL && i < SHARED_KEYS_MAX_VARIANTS; i++) {
+        if (variants[i] != NULL && dict_fits_shared_keys(mp, variants[i])) {
+            return dict_use_shared_keys(mp, variants[i]);
+        }
+    }
+
+    /* mp needs a layout of its own.  It replaces the layout mp left if no
+       other dict uses it (the type owns the last reference), otherwise it
+       takes a free or unused variant slot. */
+    if (slot == NULL || (*slot)->dk_refcnt > 1) {
+        slot = NULL;
+        if (variants == NULL) {
+            variants = PyMem_Calloc(SHARED_KEYS_MAX_VARIANTS,
+                                    sizeof(PyDictKeysObject *));
+            if (variants == NULL) {
+                PyErr_NoMemory();
+                return -1;
+            }
+            CACHED_KEYS_VARIANTS(tp) = variants;
+        }
+        for (i = 0; i < SHARED_KEYS_MAX_VARIANTS; i++) {
+            if (variants[i] == NULL || variants[i]->dk_refcnt == 1) {
+                slot = &variants[i];
+                break;
+            }
+        }
+    }
+    if (slot == NULL) {
+        /* Too many layouts: new instances get combined tables */
+        _PyDict_ClearKeysForClass(tp);
+        PyType_Modified(tp);
+        shared_keys_types_lost++;
+        return 0;
+    }
+
+    keys = make_keys_shared((PyObject *)mp);
+    if (keys == NULL) {
+        return PyErr_Occurred() ? -1 : 0;
+    }
+    if (slot != &CACHED_KEYS(tp)) {
+        shared_keys_variants++;
+    }
+    set_shared_keys_slot(tp, slot, keys);
+    return 0;
+}
+
+/* Index of key in the shared keys, or DKIX_EMPTY (-1) if it is missing.
+   Used by the LOAD_METHOD cache in ceval.c. */
+Py_ssize_t
+_PyDict_KeysIndex(PyDictKeysObject *keys, PyObject *key)
+{
+    Py_hash_t hash;
+
+    /* Shared keys are exact strings */
+    if (!PyUnicode_CheckExact(key)) {
+        return -1;
+    }
+    hash = ((PyASCIIObject *)key)->hash;
+    if (hash == -1) {
+        hash = PyObject_Hash(key);
+        assert(hash != -1);
+    }
+    return shared_keys_index(keys, key, hash);
+}
 
 PyObject *
 PyObject_GenericGetDict(PyObject *obj, void *context)
@@ -4311,43 +4912,31 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
             *dictptr = dict;
         }
         if (value == NULL) {
+            /* A split table stays split when a key is deleted */
             res = PyDict_DelItem(dict, key);
-            // Since key sharing dict doesn't allow deletion, PyDict_DelItem()
-            // always converts dict to combined form.
-            if ((cached = CACHED_KEYS(tp)) != NULL) {
-                CACHED_KEYS(tp) = NULL;
-                DK_DECREF(cached);
-            }
         }
         else {
-            int was_shared = (cached == ((PyDictObject *)dict)->ma_keys);
+            PyDictKeysObject *keys = NULL;
+            if (_PyDict_HasSplitTable((PyDictObject *)dict)) {
+                keys = ((PyDictObject *)dict)->ma_keys;
+            }
             res = PyDict_SetItem(dict, key, value);
-            if (was_shared &&
-                    (cached = CACHED_KEYS(tp)) != NULL &&
-                    cached != ((PyDictObject *)dict)->ma_keys) {
-                /* PyDict_SetItem() may call dictresize and convert split table
-                 * into combined table.  In such case, convert it to split
-                 * table again and update type's shared key only when this is
-                 * the only dict sharing key with the type.
-                 *
-                 * This is to allow using shared key in class like this:
+            if (res == 0 && keys != NULL &&
+                    keys != ((PyDictObject *)dict)->ma_keys) {
+                /* PyDict_SetItem() may grow the shared keys or convert the
+                 * split table into a combined table.  For example:
                  *
                  *     class C:
-                 *         def __init__(self):
-                 *             # one dict resize happens
-                 *             self.a, self.b, self.c = 1, 2, 3
-                 *             self.d, self.e, self.f = 4, 5, 6
-                 *     a = C()
+                 *         def __init__(self, swap):
+                 *             if swap:
+                 *                 self.b, self.a = 2, 1
+                 *             else:
+                 *                 self.a, self.b = 1, 2
+                 *     C(False), C(True)
+                 *
+                 * The second instance gets a variant of the keys of C.
                  */
-                if (cached->dk_refcnt == 1) {
-                    CACHED_KEYS(tp) = make_keys_shared(dict);
-                }
-                else {
-                    CACHED_KEYS(tp) = NULL;
-                }
-                DK_DECREF(cached);
-                if (CACHED_KEYS(tp) == NULL && PyErr_Occurred())
-                    return -1;
+                res = shared_keys_changed(tp, (PyDictObject *)dict, keys);
             }
         }
     } else {
@@ -4366,9 +4955,3 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
     }
     return res;
 }
-
-void
-_PyDictKeys_DecRef(PyDictKeysObject *keys)
-{
-    DK_DECREF(keys);
-}
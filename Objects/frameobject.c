@@ -398,7 +398,9 @@ static PyGetSetDef frame_getsetlist[] = {
 static PyFrameObject *free_list = NULL;
 static int numfree = 0;         /* number of frames currently in free_list */
 /* max value for numfree */
+#ifndef PyFrame_MAXFREELIST
 #define PyFrame_MAXFREELIST 200
+#endif
 
 static void _Py_HOT_FUNCTION
 frame_dealloc(PyFrameObject *f)
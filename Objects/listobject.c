@@ -1162,6 +1162,11 @@ struct s_MergeState {
      * of tuples. It may be set to safe_object_compare, but the idea is that hopefully
      * we can assume more, and use one of the special-case compares. */
     int (*tuple_elem_compare)(PyObject *, PyObject *, MergeState *);
+
+    /* Set in the helper threads of a parallel sort, which don't hold the
+     * GIL: the special-case compares must not check their result with
+     * PyObject_RichCompareBool() there. */
+    int nogil;
 };
 
 /* binarysort is the best method for sorting small arrays: it does
@@ -1499,6 +1504,7 @@ merge_init(MergeState *ms, Py_ssize_t list_size, int has_keyfunc)
     ms->a.keys = ms->temparray;
     ms->n = 0;
     ms->min_gallop = MIN_GALLOP;
+    ms->nogil = 0;
 }
 
 /* Free all the temp memory owned by the MergeState.  This must be called
@@ -2044,7 +2050,7 @@ unsafe_latin_compare(PyObject *v, PyObject *w, MergeState *ms)
            res < 0 :
            PyUnicode_GET_LENGTH(v) < PyUnicode_GET_LENGTH(w));
 
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));;
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2072,7 +2078,7 @@ unsafe_long_compare(PyObject *v, PyObject *w, MergeState *ms)
         w0 = -w0;
 
     res = v0 < w0;
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2087,7 +2093,7 @@ unsafe_float_compare(PyObject *v, PyObject *w, MergeState *ms)
     assert(v->ob_type == &PyFloat_Type);
 
     res = PyFloat_AS_DOUBLE(v) < PyFloat_AS_DOUBLE(w);
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2133,6 +2139,466 @@ unsafe_tuple_compare(PyObject *v, PyObject *w, MergeState *ms)
         return PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_LT);
 }
 
+/* Sort the size items of lo with the timsort of listsort.txt: march over
+ * the slice once, left to right, finding natural runs, extending short
+ * natural runs to minrun elements, and merging them.  ms must be freshly
+ * initialized.  Returns 0 on success, -1 on error.
+ */
+static int
+sort_slice(MergeState *ms, sortslice lo, Py_ssize_t size)
+{
+    Py_ssize_t nremaining = size;
+    Py_ssize_t minrun;
+
+    assert(ms->n == 0);
+    if (nremaining < 2)
+        return 0;
+
+    minrun = merge_compute_minrun(nremaining);
+    do {
+        int descending;
+        Py_ssize_t n;
+
+        /* Identify next run. */
+        n = count_run(ms, lo.keys, lo.keys + nremaining, &descending);
+        if (n < 0)
+            return -1;
+        if (descending)
+            reverse_sortslice(&lo, n);
+        /* If short, extend to min(minrun, nremaining). */
+        if (n < minrun) {
+            const Py_ssize_t force = nremaining <= minrun ?
+                              nremaining : minrun;
+            if (binarysort(ms, lo, lo.keys + force, lo.keys + n) < 0)
+                return -1;
+            n = force;
+        }
+        /* Push run onto pending-runs stack, and maybe merge. */
+        assert(ms->n < MAX_MERGE_PENDING);
+        ms->pending[ms->n].base = lo;
+        ms->pending[ms->n].len = n;
+        ++ms->n;
+        if (merge_collapse(ms) < 0)
+            return -1;
+        /* Advance to find next run. */
+        sortslice_advance(&lo, n);
+        nremaining -= n;
+    } while (nremaining);
+
+    if (merge_force_collapse(ms) < 0)
+        return -1;
+    assert(ms->n == 1);
+    assert(ms->pending[0].len == size);
+    return 0;
+}
+
+/* Parallel sort.
+ *
+ * With the special-case compares of ints, floats and latin strings, a sort
+ * doesn't call any Python code and doesn't touch any reference count, so
+ * large lists can be sorted by several threads while the sorting thread
+ * keeps the GIL.  The keys are cut into one slice per thread, the slices
+ * are sorted concurrently, and the sorted slices are merged pairwise, the
+ * merges of a round running concurrently too.  Since only adjacent slices
+ * are merged, with the stable merge_at(), the sort stays stable.
+ *
+ * The temporary memory of the merges is allocated by the sorting thread
+ * before starting the others, so that the helper threads never allocate.
+ */
+
+/* A thread is only used for every PARALLEL_SORT_MIN_ITEMS keys. */
+#define PARALLEL_SORT_MIN_ITEMS 100000
+
+/* Number of threads sorting a large list, set by sys._set_sort_threads() */
+static int sort_threads = 1;
+
+void
+_PyList_SetSortThreads(int n)
+{
+    assert(n >= 1);
+    sort_threads = n;
+}
+
+int
+_PyList_GetSortThreads(void)
+{
+    return sort_threads;
+}
+
+typedef struct {
+    MergeState ms;
+    sortslice lo;       /* the items to sort or merge */
+    Py_ssize_t na;      /* number of items to sort, or length of the
+                           first run to merge */
+    Py_ssize_t nb;      /* length of the second run to merge, 0 to sort */
+    int result;
+    PyThread_type_lock done;
+} sort_worker;
+
+static void
+sort_worker_run(sort_worker *worker)
+{
+    MergeState *ms = &worker->ms;
+
+    if (worker->nb == 0) {
+        worker->result = sort_slice(ms, worker->lo, worker->na);
+    }
+    else {
+        ms->n = 2;
+        ms->pending[0].base = worker->lo;
+        ms->pending[0].len = worker->na;
+        ms->pending[1].base = worker->lo;
+        sortslice_advance(&ms->pending[1].base, worker->na);
+        ms->pending[1].len = worker->nb;
+        worker->result = (int)merge_at(ms, 0);
+    }
+    ms->n = 0;
+}
+
+static void
+sort_worker_thread(void *arg)
+{
+    sort_worker *worker = (sort_worker *)arg;
+    sort_worker_run(worker);
+    PyThread_release_lock(worker->done);
+}
+
+/* Run the nworkers first workers, the first one in the calling thread, and
+   wait for the helper threads.  Return 0 on success, -1 if a worker
+   failed. */
+static int
+run_sort_workers(sort_worker *workers, int nworkers)
+{
+    int i, result = 0;
+    for (i = 1; i < nworkers; i++) {
+        PyThread_acquire_lock(workers[i].done, WAIT_LOCK);
+        if (PyThread_start_new_thread(sort_worker_thread,
+                                      &workers[i]) == PYTHREAD_INVALID_THREAD_ID) {
+            sort_worker_run(&workers[i]);
+            PyThread_release_lock(workers[i].done);
+        }
+    }
+    sort_worker_run(&workers[0]);
+    for (i = 0; i < nworkers; i++) {
+        if (i > 0) {
+            PyThread_acquire_lock(workers[i].done, WAIT_LOCK);
+            PyThread_release_lock(workers[i].done);
+        }
+        if (workers[i].result < 0)
+            result = -1;
+    }
+    return result;
+}
+
+/* Sort the n items of lo, whose keys are compared with ms->key_compare,
+ * with the threads set by sys._set_sort_threads().  Return 1 on success,
+ * -1 on error, or 0 without doing anything if the keys can't be compared
+ * without the GIL, if there are too few of them for the threads to pay
+ * off, or if the threads can't be set up: the caller then runs the
+ * sequential sort.
+ */
+static int
+parallel_sort(MergeState *ms, sortslice lo, Py_ssize_t n)
+{
+    sort_worker *workers;
+    int nworkers = sort_threads;
+    int nruns, i, result = 0;
+    int has_values = lo.values != NULL;
+
+    if (ms->key_compare != unsafe_long_compare &&
+        ms->key_compare != unsafe_float_compare &&
+        ms->key_compare != unsafe_latin_compare) {
+        return 0;
+    }
+    if (nworkers > n / PARALLEL_SORT_MIN_ITEMS) {
+        nworkers = (int)(n / PARALLEL_SORT_MIN_ITEMS);
+    }
+    if (nworkers < 2) {
+        return 0;
+    }
+    workers = PyMem_Calloc(nworkers, sizeof(sort_worker));
+    if (workers == NULL) {
+        return 0;
+    }
+    for (i = 0; i < nworkers; i++) {
+        sort_worker *worker = &workers[i];
+        Py_ssize_t start = n * i / nworkers;
+
+        worker->lo = lo;
+        sortslice_advance(&worker->lo, start);
+        worker->na = n * (i + 1) / nworkers - start;
+        merge_init(&worker->ms, worker->na, has_values);
+        worker->ms.key_compare = ms->key_compare;
+        worker->ms.nogil = (i > 0);
+        if (i > 0) {
+            worker->done = PyThread_allocate_lock();
+            if (worker->done == NULL) {
+                goto done;
+            }
+        }
+        if (merge_getmem(&worker->ms, (worker->na + 1) / 2) < 0) {
+            PyErr_Clear();
+            goto done;
+        }
+    }
+
+    /* Sort the slices.  The failures after this point are errors: the
+       items may have been moved. */
+    result = -1;
+    if (run_sort_workers(workers, nworkers) < 0) {
+        goto done;
+    }
+
+    /* Merge the sorted slices, now runs, pairwise until only one is left.
+       The lo and na fields of the workers hold the list of runs. */
+    nruns = nworkers;
+    while (nruns > 1) {
+        int npairs = nruns / 2;
+        for (i = 0; i < nworkers; i++) {
+            sort_worker *worker = &workers[i];
+            if (i >= npairs) {
+                /* Give back the memory of the idle workers */
+                merge_freemem(&worker->ms);
+                merge_init(&worker->ms, 0, has_values);
+                worker->ms.nogil = (i > 0);
+                continue;
+            }
+            worker->lo = workers[2 * i].lo;
+            worker->na = workers[2 * i].na;
+            worker->nb = workers[2 * i + 1].na;
+            if (merge_getmem(&worker->ms,
+                             Py_MIN(worker->na, worker->nb)) < 0) {
+                goto done;
+            }
+        }
+        if (nruns & 1) {
+            /* The last run is left for the next round */
+            workers[npairs].lo = workers[nruns - 1].lo;
+            workers[npairs].na = workers[nruns - 1].na;
+            workers[npairs].nb = 0;
+        }
+        if (run_sort_workers(workers, npairs) < 0) {
+            goto done;
+        }
+        for (i = 0; i < npairs; i++) {
+            workers[i].na += workers[i].nb;
+            workers[i].nb = 0;
+        }
+        nruns = (nruns + 1) / 2;
+    }
+    assert(workers[0].lo.keys == lo.keys && workers[0].na == n);
+    result = 1;
+
+  done:
+    for (i = 0; i < nworkers; i++) {
+        merge_freemem(&workers[i].ms);
+        if (workers[i].done != NULL) {
+            PyThread_free_lock(workers[i].done);
+        }
+    }
+    PyMem_Free(workers);
+    return result;
+}
+
+/* Radix sort.
+ *
+ * Random lists of exact ints which fit in a machine word, or of exact
+ * floats, are sorted faster by an LSD radix sort than by comparisons: the
+ * keys are converted once to unsigned 64-bit integers with the same order,
+ * stored next to the index of their item, and these pairs are sorted 8 bits
+ * at a time, each pass being a stable counting sort.  The smallest key is
+ * subtracted from all of them first, and the passes on the bytes which are
+ * the same in all the keys are skipped, so that ints of a small range take
+ * few passes.  The items are then permuted in the order of their keys.
+ *
+ * Timsort is faster on partially ordered lists, which have long runs: the
+ * radix sort is only used when the keys go up and down often enough.
+ */
+
+/* The radix sort is only used for at least RADIX_SORT_MIN_ITEMS items ... */
+#define RADIX_SORT_MIN_ITEMS 1024
+
+/* ... when the keys change direction at least once every RADIX_SORT_MAX_RUN
+   items on average. */
+#define RADIX_SORT_MAX_RUN 32
+
+/* Ints of less than RADIX_SORT_INT_DIGITS digits fit in 63 bits, and so
+   do the ints of RADIX_SORT_INT_DIGITS digits whose last digit is less
+   than 2**RADIX_SORT_INT_TOP_BITS. */
+#define RADIX_SORT_INT_DIGITS ((63 + PyLong_SHIFT - 1) / PyLong_SHIFT)
+#define RADIX_SORT_INT_TOP_BITS (63 - (RADIX_SORT_INT_DIGITS - 1) * PyLong_SHIFT)
+#define RADIX_SORT_INT_FITS(op) \
+    (Py_ABS(Py_SIZE(op)) < RADIX_SORT_INT_DIGITS || \
+     (Py_ABS(Py_SIZE(op)) == RADIX_SORT_INT_DIGITS && \
+      ((PyLongObject *)(op))->ob_digit[RADIX_SORT_INT_DIGITS - 1] \
+          >> RADIX_SORT_INT_TOP_BITS == 0))
+
+/* Kinds of keys for the radix sort */
+#define RADIX_SORT_NONE 0
+#define RADIX_SORT_INTS 1
+#define RADIX_SORT_FLOATS 2
+
+#define RADIX_SORT_SIGN ((uint64_t)1 << 63)
+
+typedef struct {
+    uint64_t key;
+    Py_ssize_t index;
+} radix_item;
+
+/* Return an unsigned key of the int or float op, ordered as op, in *key.
+   Return 0 on success, -1 if op is a NaN, which has no place in the
+   order of the keys. */
+static int
+radix_sort_key(PyObject *op, int kind, uint64_t *key)
+{
+    if (kind == RADIX_SORT_INTS) {
+        PyLongObject *v = (PyLongObject *)op;
+        Py_ssize_t i = Py_ABS(Py_SIZE(v));
+        uint64_t x = 0;
+
+        assert(RADIX_SORT_INT_FITS(op));
+        while (--i >= 0) {
+            x = (x << PyLong_SHIFT) | v->ob_digit[i];
+        }
+        if (Py_SIZE(v) < 0) {
+            x = (uint64_t)0 - x;
+        }
+        /* Offset the two's complement by 2**63 */
+        *key = x ^ RADIX_SORT_SIGN;
+    }
+    else {
+        double d = PyFloat_AS_DOUBLE(op);
+        uint64_t x;
+
+        if (Py_IS_NAN(d)) {
+            return -1;
+        }
+        if (d == 0.0) {
+            /* -0.0 and 0.0 are equal, and must stay in their order */
+            d = 0.0;
+        }
+        memcpy(&x, &d, sizeof(x));
+        /* Flip all the bits of negative floats, so that the larger their
+           magnitude the smaller their key, and the sign bit of the others,
+           so that they come after the negative ones. */
+        *key = (x & RADIX_SORT_SIGN) ? ~x : (x | RADIX_SORT_SIGN);
+    }
+    return 0;
+}
+
+/* Sort the n items of lo, whose keys are of the given kind, with a radix
+ * sort.  Return 1 on success, or 0 without doing anything if the keys have
+ * long runs, contain a NaN or if the memory can't be allocated: the caller
+ * then runs the other sorts.  This can't fail.
+ */
+static int
+radix_sort(sortslice lo, Py_ssize_t n, int kind)
+{
+    radix_item *items, *buffer, *src, *dst;
+    PyObject **tmp;
+    Py_ssize_t counts[8][256];
+    Py_ssize_t i, turns = 0;
+    uint64_t min_key = UINT64_MAX, max_key = 0;
+    int direction = 0, pass, npasses;
+
+    assert(kind != RADIX_SORT_NONE);
+    if (n < RADIX_SORT_MIN_ITEMS) {
+        return 0;
+    }
+    if ((size_t)n > PY_SSIZE_T_MAX / (2 * sizeof(radix_item))) {
+        return 0;
+    }
+    items = PyMem_Malloc(2 * n * sizeof(radix_item));
+    if (items == NULL) {
+        return 0;
+    }
+    buffer = items + n;
+
+    /* Compute the keys and their range, and count how many times they
+       change direction. */
+    for (i = 0; i < n; i++) {
+        uint64_t key;
+        if (radix_sort_key(lo.keys[i], kind, &key) < 0) {
+            goto give_up;
+        }
+        items[i].key = key;
+        items[i].index = i;
+        if (i > 0 && key != items[i - 1].key) {
+            int d = key > items[i - 1].key ? 1 : -1;
+            if (d != direction) {
+                turns++;
+                direction = d;
+            }
+        }
+        if (key < min_key)
+            min_key = key;
+        if (key > max_key)
+            max_key = key;
+    }
+    if (turns < n / RADIX_SORT_MAX_RUN) {
+        goto give_up;
+    }
+
+    /* Only the bytes of the range of the keys need a pass.  Count them. */
+    for (npasses = 0; npasses < 8 && (max_key - min_key) >> (8 * npasses);
+         npasses++) {
+    }
+    memset(counts, 0, sizeof(counts));
+    for (i = 0; i < n; i++) {
+        uint64_t key = items[i].key - min_key;
+        items[i].key = key;
+        for (pass = 0; pass < npasses; pass++) {
+            counts[pass][(key >> (8 * pass)) & 0xff]++;
+        }
+    }
+
+    src = items;
+    dst = buffer;
+    for (pass = 0; pass < npasses; pass++) {
+        Py_ssize_t *count = counts[pass];
+        Py_ssize_t offset = 0;
+        int shift = 8 * pass;
+        int byte;
+
+        if (count[(src[0].key >> shift) & 0xff] == n) {
+            /* All the keys have the same byte: nothing to do */
+            continue;
+        }
+        /* Turn the counts into the offsets of the bytes in dst */
+        for (byte = 0; byte < 256; byte++) {
+            Py_ssize_t c = count[byte];
+            count[byte] = offset;
+            offset += c;
+        }
+        for (i = 0; i < n; i++) {
+            dst[count[(src[i].key >> shift) & 0xff]++] = src[i];
+        }
+        dst = src;
+        src = (src == items) ? buffer : items;
+    }
+
+    /* The sorted items are in src: permute the keys and the values in
+       their order, through the other half of the memory. */
+    tmp = (PyObject **)dst;
+    assert(sizeof(radix_item) >= sizeof(PyObject *));
+    memcpy(tmp, lo.keys, n * sizeof(PyObject *));
+    for (i = 0; i < n; i++) {
+        lo.keys[i] = tmp[src[i].index];
+    }
+    if (lo.values != NULL) {
+        memcpy(tmp, lo.values, n * sizeof(PyObject *));
+        for (i = 0; i < n; i++) {
+            lo.values[i] = tmp[src[i].index];
+        }
+    }
+    PyMem_Free(items);
+    return 1;
+
+  give_up:
+    PyMem_Free(items);
+    return 0;
+}
+
 /* An adaptive, stable, natural mergesort.  See listsort.txt.
  * Returns Py_None on success, NULL on error.  Even in case of error, the
  * list will be some permutation of its input state (nothing is lost or
@@ -2153,8 +2619,6 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
 /*[clinic end generated code: output=57b9f9c5e23fbe42 input=b0fcf743982c5b90]*/
 {
     MergeState ms;
-    Py_ssize_t nremaining;
-    Py_ssize_t minrun;
     sortslice lo;
     Py_ssize_t saved_ob_size, saved_allocated;
     PyObject **saved_ob_item;
@@ -2162,6 +2626,8 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
     PyObject *result = NULL;            /* guilty until proved innocent */
     Py_ssize_t i;
     PyObject **keys;
+    int radix_kind = RADIX_SORT_NONE;
+    int done;
 
     assert(self != NULL);
     assert(PyList_Check(self));
@@ -2230,6 +2696,7 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         int keys_are_all_same_type = 1;
         int strings_are_latin = 1;
         int ints_are_bounded = 1;
+        int ints_fit_word = 1;
 
         /* Prove that assumption by checking every key. */
         int i;
@@ -2257,6 +2724,8 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
             if (key_type == &PyLong_Type) {
                 if (ints_are_bounded && Py_ABS(Py_SIZE(key)) > 1)
                     ints_are_bounded = 0;
+                if (ints_fit_word && !RADIX_SORT_INT_FITS(key))
+                    ints_fit_word = 0;
             }
             else if (key_type == &PyUnicode_Type){
                 if (strings_are_latin &&
@@ -2295,13 +2764,18 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
 
             ms.key_compare = unsafe_tuple_compare;
         }
+        else if (keys_are_all_same_type) {
+            if (key_type == &PyLong_Type && ints_fit_word)
+                radix_kind = RADIX_SORT_INTS;
+            else if (key_type == &PyFloat_Type)
+                radix_kind = RADIX_SORT_FLOATS;
+        }
     }
     /* End of pre-sort check: ms is now set properly! */
 
     merge_init(&ms, saved_ob_size, keys != NULL);
 
-    nremaining = saved_ob_size;
-    if (nremaining < 2)
+    if (saved_ob_size < 2)
         goto succeed;
 
     /* Reverse sort stability achieved by initially reversing the list,
@@ -2312,48 +2786,17 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
-    /* March over the array once, left to right, finding natural runs,
-     * and extending short natural runs to minrun elements.
-     */
-    minrun = merge_compute_minrun(nremaining);
-    do {
-        int descending;
-        Py_ssize_t n;
-
-        /* Identify next run. */
-        n = count_run(&ms, lo.keys, lo.keys + nremaining, &descending);
-        if (n < 0)
-            goto fail;
-        if (descending)
-            reverse_sortslice(&lo, n);
-        /* If short, extend to min(minrun, nremaining). */
-        if (n < minrun) {
-            const Py_ssize_t force = nremaining <= minrun ?
-                              nremaining : minrun;
-            if (binarysort(&ms, lo, lo.keys + force, lo.keys + n) < 0)
-                goto fail;
-            n = force;
-        }
-        /* Push run onto pending-runs stack, and maybe merge. */
-        assert(ms.n < MAX_MERGE_PENDING);
-        ms.pending[ms.n].base = lo;
-        ms.pending[ms.n].len = n;
-        ++ms.n;
-        if (merge_collapse(&ms) < 0)
-            goto fail;
-        /* Advance to find next run. */
-        sortslice_advance(&lo, n);
-        nremaining -= n;
-    } while (nremaining);
-
-    if (merge_force_collapse(&ms) < 0)
+    /* Try the sorts for special cases first: they return 0 if they don't
+       apply. */
+    done = 0;
+    if (radix_kind != RADIX_SORT_NONE)
+        done = radix_sort(lo, saved_ob_size, radix_kind);
+    if (done == 0)
+        done = parallel_sort(&ms, lo, saved_ob_size);
+    if (done < 0)
+        goto fail;
+    if (done == 0 && sort_slice(&ms, lo, saved_ob_size) < 0)
         goto fail;
-    assert(ms.n == 1);
-    assert(keys == NULL
-           ? ms.pending[0].base.keys == saved_ob_item
-           : ms.pending[0].base.keys == &keys[0]);
-    assert(ms.pending[0].len == saved_ob_size);
-    lo = ms.pending[0].base;
 
 succeed:
     result = Py_None;
@@ -3,7 +3,8 @@
 /* XXX The functional organization of this file is terrible */
 
 #include "Python.h"
-#include "longintrepr.h"
+#include "internal/pystate.h"
+#include "internal/long.h"
 
 #include <float.h>
 #include <ctype.h>
@@ -34,6 +35,19 @@ _Py_IDENTIFIER(big);
 PyObject *_PyLong_Zero = NULL;
 PyObject *_PyLong_One = NULL;
 
+/* Special free list
+   free_list is a singly-linked list of available int objects of at most one
+   digit, linked via abuse of their ob_type members, like the free list of
+   floats.  _PyLong_New() allocates room for at least one digit, so that any
+   exact int of at most one digit can go on the list when it is freed.
+*/
+
+#ifndef PyLong_MAXFREELIST
+#define PyLong_MAXFREELIST    100
+#endif
+static int numfree = 0;
+static PyLongObject *free_list = NULL;
+
 #if NSMALLNEGINTS + NSMALLPOSINTS > 0
 /* Small integers are preallocated in this array so that they
    can be shared.
@@ -106,6 +120,33 @@ _PyLong_Negate(PyLongObject **x_p)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* Above TOOM3_CUTOFF digits, balanced multiplications use Toom-Cook 3-way
+ * splitting (t3_mul) instead of Karatsuba.
+ */
+#define TOOM3_CUTOFF 300
+#define TOOM3_SQUARE_CUTOFF (2 * TOOM3_CUTOFF)
+
+/* Conversions to and from decimal strings, and divisions, of ints larger
+ * than these limits are delegated to the _pylong module, which implements
+ * subquadratic algorithms on top of int multiplication.  The limits are in
+ * digits, derived from sizes in bits so that they don't depend on
+ * PyLong_SHIFT, except PYLONG_FROM_STRING_CUTOFF which is in decimal
+ * characters.
+ */
+#define PYLONG_TO_STRING_CUTOFF (30000 / PyLong_SHIFT)
+#define PYLONG_FROM_STRING_CUTOFF 6000
+#define PYLONG_DIVMOD_CUTOFF (9000 / PyLong_SHIFT)
+#define PYLONG_DIVMOD_QUOTIENT_CUTOFF (4500 / PyLong_SHIFT)
+
+/* Bits of PyThreadState.pylong_active.  A _pylong function splits its
+ * operands into smaller ints and hands them to the int operations: these
+ * never call the function again in the same thread, whatever the sizes,
+ * and use the builtin algorithms instead.
+ */
+#define PYLONG_ACTIVE_TO_STRING 1
+#define PYLONG_ACTIVE_FROM_STRING 2
+#define PYLONG_ACTIVE_DIVMOD 4
+
 /* For exponentiation, use the binary left-to-right algorithm
  * unless the exponent contains more than FIVEARY_CUTOFF digits.
  * In that case, do 5 bits at a time.  The potential drawback is that
@@ -205,8 +246,14 @@ _PyLong_New(Py_ssize_t size)
                         "too many digits in integer");
         return NULL;
     }
+    if (size <= 1 && free_list != NULL) {
+        result = free_list;
+        free_list = (PyLongObject *)Py_TYPE(result);
+        numfree--;
+        return (PyLongObject*)PyObject_INIT_VAR(result, &PyLong_Type, size);
+    }
     result = PyObject_MALLOC(offsetof(PyLongObject, ob_digit) +
-                             size*sizeof(digit));
+                             Py_MAX(size, 1)*sizeof(digit));
     if (!result) {
         PyErr_NoMemory();
         return NULL;
@@ -1112,6 +1159,26 @@ PyLong_FromLongLong(long long ival)
     return (PyObject *)v;
 }
 
+/* Create a new int object from a C stwodigits, with a fast path for values
+   of a single digit. */
+
+PyObject *
+_PyLong_FromSTwoDigits(stwodigits x)
+{
+    PyLongObject *v;
+
+    CHECK_SMALL_INT(x);
+    if (-(stwodigits)PyLong_MASK <= x && x <= (stwodigits)PyLong_MASK) {
+        v = _PyLong_New(1);
+        if (v != NULL) {
+            Py_SIZE(v) = x < 0 ? -1 : 1;
+            v->ob_digit[0] = (digit)(x < 0 ? -x : x);
+        }
+        return (PyObject *)v;
+    }
+    return PyLong_FromLongLong((long long)x);
+}
+
 /* Create a new int object from a C unsigned long long int. */
 
 PyObject *
@@ -1575,6 +1642,128 @@ divrem1(PyLongObject *a, digit n, digit *prem)
     return long_normalize(z);
 }
 
+/* Return a new reference to the _pylong module.  If it can't be imported
+   (early at startup, late at shutdown, or in a stripped down install), or
+   if the function of the active bit already runs in this thread, return
+   NULL with no exception set: the caller falls back to its own
+   algorithm. */
+static PyObject *
+pylong_import(int active)
+{
+    PyThreadState *tstate = PyThreadState_GET();
+    PyObject *mod;
+
+    if (tstate == NULL || (tstate->pylong_active & active)) {
+        return NULL;
+    }
+    mod = PyImport_ImportModule("_pylong");
+    if (mod == NULL && PyErr_ExceptionMatches(PyExc_ImportError)) {
+        PyErr_Clear();
+    }
+    return mod;
+}
+
+/* Call the function name of the _pylong module mod with the arguments
+   args, with the active bit set in the thread state. */
+static PyObject *
+pylong_call(PyObject *mod, const char *name, int active, PyObject *args)
+{
+    PyThreadState *tstate = PyThreadState_GET();
+    PyObject *func, *result;
+
+    func = PyObject_GetAttrString(mod, name);
+    if (func == NULL) {
+        return NULL;
+    }
+    tstate->pylong_active |= active;
+    result = PyObject_Call(func, args, NULL);
+    tstate->pylong_active &= ~active;
+    Py_DECREF(func);
+    return result;
+}
+
+/* Return a new reference to an exact int equal to op: the functions of
+   _pylong must not run the methods of int subclasses. */
+static PyObject *
+pylong_exact(PyObject *op)
+{
+    if (PyLong_CheckExact(op)) {
+        Py_INCREF(op);
+        return op;
+    }
+    return _PyLong_Copy((PyLongObject *)op);
+}
+
+/* Convert a large int to a decimal string with
+   _pylong.int_to_decimal_string(), and store it like
+   long_to_decimal_string_internal().  Returns 0 on success, -1 on error and
+   1 if _pylong is not available. */
+static int
+pylong_int_to_decimal_string(PyObject *aa,
+                             PyObject **p_output,
+                             _PyUnicodeWriter *writer,
+                             _PyBytesWriter *bytes_writer,
+                             char **bytes_str)
+{
+    PyObject *mod, *args, *s;
+    Py_ssize_t size;
+
+    mod = pylong_import(PYLONG_ACTIVE_TO_STRING);
+    if (mod == NULL) {
+        return PyErr_Occurred() ? -1 : 1;
+    }
+    args = PyTuple_New(1);
+    if (args == NULL) {
+        Py_DECREF(mod);
+        return -1;
+    }
+    PyTuple_SET_ITEM(args, 0, pylong_exact(aa));
+    if (PyTuple_GET_ITEM(args, 0) == NULL) {
+        Py_DECREF(args);
+        Py_DECREF(mod);
+        return -1;
+    }
+    s = pylong_call(mod, "int_to_decimal_string", PYLONG_ACTIVE_TO_STRING,
+                    args);
+    Py_DECREF(args);
+    Py_DECREF(mod);
+    if (s == NULL) {
+        return -1;
+    }
+    if (!PyUnicode_Check(s) || PyUnicode_READY(s) == -1 ||
+        !PyUnicode_IS_ASCII(s)) {
+        if (!PyErr_Occurred()) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "_pylong.int_to_decimal_string() must return "
+                            "an ASCII str");
+        }
+        Py_DECREF(s);
+        return -1;
+    }
+    size = PyUnicode_GET_LENGTH(s);
+    if (writer) {
+        if (_PyUnicodeWriter_WriteStr(writer, s) < 0) {
+            Py_DECREF(s);
+            return -1;
+        }
+        Py_DECREF(s);
+    }
+    else if (bytes_writer) {
+        *bytes_str = _PyBytesWriter_Prepare(bytes_writer, *bytes_str, size);
+        if (*bytes_str == NULL) {
+            Py_DECREF(s);
+            return -1;
+        }
+        memcpy(*bytes_str, PyUnicode_1BYTE_DATA(s), size);
+        (*bytes_str) += size;
+        Py_DECREF(s);
+    }
+    else {
+        *p_output = s;
+    }
+    return 0;
+}
+
 /* Convert an integer to a base 10 string.  Returns a new non-shared
    string.  (Return value is non-shared so that callers can modify the
    returned value if necessary.) */
@@ -1602,6 +1791,16 @@ long_to_decimal_string_internal(PyObject *aa,
     size_a = Py_ABS(Py_SIZE(a));
     negative = Py_SIZE(a) < 0;
 
+    /* The algorithm below is quadratic: switch to the divide-and-conquer
+       one of _pylong for large ints. */
+    if (size_a > PYLONG_TO_STRING_CUTOFF) {
+        int res = pylong_int_to_decimal_string(aa, p_output, writer,
+                                               bytes_writer, bytes_str);
+        if (res <= 0) {
+            return res;
+        }
+    }
+
     /* quick and dirty upper bound for the number of digits
        required to express a in base _PyLong_DECIMAL_BASE:
 
@@ -2105,6 +2304,50 @@ long_from_binary_base(const char **str, int base, PyLongObject **res)
     return 0;
 }
 
+/* Convert the decimal digits (and underscores) from start to end with
+ * _pylong.int_from_string(), and store the result, with the given sign, in
+ * *res.  Returns 0 on success, -1 on error and 1 if _pylong is not available.
+ */
+static int
+pylong_int_from_string(const char *start, const char *end, int sign,
+                       PyLongObject **res)
+{
+    PyObject *mod, *args, *result;
+
+    mod = pylong_import(PYLONG_ACTIVE_FROM_STRING);
+    if (mod == NULL) {
+        return PyErr_Occurred() ? -1 : 1;
+    }
+    args = Py_BuildValue("(N)",
+                         PyUnicode_DecodeASCII(start, end - start, "strict"));
+    if (args == NULL) {
+        Py_DECREF(mod);
+        return -1;
+    }
+    result = pylong_call(mod, "int_from_string", PYLONG_ACTIVE_FROM_STRING,
+                         args);
+    Py_DECREF(args);
+    Py_DECREF(mod);
+    if (result == NULL) {
+        return -1;
+    }
+    if (!PyLong_CheckExact(result)) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "_pylong.int_from_string() must return an int");
+        Py_DECREF(result);
+        return -1;
+    }
+    /* The result may be shared: don't negate it in place. */
+    if (sign < 0) {
+        Py_SETREF(result, PyNumber_Negative(result));
+        if (result == NULL) {
+            return -1;
+        }
+    }
+    *res = (PyLongObject *)result;
+    return 0;
+}
+
 /* Parses an int from a bytestring. Leading and trailing whitespace will be
  * ignored.
  *
@@ -2325,6 +2568,21 @@ digit beyond the first.
             goto onError;
         }
 
+        /* The algorithm below is quadratic: switch to the divide-and-conquer
+         * one of _pylong for long decimal strings.
+         */
+        if (base == 10 && digits > PYLONG_FROM_STRING_CUTOFF) {
+            int res = pylong_int_from_string(start, scan, sign, &z);
+            if (res < 0) {
+                return NULL;
+            }
+            if (res == 0) {
+                str = scan;
+                sign = 1;
+                goto digits_done;
+            }
+        }
+
         /* Create an int object that can contain the largest possible
          * integer with this base and length.  Note that there's no
          * need to initialize z->ob_digit -- no slot is read up before
@@ -2417,6 +2675,7 @@ digit beyond the first.
             }
         }
     }
+  digits_done:
     if (z == NULL) {
         return NULL;
     }
@@ -2893,6 +3152,13 @@ PyLong_AsDouble(PyObject *v)
 static void
 long_dealloc(PyObject *v)
 {
+    if (PyLong_CheckExact(v) && Py_ABS(Py_SIZE(v)) <= 1 &&
+        numfree < PyLong_MAXFREELIST) {
+        numfree++;
+        Py_TYPE(v) = (struct _typeobject *)free_list;
+        free_list = (PyLongObject *)v;
+        return;
+    }
     Py_TYPE(v)->tp_free(v);
 }
 
@@ -2924,6 +3190,11 @@ long_richcompare(PyObject *self, PyObject *other, int op)
 {
     int result;
     CHECK_BINOP(self, other);
+    if (Py_ABS(Py_SIZE(self)) <= 1 && Py_ABS(Py_SIZE(other)) <= 1) {
+        sdigit a = MEDIUM_VALUE((PyLongObject *)self);
+        sdigit b = MEDIUM_VALUE((PyLongObject *)other);
+        Py_RETURN_RICHCOMPARE(a, b, op);
+    }
     if (self == other)
         result = 0;
     else
@@ -3086,8 +3357,9 @@ long_add(PyLongObject *a, PyLongObject *b)
 
     CHECK_BINOP(a, b);
 
-    if (Py_ABS(Py_SIZE(a)) <= 1 && Py_ABS(Py_SIZE(b)) <= 1) {
-        return PyLong_FromLong(MEDIUM_VALUE(a) + MEDIUM_VALUE(b));
+    if (_PyLong_IsTwoDigits(a) && _PyLong_IsTwoDigits(b)) {
+        return _PyLong_FromSTwoDigits(_PyLong_TwoDigitsValue(a) +
+                                      _PyLong_TwoDigitsValue(b));
     }
     if (Py_SIZE(a) < 0) {
         if (Py_SIZE(b) < 0) {
@@ -3120,8 +3392,9 @@ long_sub(PyLongObject *a, PyLongObject *b)
 
     CHECK_BINOP(a, b);
 
-    if (Py_ABS(Py_SIZE(a)) <= 1 && Py_ABS(Py_SIZE(b)) <= 1) {
-        return PyLong_FromLong(MEDIUM_VALUE(a) - MEDIUM_VALUE(b));
+    if (_PyLong_IsTwoDigits(a) && _PyLong_IsTwoDigits(b)) {
+        return _PyLong_FromSTwoDigits(_PyLong_TwoDigitsValue(a) -
+                                      _PyLong_TwoDigitsValue(b));
     }
     if (Py_SIZE(a) < 0) {
         if (Py_SIZE(b) < 0)
@@ -3265,6 +3538,7 @@ kmul_split(PyLongObject *n,
 }
 
 static PyLongObject *k_lopsided_mul(PyLongObject *a, PyLongObject *b);
+static PyLongObject *t3_mul(PyLongObject *a, PyLongObject *b);
 
 /* Karatsuba multiplication.  Ignores the input signs, and returns the
  * absolute value of the product (or NULL if error).
@@ -3323,6 +3597,13 @@ k_mul(PyLongObject *a, PyLongObject *b)
     if (2 * asize <= bsize)
         return k_lopsided_mul(a, b);
 
+    /* Toom-Cook 3-way splitting wins over Karatsuba on large inputs, as long
+     * as a is big enough to fill most of the three pieces of b's width.
+     */
+    i = a == b ? TOOM3_SQUARE_CUTOFF : TOOM3_CUTOFF;
+    if (asize > i && 3 * asize > 2 * bsize)
+        return t3_mul(a, b);
+
     /* Split a & b into hi & lo pieces. */
     shift = bsize >> 1;
     if (kmul_split(a, shift, &ah, &al) < 0) goto fail;
@@ -3545,6 +3826,254 @@ k_lopsided_mul(PyLongObject *a, PyLongObject *b)
     return NULL;
 }
 
+/* Helpers for Toom-Cook multiplication (t3_mul). */
+
+/* Return the digits lo to hi-1 of abs(n) as a new normalized int, or NULL
+   on error. */
+static PyLongObject *
+t3_slice(PyLongObject *n, Py_ssize_t lo, Py_ssize_t hi)
+{
+    PyLongObject *z;
+    const Py_ssize_t size_n = Py_ABS(Py_SIZE(n));
+
+    hi = Py_MIN(hi, size_n);
+    lo = Py_MIN(lo, hi);
+    z = _PyLong_New(hi - lo);
+    if (z == NULL)
+        return NULL;
+    memcpy(z->ob_digit, n->ob_digit + lo, (hi - lo) * sizeof(digit));
+    return long_normalize(z);
+}
+
+/* Return a / n, where the digit n is known to divide a. */
+static PyLongObject *
+t3_divexact(PyLongObject *a, digit n)
+{
+    const Py_ssize_t size_a = Py_ABS(Py_SIZE(a));
+    PyLongObject *z;
+    digit rem;
+
+    z = _PyLong_New(size_a);
+    if (z == NULL)
+        return NULL;
+    rem = inplace_divrem1(z->ob_digit, a->ob_digit, size_a, n);
+    assert(rem == 0);
+    (void)rem;
+    z = long_normalize(z);
+    if (Py_SIZE(a) < 0)
+        Py_SIZE(z) = -Py_SIZE(z);
+    return z;
+}
+
+/* Return a * b, with the sign of the product. */
+static PyLongObject *
+t3_signed_mul(PyLongObject *a, PyLongObject *b)
+{
+    PyLongObject *z = k_mul(a, b);
+
+    if (z != NULL && (Py_SIZE(a) ^ Py_SIZE(b)) < 0)
+        _PyLong_Negate(&z);
+    return z;
+}
+
+/* Evaluate p[2]*x**2 + p[1]*x + p[0] at x = 0, 1, -1, -2 and infinity,
+   storing new references to the five values in v.
+   Returns 0 on success, -1 on failure. */
+static int
+t3_evaluate(PyLongObject **p, PyLongObject **v)
+{
+    PyLongObject *t, *u;
+
+    /* p(1) = (p0 + p2) + p1 and p(-1) = (p0 + p2) - p1 */
+    t = (PyLongObject *)long_add(p[0], p[2]);
+    if (t == NULL)
+        return -1;
+    v[1] = (PyLongObject *)long_add(t, p[1]);
+    v[2] = (PyLongObject *)long_sub(t, p[1]);
+    Py_DECREF(t);
+    if (v[1] == NULL || v[2] == NULL)
+        goto fail;
+
+    /* p(-2) = 2*(p(-1) + p2) - p0 */
+    t = (PyLongObject *)long_add(v[2], p[2]);
+    if (t == NULL)
+        goto fail;
+    u = (PyLongObject *)long_add(t, t);
+    Py_DECREF(t);
+    if (u == NULL)
+        goto fail;
+    v[3] = (PyLongObject *)long_sub(u, p[0]);
+    Py_DECREF(u);
+    if (v[3] == NULL)
+        goto fail;
+
+    Py_INCREF(p[0]);
+    v[0] = p[0];
+    Py_INCREF(p[2]);
+    v[4] = p[2];
+    return 0;
+
+  fail:
+    Py_CLEAR(v[1]);
+    Py_CLEAR(v[2]);
+    return -1;
+}
+
+/* Toom-Cook 3-way multiplication.  Ignores the input signs, and returns the
+ * absolute value of the product (or NULL if error).
+ *
+ * a and b are split into three pieces of shift digits,
+ *     a = a2*X**2 + a1*X + a0 and b = b2*X**2 + b1*X + b0, X = BASE**shift,
+ * the polynomials are evaluated at 0, 1, -1, -2 and infinity, and the five
+ * products of the values (computed by k_mul, on numbers a third of the size)
+ * are interpolated back into the five coefficients of the product.  The
+ * interpolation sequence is the one of Bodrato and Zanoni, "Integer and
+ * Polynomial Multiplication: Towards Optimal Toom-Cook Matrices" (2007).
+ *
+ * The intermediate values may be negative, but the final coefficients are
+ * the nonnegative sums of products of pieces of a and b, and each of them
+ * times its power of X is at most a*b: so they can be added into the
+ * asize + bsize digits of the result at their offsets, as in k_mul.
+ */
+static PyLongObject *
+t3_mul(PyLongObject *a, PyLongObject *b)
+{
+    const Py_ssize_t asize = Py_ABS(Py_SIZE(a));
+    const Py_ssize_t bsize = Py_ABS(Py_SIZE(b));
+    const Py_ssize_t shift = (bsize + 2) / 3;
+    PyLongObject *pa[3] = {NULL, NULL, NULL};
+    PyLongObject *pb[3] = {NULL, NULL, NULL};
+    PyLongObject *va[5] = {NULL, NULL, NULL, NULL, NULL};
+    PyLongObject *vb[5] = {NULL, NULL, NULL, NULL, NULL};
+    PyLongObject *r[5] = {NULL, NULL, NULL, NULL, NULL};
+    PyLongObject *ret = NULL;
+    PyLongObject *t, *u;
+    int i;
+
+    assert(asize <= bsize);
+
+    /* Split a and b, and evaluate them. */
+    for (i = 0; i < 3; i++) {
+        pa[i] = t3_slice(a, i * shift, (i + 1) * shift);
+        if (pa[i] == NULL)
+            goto fail;
+    }
+    if (t3_evaluate(pa, va) < 0)
+        goto fail;
+    if (a != b) {
+        for (i = 0; i < 3; i++) {
+            pb[i] = t3_slice(b, i * shift, (i + 1) * shift);
+            if (pb[i] == NULL)
+                goto fail;
+        }
+        if (t3_evaluate(pb, vb) < 0)
+            goto fail;
+    }
+
+    /* r[i] <- values of the product at 0, 1, -1, -2 and infinity. */
+    for (i = 0; i < 5; i++) {
+        r[i] = t3_signed_mul(va[i], a == b ? va[i] : vb[i]);
+        if (r[i] == NULL)
+            goto fail;
+    }
+    for (i = 0; i < 3; i++) {
+        Py_CLEAR(pa[i]);
+        Py_CLEAR(pb[i]);
+    }
+    for (i = 0; i < 5; i++) {
+        Py_CLEAR(va[i]);
+        Py_CLEAR(vb[i]);
+    }
+
+    /* Interpolate.  Naming the values r0, r1, r-1, r-2 and rinf:
+     *     r3 <- (r-2 - r1) / 3
+     *     r1 <- (r1 - r-1) / 2
+     *     r2 <- r-1 - r0
+     *     r3 <- (r2 - r3) / 2 + 2*rinf
+     *     r2 <- r2 + r1 - rinf
+     *     r1 <- r1 - r3
+     * leaves the coefficients of X**0 to X**4 in r0, r1, r2, r3 and rinf.
+     * All the divisions are exact.
+     */
+    t = (PyLongObject *)long_sub(r[3], r[1]);
+    if (t == NULL)
+        goto fail;
+    Py_SETREF(r[3], t3_divexact(t, 3));
+    Py_DECREF(t);
+    if (r[3] == NULL)
+        goto fail;
+
+    t = (PyLongObject *)long_sub(r[1], r[2]);
+    if (t == NULL)
+        goto fail;
+    Py_SETREF(r[1], t3_divexact(t, 2));
+    Py_DECREF(t);
+    if (r[1] == NULL)
+        goto fail;
+
+    Py_SETREF(r[2], (PyLongObject *)long_sub(r[2], r[0]));
+    if (r[2] == NULL)
+        goto fail;
+
+    t = (PyLongObject *)long_sub(r[2], r[3]);
+    if (t == NULL)
+        goto fail;
+    u = t3_divexact(t, 2);
+    Py_DECREF(t);
+    if (u == NULL)
+        goto fail;
+    t = (PyLongObject *)long_add(r[4], r[4]);
+    if (t == NULL) {
+        Py_DECREF(u);
+        goto fail;
+    }
+    Py_SETREF(r[3], (PyLongObject *)long_add(u, t));
+    Py_DECREF(u);
+    Py_DECREF(t);
+    if (r[3] == NULL)
+        goto fail;
+
+    t = (PyLongObject *)long_add(r[2], r[1]);
+    if (t == NULL)
+        goto fail;
+    Py_SETREF(r[2], (PyLongObject *)long_sub(t, r[4]));
+    Py_DECREF(t);
+    if (r[2] == NULL)
+        goto fail;
+
+    Py_SETREF(r[1], (PyLongObject *)long_sub(r[1], r[3]));
+    if (r[1] == NULL)
+        goto fail;
+
+    /* Add the coefficients into the result at their offsets. */
+    ret = _PyLong_New(asize + bsize);
+    if (ret == NULL)
+        goto fail;
+    memset(ret->ob_digit, 0, Py_SIZE(ret) * sizeof(digit));
+    for (i = 0; i < 5; i++) {
+        assert(Py_SIZE(r[i]) >= 0);
+        if (Py_SIZE(r[i]) > 0) {
+            assert(i * shift + Py_SIZE(r[i]) <= Py_SIZE(ret));
+            (void)v_iadd(ret->ob_digit + i * shift, Py_SIZE(ret) - i * shift,
+                         r[i]->ob_digit, Py_SIZE(r[i]));
+        }
+        Py_CLEAR(r[i]);
+    }
+    return long_normalize(ret);
+
+  fail:
+    for (i = 0; i < 3; i++) {
+        Py_XDECREF(pa[i]);
+        Py_XDECREF(pb[i]);
+    }
+    for (i = 0; i < 5; i++) {
+        Py_XDECREF(va[i]);
+        Py_XDECREF(vb[i]);
+        Py_XDECREF(r[i]);
+    }
+    return NULL;
+}
+
 static PyObject *
 long_mul(PyLongObject *a, PyLongObject *b)
 {
@@ -3555,7 +4084,7 @@ long_mul(PyLongObject *a, PyLongObject *b)
     /* fast path for single-digit multiplication */
     if (Py_ABS(Py_SIZE(a)) <= 1 && Py_ABS(Py_SIZE(b)) <= 1) {
         stwodigits v = (stwodigits)(MEDIUM_VALUE(a)) * MEDIUM_VALUE(b);
-        return PyLong_FromLongLong((long long)v);
+        return _PyLong_FromSTwoDigits(v);
     }
 
     z = k_mul(a, b);
@@ -3629,6 +4158,55 @@ fast_floor_div(PyLongObject *a, PyLongObject *b)
    have different signs.  We then subtract one from the 'div'
    part of the outcome to keep the invariant intact. */
 
+/* Compute divmod(v, w) with _pylong.int_divmod(), and store the results
+ * like l_divmod().  Returns 0 on success, -1 on error and 1 if _pylong is
+ * not available.
+ */
+static int
+pylong_int_divmod(PyLongObject *v, PyLongObject *w,
+                  PyLongObject **pdiv, PyLongObject **pmod)
+{
+    PyObject *mod, *args, *result;
+    PyObject *div, *rem;
+
+    mod = pylong_import(PYLONG_ACTIVE_DIVMOD);
+    if (mod == NULL) {
+        return PyErr_Occurred() ? -1 : 1;
+    }
+    args = Py_BuildValue("(NN)", pylong_exact((PyObject *)v),
+                         pylong_exact((PyObject *)w));
+    if (args == NULL) {
+        Py_DECREF(mod);
+        return -1;
+    }
+    result = pylong_call(mod, "int_divmod", PYLONG_ACTIVE_DIVMOD, args);
+    Py_DECREF(args);
+    Py_DECREF(mod);
+    if (result == NULL) {
+        return -1;
+    }
+    if (!PyTuple_Check(result) || PyTuple_GET_SIZE(result) != 2 ||
+        !PyLong_CheckExact(PyTuple_GET_ITEM(result, 0)) ||
+        !PyLong_CheckExact(PyTuple_GET_ITEM(result, 1))) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "_pylong.int_divmod() must return a pair of ints");
+        Py_DECREF(result);
+        return -1;
+    }
+    div = PyTuple_GET_ITEM(result, 0);
+    rem = PyTuple_GET_ITEM(result, 1);
+    if (pdiv != NULL) {
+        Py_INCREF(div);
+        *pdiv = (PyLongObject *)div;
+    }
+    if (pmod != NULL) {
+        Py_INCREF(rem);
+        *pmod = (PyLongObject *)rem;
+    }
+    Py_DECREF(result);
+    return 0;
+}
+
 /* Compute
  *     *pdiv, *pmod = divmod(v, w)
  * NULL can be passed for pdiv or pmod, in which case that part of
@@ -3665,6 +4243,16 @@ l_divmod(PyLongObject *v, PyLongObject *w,
         }
         return 0;
     }
+    /* x_divrem() is quadratic: switch to the recursive division of _pylong
+       when the divisor and the quotient are both large. */
+    if (Py_ABS(Py_SIZE(w)) > PYLONG_DIVMOD_CUTOFF &&
+        Py_ABS(Py_SIZE(v)) - Py_ABS(Py_SIZE(w)) >
+            PYLONG_DIVMOD_QUOTIENT_CUTOFF) {
+        int res = pylong_int_divmod(v, w, pdiv, pmod);
+        if (res <= 0) {
+            return res;
+        }
+    }
     if (long_divrem(v, w, &div, &mod) < 0)
         return -1;
     if ((Py_SIZE(mod) < 0 && Py_SIZE(w) > 0) ||
@@ -5515,6 +6103,21 @@ _PyLong_Init(void)
     return 1;
 }
 
+int
+PyLong_ClearFreeList(void)
+{
+    PyLongObject *v = free_list, *next;
+    int i = numfree;
+    while (v) {
+        next = (PyLongObject *)Py_TYPE(v);
+        PyObject_FREE(v);
+        v = next;
+    }
+    free_list = NULL;
+    numfree = 0;
+    return i;
+}
+
 void
 PyLong_Fini(void)
 {
@@ -5531,4 +6134,15 @@ PyLong_Fini(void)
         _Py_ForgetReference((PyObject*)v);
     }
 #endif
+    (void)PyLong_ClearFreeList();
+}
+
+/* Print summary info about the state of the optimized allocator */
+void
+_PyLong_DebugMallocStats(FILE *out)
+{
+    _PyDebugAllocatorStats(out,
+                           "free PyLongObject",
+                           numfree,
+                           offsetof(PyLongObject, ob_digit) + sizeof(digit));
 }
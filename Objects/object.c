@@ -50,6 +50,30 @@ _PyDebug_PrintTotalRefs(void) {
  */
 static PyObject refchain = {&refchain, &refchain};
 
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+/* The list is shared by all interpreters, including those with their own
+ * GIL: guard it with a lock of its own.  The first objects are created at
+ * startup, by a single thread, which allocates the lock.
+ */
+static PyThread_type_lock refchain_lock = NULL;
+
+static void
+refchain_acquire(void)
+{
+    if (refchain_lock == NULL) {
+        refchain_lock = PyThread_allocate_lock();
+        if (refchain_lock == NULL)
+            Py_FatalError("Can't allocate the refchain lock");
+    }
+    PyThread_acquire_lock(refchain_lock, WAIT_LOCK);
+}
+#define REFCHAIN_LOCK() refchain_acquire()
+#define REFCHAIN_UNLOCK() PyThread_release_lock(refchain_lock)
+#else
+#define REFCHAIN_LOCK()
+#define REFCHAIN_UNLOCK()
+#endif
+
 /* Insert op at the front of the list of all objects.  If force is true,
  * op is added even if _ob_prev and _ob_next are non-NULL already.  If
  * force is false amd _ob_prev or _ob_next are non-NULL, do nothing.
@@ -73,10 +97,12 @@ _Py_AddToAllObjects(PyObject *op, int force)
     }
 #endif
     if (force || op->_ob_prev == NULL) {
+        REFCHAIN_LOCK();
         op->_ob_next = refchain._ob_next;
         op->_ob_prev = &refchain;
         refchain._ob_next->_ob_prev = op;
         refchain._ob_next = op;
+        REFCHAIN_UNLOCK();
     }
 }
 #endif  /* Py_TRACE_REFS */
@@ -1882,11 +1908,15 @@ _Py_ReadyTypes(void)
 }
 
 
+/* Set and used by Modules/_tracemalloc.c */
+void *_PyTraceMalloc_NewBlock = NULL;
+
 #ifdef Py_TRACE_REFS
 
 void
 _Py_NewReference(PyObject *op)
 {
+    _Py_TRACEMALLOC_NEWREF(op);
     _Py_INC_REFTOTAL;
     op->ob_refcnt = 1;
     _Py_AddToAllObjects(op, 1);
@@ -1901,6 +1931,7 @@ _Py_ForgetReference(PyObject *op)
 #endif
     if (op->ob_refcnt < 0)
         Py_FatalError("UNREF negative refcnt");
+    REFCHAIN_LOCK();
     if (op == &refchain ||
         op->_ob_prev->_ob_next != op || op->_ob_next->_ob_prev != op) {
         fprintf(stderr, "* ob\n");
@@ -1922,6 +1953,7 @@ _Py_ForgetReference(PyObject *op)
     op->_ob_next->_ob_prev = op->_ob_prev;
     op->_ob_prev->_ob_next = op->_ob_next;
     op->_ob_next = op->_ob_prev = NULL;
+    REFCHAIN_UNLOCK();
     _Py_INC_TPFREES(op);
 }
 
@@ -2006,6 +2038,7 @@ _PyObject_DebugTypeStats(FILE *out)
     _PyFloat_DebugMallocStats(out);
     _PyFrame_DebugMallocStats(out);
     _PyList_DebugMallocStats(out);
+    _PyLong_DebugMallocStats(out);
     _PyMethod_DebugMallocStats(out);
     _PyTuple_DebugMallocStats(out);
 }
@@ -2097,8 +2130,8 @@ _PyTrash_deposit_object(PyObject *op)
     assert(PyObject_IS_GC(op));
     assert(_PyGC_REFS(op) == _PyGC_REFS_UNTRACKED);
     assert(op->ob_refcnt == 0);
-    _Py_AS_GC(op)->gc.gc_prev = (PyGC_Head *)_PyRuntime.gc.trash_delete_later;
-    _PyRuntime.gc.trash_delete_later = op;
+    _Py_AS_GC(op)->gc.gc_prev = (PyGC_Head *)_PyGC_STATE()->trash_delete_later;
+    _PyGC_STATE()->trash_delete_later = op;
 }
 
 /* The equivalent API, using per-thread state recursion info */
@@ -2119,11 +2152,11 @@ _PyTrash_thread_deposit_object(PyObject *op)
 void
 _PyTrash_destroy_chain(void)
 {
-    while (_PyRuntime.gc.trash_delete_later) {
-        PyObject *op = _PyRuntime.gc.trash_delete_later;
+    while (_PyGC_STATE()->trash_delete_later) {
+        PyObject *op = _PyGC_STATE()->trash_delete_later;
         destructor dealloc = Py_TYPE(op)->tp_dealloc;
 
-        _PyRuntime.gc.trash_delete_later =
+        _PyGC_STATE()->trash_delete_later =
             (PyObject*) _Py_AS_GC(op)->gc.gc_prev;
 
         /* Call the deallocator directly.  This used to try to
@@ -2133,9 +2166,9 @@ _PyTrash_destroy_chain(void)
          * up distorting allocation statistics.
          */
         assert(op->ob_refcnt == 0);
-        ++_PyRuntime.gc.trash_delete_nesting;
+        ++_PyGC_STATE()->trash_delete_nesting;
         (*dealloc)(op);
-        --_PyRuntime.gc.trash_delete_nesting;
+        --_PyGC_STATE()->trash_delete_nesting;
     }
 }
 
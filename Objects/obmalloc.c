@@ -1,4 +1,5 @@
 #include "Python.h"
+#include "internal/pystate.h"
 
 #include <stdbool.h>
 
@@ -52,6 +53,11 @@ static void _PyMem_SetupDebugHooksDomain(PyMemAllocatorDomain domain);
 #  include <sys/mman.h>
 #  ifdef MAP_ANONYMOUS
 #    define ARENAS_USE_MMAP
+#    ifdef MADV_DONTNEED
+       /* The memory of the free pools of an arena can be given back to the
+          system (see arena_release_pools()) */
+#      define ARENAS_RELEASE_POOLS
+#    endif
 #  endif
 #endif
 
@@ -119,10 +125,34 @@ _PyObject_ArenaVirtualFree(void *ctx, void *ptr, size_t size)
 }
 
 #elif defined(ARENAS_USE_MMAP)
+/* Size of the huge pages of the MMU.  2 MiB is the most common one. */
+#define HUGE_PAGE_SIZE (2 << 20)
+
 static void *
 _PyObject_ArenaMmap(void *ctx, size_t size)
 {
     void *ptr;
+#ifdef MADV_HUGEPAGE
+    if (size >= HUGE_PAGE_SIZE) {
+        /* Align the arena on a huge page boundary, so that the kernel can
+           back it with transparent huge pages: map one huge page more than
+           needed and unmap what lies outside of the aligned range. */
+        size_t len = size + HUGE_PAGE_SIZE;
+        char *raw, *aligned;
+
+        raw = mmap(NULL, len, PROT_READ|PROT_WRITE,
+                   MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED)
+            return NULL;
+        aligned = _Py_ALIGN_UP(raw, HUGE_PAGE_SIZE);
+        if (aligned != raw)
+            munmap(raw, aligned - raw);
+        if (aligned + size != raw + len)
+            munmap(aligned + size, (raw + len) - (aligned + size));
+        (void)madvise(aligned, size, MADV_HUGEPAGE);
+        return aligned;
+    }
+#endif
     ptr = mmap(NULL, size, PROT_READ|PROT_WRITE,
                MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
     if (ptr == MAP_FAILED)
@@ -829,11 +859,19 @@ static int running_on_valgrind = -1;
  *
  * Arenas are allocated with mmap() on systems supporting anonymous memory
  * mappings to reduce heap fragmentation.
+ *
+ * The size of the arenas is DEFAULT_ARENA_SIZE, unless the
+ * PYTHONMALLOCARENASIZE environment variable asks for larger ones, which
+ * means fewer memory mappings.  Arenas of HUGE_PAGE_SIZE or more are aligned
+ * on a huge page so that the system can back them with huge pages, which
+ * reduces the TLB pressure.  The size is set with the core configuration,
+ * before the first arena is allocated, and doesn't change after that.
  */
-#define ARENA_SIZE              (256 << 10)     /* 256KB */
+#define DEFAULT_ARENA_SIZE      (256 << 10)     /* 256KB */
+#define MAX_ARENA_SIZE          (256 << 20)     /* 256MB */
 
 #ifdef WITH_MEMORY_LIMITS
-#define MAX_ARENAS              (SMALL_MEMORY_LIMIT / ARENA_SIZE)
+#define MAX_ARENAS              (SMALL_MEMORY_LIMIT / arena_size)
 #endif
 
 /*
@@ -890,6 +928,14 @@ struct arena_object {
     /* Singly-linked list of available pools. */
     struct pool_header* freepools;
 
+    /* Stack of the indices of the available pools whose memory was given
+     * back to the system, and which can't be linked together since their
+     * headers are gone.  The array is NULL if the pools of this arena are
+     * never released.
+     */
+    uint16_t *releasedpools;
+    uint nreleasedpools;
+
     /* Whenever this arena_object is not associated with an allocated
      * arena, the nextarena member is used to link all unassociated
      * arena_objects in the singly-linked `unused_arena_objects` list.
@@ -1098,8 +1144,8 @@ static struct arena_object* unused_arena_objects = NULL;
 static struct arena_object* usable_arenas = NULL;
 
 /* How many arena_objects do we initially allocate?
- * 16 = can allocate 16 arenas = 16 * ARENA_SIZE = 4MB before growing the
- * `arenas` vector.
+ * 16 = can allocate 16 arenas = 16 * arena_size = 4MB by default before
+ * growing the `arenas` vector.
  */
 #define INITIAL_ARENA_OBJECTS 16
 
@@ -1111,6 +1157,81 @@ static size_t ntimes_arena_allocated = 0;
 /* High water mark (max value ever seen) for narenas_currently_allocated. */
 static size_t narenas_highwater = 0;
 
+/* Size of the arenas, see PYTHONMALLOCARENASIZE. */
+static size_t arena_size = DEFAULT_ARENA_SIZE;
+
+/* Total number of pools whose memory was given back to the system. */
+static size_t npools_released = 0;
+
+#ifdef ARENAS_RELEASE_POOLS
+/* Can the pools of the arenas be released?  -1 means not checked yet. */
+static int release_pools = -1;
+#endif
+
+/* Set arena_size from opt, the value of the PYTHONMALLOCARENASIZE
+ * environment variable read with the core configuration (so that -E and -I
+ * ignore it): a power of 2 number of bytes, optionally followed by "K" or
+ * "M".  Return -1 if opt is invalid.  Once an arena was allocated the size
+ * can't change any more and opt is only checked.
+ */
+int
+_PyObject_SetArenaSize(const char *opt)
+{
+    char *end;
+    unsigned long size;
+
+    errno = 0;
+    size = strtoul(opt, &end, 10);
+    if (errno == 0 && end != opt && size <= MAX_ARENA_SIZE) {
+        if (*end == 'k' || *end == 'K') {
+            size <<= 10;
+            end++;
+        }
+        else if (*end == 'm' || *end == 'M') {
+            size <<= 20;
+            end++;
+        }
+    }
+    if (errno != 0 || end == opt || *end != '\0'
+        || size < DEFAULT_ARENA_SIZE || size > MAX_ARENA_SIZE
+        || (size & (size - 1)) != 0)
+    {
+        return -1;
+    }
+    if (maxarenas == 0) {
+        arena_size = size;
+    }
+    return 0;
+}
+
+#ifdef ARENAS_RELEASE_POOLS
+/* Give the memory of the pools of the freepools list of the arena ao back
+ * to the system, except for the most recently freed pool, which is likely
+ * to be reused soon.  The pages are mapped again, filled with zeros, when
+ * the pools are reused.
+ */
+static void
+arena_release_pools(struct arena_object *ao)
+{
+    uintptr_t base = (uintptr_t)_Py_ALIGN_UP(ao->address, POOL_SIZE);
+    poolp pool;
+
+    assert(ao->releasedpools != NULL);
+    assert(ao->freepools != NULL);
+    pool = ao->freepools->nextpool;
+    ao->freepools->nextpool = NULL;
+    while (pool != NULL) {
+        poolp next = pool->nextpool;
+        (void)madvise(pool, POOL_SIZE, MADV_DONTNEED);
+        assert(ao->nreleasedpools < ao->ntotalpools);
+        ao->releasedpools[ao->nreleasedpools++] =
+            (uint16_t)(((uintptr_t)pool - base) / POOL_SIZE);
+        ++npools_released;
+        pool = next;
+    }
+}
+#endif
+
 static Py_ssize_t _Py_AllocatedBlocks = 0;
 
 Py_ssize_t
@@ -1140,6 +1261,14 @@ new_arena(void)
     if (debug_stats)
         _PyObject_DebugMallocStats(stderr);
 
+#ifdef ARENAS_RELEASE_POOLS
+    if (release_pools == -1) {
+        /* madvise() works on whole pages */
+        long page_size = sysconf(_SC_PAGESIZE);
+        release_pools = (page_size > 0 && POOL_SIZE % page_size == 0);
+    }
+#endif
+
     if (unused_arena_objects == NULL) {
         uint i;
         uint numarenas;
@@ -1173,6 +1302,7 @@ new_arena(void)
         /* Put the new arenas on the unused_arena_objects list. */
         for (i = maxarenas; i < numarenas; ++i) {
             arenas[i].address = 0;              /* mark as unassociated */
+            arenas[i].releasedpools = NULL;
             arenas[i].nextarena = i < numarenas - 1 ?
                                    &arenas[i+1] : NULL;
         }
@@ -1187,7 +1317,7 @@ new_arena(void)
     arenaobj = unused_arena_objects;
     unused_arena_objects = arenaobj->nextarena;
     assert(arenaobj->address == 0);
-    address = _PyObject_Arena.alloc(_PyObject_Arena.ctx, ARENA_SIZE);
+    address = _PyObject_Arena.alloc(_PyObject_Arena.ctx, arena_size);
     if (address == NULL) {
         /* The allocation failed: return NULL after putting the
          * arenaobj back.
@@ -1206,14 +1336,29 @@ new_arena(void)
     /* pool_address <- first pool-aligned address in the arena
        nfreepools <- number of whole pools that fit after alignment */
     arenaobj->pool_address = (block*)arenaobj->address;
-    arenaobj->nfreepools = ARENA_SIZE / POOL_SIZE;
-    assert(POOL_SIZE * arenaobj->nfreepools == ARENA_SIZE);
+    arenaobj->nfreepools = (uint)(arena_size / POOL_SIZE);
+    assert(POOL_SIZE * arenaobj->nfreepools == arena_size);
     excess = (uint)(arenaobj->address & POOL_SIZE_MASK);
     if (excess != 0) {
         --arenaobj->nfreepools;
         arenaobj->pool_address += POOL_SIZE - excess;
     }
     arenaobj->ntotalpools = arenaobj->nfreepools;
+    arenaobj->nreleasedpools = 0;
+#ifdef ARENAS_RELEASE_POOLS
+    /* Only the memory of the arenas mapped by _PyObject_ArenaMmap() can be
+     * released with madvise().  The array is kept when the arena_object
+     * is reused, since the arena size doesn't change.
+     */
+    if (!release_pools || _PyObject_Arena.alloc != _PyObject_ArenaMmap) {
+        PyMem_RawFree(arenaobj->releasedpools);
+        arenaobj->releasedpools = NULL;
+    }
+    else if (arenaobj->releasedpools == NULL) {
+        arenaobj->releasedpools = PyMem_RawMalloc(
+            arenaobj->ntotalpools * sizeof(uint16_t));
+    }
+#endif
 
     return arenaobj;
 }
@@ -1232,11 +1377,11 @@ called on every alloc/realloc/free, micro-efficiency is important here).
 Tricky:  Let B be the arena base address associated with the pool, B =
 arenas[(POOL)->arenaindex].address.  Then P belongs to the arena if and only if
 
-    B <= P < B + ARENA_SIZE
+    B <= P < B + arena_size
 
 Subtracting B throughout, this is true iff
 
-    0 <= P-B < ARENA_SIZE
+    0 <= P-B < arena_size
 
 By using unsigned arithmetic, the "0 <=" half of the test can be skipped.
 
@@ -1249,7 +1394,7 @@ into a NULL arenas.
 Details:  given P and POOL, the arena_object corresponding to P is AO =
 arenas[(POOL)->arenaindex].  Suppose obmalloc controls P.  Then (barring wild
 stores, etc), POOL is the correct address of P's pool, AO.address is the
-correct base address of the pool's arena, and P must be within ARENA_SIZE of
+correct base address of the pool's arena, and P must be within arena_size of
 AO.address.  In addition, AO.address is not 0 (no arena can start at address 0
 (NULL)).  Therefore address_in_range correctly reports that obmalloc
 controls P.
@@ -1262,7 +1407,7 @@ control P.
 
 Else arenaindex is < maxarena, and AO is read up.  If AO corresponds to an
 allocated arena, obmalloc controls all the memory in slice AO.address :
-AO.address+ARENA_SIZE.  By case assumption, P is not controlled by obmalloc,
+AO.address+arena_size.  By case assumption, P is not controlled by obmalloc,
 so P doesn't lie in that slice, so the macro correctly reports that P is not
 controlled by obmalloc.
 
@@ -1270,19 +1415,19 @@ Finally, if P is not controlled by obmalloc and AO corresponds to an unused
 arena_object (one not currently associated with an allocated arena),
 AO.address is 0, and the second test in the macro reduces to:
 
-    P < ARENA_SIZE
+    P < arena_size
 
-If P >= ARENA_SIZE (extremely likely), the macro again correctly concludes
-that P is not controlled by obmalloc.  However, if P < ARENA_SIZE, this part
+If P >= arena_size (extremely likely), the macro again correctly concludes
+that P is not controlled by obmalloc.  However, if P < arena_size, this part
 of the test still passes, and the third clause (AO.address != 0) is necessary
 to get the correct result:  AO.address is 0 in this case, so the macro
 correctly reports that P is not controlled by obmalloc (despite that P lies in
-slice AO.address : AO.address + ARENA_SIZE).
+slice AO.address : AO.address + arena_size).
 
 Note:  The third (AO.address != 0) clause was added in Python 2.5.  Before
 2.5, arenas were never free()'ed, and an arenaindex < maxarena always
 corresponded to a currently-allocated arena, so the "P is not controlled by
-obmalloc, AO corresponds to an unused arena_object, and P < ARENA_SIZE" case
+obmalloc, AO corresponds to an unused arena_object, and P < arena_size" case
 was impossible.
 
 Note that the logic is excruciating, and reading up possibly uninitialized
@@ -1304,11 +1449,121 @@ address_in_range(void *p, poolp pool)
     // only once.
     uint arenaindex = *((volatile uint *)&pool->arenaindex);
     return arenaindex < maxarenas &&
-        (uintptr_t)p - arenas[arenaindex].address < ARENA_SIZE &&
+        (uintptr_t)p - arenas[arenaindex].address < arena_size &&
         arenas[arenaindex].address != 0;
 }
 
 
+/*==========================================================================*/
+
+/* Thread caches
+
+   With WITH_PYMALLOC_THREAD_CACHE (--with-pymalloc-thread-cache), every
+   thread state owns a small cache of free blocks per size class
+   (tstate->obmalloc_cache), which sits in front of the pools:
+   pymalloc_free() pushes a block on the cache of the current thread, and
+   pymalloc_alloc() pops it from there before looking at usedpools.  A block
+   freed and allocated again in a row by the same thread thus never touches
+   the pool lists.  The default build doesn't have the caches: looking up the
+   current thread state costs something on every allocation.
+
+   From the pool's point of view, a cached block is still allocated.  To not
+   keep pools and arenas alive for too long, every class of a cache holds at
+   most THREAD_CACHE_MAX_BLOCKS blocks and THREAD_CACHE_MAX_BYTES bytes: when
+   it is full, half of it is given back to the pools.
+
+   Giving blocks back to the pools requires the GIL, so the whole cache is
+   given back by PyThreadState_Clear(), not when the thread state is deleted.
+   The cache is then replaced by closed_thread_cache, which is always empty
+   and never filled: the blocks freed by the thread after that go straight
+   back to the pools. */
+
+static int pool_free(poolp pool, block *bp);
+
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+
+#define THREAD_CACHE_MAX_BLOCKS 64
+#define THREAD_CACHE_MAX_BYTES  4096
+
+struct _obmalloc_cache {
+    block *freeblocks[NB_SMALL_SIZE_CLASSES];
+    uint count[NB_SMALL_SIZE_CLASSES];
+};
+
+static struct _obmalloc_cache closed_thread_cache;
+
+/* Statistics reported by _PyObject_DebugMallocStats() */
+static size_t thread_cache_hits = 0;
+static size_t thread_cache_misses = 0;
+static size_t thread_cache_flushes = 0;
+
+/* Return the cache of the current thread, or NULL.  If create is true,
+   allocate the cache if the thread doesn't have one yet. */
+static inline struct _obmalloc_cache *
+thread_cache_get(int create)
+{
+    PyThreadState *tstate = PyThreadState_GET();
+    if (tstate == NULL) {
+        return NULL;
+    }
+    if (tstate->obmalloc_cache == NULL && create) {
+        tstate->obmalloc_cache = PyMem_RawCalloc(1,
+                                                 sizeof(struct _obmalloc_cache));
+    }
+    return tstate->obmalloc_cache;
+}
+
+/* Give the n least recently freed blocks of the class size of cache back to
+   their pools. */
+static void
+thread_cache_flush(struct _obmalloc_cache *cache, uint size, uint n)
+{
+    block **link = &cache->freeblocks[size];
+    uint keep;
+    block *bp;
+
+    assert(n <= cache->count[size]);
+    for (keep = cache->count[size] - n; keep > 0; keep--) {
+        link = (block **)*link;
+    }
+    bp = *link;
+    *link = NULL;
+    cache->count[size] -= n;
+    thread_cache_flushes += n;
+    while (bp != NULL) {
+        block *next = *(block **)bp;
+        pool_free(POOL_ADDR(bp), bp);
+        bp = next;
+    }
+}
+
+/* Must be called with the GIL held */
+void
+_PyObject_ClearThreadCache(PyThreadState *tstate)
+{
+    struct _obmalloc_cache *cache = tstate->obmalloc_cache;
+    uint i;
+
+    tstate->obmalloc_cache = &closed_thread_cache;
+    if (cache == NULL || cache == &closed_thread_cache) {
+        return;
+    }
+    for (i = 0; i < NB_SMALL_SIZE_CLASSES; i++) {
+        thread_cache_flush(cache, i, cache->count[i]);
+        assert(cache->freeblocks[i] == NULL);
+    }
+    PyMem_RawFree(cache);
+}
+
+#else   /* !WITH_PYMALLOC_THREAD_CACHE */
+
+void
+_PyObject_ClearThreadCache(PyThreadState *tstate)
+{
+}
+
+#endif  /* WITH_PYMALLOC_THREAD_CACHE */
+
 /*==========================================================================*/
 
 /* pymalloc allocator
@@ -1327,6 +1582,9 @@ address_in_range(void *p, poolp pool)
 static int
 pymalloc_alloc(void *ctx, void **ptr_p, size_t nbytes)
 {
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    struct _obmalloc_cache *cache;
+#endif
     block *bp;
     poolp pool;
     poolp next;
@@ -1352,6 +1610,18 @@ pymalloc_alloc(void *ctx, void **ptr_p, size_t nbytes)
      * Most frequent paths first
      */
     size = (uint)(nbytes - 1) >> ALIGNMENT_SHIFT;
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    cache = thread_cache_get(0);
+    if (cache != NULL && (bp = cache->freeblocks[size]) != NULL) {
+        /* A block recently freed by this thread */
+        cache->freeblocks[size] = *(block **)bp;
+        --cache->count[size];
+        ++thread_cache_hits;
+        goto success;
+    }
+    ++thread_cache_misses;
+#endif
+
     pool = usedpools[size + size];
     if (pool != pool->nextpool) {
         /*
@@ -1433,14 +1703,15 @@ pymalloc_alloc(void *ctx, void **ptr_p, size_t nbytes)
         }
         else {
             /* nfreepools > 0:  it must be that freepools
-             * isn't NULL, or that we haven't yet carved
-             * off all the arena's pools for the first
-             * time.
+             * isn't NULL, that some pools were released, or
+             * that we haven't yet carved off all the arena's
+             * pools for the first time.
              */
             assert(usable_arenas->freepools != NULL ||
+                   usable_arenas->nreleasedpools > 0 ||
                    usable_arenas->pool_address <=
                    (block*)usable_arenas->address +
-                       ARENA_SIZE - POOL_SIZE);
+                       arena_size - POOL_SIZE);
         }
 
     init_pool:
@@ -1476,16 +1747,29 @@ pymalloc_alloc(void *ctx, void **ptr_p, size_t nbytes)
         goto success;
     }
 
-    /* Carve off a new pool. */
     assert(usable_arenas->nfreepools > 0);
     assert(usable_arenas->freepools == NULL);
-    pool = (poolp)usable_arenas->pool_address;
-    assert((block*)pool <= (block*)usable_arenas->address +
-                             ARENA_SIZE - POOL_SIZE);
+    if (usable_arenas->nreleasedpools > 0) {
+        /* Reuse a released pool:  its header is gone, so it's
+         * initialized as a new pool.
+         */
+        uint index;
+        index = usable_arenas->releasedpools[--usable_arenas->nreleasedpools];
+        pool = (poolp)((uintptr_t)_Py_ALIGN_UP(usable_arenas->address,
+                                               POOL_SIZE)
+                       + (uintptr_t)index * POOL_SIZE);
+        assert((block*)pool < usable_arenas->pool_address);
+    }
+    else {
+        /* Carve off a new pool. */
+        pool = (poolp)usable_arenas->pool_address;
+        assert((block*)pool <= (block*)usable_arenas->address +
+                                 arena_size - POOL_SIZE);
+        usable_arenas->pool_address += POOL_SIZE;
+    }
     pool->arenaindex = (uint)(usable_arenas - arenas);
     assert(&arenas[pool->arenaindex] == usable_arenas);
     pool->szidx = DUMMY_SIZE_IDX;
-    usable_arenas->pool_address += POOL_SIZE;
     --usable_arenas->nfreepools;
 
     if (usable_arenas->nfreepools == 0) {
@@ -1557,10 +1841,11 @@ _PyObject_Calloc(void *ctx, size_t nelem, size_t elsize)
 static int
 pymalloc_free(void *ctx, void *p)
 {
-    poolp pool;
-    block *lastfree;
-    poolp next, prev;
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    struct _obmalloc_cache *cache;
     uint size;
+#endif
+    poolp pool;
 
     assert(p != NULL);
 
@@ -1576,6 +1861,36 @@ pymalloc_free(void *ctx, void *p)
     }
     /* We allocated this address. */
 
+#ifndef WITH_PYMALLOC_THREAD_CACHE
+    return pool_free(pool, (block *)p);
+#else
+    cache = thread_cache_get(1);
+    if (cache == NULL || cache == &closed_thread_cache) {
+        return pool_free(pool, (block *)p);
+    }
+    size = pool->szidx;
+    if (cache->count[size] >= THREAD_CACHE_MAX_BLOCKS ||
+        cache->count[size] * INDEX2SIZE(size) >= THREAD_CACHE_MAX_BYTES)
+    {
+        /* The cache is full: give its older half back to the pools */
+        thread_cache_flush(cache, size, (cache->count[size] + 1) / 2);
+    }
+    *(block **)p = cache->freeblocks[size];
+    cache->freeblocks[size] = (block *)p;
+    ++cache->count[size];
+    return 1;
+#endif
+}
+
+
+/* Give the block p back to its pool. */
+static int
+pool_free(poolp pool, block *p)
+{
+    block *lastfree;
+    poolp next, prev;
+    uint size;
+
     /* Link p to the start of the pool's freeblock list.  Since
      * the pool had at least the p block outstanding, the pool
      * wasn't empty (so it's already in a usedpools[] list, or
@@ -1681,13 +1996,28 @@ pymalloc_free(void *ctx, void *p)
 
         /* Free the entire arena. */
         _PyObject_Arena.free(_PyObject_Arena.ctx,
-                             (void *)ao->address, ARENA_SIZE);
+                             (void *)ao->address, arena_size);
         ao->address = 0;                        /* mark unassociated */
         --narenas_currently_allocated;
 
         goto success;
     }
 
+#ifdef ARENAS_RELEASE_POOLS
+    /* The arena is still in use:  if a quarter of its pools are free
+     * but still mapped, give their memory back to the system.  Doing it
+     * in batches spares a system call each time a pool gets empty.
+     */
+    if (ao->releasedpools != NULL) {
+        uint nuncarved = (uint)((ao->address + arena_size
+                                 - (uintptr_t)ao->pool_address) / POOL_SIZE);
+        uint nmapped = nf - ao->nreleasedpools - nuncarved;
+        if (nmapped > 1 && nmapped >= ao->ntotalpools / 4) {
+            arena_release_pools(ao);
+        }
+    }
+#endif
+
     if (nf == 1) {
         /* Case 2.  Put ao at the head of
          * usable_arenas.  Note that because
@@ -1878,6 +2208,17 @@ _Py_GetAllocatedBlocks(void)
     return 0;
 }
 
+void
+_PyObject_ClearThreadCache(PyThreadState *tstate)
+{
+}
+
+int
+_PyObject_SetArenaSize(const char *opt)
+{
+    return 0;
+}
+
 #endif /* WITH_PYMALLOC */
 
 
@@ -2423,6 +2764,20 @@ pool_is_in_list(const poolp target, poolp list)
     } while (list != NULL && list != origlist);
     return 0;
 }
+
+/* Was the memory of the pool target of the arena ao released? */
+static int
+pool_is_released(const poolp target, const struct arena_object *ao)
+{
+    uintptr_t base = (uintptr_t)_Py_ALIGN_UP(ao->address, POOL_SIZE);
+    uint i;
+    for (i = 0; i < ao->nreleasedpools; i++) {
+        uintptr_t pool = base + (uintptr_t)ao->releasedpools[i] * POOL_SIZE;
+        if ((uintptr_t)target == pool)
+            return 1;
+    }
+    return 0;
+}
 #endif
 
 /* Print summary info to "out" about the state of pymalloc's structures.
@@ -2451,6 +2806,8 @@ _PyObject_DebugMallocStats(FILE *out)
     size_t available_bytes = 0;
     /* # of free pools + pools not yet carved out of current arena */
     uint numfreepools = 0;
+    /* # of free pools whose memory was given back to the system */
+    uint numreleasedpools = 0;
     /* # of bytes for arena alignment padding */
     size_t arena_alignment = 0;
     /* # of bytes in used and full pools used for pool_headers */
@@ -2462,9 +2819,17 @@ _PyObject_DebugMallocStats(FILE *out)
     size_t quantization = 0;
     /* # of arenas actually allocated. */
     size_t narenas = 0;
-    /* running total -- should equal narenas * ARENA_SIZE */
+    /* # of blocks and bytes in the thread caches */
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    size_t cached_blocks = 0;
+#endif
+    size_t cached_bytes = 0;
+    /* running total -- should equal narenas * arena_size */
     size_t total;
     char buf[128];
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    PyInterpreterState *interp;
+#endif
 
     fprintf(out, "Small block threshold = %d, in %u size classes.\n",
             SMALL_REQUEST_THRESHOLD, numclasses);
@@ -2486,6 +2851,7 @@ _PyObject_DebugMallocStats(FILE *out)
         narenas += 1;
 
         numfreepools += arenas[i].nfreepools;
+        numreleasedpools += arenas[i].nreleasedpools;
 
         /* round up to pool alignment */
         if (base & (uintptr_t)POOL_SIZE_MASK) {
@@ -2505,7 +2871,8 @@ _PyObject_DebugMallocStats(FILE *out)
             if (p->ref.count == 0) {
                 /* currently unused */
 #ifdef Py_DEBUG
-                assert(pool_is_in_list(p, arenas[i].freepools));
+                assert(pool_is_in_list(p, arenas[i].freepools) ||
+                       pool_is_released(p, &arenas[i]));
 #endif
                 continue;
             }
@@ -2521,6 +2888,26 @@ _PyObject_DebugMallocStats(FILE *out)
     }
     assert(narenas == narenas_currently_allocated);
 
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    /* The blocks in the thread caches are allocated from the pools' point
+     * of view, but available in fact.
+     */
+    for (interp = PyInterpreterState_Head(); interp != NULL;
+         interp = PyInterpreterState_Next(interp)) {
+        PyThreadState *tstate;
+        for (tstate = PyInterpreterState_ThreadHead(interp); tstate != NULL;
+             tstate = PyThreadState_Next(tstate)) {
+            struct _obmalloc_cache *cache = tstate->obmalloc_cache;
+            if (cache == NULL)
+                continue;
+            for (i = 0; i < numclasses; ++i) {
+                cached_blocks += cache->count[i];
+                cached_bytes += cache->count[i] * INDEX2SIZE(i);
+            }
+        }
+    }
+#endif
+
     fputc('\n', out);
     fputs("class   size   num pools   blocks in use  avail blocks\n"
           "-----   ----   ---------   -------------  ------------\n",
@@ -2554,18 +2941,37 @@ _PyObject_DebugMallocStats(FILE *out)
     (void)printone(out, "# arenas allocated current", narenas);
 
     PyOS_snprintf(buf, sizeof(buf),
-        "%" PY_FORMAT_SIZE_T "u arenas * %d bytes/arena",
-        narenas, ARENA_SIZE);
-    (void)printone(out, buf, narenas * ARENA_SIZE);
+        "%" PY_FORMAT_SIZE_T "u arenas * %" PY_FORMAT_SIZE_T "u bytes/arena",
+        narenas, arena_size);
+    (void)printone(out, buf, narenas * arena_size);
+    (void)printone(out, "# pools released total", npools_released);
 
     fputc('\n', out);
 
-    total = printone(out, "# bytes in allocated blocks", allocated_bytes);
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    (void)printone(out, "# thread cache hits", thread_cache_hits);
+    (void)printone(out, "# thread cache misses", thread_cache_misses);
+    (void)printone(out, "# thread cache flushed blocks", thread_cache_flushes);
+    (void)printone(out, "# blocks in thread caches", cached_blocks);
+
+    fputc('\n', out);
+#endif
+
+    total = printone(out, "# bytes in allocated blocks",
+                     allocated_bytes - cached_bytes);
     total += printone(out, "# bytes in available blocks", available_bytes);
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+    total += printone(out, "# bytes in thread caches", cached_bytes);
+#endif
 
     PyOS_snprintf(buf, sizeof(buf),
-        "%u unused pools * %d bytes", numfreepools, POOL_SIZE);
-    total += printone(out, buf, (size_t)numfreepools * POOL_SIZE);
+        "%u unused pools * %d bytes", numfreepools - numreleasedpools,
+        POOL_SIZE);
+    total += printone(out, buf,
+                      (size_t)(numfreepools - numreleasedpools) * POOL_SIZE);
+    PyOS_snprintf(buf, sizeof(buf),
+        "%u released pools * %d bytes", numreleasedpools, POOL_SIZE);
+    total += printone(out, buf, (size_t)numreleasedpools * POOL_SIZE);
 
     total += printone(out, "# bytes lost to pool headers", pool_header_bytes);
     total += printone(out, "# bytes lost to quantization", quantization);
@@ -563,14 +563,16 @@ _odict_resize(PyODictObject *od) {
     Py_ssize_t size, i;
     _ODictNode **fast_nodes, *node;
 
-    /* Initialize a new "fast nodes" table. */
+    /* Initialize a new "fast nodes" table.  All the entries of a compact
+       table are usable: add a slot for the index of a missing key
+       (dk_nentries, see _odict_get_index_raw()). */
     size = ((PyDictObject *)od)->ma_keys->dk_size;
-    fast_nodes = PyMem_NEW(_ODictNode *, size);
+    fast_nodes = PyMem_NEW(_ODictNode *, size + 1);
     if (fast_nodes == NULL) {
         PyErr_NoMemory();
         return -1;
     }
-    for (i = 0; i < size; i++)
+    for (i = 0; i < size + 1; i++)
         fast_nodes[i] = NULL;
 
     /* Copy the current nodes into the table. */
@@ -887,7 +889,7 @@ static PyObject *
 odict_sizeof(PyODictObject *od, PyObject *Py_UNUSED(ignored))
 {
     Py_ssize_t res = _PyDict_SizeOf((PyDictObject *)od);
-    res += sizeof(_ODictNode *) * _odict_FAST_SIZE(od);  /* od_fast_nodes */
+    res += sizeof(_ODictNode *) * (_odict_FAST_SIZE(od) + 1);  /* od_fast_nodes */
     if (!_odict_EMPTY(od)) {
         res += sizeof(_ODictNode) * PyODict_SIZE(od);  /* linked-list */
     }
@@ -98,6 +98,9 @@ PyObject _Py_EllipsisObject = {
 /* Using a cache is very effective since typically only a single slice is
  * created and then deleted again
  */
+#ifndef PySlice_MAXFREELIST
+#define PySlice_MAXFREELIST 1
+#endif
 static PySliceObject *slice_cache = NULL;
 void PySlice_Fini(void)
 {
@@ -327,7 +330,7 @@ slice_dealloc(PySliceObject *r)
     Py_DECREF(r->step);
     Py_DECREF(r->start);
     Py_DECREF(r->stop);
-    if (slice_cache == NULL)
+    if (PySlice_MAXFREELIST > 0 && slice_cache == NULL)
         slice_cache = r;
     else
         PyObject_GC_Del(r);
@@ -31,6 +31,16 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
         ch = (unsigned char)*s;
 
         if (ch < 0x80) {
+#ifdef UTF8_SIMD
+            /* Runs of ASCII characters, see stringlib/utf8_simd.h */
+            if (end - s >= 16 && (unsigned char)s[1] < 0x80) {
+                Py_ssize_t n = utf8_ascii_run(s, end, p,
+                                              STRINGLIB_SIZEOF_CHAR);
+                s += n;
+                p += n;
+                continue;
+            }
+#endif
             /* Fast path for runs of ASCII characters. Given that common UTF-8
                input will consist of an overwhelming majority of ASCII
                characters, we try to optimize for this case by checking
@@ -102,6 +112,19 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                 \xC0-\xC1 -- fake 0000-007F */
                 goto InvalidStart;
             }
+#ifdef UTF8_SIMD
+            if (STRINGLIB_MAX_CHAR > 0x007F && end - s >= 16 &&
+                ((unsigned char)s[2] & 0xE0) == 0xC0) {
+                /* Run of 2-byte sequences */
+                Py_ssize_t n = utf8_decode_2byte_run(s, end, p,
+                                                     STRINGLIB_SIZEOF_CHAR);
+                if (n) {
+                    s += 2 * n;
+                    p += n;
+                    continue;
+                }
+            }
+#endif
             if (end - s < 2) {
                 /* unexpected end of data: the caller will decide whether
                    it's an error or not */
@@ -126,6 +149,19 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
         if (ch < 0xF0) {
             /* \xE0\xA0\x80-\xEF\xBF\xBF -- 0800-FFFF */
             Py_UCS4 ch2, ch3;
+#ifdef UTF8_SIMD_DISPATCH
+            if (STRINGLIB_MAX_CHAR >= 0xFFFF && utf8_simd_ssse3 &&
+                end - s >= 16 && ((unsigned char)s[3] & 0xF0) == 0xE0) {
+                /* Run of 3-byte sequences */
+                Py_ssize_t n = utf8_decode_3byte_run_ssse3(
+                    s, end, p, STRINGLIB_SIZEOF_CHAR);
+                if (n) {
+                    s += 3 * n;
+                    p += n;
+                    continue;
+                }
+            }
+#endif
             if (end - s < 3) {
                 /* unexpected end of data: the caller will decide whether
                    it's an error or not */
@@ -297,7 +333,15 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
         if (ch < 0x80) {
             /* Encode ASCII */
             *p++ = (char) ch;
-
+#ifdef UTF8_SIMD
+            if (size - i >= 16 && data[i] < 0x80) {
+                /* Run of ASCII characters, see stringlib/utf8_simd.h */
+                Py_ssize_t n = utf8_encode_ascii_run(data + i, size - i, p,
+                                                     STRINGLIB_SIZEOF_CHAR);
+                i += n;
+                p += n;
+            }
+#endif
         }
         else
 #if STRINGLIB_SIZEOF_CHAR > 1
@@ -307,6 +351,19 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
             /* Encode Latin-1 */
             *p++ = (char)(0xc0 | (ch >> 6));
             *p++ = (char)(0x80 | (ch & 0x3f));
+#ifdef UTF8_SIMD
+            if (size - i >= 8 && data[i] >= 0x80 && data[i + 7] >= 0x80
+#if STRINGLIB_SIZEOF_CHAR > 1
+                && data[i] < 0x0800 && data[i + 7] < 0x0800
+#endif
+                ) {
+                /* Run of 2-byte sequences, long enough to fill a vector */
+                Py_ssize_t n = utf8_encode_2byte_run(data + i, size - i, p,
+                                                     STRINGLIB_SIZEOF_CHAR);
+                i += n;
+                p += 2 * n;
+            }
+#endif
         }
 #if STRINGLIB_SIZEOF_CHAR > 1
         else if (Py_UNICODE_IS_SURROGATE(ch)) {
@@ -430,6 +487,15 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
             *p++ = (char)(0xe0 | (ch >> 12));
             *p++ = (char)(0x80 | ((ch >> 6) & 0x3f));
             *p++ = (char)(0x80 | (ch & 0x3f));
+#ifdef UTF8_SIMD_DISPATCH
+            if (utf8_simd_ssse3 && size - i >= 6 && data[i] >= 0x0800) {
+                /* Run of 3-byte sequences */
+                Py_ssize_t n = utf8_encode_3byte_run_ssse3(
+                    data + i, size - i, p, STRINGLIB_SIZEOF_CHAR);
+                i += n;
+                p += 3 * n;
+            }
+#endif
         }
 #if STRINGLIB_SIZEOF_CHAR > 2
         else /* ch >= 0x10000 */
@@ -0,0 +1,427 @@
+/* stringlib: SIMD kernels of the UTF-8 codec */
+
+#ifndef STRINGLIB_UTF8_SIMD_H
+#define STRINGLIB_UTF8_SIMD_H
+
+/* The UTF-8 decoder and encoder of stringlib/codecs.h hand the runs of
+   ASCII characters, of 2-byte sequences (Latin-1 supplement, Greek,
+   Cyrillic, Hebrew, Arabic...) and of 3-byte sequences (the rest of the
+   BMP, including CJK) to the kernels below, which handle 16 or 32 bytes at
+   a time.  The decoding kernels check the bytes as strictly as the scalar
+   decoder does: they stop before the first sequence they can't decode and
+   leave it, valid or not, to the scalar code.
+
+   SSE2 is part of x86-64.  With GCC and clang, the SSSE3 and AVX2 kernels
+   are compiled with a target attribute and only used if utf8_simd_init()
+   found the instructions on the CPU.
+
+   The kernels store whole vectors, and so may write past the characters
+   they return.  When decoding, the output buffer must have room for one
+   character per byte left in the input: the decoders allocate that much
+   anyway.  When encoding, it must have room for max_char_size bytes per
+   character left, which the encoder allocates. */
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  define UTF8_SIMD
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  else
+#    include <emmintrin.h>
+#  endif
+#  if defined(__clang__) || (defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+     /* Kernels for newer CPUs, selected at runtime */
+#    define UTF8_SIMD_DISPATCH
+#    include <immintrin.h>
+#  endif
+#endif
+
+#ifdef UTF8_SIMD
+
+#ifdef UTF8_SIMD_DISPATCH
+static int utf8_simd_ssse3 = 0;
+static int utf8_simd_avx2 = 0;
+#endif
+
+/* Check which kernels the CPU can run; called once at startup.  Until then,
+   only the SSE2 kernels are used. */
+static void
+utf8_simd_init(void)
+{
+#ifdef UTF8_SIMD_DISPATCH
+    __builtin_cpu_init();
+    utf8_simd_ssse3 = __builtin_cpu_supports("ssse3");
+    utf8_simd_avx2 = __builtin_cpu_supports("avx2");
+#endif
+}
+
+/* Index of the lowest set bit of x, which must not be 0 */
+Py_LOCAL_INLINE(int)
+utf8_simd_ctz(unsigned int x)
+{
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return (int)i;
+#else
+    return __builtin_ctz(x);
+#endif
+}
+
+/* Store the 16 bytes of v as 16 characters of the given kind */
+Py_LOCAL_INLINE(void)
+utf8_simd_store_widened(void *dest, __m128i v, int kind)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i *q = (__m128i *)dest;
+
+    if (kind == 1) {
+        _mm_storeu_si128(q, v);
+    }
+    else if (kind == 2) {
+        _mm_storeu_si128(q, _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(q + 1, _mm_unpackhi_epi8(v, zero));
+    }
+    else {
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128(q, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(q + 1, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(q + 2, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(q + 3, _mm_unpackhi_epi16(hi, zero));
+    }
+}
+
+#ifdef UTF8_SIMD_DISPATCH
+__attribute__((target("avx2")))
+static Py_ssize_t
+utf8_ascii_run_avx2(const char *start, const char *end, char *dest, int kind)
+{
+    const char *s = start;
+
+    while (end - s >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)s);
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(v);
+        __m256i *q = (__m256i *)dest;
+
+        if (kind == 1) {
+            _mm256_storeu_si256(q, v);
+        }
+        else {
+            __m128i lo = _mm256_castsi256_si128(v);
+            __m128i hi = _mm256_extracti128_si256(v, 1);
+            if (kind == 2) {
+                _mm256_storeu_si256(q, _mm256_cvtepu8_epi16(lo));
+                _mm256_storeu_si256(q + 1, _mm256_cvtepu8_epi16(hi));
+            }
+            else {
+                _mm256_storeu_si256(q, _mm256_cvtepu8_epi32(lo));
+                _mm256_storeu_si256(q + 1,
+                    _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+                _mm256_storeu_si256(q + 2, _mm256_cvtepu8_epi32(hi));
+                _mm256_storeu_si256(q + 3,
+                    _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+            }
+        }
+        if (mask)
+            return (s - start) + utf8_simd_ctz(mask);
+        s += 32;
+        dest += 32 * kind;
+    }
+    return s - start;
+}
+#endif
+
+/* Copy the ASCII characters at the start of [start, end) to dest, as
+   characters of the given kind, and return their number.  The last 15 bytes
+   at most are left to the caller. */
+Py_LOCAL_INLINE(Py_ssize_t)
+utf8_ascii_run(const char *start, const char *end, void *dest, int kind)
+{
+    const char *s = start;
+    char *q = (char *)dest;
+
+    while (end - s >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)s);
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(v);
+
+        utf8_simd_store_widened(q, v, kind);
+        if (mask)
+            return (s - start) + utf8_simd_ctz(mask);
+        s += 16;
+        q += 16 * kind;
+#ifdef UTF8_SIMD_DISPATCH
+        /* A long run: go on 32 bytes at a time */
+        if (utf8_simd_avx2 && end - s >= 32) {
+            Py_ssize_t n = utf8_ascii_run_avx2(s, end, q, kind);
+            s += n;
+            q += n * kind;
+        }
+#endif
+    }
+    return s - start;
+}
+
+/* Decode the run of 2-byte sequences at the start of [start, end) to dest,
+   and return their number.  For the 1-byte kind, only U+0080-U+00FF are
+   decoded. */
+Py_LOCAL_INLINE(Py_ssize_t)
+utf8_decode_2byte_run(const char *start, const char *end, void *dest,
+                      int kind)
+{
+    /* Lead bytes \xC2-\xDF (\xC2-\xC3 for the 1-byte kind) at even
+       offsets, continuation bytes \x80-\xBF at odd offsets: a byte is valid
+       if byte - low <= range, unsigned. */
+    const __m128i low = _mm_set1_epi16((short)0x80C2);
+    const __m128i range = _mm_set1_epi16(kind == 1 ? 0x3F01 : 0x3F1D);
+    const char *s = start;
+    char *q = (char *)dest;
+
+    while (end - s >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)s);
+        __m128i t = _mm_sub_epi8(v, low);
+        __m128i ok = _mm_cmpeq_epi8(_mm_max_epu8(t, range), range);
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(ok);
+        /* number of leading sequences with two valid bytes */
+        int n = (mask == 0xFFFF) ? 8 : utf8_simd_ctz(~mask) / 2;
+        __m128i ch = _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1F)), 6),
+            _mm_and_si128(_mm_srli_epi16(v, 8), _mm_set1_epi16(0x3F)));
+
+        if (kind == 1) {
+            _mm_storel_epi64((__m128i *)q, _mm_packus_epi16(ch, ch));
+        }
+        else if (kind == 2) {
+            _mm_storeu_si128((__m128i *)q, ch);
+        }
+        else {
+            const __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128((__m128i *)q, _mm_unpacklo_epi16(ch, zero));
+            _mm_storeu_si128((__m128i *)q + 1, _mm_unpackhi_epi16(ch, zero));
+        }
+        s += 2 * n;
+        q += n * kind;
+        if (n < 8)
+            break;
+    }
+    return (s - start) / 2;
+}
+
+#ifdef UTF8_SIMD_DISPATCH
+/* Decode the run of 3-byte sequences at the start of [start, end) to dest,
+   of the 2-byte or the 4-byte kind, and return their number. */
+__attribute__((target("ssse3")))
+static Py_ssize_t
+utf8_decode_3byte_run_ssse3(const char *start, const char *end, void *dest,
+                            int kind)
+{
+    /* Put the 3 bytes of 4 sequences in 32-bit lanes, the lead byte
+       in bits 16-23 */
+    const __m128i spread = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1,
+                                         8, 7, 6, -1, 11, 10, 9, -1);
+    const __m128i narrow = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13,
+                                         -1, -1, -1, -1, -1, -1, -1, -1);
+    const char *s = start;
+    char *q = (char *)dest;
+
+    while (end - s >= 16) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)s),
+                                     spread);
+        __m128i ch = _mm_or_si128(
+            _mm_or_si128(
+                _mm_and_si128(_mm_srli_epi32(v, 4), _mm_set1_epi32(0xF000)),
+                _mm_and_si128(_mm_srli_epi32(v, 2), _mm_set1_epi32(0x0FC0))),
+            _mm_and_si128(v, _mm_set1_epi32(0x3F)));
+        /* 1110xxxx 10xxxxxx 10xxxxxx, neither overlong nor a surrogate */
+        __m128i ok = _mm_cmpeq_epi32(
+            _mm_and_si128(v, _mm_set1_epi32(0xF0C0C0)),
+            _mm_set1_epi32(0xE08080));
+        unsigned int mask;
+        int n;
+
+        ok = _mm_and_si128(ok, _mm_cmpgt_epi32(ch, _mm_set1_epi32(0x7FF)));
+        ok = _mm_andnot_si128(
+            _mm_cmpeq_epi32(_mm_and_si128(ch, _mm_set1_epi32(0xF800)),
+                            _mm_set1_epi32(0xD800)),
+            ok);
+        mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(ok));
+        n = (mask == 0xF) ? 4 : utf8_simd_ctz(~mask);
+
+        if (kind == 2)
+            _mm_storel_epi64((__m128i *)q, _mm_shuffle_epi8(ch, narrow));
+        else
+            _mm_storeu_si128((__m128i *)q, ch);
+        s += 3 * n;
+        q += n * kind;
+        if (n < 4)
+            break;
+    }
+    return (s - start) / 3;
+}
+#endif
+
+/* Encode the run of ASCII characters at the start of data[0:size], of the
+   given kind, to dest and return their number. */
+Py_LOCAL_INLINE(Py_ssize_t)
+utf8_encode_ascii_run(const void *data, Py_ssize_t size, char *dest,
+                      int kind)
+{
+    const __m128i zero = _mm_setzero_si128();
+    Py_ssize_t i = 0;
+
+    if (kind == 1)
+        return utf8_ascii_run((const char *)data, (const char *)data + size,
+                              dest, 1);
+
+    while (size - i >= 16) {
+        __m128i bytes, ascii;
+        unsigned int mask;
+        int n;
+
+        if (kind == 2) {
+            const __m128i *in = (const __m128i *)((const Py_UCS2 *)data + i);
+            const __m128i high = _mm_set1_epi16((short)0xFF80);
+            __m128i a = _mm_loadu_si128(in);
+            __m128i b = _mm_loadu_si128(in + 1);
+            ascii = _mm_packs_epi16(
+                _mm_cmpeq_epi16(_mm_and_si128(a, high), zero),
+                _mm_cmpeq_epi16(_mm_and_si128(b, high), zero));
+            bytes = _mm_packus_epi16(a, b);
+        }
+        else {
+            const __m128i *in = (const __m128i *)((const Py_UCS4 *)data + i);
+            const __m128i high = _mm_set1_epi32((int)0xFFFFFF80);
+            __m128i a = _mm_loadu_si128(in);
+            __m128i b = _mm_loadu_si128(in + 1);
+            __m128i c = _mm_loadu_si128(in + 2);
+            __m128i d = _mm_loadu_si128(in + 3);
+            ascii = _mm_packs_epi16(
+                _mm_packs_epi32(
+                    _mm_cmpeq_epi32(_mm_and_si128(a, high), zero),
+                    _mm_cmpeq_epi32(_mm_and_si128(b, high), zero)),
+                _mm_packs_epi32(
+                    _mm_cmpeq_epi32(_mm_and_si128(c, high), zero),
+                    _mm_cmpeq_epi32(_mm_and_si128(d, high), zero)));
+            bytes = _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                     _mm_packs_epi32(c, d));
+        }
+        mask = (unsigned int)_mm_movemask_epi8(ascii);
+        n = (mask == 0xFFFF) ? 16 : utf8_simd_ctz(~mask);
+
+        _mm_storeu_si128((__m128i *)(dest + i), bytes);
+        i += n;
+        if (n < 16)
+            break;
+    }
+    return i;
+}
+
+/* Encode the run of U+0080-U+07FF characters at the start of data[0:size],
+   of the given kind, to dest and return their number. */
+Py_LOCAL_INLINE(Py_ssize_t)
+utf8_encode_2byte_run(const void *data, Py_ssize_t size, char *dest,
+                      int kind)
+{
+    const __m128i zero = _mm_setzero_si128();
+    Py_ssize_t i = 0;
+
+    while (size - i >= 8) {
+        __m128i ch, ok, out;
+        unsigned int mask;
+        int n;
+
+        if (kind == 1) {
+            ch = _mm_unpacklo_epi8(
+                _mm_loadl_epi64((const __m128i *)((const Py_UCS1 *)data + i)),
+                zero);
+        }
+        else if (kind == 2) {
+            ch = _mm_loadu_si128((const __m128i *)((const Py_UCS2 *)data + i));
+        }
+        else {
+            /* characters above U+7FFF saturate to U+7FFF */
+            const __m128i *in = (const __m128i *)((const Py_UCS4 *)data + i);
+            ch = _mm_packs_epi32(_mm_loadu_si128(in),
+                                 _mm_loadu_si128(in + 1));
+        }
+        ok = _mm_andnot_si128(
+            _mm_cmpeq_epi16(_mm_and_si128(ch, _mm_set1_epi16((short)0xFF80)),
+                            zero),
+            _mm_cmpeq_epi16(_mm_and_si128(ch, _mm_set1_epi16((short)0xF800)),
+                            zero));
+        mask = (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(ok, zero));
+        n = (mask == 0xFF) ? 8 : utf8_simd_ctz(~mask);
+
+        /* 110xxxxx 10xxxxxx */
+        out = _mm_or_si128(
+            _mm_or_si128(_mm_srli_epi16(ch, 6),
+                         _mm_slli_epi16(_mm_and_si128(ch, _mm_set1_epi16(0x3F)),
+                                        8)),
+            _mm_set1_epi16((short)0x80C0));
+        _mm_storeu_si128((__m128i *)(dest + 2 * i), out);
+        i += n;
+        if (n < 8)
+            break;
+    }
+    return i;
+}
+
+#ifdef UTF8_SIMD_DISPATCH
+/* Encode the run of U+0800-U+FFFF characters, except surrogates, at the
+   start of data[0:size], of the 2-byte or the 4-byte kind, to dest and
+   return their number. */
+__attribute__((target("ssse3")))
+static Py_ssize_t
+utf8_encode_3byte_run_ssse3(const void *data, Py_ssize_t size, char *dest,
+                            int kind)
+{
+    /* Pack the 3 low bytes of 4 lanes */
+    const __m128i narrow = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10,
+                                         12, 13, 14, -1, -1, -1, -1);
+    Py_ssize_t i = 0;
+
+    /* 16 bytes are stored for 4 characters: 6 characters left leave room
+       for them */
+    while (size - i >= 6) {
+        __m128i ch, ok, out;
+        unsigned int mask;
+        int n;
+
+        if (kind == 2) {
+            ch = _mm_unpacklo_epi16(
+                _mm_loadl_epi64((const __m128i *)((const Py_UCS2 *)data + i)),
+                _mm_setzero_si128());
+        }
+        else {
+            ch = _mm_loadu_si128((const __m128i *)((const Py_UCS4 *)data + i));
+        }
+        ok = _mm_and_si128(_mm_cmpgt_epi32(ch, _mm_set1_epi32(0x7FF)),
+                           _mm_cmpgt_epi32(_mm_set1_epi32(0x10000), ch));
+        ok = _mm_andnot_si128(
+            _mm_cmpeq_epi32(_mm_and_si128(ch, _mm_set1_epi32(0xF800)),
+                            _mm_set1_epi32(0xD800)),
+            ok);
+        mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(ok));
+        n = (mask == 0xF) ? 4 : utf8_simd_ctz(~mask);
+
+        /* 1110xxxx 10xxxxxx 10xxxxxx */
+        out = _mm_or_si128(
+            _mm_or_si128(
+                _mm_srli_epi32(ch, 12),
+                _mm_and_si128(_mm_slli_epi32(ch, 2),
+                              _mm_set1_epi32(0x3F00))),
+            _mm_and_si128(_mm_slli_epi32(ch, 16), _mm_set1_epi32(0x3F0000)));
+        out = _mm_or_si128(out, _mm_set1_epi32(0x8080E0));
+        _mm_storeu_si128((__m128i *)(dest + 3 * i),
+                         _mm_shuffle_epi8(out, narrow));
+        i += n;
+        if (n < 4)
+            break;
+    }
+    return i;
+}
+#endif
+
+#endif /* UTF8_SIMD */
+
+#endif /* !STRINGLIB_UTF8_SIMD_H */
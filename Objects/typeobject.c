@@ -30,10 +30,16 @@ class object "PyObject *" "&PyBaseObject_Type"
 #define MCACHE_HASH_METHOD(type, name)                                  \
         MCACHE_HASH((type)->tp_version_tag,                     \
                     ((PyASCIIObject *)(name))->hash)
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+/* The cache is shared by all interpreters, including those with their
+   own GIL, so don't use it. */
+#define MCACHE_CACHEABLE_NAME(name) 0
+#else
 #define MCACHE_CACHEABLE_NAME(name)                             \
         PyUnicode_CheckExact(name) &&                           \
         PyUnicode_IS_READY(name) &&                             \
         PyUnicode_GET_LENGTH(name) <= MCACHE_MAX_ATTR_SIZE
+#endif
 
 struct method_cache_entry {
     unsigned int version;
@@ -74,6 +80,9 @@ _Py_IDENTIFIER(builtins);
 static PyObject *
 slot_tp_new(PyTypeObject *type, PyObject *args, PyObject *kwds);
 
+static int
+slot_tp_init(PyObject *self, PyObject *args, PyObject *kwds);
+
 static void
 clear_slotdefs(void);
 
@@ -959,6 +968,102 @@ type_call(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return obj;
 }
 
+static PyObject *object_new(PyTypeObject *, PyObject *, PyObject *);
+static int object_init(PyObject *, PyObject *, PyObject *);
+
+/* Call type_call() with a temporary tuple and dictionary */
+static PyObject *
+type_vectorcall_slow(PyTypeObject *type, PyObject *const *args,
+                     Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *argstuple, *kwdict = NULL, *result;
+
+    argstuple = _PyStack_AsTuple(args, nargs);
+    if (argstuple == NULL) {
+        return NULL;
+    }
+    if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) > 0) {
+        kwdict = _PyStack_AsDict(args + nargs, kwnames);
+        if (kwdict == NULL) {
+            Py_DECREF(argstuple);
+            return NULL;
+        }
+    }
+
+    if (Py_EnterRecursiveCall(" while calling a Python object")) {
+        result = NULL;
+    }
+    else {
+        result = type_call(type, argstuple, kwdict);
+        Py_LeaveRecursiveCall();
+    }
+    Py_DECREF(argstuple);
+    Py_XDECREF(kwdict);
+    return result;
+}
+
+/* Vectorcall entry point of heap types: instantiate a class without
+   packing the arguments into a tuple when __new__ is object.__new__()
+   and __init__ is either object.__init__() or a Python function.
+   Otherwise, fall back to type_call(). */
+static PyObject *
+type_vectorcall(PyObject *callable, PyObject *const *args,
+                size_t nargsf, PyObject *kwnames)
+{
+    _Py_IDENTIFIER(__init__);
+    PyTypeObject *type = (PyTypeObject *)callable;
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    PyObject *init, *obj, *res;
+
+    if (type->tp_new != object_new ||
+        (type->tp_flags & Py_TPFLAGS_IS_ABSTRACT))
+    {
+        return type_vectorcall_slow(type, args, nargs, kwnames);
+    }
+
+    if (type->tp_init == object_init) {
+        if (nargs != 0 || (kwnames != NULL && PyTuple_GET_SIZE(kwnames))) {
+            /* let object_new() raise the TypeError */
+            return type_vectorcall_slow(type, args, nargs, kwnames);
+        }
+        return type->tp_alloc(type, 0);
+    }
+
+    if (type->tp_init != slot_tp_init) {
+        return type_vectorcall_slow(type, args, nargs, kwnames);
+    }
+    /* object_new() ignores the arguments since __init__() is overridden */
+    init = _PyType_LookupId(type, &PyId___init__);
+    if (init == NULL || !PyFunction_Check(init)) {
+        return type_vectorcall_slow(type, args, nargs, kwnames);
+    }
+
+    obj = type->tp_alloc(type, 0);
+    if (obj == NULL) {
+        return NULL;
+    }
+
+    /* __init__() can modify the type and so drop the last reference to
+       the function */
+    Py_INCREF(init);
+    res = _PyObject_Vectorcall_Prepend(init, obj, args, nargsf, kwnames);
+    Py_DECREF(init);
+    if (res == NULL) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    if (res != Py_None) {
+        PyErr_Format(PyExc_TypeError,
+                     "__init__() should return None, not '%.200s'",
+                     Py_TYPE(res)->tp_name);
+        Py_DECREF(res);
+        Py_DECREF(obj);
+        return NULL;
+    }
+    Py_DECREF(res);
+    return obj;
+}
+
 PyObject *
 PyType_GenericAlloc(PyTypeObject *type, Py_ssize_t nitems)
 {
@@ -1165,10 +1270,10 @@ subtype_dealloc(PyObject *self)
     /* UnTrack and re-Track around the trashcan macro, alas */
     /* See explanation at end of function for full disclosure */
     PyObject_GC_UnTrack(self);
-    ++_PyRuntime.gc.trash_delete_nesting;
+    ++_PyGC_STATE()->trash_delete_nesting;
     ++ tstate->trash_delete_nesting;
     Py_TRASHCAN_SAFE_BEGIN(self);
-    --_PyRuntime.gc.trash_delete_nesting;
+    --_PyGC_STATE()->trash_delete_nesting;
     -- tstate->trash_delete_nesting;
 
     /* Find the nearest base with a different tp_dealloc */
@@ -1262,10 +1367,10 @@ subtype_dealloc(PyObject *self)
       Py_DECREF(type);
 
   endlabel:
-    ++_PyRuntime.gc.trash_delete_nesting;
+    ++_PyGC_STATE()->trash_delete_nesting;
     ++ tstate->trash_delete_nesting;
     Py_TRASHCAN_SAFE_END(self);
-    --_PyRuntime.gc.trash_delete_nesting;
+    --_PyGC_STATE()->trash_delete_nesting;
     -- tstate->trash_delete_nesting;
 
     /* Explanation of the weirdness around the trashcan macros:
@@ -2778,6 +2883,7 @@ type_new(PyTypeObject *metatype, PyObject *args, PyObject *kwds)
 
     /* Always override allocation strategy to use regular heap */
     type->tp_alloc = PyType_GenericAlloc;
+    type->tp_vectorcall = type_vectorcall;
     if (type->tp_flags & Py_TPFLAGS_HAVE_GC) {
         type->tp_free = PyObject_GC_Del;
         type->tp_traverse = subtype_traverse;
@@ -3256,9 +3362,6 @@ type_setattro(PyTypeObject *type, PyObject *name, PyObject *value)
     return res;
 }
 
-extern void
-_PyDictKeys_DecRef(PyDictKeysObject *keys);
-
 static void
 type_dealloc(PyTypeObject *type)
 {
@@ -3286,8 +3389,7 @@ type_dealloc(PyTypeObject *type)
     Py_XDECREF(et->ht_name);
     Py_XDECREF(et->ht_qualname);
     Py_XDECREF(et->ht_slots);
-    if (et->ht_cached_keys)
-        _PyDictKeys_DecRef(et->ht_cached_keys);
+    _PyDict_ClearKeysForClass(type);
     Py_TYPE(type)->tp_free((PyObject *)type);
 }
 
@@ -3428,10 +3530,7 @@ type___sizeof___impl(PyTypeObject *self)
 {
     Py_ssize_t size;
     if (self->tp_flags & Py_TPFLAGS_HEAPTYPE) {
-        PyHeapTypeObject* et = (PyHeapTypeObject*)self;
-        size = sizeof(PyHeapTypeObject);
-        if (et->ht_cached_keys)
-            size += _PyDict_KeysSize(et->ht_cached_keys);
+        size = sizeof(PyHeapTypeObject) + _PyDict_KeysForClassSize(self);
     }
     else
         size = sizeof(PyTypeObject);
@@ -3487,7 +3586,6 @@ type_traverse(PyTypeObject *type, visitproc visit, void *arg)
 static int
 type_clear(PyTypeObject *type)
 {
-    PyDictKeysObject *cached_keys;
     /* Because of type_is_gc(), the collector only calls this
        for heaptypes. */
     assert(type->tp_flags & Py_TPFLAGS_HEAPTYPE);
@@ -3519,11 +3617,7 @@ type_clear(PyTypeObject *type)
     */
 
     PyType_Modified(type);
-    cached_keys = ((PyHeapTypeObject *)type)->ht_cached_keys;
-    if (cached_keys != NULL) {
-        ((PyHeapTypeObject *)type)->ht_cached_keys = NULL;
-        _PyDictKeys_DecRef(cached_keys);
-    }
+    _PyDict_ClearKeysForClass(type);
     if (type->tp_dict)
         PyDict_Clear(type->tp_dict);
     Py_CLEAR(type->tp_mro);
@@ -3543,7 +3637,7 @@ PyTypeObject PyType_Type = {
     sizeof(PyHeapTypeObject),                   /* tp_basicsize */
     sizeof(PyMemberDef),                        /* tp_itemsize */
     (destructor)type_dealloc,                   /* tp_dealloc */
-    0,                                          /* tp_print */
+    offsetof(PyTypeObject, tp_vectorcall),      /* tp_vectorcall_offset */
     0,                                          /* tp_getattr */
     0,                                          /* tp_setattr */
     0,                                          /* tp_reserved */
@@ -3558,7 +3652,8 @@ PyTypeObject PyType_Type = {
     (setattrofunc)type_setattro,                /* tp_setattro */
     0,                                          /* tp_as_buffer */
     Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
-        Py_TPFLAGS_BASETYPE | Py_TPFLAGS_TYPE_SUBCLASS,         /* tp_flags */
+        Py_TPFLAGS_BASETYPE | Py_TPFLAGS_TYPE_SUBCLASS |
+        _Py_TPFLAGS_HAVE_VECTORCALL,                            /* tp_flags */
     type_doc,                                   /* tp_doc */
     (traverseproc)type_traverse,                /* tp_traverse */
     (inquiry)type_clear,                        /* tp_clear */
@@ -4885,6 +4980,7 @@ inherit_special(PyTypeObject *type, PyTypeObject *base)
     COPYVAL(tp_itemsize);
     COPYVAL(tp_weaklistoffset);
     COPYVAL(tp_dictoffset);
+    COPYVAL(tp_vectorcall_offset);
 
     /* Setup fast subclass flags */
     if (PyType_IsSubtype(base, (PyTypeObject*)PyExc_BaseException))
@@ -5042,7 +5138,18 @@ inherit_slots(PyTypeObject *type, PyTypeObject *base)
     /* tp_reserved is ignored */
     COPYSLOT(tp_repr);
     /* tp_hash see tp_richcompare */
-    COPYSLOT(tp_call);
+    {
+        /* Inherit the vectorcall protocol only together with tp_call.
+           Heap types never inherit it: __call__ can be overridden or
+           assigned later, which the vectorcall entry point would bypass. */
+        if (!type->tp_call &&
+            (base->tp_flags & _Py_TPFLAGS_HAVE_VECTORCALL) &&
+            !(type->tp_flags & Py_TPFLAGS_HEAPTYPE))
+        {
+            type->tp_flags |= _Py_TPFLAGS_HAVE_VECTORCALL;
+        }
+        COPYSLOT(tp_call);
+    }
     COPYSLOT(tp_str);
     {
         /* Copy comparison-related slots only when
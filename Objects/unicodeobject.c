@@ -196,6 +196,17 @@ extern "C" {
 */
 static PyObject *interned = NULL;
 
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+/* The interned dictionary is shared by all interpreters, including those
+   with their own GIL: guard it with a lock of its own. */
+static PyThread_type_lock interned_lock = NULL;
+#define INTERNED_LOCK() PyThread_acquire_lock(interned_lock, WAIT_LOCK)
+#define INTERNED_UNLOCK() PyThread_release_lock(interned_lock)
+#else
+#define INTERNED_LOCK()
+#define INTERNED_UNLOCK()
+#endif
+
 /* The empty Unicode object is shared to improve performance. */
 static PyObject *unicode_empty = NULL;
 
@@ -1783,9 +1794,11 @@ unicode_dealloc(PyObject *unicode)
     case SSTATE_INTERNED_MORTAL:
         /* revive dead object temporarily for DelItem */
         Py_REFCNT(unicode) = 3;
+        INTERNED_LOCK();
         if (PyDict_DelItem(interned, unicode) != 0)
             Py_FatalError(
                 "deletion of interned string failed");
+        INTERNED_UNLOCK();
         break;
 
     case SSTATE_INTERNED_IMMORTAL:
@@ -4694,6 +4707,8 @@ PyUnicode_DecodeUTF8(const char *s,
     return PyUnicode_DecodeUTF8Stateful(s, size, errors, NULL);
 }
 
+#include "stringlib/utf8_simd.h"
+
 #include "stringlib/asciilib.h"
 #include "stringlib/codecs.h"
 #include "stringlib/undef.h"
@@ -4724,6 +4739,16 @@ static Py_ssize_t
 ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
 {
     const char *p = start;
+#ifdef UTF8_SIMD
+    /* Copy 16 or 32 bytes at a time, see stringlib/utf8_simd.h */
+    Py_UCS1 *q = dest;
+
+    p += utf8_ascii_run(start, end, dest, PyUnicode_1BYTE_KIND);
+    q += p - start;
+    while (p < end && !((unsigned char)*p & 0x80))
+        *q++ = *p++;
+    return p - start;
+#else
     const char *aligned_end = (const char *) _Py_ALIGN_DOWN(end, SIZEOF_LONG);
 
     /*
@@ -4782,6 +4807,7 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
     }
     memcpy(dest, start, p - start);
     return p - start;
+#endif
 }
 
 PyObject *
@@ -15142,6 +15168,10 @@ int _PyUnicode_Init(void)
     if (PyType_Ready(&PyFormatterIter_Type) < 0)
         Py_FatalError("Can't initialize formatter iter type");
 
+#ifdef UTF8_SIMD
+    utf8_simd_init();
+#endif
+
     return 0;
 }
 
@@ -15184,9 +15214,19 @@ PyUnicode_InternInPlace(PyObject **p)
         return;
     if (PyUnicode_CHECK_INTERNED(s))
         return;
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+    if (interned_lock == NULL) {
+        /* The first strings are interned at startup, by a single thread */
+        interned_lock = PyThread_allocate_lock();
+        if (interned_lock == NULL)
+            return;
+    }
+#endif
+    INTERNED_LOCK();
     if (interned == NULL) {
         interned = PyDict_New();
         if (interned == NULL) {
+            INTERNED_UNLOCK();
             PyErr_Clear(); /* Don't leave an exception */
             return;
         }
@@ -15195,11 +15235,13 @@ PyUnicode_InternInPlace(PyObject **p)
     t = PyDict_SetDefault(interned, s, s);
     Py_END_ALLOW_RECURSION
     if (t == NULL) {
+        INTERNED_UNLOCK();
         PyErr_Clear();
         return;
     }
     if (t != s) {
         Py_INCREF(t);
+        INTERNED_UNLOCK();
         Py_SETREF(*p, t);
         return;
     }
@@ -15207,6 +15249,7 @@ PyUnicode_InternInPlace(PyObject **p)
        The deallocator will take care of this */
     Py_REFCNT(s) -= 2;
     _PyUnicode_STATE(s).interned = SSTATE_INTERNED_MORTAL;
+    INTERNED_UNLOCK();
 }
 
 void
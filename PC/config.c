@@ -64,6 +64,7 @@ extern PyObject* PyInit__codecs_kr(void);
 extern PyObject* PyInit__codecs_tw(void);
 extern PyObject* PyInit__winapi(void);
 extern PyObject* PyInit__lsprof(void);
+extern PyObject* PyInit__sampleprof(void);
 extern PyObject* PyInit__ast(void);
 extern PyObject* PyInit__io(void);
 extern PyObject* PyInit__pickle(void);
@@ -116,6 +117,7 @@ struct _inittab _PyImport_Inittab[] = {
     {"_bisect", PyInit__bisect},
     {"_heapq", PyInit__heapq},
     {"_lsprof", PyInit__lsprof},
+    {"_sampleprof", PyInit__sampleprof},
     {"itertools", PyInit_itertools},
     {"_collections", PyInit__collections},
     {"_symtable", PyInit__symtable},
@@ -10,6 +10,8 @@
 #define PY_LOCAL_AGGRESSIVE
 
 #include "Python.h"
+#include "internal/code.h"
+#include "internal/long.h"
 #include "internal/pystate.h"
 
 #include "code.h"
@@ -70,6 +72,18 @@ static PyObject * special_lookup(PyObject *, _Py_Identifier *);
 static int check_args_iterable(PyObject *func, PyObject *vararg);
 static void format_kwargs_mapping_error(PyObject *func, PyObject *kwargs);
 static void format_awaitable_error(PyTypeObject *, int);
+static int opcache_use_try(_PyOpcache *, int);
+static int opcache_fill_attr(_PyOpcache *, PyObject *, PyObject *, int);
+static int opcache_fill_method(_PyOpcache *, PyObject *, PyObject *,
+                               PyObject *);
+
+/* Create the opcache of a code object once it has been executed this many
+   times, so that cold code does not pay for the cache memory. */
+#define OPCACHE_MIN_RUNS 1024
+
+/* Number of misses tolerated by an attribute cache before it is disabled,
+   so that polymorphic sites stop paying for refilling it. */
+#define OPCACHE_MAX_TRIES 20
 
 #define NAME_ERROR_MSG \
     "name '%.200s' is not defined"
@@ -79,63 +93,59 @@ static void format_awaitable_error(PyTypeObject *, int);
     "free variable '%.200s' referenced before assignment" \
     " in enclosing scope"
 
-/* Dynamic execution profile */
-#ifdef DYNAMIC_EXECUTION_PROFILE
-#ifdef DXPAIRS
-static long dxpairs[257][256];
-#define dxp dxpairs[256]
-#else
-static long dxp[256];
-#endif
-#endif
+#define GIL_REQUEST(g) _Py_atomic_load_relaxed(&(g)->gil_drop_request)
 
-#define GIL_REQUEST _Py_atomic_load_relaxed(&_PyRuntime.ceval.gil_drop_request)
+/* Pending calls are only run by the main thread, so they only break the
+   eval loop of threads holding the main GIL. */
+#define PENDING_CALLS(g) \
+    ((g) == &_PyRuntime.ceval.gil && \
+     _Py_atomic_load_relaxed(&_PyRuntime.ceval.pending.calls_to_do))
 
 /* This can set eval_breaker to 0 even though gil_drop_request became
    1.  We believe this is all right because the eval loop will release
    the GIL eventually anyway. */
-#define COMPUTE_EVAL_BREAKER() \
+#define COMPUTE_EVAL_BREAKER(g) \
     _Py_atomic_store_relaxed( \
-        &_PyRuntime.ceval.eval_breaker, \
-        GIL_REQUEST | \
-        _Py_atomic_load_relaxed(&_PyRuntime.ceval.pending.calls_to_do) | \
-        _PyRuntime.ceval.pending.async_exc)
+        &(g)->eval_breaker, \
+        GIL_REQUEST(g) | \
+        PENDING_CALLS(g) | \
+        (g)->async_exc)
 
-#define SET_GIL_DROP_REQUEST() \
+#define SET_GIL_DROP_REQUEST(g) \
     do { \
-        _Py_atomic_store_relaxed(&_PyRuntime.ceval.gil_drop_request, 1); \
-        _Py_atomic_store_relaxed(&_PyRuntime.ceval.eval_breaker, 1); \
+        _Py_atomic_store_relaxed(&(g)->gil_drop_request, 1); \
+        _Py_atomic_store_relaxed(&(g)->eval_breaker, 1); \
     } while (0)
 
-#define RESET_GIL_DROP_REQUEST() \
+#define RESET_GIL_DROP_REQUEST(g) \
     do { \
-        _Py_atomic_store_relaxed(&_PyRuntime.ceval.gil_drop_request, 0); \
-        COMPUTE_EVAL_BREAKER(); \
+        _Py_atomic_store_relaxed(&(g)->gil_drop_request, 0); \
+        COMPUTE_EVAL_BREAKER(g); \
     } while (0)
 
 /* Pending calls are only modified under pending_lock */
 #define SIGNAL_PENDING_CALLS() \
     do { \
         _Py_atomic_store_relaxed(&_PyRuntime.ceval.pending.calls_to_do, 1); \
-        _Py_atomic_store_relaxed(&_PyRuntime.ceval.eval_breaker, 1); \
+        _Py_atomic_store_relaxed(&_PyRuntime.ceval.gil.eval_breaker, 1); \
     } while (0)
 
 #define UNSIGNAL_PENDING_CALLS() \
     do { \
         _Py_atomic_store_relaxed(&_PyRuntime.ceval.pending.calls_to_do, 0); \
-        COMPUTE_EVAL_BREAKER(); \
+        COMPUTE_EVAL_BREAKER(&_PyRuntime.ceval.gil); \
     } while (0)
 
-#define SIGNAL_ASYNC_EXC() \
+#define SIGNAL_ASYNC_EXC(g) \
     do { \
-        _PyRuntime.ceval.pending.async_exc = 1; \
-        _Py_atomic_store_relaxed(&_PyRuntime.ceval.eval_breaker, 1); \
+        (g)->async_exc = 1; \
+        _Py_atomic_store_relaxed(&(g)->eval_breaker, 1); \
     } while (0)
 
-#define UNSIGNAL_ASYNC_EXC() \
+#define UNSIGNAL_ASYNC_EXC(g) \
     do { \
-        _PyRuntime.ceval.pending.async_exc = 0; \
-        COMPUTE_EVAL_BREAKER(); \
+        (g)->async_exc = 0; \
+        COMPUTE_EVAL_BREAKER(g); \
     } while (0)
 
 
@@ -148,16 +158,17 @@ static long dxp[256];
 int
 PyEval_ThreadsInitialized(void)
 {
-    return gil_created();
+    return gil_created(&_PyRuntime.ceval.gil);
 }
 
 void
 PyEval_InitThreads(void)
 {
-    if (gil_created())
+    struct _gil_runtime_state *gil = &_PyRuntime.ceval.gil;
+    if (gil_created(gil))
         return;
-    create_gil();
-    take_gil(PyThreadState_GET());
+    create_gil(gil);
+    take_gil(gil, PyThreadState_GET(), 0);
     _PyRuntime.ceval.pending.main_thread = PyThread_get_thread_ident();
     if (!_PyRuntime.ceval.pending.lock)
         _PyRuntime.ceval.pending.lock = PyThread_allocate_lock();
@@ -166,10 +177,11 @@ PyEval_InitThreads(void)
 void
 _PyEval_FiniThreads(void)
 {
-    if (!gil_created())
+    struct _gil_runtime_state *gil = &_PyRuntime.ceval.gil;
+    if (!gil_created(gil))
         return;
-    destroy_gil();
-    assert(!gil_created());
+    destroy_gil(gil);
+    assert(!gil_created(gil));
 }
 
 void
@@ -178,18 +190,25 @@ PyEval_AcquireLock(void)
     PyThreadState *tstate = PyThreadState_GET();
     if (tstate == NULL)
         Py_FatalError("PyEval_AcquireLock: current thread state is NULL");
-    take_gil(tstate);
+    take_gil(tstate->interp->gil, tstate, 0);
 }
 
 void
 PyEval_ReleaseLock(void)
 {
     /* This function must succeed when the current thread state is NULL.
-       We therefore avoid PyThreadState_GET() which dumps a fatal error
+       We therefore avoid PyThreadState_Get() which dumps a fatal error
        in debug mode.
     */
-    drop_gil((PyThreadState*)_Py_atomic_load_relaxed(
-        &_PyThreadState_Current));
+    PyThreadState *tstate = _PyThreadState_UncheckedGet();
+    drop_gil(tstate != NULL ? tstate->interp->gil : &_PyRuntime.ceval.gil,
+             tstate, 0);
+}
+
+void
+_PyEval_ReleaseInterpreterLock(PyInterpreterState *interp)
+{
+    drop_gil(interp->gil, NULL, 0);
 }
 
 void
@@ -198,8 +217,8 @@ PyEval_AcquireThread(PyThreadState *tstate)
     if (tstate == NULL)
         Py_FatalError("PyEval_AcquireThread: NULL new thread state");
     /* Check someone has called PyEval_InitThreads() to create the lock */
-    assert(gil_created());
-    take_gil(tstate);
+    assert(gil_created(tstate->interp->gil));
+    take_gil(tstate->interp->gil, tstate, 0);
     if (PyThreadState_Swap(tstate) != NULL)
         Py_FatalError(
             "PyEval_AcquireThread: non-NULL old thread state");
@@ -212,7 +231,7 @@ PyEval_ReleaseThread(PyThreadState *tstate)
         Py_FatalError("PyEval_ReleaseThread: NULL thread state");
     if (PyThreadState_Swap(NULL) != tstate)
         Py_FatalError("PyEval_ReleaseThread: wrong thread state");
-    drop_gil(tstate);
+    drop_gil(tstate->interp->gil, tstate, 0);
 }
 
 /* This function is called from PyOS_AfterFork_Child to destroy all threads
@@ -224,12 +243,17 @@ void
 PyEval_ReInitThreads(void)
 {
     PyThreadState *current_tstate = PyThreadState_GET();
+    struct _gil_runtime_state *gil = current_tstate->interp->gil;
 
-    if (!gil_created())
+    if (!gil_created(&_PyRuntime.ceval.gil))
         return;
-    recreate_gil();
+    recreate_gil(&_PyRuntime.ceval.gil);
+    if (gil != &_PyRuntime.ceval.gil) {
+        /* The child was forked from a subinterpreter with its own GIL */
+        recreate_gil(gil);
+    }
     _PyRuntime.ceval.pending.lock = PyThread_allocate_lock();
-    take_gil(current_tstate);
+    take_gil(gil, current_tstate, 0);
     _PyRuntime.ceval.pending.main_thread = PyThread_get_thread_ident();
 
     /* Destroy all threads except the current one */
@@ -242,7 +266,7 @@ PyEval_ReInitThreads(void)
 void
 _PyEval_SignalAsyncExc(void)
 {
-    SIGNAL_ASYNC_EXC();
+    SIGNAL_ASYNC_EXC(PyThreadState_GET()->interp->gil);
 }
 
 /* Functions save_thread and restore_thread are always defined so
@@ -255,8 +279,8 @@ PyEval_SaveThread(void)
     PyThreadState *tstate = PyThreadState_Swap(NULL);
     if (tstate == NULL)
         Py_FatalError("PyEval_SaveThread: NULL tstate");
-    assert(gil_created());
-    drop_gil(tstate);
+    assert(gil_created(tstate->interp->gil));
+    drop_gil(tstate->interp->gil, tstate, 0);
     return tstate;
 }
 
@@ -265,13 +289,14 @@ PyEval_RestoreThread(PyThreadState *tstate)
 {
     if (tstate == NULL)
         Py_FatalError("PyEval_RestoreThread: NULL tstate");
-    assert(gil_created());
+    struct _gil_runtime_state *gil = tstate->interp->gil;
+    assert(gil_created(gil));
 
     int err = errno;
-    take_gil(tstate);
+    take_gil(gil, tstate, 1);
     /* _Py_Finalizing is protected by the GIL */
     if (_Py_IsFinalizing() && !_Py_CURRENTLY_FINALIZING(tstate)) {
-        drop_gil(tstate);
+        drop_gil(gil, tstate, 0);
         PyThread_exit_thread();
         Py_UNREACHABLE();
     }
@@ -281,6 +306,93 @@ PyEval_RestoreThread(PyThreadState *tstate)
 }
 
 
+/* Subinterpreters with their own GIL.
+
+   By default every interpreter uses the GIL of the main interpreter,
+   _PyRuntime.ceval.gil.  _PyEval_InitInterpreterGIL() gives an
+   interpreter a GIL of its own, so that its threads run in parallel with
+   the threads of the other interpreters.  A thread moving between two
+   interpreters must then also move between their GILs, which is what
+   _PyEval_SwitchThreadState() does.
+
+   This requires the rest of the runtime not to share mutable state between
+   interpreters, which is only (partially) the case in builds configured
+   with --with-experimental-isolated-subinterpreters.  See
+   EXPERIMENTAL_ISOLATED_SUBINTERPRETERS. */
+
+int
+_PyEval_InitInterpreterGIL(PyInterpreterState *interp)
+{
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+    struct _gil_runtime_state *gil;
+
+    if (interp == _PyRuntime.interpreters.main) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "the main interpreter can't get its own GIL");
+        return -1;
+    }
+    if (interp->gil != &_PyRuntime.ceval.gil) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "interpreter already has its own GIL");
+        return -1;
+    }
+    gil = PyMem_RawCalloc(1, sizeof(*gil));
+    if (gil == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    _gil_initialize(gil);
+    gil->interval = _PyRuntime.ceval.gil.interval;
+    gil->io_priority = _PyRuntime.ceval.gil.io_priority;
+    create_gil(gil);
+    interp->gil = gil;
+    return 0;
+#else
+    PyErr_SetString(PyExc_RuntimeError,
+                    "subinterpreters with their own GIL require a build "
+                    "configured with --with-experimental-isolated-"
+                    "subinterpreters");
+    return -1;
+#endif
+}
+
+void
+_PyEval_FiniInterpreterGIL(PyInterpreterState *interp)
+{
+    PyThreadState *tstate = PyThreadState_GET();
+    struct _gil_runtime_state *gil = interp->gil;
+
+    if (gil == &_PyRuntime.ceval.gil || gil == tstate->interp->gil)
+        return;
+    /* Wait for a thread which is done with interp but may still be
+       switching away from it. */
+    take_gil(gil, tstate, 0);
+    interp->gil = tstate->interp->gil;
+    destroy_gil(gil);
+    PyMem_RawFree(gil);
+}
+
+PyThreadState *
+_PyEval_SwitchThreadState(PyThreadState *tstate)
+{
+    PyThreadState *old = PyThreadState_Swap(NULL);
+    struct _gil_runtime_state *old_gil, *gil;
+
+    if (old == NULL || tstate == NULL)
+        Py_FatalError("_PyEval_SwitchThreadState: NULL tstate");
+    old_gil = old->interp->gil;
+    gil = tstate->interp->gil;
+    if (gil != old_gil) {
+        /* Release first, so that a thread switching the other way around
+           can't deadlock with us. */
+        drop_gil(old_gil, old, 0);
+        take_gil(gil, tstate, 0);
+    }
+    PyThreadState_Swap(tstate);
+    return old;
+}
+
+
 /* Mechanism whereby asynchronously executing callbacks (e.g. UNIX
    signal handlers or Mac I/O completion routines) can schedule calls
    to a function to be called synchronously.
@@ -505,6 +617,7 @@ static int do_raise(PyObject *, PyObject *);
 static int unpack_iterable(PyObject *, int, int, PyObject **);
 
 #define _Py_TracingPossible _PyRuntime.ceval.tracing_possible
+#define _Py_OpcodeProfiling _PyRuntime.ceval.opcode_profiling
 
 
 PyObject *
@@ -539,9 +652,9 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
 PyObject* _Py_HOT_FUNCTION
 _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
 {
-#ifdef DXPAIRS
-    int lastopcode = 0;
-#endif
+    int lastopcode = 0;  /* Previous opcode, for opcode profiling */
+    /* Copy of _Py_OpcodeProfiling for PREDICT(), updated on the slow path */
+    int opcode_profiling = 0;
     PyObject **stack_pointer;  /* Next free slot in value stack */
     const _Py_CODEUNIT *next_instr;
     int opcode;        /* Current opcode */
@@ -549,6 +662,8 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
     PyObject **fastlocals, **freevars;
     PyObject *retval = NULL;            /* Return value */
     PyThreadState *tstate = PyThreadState_GET();
+    /* The GIL of this interpreter, and the requests made to its holder */
+    struct _gil_runtime_state *gil = tstate->interp->gil;
     PyCodeObject *co;
 
     /* when tracing we set things up so that
@@ -563,6 +678,7 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
     const _Py_CODEUNIT *first_instr;
     PyObject *names;
     PyObject *consts;
+    _PyOpcache *co_opcache;
 
 #ifdef LLTRACE
     _Py_IDENTIFIER(__ltrace__);
@@ -597,8 +713,8 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
    faster than the normal "switch" version, depending on the compiler and the
    CPU architecture.
 
-   We disable the optimization if DYNAMIC_EXECUTION_PROFILE is defined,
-   because it would render the measurements invalid.
+   While opcode profiling is enabled (see _PyEval_SetOpcodeProfiling()),
+   the fast path is skipped so that every instruction is counted.
 
 
    NOTE: care must be taken that the compiler doesn't try to "optimize" the
@@ -607,11 +723,6 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
    -fno-crossjumping).
 */
 
-#ifdef DYNAMIC_EXECUTION_PROFILE
-#undef USE_COMPUTED_GOTOS
-#define USE_COMPUTED_GOTOS 0
-#endif
-
 #ifdef HAVE_COMPUTED_GOTOS
     #ifndef USE_COMPUTED_GOTOS
     #define USE_COMPUTED_GOTOS 1
@@ -634,7 +745,7 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
 
 #define DISPATCH() \
     { \
-        if (!_Py_atomic_load_relaxed(&_PyRuntime.ceval.eval_breaker)) { \
+        if (!_Py_atomic_load_relaxed(&gil->eval_breaker)) { \
                     FAST_DISPATCH(); \
         } \
         continue; \
@@ -693,6 +804,21 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
 #define JUMPTO(x)       (next_instr = first_instr + (x) / sizeof(_Py_CODEUNIT))
 #define JUMPBY(x)       (next_instr += (x) / sizeof(_Py_CODEUNIT))
 
+/* Set co_opcache to the inline cache entry of the current opcode, or to
+   NULL if the code object has no opcache (yet) or the opcode has none. */
+#define OPCACHE_CHECK() \
+    do { \
+        co_opcache = NULL; \
+        if (co->co_opcache != NULL) { \
+            unsigned char co_opt_offset = \
+                co->co_opcache_map[next_instr - first_instr]; \
+            if (co_opt_offset > 0) { \
+                assert(co_opt_offset <= co->co_opcache_size); \
+                co_opcache = &co->co_opcache[co_opt_offset - 1]; \
+            } \
+        } \
+    } while (0)
+
 /* OpCode prediction macros
     Some opcodes tend to come in pairs thus making it possible to
     predict the second code when the first is run.  For example,
@@ -708,10 +834,8 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
     effect of making the two opcodes run as if they were a single new opcode
     with the bodies combined.
 
-    If collecting opcode statistics, your choices are to either keep the
-    predictions turned-on and interpret the results as if some opcodes
-    had been combined or turn-off predictions so that the opcode frequency
-    counter updates for both opcodes.
+    While opcode profiling is enabled, predictions are turned off so that
+    the opcode counters are updated for both opcodes.
 
     Opcode prediction is disabled with threaded code, since the latter allows
     the CPU to record separate branch prediction information for each
@@ -719,14 +843,14 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
 
 */
 
-#if defined(DYNAMIC_EXECUTION_PROFILE) || USE_COMPUTED_GOTOS
+#if USE_COMPUTED_GOTOS
 #define PREDICT(op)             if (0) goto PRED_##op
 #else
 #define PREDICT(op) \
     do{ \
         _Py_CODEUNIT word = *next_instr; \
         opcode = _Py_OPCODE(word); \
-        if (opcode == op){ \
+        if (opcode == op && !opcode_profiling){ \
             oparg = _Py_OPARG(word); \
             next_instr++; \
             goto PRED_##op; \
@@ -736,6 +860,39 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
 #define PREDICTED(op)           PRED_##op:
 
 
+/* Superinstruction macros
+    The peephole optimizer replaces the first instruction of some common
+    pairs with a superinstruction, and leaves the second instruction in
+    place.  After running its first half, a superinstruction fetches the
+    second instruction and jumps straight to its implementation, without a
+    trip through the eval-loop: as with PREDICT(), the two opcodes run as if
+    they were a single opcode, but no runtime test is needed to choose the
+    second one.
+
+    When tracing is possible, a superinstruction only runs its first half,
+    so that the second instruction produces its own trace events.
+*/
+
+#ifdef LLTRACE
+#define SUPERINSTRUCTION_SPLIT() \
+    (lltrace || _Py_TracingPossible || PyDTrace_LINE_ENABLED())
+#else
+#define SUPERINSTRUCTION_SPLIT() \
+    (_Py_TracingPossible || PyDTrace_LINE_ENABLED())
+#endif
+
+#define SUPERINSTRUCTION_NEXT(op) \
+    do { \
+        if (SUPERINSTRUCTION_SPLIT()) { \
+            FAST_DISPATCH(); \
+        } \
+        f->f_lasti = INSTR_OFFSET(); \
+        NEXTOPARG(); \
+        assert(opcode == op); \
+        goto PRED_##op; \
+    } while (0)
+
+
 /* Stack manipulation macros */
 
 /* The stack can grow at most MAXINT deep, as co_nlocals and
@@ -872,6 +1029,16 @@ _PyEval_EvalFrameDefault(PyFrameObject *f, int throwflag)
     assert(PyBytes_GET_SIZE(co->co_code) % sizeof(_Py_CODEUNIT) == 0);
     assert(_Py_IS_ALIGNED(PyBytes_AS_STRING(co->co_code), sizeof(_Py_CODEUNIT)));
     first_instr = (_Py_CODEUNIT *) PyBytes_AS_STRING(co->co_code);
+
+    if (co->co_opcache_flag < OPCACHE_MIN_RUNS) {
+        co->co_opcache_flag++;
+        if (co->co_opcache_flag == OPCACHE_MIN_RUNS) {
+            if (_PyCode_InitOpcache(co) < 0) {
+                goto exit_eval_frame;
+            }
+        }
+    }
+
     /*
        f->f_lasti refers to the index of the last instruction,
        unless it's -1 in which case next_instr should be first_instr.
@@ -927,7 +1094,7 @@ main_loop:
            async I/O handler); see Py_AddPendingCall() and
            Py_MakePendingCalls() above. */
 
-        if (_Py_atomic_load_relaxed(&_PyRuntime.ceval.eval_breaker)) {
+        if (_Py_atomic_load_relaxed(&gil->eval_breaker)) {
             if (_Py_OPCODE(*next_instr) == SETUP_FINALLY ||
                 _Py_OPCODE(*next_instr) == YIELD_FROM) {
                 /* Two cases where we skip running signal handlers and other
@@ -950,23 +1117,21 @@ main_loop:
                 if (Py_MakePendingCalls() < 0)
                     goto error;
             }
-            if (_Py_atomic_load_relaxed(
-                        &_PyRuntime.ceval.gil_drop_request))
-            {
+            if (_Py_atomic_load_relaxed(&gil->gil_drop_request)) {
                 /* Give another thread a chance */
                 if (PyThreadState_Swap(NULL) != tstate)
                     Py_FatalError("ceval: tstate mix-up");
-                drop_gil(tstate);
+                drop_gil(gil, tstate, 1);
 
                 /* Other threads may run now */
 
-                take_gil(tstate);
+                take_gil(gil, tstate, 0);
 
                 /* Check if we should make a quick exit. */
                 if (_Py_IsFinalizing() &&
                     !_Py_CURRENTLY_FINALIZING(tstate))
                 {
-                    drop_gil(tstate);
+                    drop_gil(gil, tstate, 0);
                     PyThread_exit_thread();
                 }
 
@@ -977,7 +1142,7 @@ main_loop:
             if (tstate->async_exc != NULL) {
                 PyObject *exc = tstate->async_exc;
                 tstate->async_exc = NULL;
-                UNSIGNAL_ASYNC_EXC();
+                UNSIGNAL_ASYNC_EXC(gil);
                 PyErr_SetNone(exc);
                 Py_DECREF(exc);
                 goto error;
@@ -990,41 +1155,44 @@ main_loop:
         if (PyDTrace_LINE_ENABLED())
             maybe_dtrace_line(f, &instr_lb, &instr_ub, &instr_prev);
 
-        /* line-by-line tracing support */
+        if (_Py_TracingPossible) {
+            /* line-by-line tracing support */
 
-        if (_Py_TracingPossible &&
-            tstate->c_tracefunc != NULL && !tstate->tracing) {
-            int err;
-            /* see maybe_call_line_trace
-               for expository comments */
-            f->f_stacktop = stack_pointer;
+            if (tstate->c_tracefunc != NULL && !tstate->tracing) {
+                int err;
+                /* see maybe_call_line_trace
+                   for expository comments */
+                f->f_stacktop = stack_pointer;
+
+                err = maybe_call_line_trace(tstate->c_tracefunc,
+                                            tstate->c_traceobj,
+                                            tstate, f,
+                                            &instr_lb, &instr_ub, &instr_prev);
+                /* Reload possibly changed frame fields */
+                JUMPTO(f->f_lasti);
+                if (f->f_stacktop != NULL) {
+                    stack_pointer = f->f_stacktop;
+                    f->f_stacktop = NULL;
+                }
+                if (err)
+                    /* trace function raised an exception */
+                    goto error;
+            }
 
-            err = maybe_call_line_trace(tstate->c_tracefunc,
-                                        tstate->c_traceobj,
-                                        tstate, f,
-                                        &instr_lb, &instr_ub, &instr_prev);
-            /* Reload possibly changed frame fields */
-            JUMPTO(f->f_lasti);
-            if (f->f_stacktop != NULL) {
-                stack_pointer = f->f_stacktop;
-                f->f_stacktop = NULL;
-            }
-            if (err)
-                /* trace function raised an exception */
-                goto error;
+            /* Opcode profiling makes tracing possible, so that the other
+               paths don't test it */
+            opcode_profiling = _Py_OpcodeProfiling;
+            if (opcode_profiling) {
+                int nextop = _Py_OPCODE(*next_instr);
+                _PyCode_CountOpcode(co, lastopcode, nextop);
+                lastopcode = nextop;
+            }
         }
 
         /* Extract opcode and argument */
 
         NEXTOPARG();
     dispatch_opcode:
-#ifdef DYNAMIC_EXECUTION_PROFILE
-#ifdef DXPAIRS
-        dxpairs[lastopcode][opcode]++;
-        lastopcode = opcode;
-#endif
-        dxp[opcode]++;
-#endif
 
 #ifdef LLTRACE
         /* Instruction tracing */
@@ -1050,6 +1218,7 @@ main_loop:
         TARGET(NOP)
             FAST_DISPATCH();
 
+        PREDICTED(LOAD_FAST);
         TARGET(LOAD_FAST) {
             PyObject *value = GETLOCAL(oparg);
             if (value == NULL) {
@@ -1063,6 +1232,32 @@ main_loop:
             FAST_DISPATCH();
         }
 
+        TARGET(LOAD_FAST__LOAD_FAST) {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            SUPERINSTRUCTION_NEXT(LOAD_FAST);
+        }
+
+        TARGET(LOAD_FAST__LOAD_ATTR) {
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            SUPERINSTRUCTION_NEXT(LOAD_ATTR);
+        }
+
         PREDICTED(LOAD_CONST);
         TARGET(LOAD_CONST) {
             PyObject *value = GETITEM(consts, oparg);
@@ -1071,6 +1266,13 @@ main_loop:
             FAST_DISPATCH();
         }
 
+        TARGET(LOAD_CONST__RETURN) {
+            PyObject *value = GETITEM(consts, oparg);
+            Py_INCREF(value);
+            PUSH(value);
+            SUPERINSTRUCTION_NEXT(RETURN_VALUE);
+        }
+
         PREDICTED(STORE_FAST);
         TARGET(STORE_FAST) {
             PyObject *value = POP();
@@ -1264,13 +1466,17 @@ main_loop:
             PyObject *right = POP();
             PyObject *left = TOP();
             PyObject *sum;
-            /* NOTE(haypo): Please don't try to micro-optimize int+int on
-               CPython using bytecode, it is simply worthless.
-               See http://bugs.python.org/issue21955 and
-               http://bugs.python.org/issue10044 for the discussion. In short,
-               no patch shown any impact on a realistic benchmark, only a minor
-               speedup on microbenchmarks. */
-            if (PyUnicode_CheckExact(left) &&
+            /* Ints of at most two digits (loop counters, indexes) are added
+               inline, without going through PyNumber_Add() and the slots
+               of the int type. */
+            if (PyLong_CheckExact(left) && PyLong_CheckExact(right) &&
+                _PyLong_IsTwoDigits(left) && _PyLong_IsTwoDigits(right)) {
+                sum = _PyLong_FromSTwoDigits(
+                    _PyLong_TwoDigitsValue((PyLongObject *)left) +
+                    _PyLong_TwoDigitsValue((PyLongObject *)right));
+                Py_DECREF(left);
+            }
+            else if (PyUnicode_CheckExact(left) &&
                      PyUnicode_CheckExact(right)) {
                 sum = unicode_concatenate(left, right, f, next_instr);
                 /* unicode_concatenate consumed the ref to left */
@@ -1289,7 +1495,16 @@ main_loop:
         TARGET(BINARY_SUBTRACT) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *diff = PyNumber_Subtract(left, right);
+            PyObject *diff;
+            if (PyLong_CheckExact(left) && PyLong_CheckExact(right) &&
+                _PyLong_IsTwoDigits(left) && _PyLong_IsTwoDigits(right)) {
+                diff = _PyLong_FromSTwoDigits(
+                    _PyLong_TwoDigitsValue((PyLongObject *)left) -
+                    _PyLong_TwoDigitsValue((PyLongObject *)right));
+            }
+            else {
+                diff = PyNumber_Subtract(left, right);
+            }
             Py_DECREF(right);
             Py_DECREF(left);
             SET_TOP(diff);
@@ -1470,7 +1685,15 @@ main_loop:
             PyObject *right = POP();
             PyObject *left = TOP();
             PyObject *sum;
-            if (PyUnicode_CheckExact(left) && PyUnicode_CheckExact(right)) {
+            if (PyLong_CheckExact(left) && PyLong_CheckExact(right) &&
+                _PyLong_IsTwoDigits(left) && _PyLong_IsTwoDigits(right)) {
+                sum = _PyLong_FromSTwoDigits(
+                    _PyLong_TwoDigitsValue((PyLongObject *)left) +
+                    _PyLong_TwoDigitsValue((PyLongObject *)right));
+                Py_DECREF(left);
+            }
+            else if (PyUnicode_CheckExact(left) &&
+                     PyUnicode_CheckExact(right)) {
                 sum = unicode_concatenate(left, right, f, next_instr);
                 /* unicode_concatenate consumed the ref to left */
             }
@@ -1488,7 +1711,16 @@ main_loop:
         TARGET(INPLACE_SUBTRACT) {
             PyObject *right = POP();
             PyObject *left = TOP();
-            PyObject *diff = PyNumber_InPlaceSubtract(left, right);
+            PyObject *diff;
+            if (PyLong_CheckExact(left) && PyLong_CheckExact(right) &&
+                _PyLong_IsTwoDigits(left) && _PyLong_IsTwoDigits(right)) {
+                diff = _PyLong_FromSTwoDigits(
+                    _PyLong_TwoDigitsValue((PyLongObject *)left) -
+                    _PyLong_TwoDigitsValue((PyLongObject *)right));
+            }
+            else {
+                diff = PyNumber_InPlaceSubtract(left, right);
+            }
             Py_DECREF(left);
             Py_DECREF(right);
             SET_TOP(diff);
@@ -1628,6 +1860,7 @@ main_loop:
             goto error;
         }
 
+        PREDICTED(RETURN_VALUE);
         TARGET(RETURN_VALUE) {
             retval = POP();
             assert(f->f_iblock == 0);
@@ -2091,7 +2324,32 @@ main_loop:
             PyObject *v = SECOND();
             int err;
             STACKADJ(-2);
+            OPCACHE_CHECK();
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                _PyOpcache_Attr *la = &co_opcache->u.la;
+                PyTypeObject *type = Py_TYPE(owner);
+
+                if (la->type == type
+                    && la->tp_version_tag == type->tp_version_tag
+                    && PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))
+                {
+                    PyDictObject *dict = *(PyDictObject **)(
+                        (char *)owner + type->tp_dictoffset);
+                    if (dict != NULL && dict->ma_keys == la->keys
+                        && _PyDict_SetSplitItemAt(dict, la->index, v) == 0)
+                    {
+                        Py_DECREF(v);
+                        Py_DECREF(owner);
+                        DISPATCH();
+                    }
+                }
+            }
             err = PyObject_SetAttr(owner, name, v);
+            if (err == 0 && co_opcache != NULL
+                && co_opcache->optimized >= 0)
+            {
+                opcache_fill_attr(co_opcache, owner, name, 1);
+            }
             Py_DECREF(v);
             Py_DECREF(owner);
             if (err != 0)
@@ -2185,11 +2443,29 @@ main_loop:
         }
 
         TARGET(LOAD_GLOBAL) {
-            PyObject *name = GETITEM(names, oparg);
+            PyObject *name;
             PyObject *v;
             if (PyDict_CheckExact(f->f_globals)
                 && PyDict_CheckExact(f->f_builtins))
             {
+                OPCACHE_CHECK();
+                if (co_opcache != NULL && co_opcache->optimized > 0) {
+                    _PyOpcache_LoadGlobal *lg = &co_opcache->u.lg;
+
+                    if (lg->globals_ver ==
+                            ((PyDictObject *)f->f_globals)->ma_version_tag
+                        && lg->builtins_ver ==
+                           ((PyDictObject *)f->f_builtins)->ma_version_tag)
+                    {
+                        PyObject *ptr = lg->ptr;
+                        assert(ptr != NULL);
+                        Py_INCREF(ptr);
+                        PUSH(ptr);
+                        DISPATCH();
+                    }
+                }
+
+                name = GETITEM(names, oparg);
                 v = _PyDict_LoadGlobal((PyDictObject *)f->f_globals,
                                        (PyDictObject *)f->f_builtins,
                                        name);
@@ -2202,12 +2478,27 @@ main_loop:
                     }
                     goto error;
                 }
+
+                if (co_opcache != NULL) {
+                    /* Both dicts are unchanged for as long as their version
+                       tags are, so the borrowed reference stays valid. */
+                    _PyOpcache_LoadGlobal *lg = &co_opcache->u.lg;
+
+                    co_opcache->optimized = 1;
+                    lg->globals_ver =
+                        ((PyDictObject *)f->f_globals)->ma_version_tag;
+                    lg->builtins_ver =
+                        ((PyDictObject *)f->f_builtins)->ma_version_tag;
+                    lg->ptr = v; /* borrowed */
+                }
+
                 Py_INCREF(v);
             }
             else {
                 /* Slow-path if globals or builtins is not a dict */
 
                 /* namespace 1: globals */
+                name = GETITEM(names, oparg);
                 v = PyObject_GetItem(f->f_globals, name);
                 if (v == NULL) {
                     if (!PyErr_ExceptionMatches(PyExc_KeyError))
@@ -2646,10 +2937,39 @@ main_loop:
             DISPATCH();
         }
 
+        PREDICTED(LOAD_ATTR);
         TARGET(LOAD_ATTR) {
             PyObject *name = GETITEM(names, oparg);
             PyObject *owner = TOP();
-            PyObject *res = PyObject_GetAttr(owner, name);
+            PyObject *res;
+            OPCACHE_CHECK();
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                _PyOpcache_Attr *la = &co_opcache->u.la;
+                PyTypeObject *type = Py_TYPE(owner);
+
+                if (la->type == type
+                    && la->tp_version_tag == type->tp_version_tag
+                    && PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))
+                {
+                    PyDictObject *dict = *(PyDictObject **)(
+                        (char *)owner + type->tp_dictoffset);
+                    if (dict != NULL && dict->ma_keys == la->keys) {
+                        res = dict->ma_values[la->index];
+                        if (res != NULL) {
+                            Py_INCREF(res);
+                            SET_TOP(res);
+                            Py_DECREF(owner);
+                            DISPATCH();
+                        }
+                    }
+                }
+            }
+            res = PyObject_GetAttr(owner, name);
+            if (res != NULL && co_opcache != NULL
+                && co_opcache->optimized >= 0)
+            {
+                opcache_fill_attr(co_opcache, owner, name, 0);
+            }
             Py_DECREF(owner);
             SET_TOP(res);
             if (res == NULL)
@@ -2671,6 +2991,18 @@ main_loop:
             DISPATCH();
         }
 
+        TARGET(COMPARE_AND_BRANCH) {
+            PyObject *right = POP();
+            PyObject *left = TOP();
+            PyObject *res = cmp_outcome(oparg, left, right);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            SET_TOP(res);
+            if (res == NULL)
+                goto error;
+            SUPERINSTRUCTION_NEXT(POP_JUMP_IF_FALSE);
+        }
+
         TARGET(IMPORT_NAME) {
             PyObject *name = GETITEM(names, oparg);
             PyObject *fromlist = POP();
@@ -3095,14 +3427,51 @@ main_loop:
             PyObject *name = GETITEM(names, oparg);
             PyObject *obj = TOP();
             PyObject *meth = NULL;
+            int meth_found;
 
-            int meth_found = _PyObject_GetMethod(obj, name, &meth);
+            OPCACHE_CHECK();
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                _PyOpcache_LoadMethod *lm = &co_opcache->u.lm;
+                PyTypeObject *type = Py_TYPE(obj);
+
+                if (lm->type == type
+                    && lm->tp_version_tag == type->tp_version_tag
+                    && PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))
+                {
+                    PyDictObject *dict = NULL;
+                    if (type->tp_dictoffset != 0) {
+                        dict = *(PyDictObject **)(
+                            (char *)obj + type->tp_dictoffset);
+                    }
+                    if (dict == NULL || (dict->ma_keys == lm->keys
+                                         && _PyDict_KeysNEntries(lm->keys)
+                                            == lm->nentries))
+                    {
+                        meth = lm->meth;
+                        Py_INCREF(meth);
+                        SET_TOP(meth);
+                        PUSH(obj);  // self
+                        DISPATCH();
+                    }
+                }
+            }
+
+            meth_found = _PyObject_GetMethod(obj, name, &meth);
 
             if (meth == NULL) {
                 /* Most likely attribute wasn't found. */
                 goto error;
             }
 
+            if (co_opcache != NULL && co_opcache->optimized >= 0) {
+                if (meth_found) {
+                    opcache_fill_method(co_opcache, obj, name, meth);
+                }
+                else {
+                    opcache_use_try(co_opcache, 0);
+                }
+            }
+
             if (meth_found) {
                 /* We can bypass temporary bound method object.
                    meth is unbound method and obj is self.
@@ -3372,6 +3741,10 @@ main_loop:
             int oldoparg = oparg;
             NEXTOPARG();
             oparg |= oldoparg << 8;
+            if (_Py_OpcodeProfiling) {
+                _PyCode_CountOpcode(co, lastopcode, opcode);
+                lastopcode = opcode;
+            }
             goto dispatch_opcode;
         }
 
@@ -3699,9 +4072,10 @@ _PyEval_EvalCodeWithName(PyObject *_co, PyObject *globals, PyObject *locals,
     fastlocals = f->f_localsplus;
     freevars = f->f_localsplus + co->co_nlocals;
 
-    /* Create a dictionary for keyword parameters (**kwags) */
+    /* Create a dictionary for keyword parameters (**kwags): small dicts are
+       compact, presize it for the keyword arguments. */
     if (co->co_flags & CO_VARKEYWORDS) {
-        kwdict = PyDict_New();
+        kwdict = _PyDict_NewPresized(kwcount);
         if (kwdict == NULL)
             goto fail;
         i = total_args;
@@ -4575,6 +4949,10 @@ call_function(PyObject ***pp_stack, Py_ssize_t oparg, PyObject *kwnames)
         }
     }
     else {
+        /* The slot of the function object below the arguments can be
+           borrowed by the callee, see PY_VECTORCALL_ARGUMENTS_OFFSET */
+        size_t offset = PY_VECTORCALL_ARGUMENTS_OFFSET;
+
         if (PyMethod_Check(func) && PyMethod_GET_SELF(func) != NULL) {
             /* Optimize access to bound methods. Reuse the Python stack
                to pass 'self' as the first argument, replace 'func'
@@ -4588,6 +4966,8 @@ call_function(PyObject ***pp_stack, Py_ssize_t oparg, PyObject *kwnames)
             Py_SETREF(*pfunc, self);
             nargs++;
             stack--;
+            /* stack[-1] is no longer owned by this call */
+            offset = 0;
         }
         else {
             Py_INCREF(func);
@@ -4597,7 +4977,7 @@ call_function(PyObject ***pp_stack, Py_ssize_t oparg, PyObject *kwnames)
             x = _PyFunction_FastCallKeywords(func, stack, nargs, kwnames);
         }
         else {
-            x = _PyObject_FastCallKeywords(func, stack, nargs, kwnames);
+            x = _PyObject_Vectorcall(func, stack, nargs | offset, kwnames);
         }
         Py_DECREF(func);
     }
@@ -4722,6 +5102,13 @@ cmp_outcome(int op, PyObject *v, PyObject *w)
         res = PyErr_GivenExceptionMatches(v, w);
         break;
     default:
+        /* Compare ints of at most two digits inline. */
+        if (PyLong_CheckExact(v) && PyLong_CheckExact(w) &&
+            _PyLong_IsTwoDigits(v) && _PyLong_IsTwoDigits(w)) {
+            stwodigits a = _PyLong_TwoDigitsValue((PyLongObject *)v);
+            stwodigits b = _PyLong_TwoDigitsValue((PyLongObject *)w);
+            Py_RETURN_RICHCOMPARE(a, b, op);
+        }
         return PyObject_RichCompare(v, w, op);
     }
     v = res ? Py_True : Py_False;
@@ -4954,6 +5341,137 @@ format_kwargs_mapping_error(PyObject *func, PyObject *kwargs)
                  kwargs->ob_type->tp_name);
 }
 
+/* Attribute and method cache entries tolerate OPCACHE_MAX_TRIES refills or
+   failed fills before they are disabled, so that polymorphic sites go back
+   to the generic path for good; an entry that can't be filled the first
+   time is disabled right away.  Return 1 if the entry may be (re)filled. */
+static int
+opcache_use_try(_PyOpcache *co_opcache, int fillable)
+{
+    if (co_opcache->optimized == 0) {
+        co_opcache->optimized = fillable ? OPCACHE_MAX_TRIES : -1;
+    }
+    else if (--co_opcache->optimized == 0) {
+        co_opcache->optimized = -1;
+    }
+    return fillable && co_opcache->optimized > 0;
+}
+
+/* Fill the LOAD_ATTR (store=0) or STORE_ATTR (store=1) cache entry of
+   attribute name of owner after an access through the generic path.
+
+   Only attributes stored in an instance dict that shares the keys of its
+   type are cached, and only if no data descriptor of the type takes
+   precedence: a hit then is a couple of pointer compares and an access to
+   ma_values.  Return 1 if the entry was filled. */
+static int
+opcache_fill_attr(_PyOpcache *co_opcache, PyObject *owner, PyObject *name,
+                  int store)
+{
+    _PyOpcache_Attr *la = &co_opcache->u.la;
+    PyTypeObject *type = Py_TYPE(owner);
+    PyObject *descr;
+    PyDictObject *dict;
+    Py_ssize_t index;
+
+    if (!PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE)
+        || type->tp_dictoffset <= 0
+        || (store ? type->tp_setattro != PyObject_GenericSetAttr
+                  : type->tp_getattro != PyObject_GenericGetAttr))
+    {
+        return opcache_use_try(co_opcache, 0);
+    }
+    /* _PyType_Lookup() assigns a version tag to the type if it can */
+    descr = _PyType_Lookup(type, name);
+    if (!PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)
+        || (descr != NULL && PyDescr_IsData(descr)))
+    {
+        return opcache_use_try(co_opcache, 0);
+    }
+    dict = *(PyDictObject **)((char *)owner + type->tp_dictoffset);
+    if (dict == NULL
+        || dict->ma_keys != ((PyHeapTypeObject *)type)->ht_cached_keys)
+    {
+        return opcache_use_try(co_opcache, 0);
+    }
+    index = _PyDict_GetSplitIndex(dict, name);
+    if (index < 0) {
+        return opcache_use_try(co_opcache, 0);
+    }
+
+    if (co_opcache->optimized > 0
+        && la->type == type && la->tp_version_tag == type->tp_version_tag
+        && la->keys == dict->ma_keys && la->index == index)
+    {
+        /* The entry was right, the fast path just couldn't serve this
+           access (e.g. the first store into a new instance). */
+        return 1;
+    }
+    if (!opcache_use_try(co_opcache, 1)) {
+        return 0;
+    }
+    la->type = type;
+    la->tp_version_tag = type->tp_version_tag;
+    la->keys = dict->ma_keys;
+    la->index = index;
+    return 1;
+}
+
+/* Fill the LOAD_METHOD cache entry after _PyObject_GetMethod() found the
+   unbound method meth on the type of obj.  Return 1 if the entry was
+   filled. */
+static int
+opcache_fill_method(_PyOpcache *co_opcache, PyObject *obj, PyObject *name,
+                    PyObject *meth)
+{
+    _PyOpcache_LoadMethod *lm = &co_opcache->u.lm;
+    PyTypeObject *type = Py_TYPE(obj);
+    PyDictKeysObject *keys = NULL;
+    Py_ssize_t nentries = 0;
+
+    /* _PyObject_GetMethod() looked meth up with _PyType_Lookup(), which
+       assigned a version tag to the type if it can. */
+    if (!PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)
+        || type->tp_dictoffset < 0)
+    {
+        return opcache_use_try(co_opcache, 0);
+    }
+    if (type->tp_dictoffset > 0) {
+        PyDictObject *dict = *(PyDictObject **)(
+            (char *)obj + type->tp_dictoffset);
+        if (PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE)) {
+            keys = ((PyHeapTypeObject *)type)->ht_cached_keys;
+        }
+        /* meth was not shadowed by the instance dict, but other instances
+           may have a value for name if it is in keys */
+        if ((dict != NULL && (keys == NULL || dict->ma_keys != keys))
+            || (keys != NULL && _PyDict_KeysIndex(keys, name) >= 0))
+        {
+            return opcache_use_try(co_opcache, 0);
+        }
+        if (keys != NULL) {
+            nentries = _PyDict_KeysNEntries(keys);
+        }
+    }
+
+    if (co_opcache->optimized > 0
+        && lm->type == type && lm->tp_version_tag == type->tp_version_tag
+        && lm->meth == meth && lm->keys == keys)
+    {
+        lm->nentries = nentries;
+        return 1;
+    }
+    if (!opcache_use_try(co_opcache, 1)) {
+        return 0;
+    }
+    lm->type = type;
+    lm->tp_version_tag = type->tp_version_tag;
+    lm->meth = meth;
+    lm->keys = keys;
+    lm->nentries = nentries;
+    return 1;
+}
+
 static void
 format_exc_check_arg(PyObject *exc, const char *format_str, PyObject *obj)
 {
@@ -5063,50 +5581,29 @@ unicode_concatenate(PyObject *v, PyObject *w,
     return res;
 }
 
-#ifdef DYNAMIC_EXECUTION_PROFILE
-
-static PyObject *
-getarray(long a[256])
+int
+_PyEval_SetOpcodeProfiling(int enabled)
 {
-    int i;
-    PyObject *l = PyList_New(256);
-    if (l == NULL) return NULL;
-    for (i = 0; i < 256; i++) {
-        PyObject *x = PyLong_FromLong(a[i]);
-        if (x == NULL) {
-            Py_DECREF(l);
-            return NULL;
-        }
-        PyList_SetItem(l, i, x);
+    enabled = (enabled != 0);
+    if (enabled == _Py_OpcodeProfiling) {
+        return 0;
+    }
+    if (enabled && _PyCode_InitOpcodeProfiles() < 0) {
+        return -1;
     }
-    for (i = 0; i < 256; i++)
-        a[i] = 0;
-    return l;
+    _Py_OpcodeProfiling = enabled;
+    /* Make the eval loop leave its fast path, which skips the counters, and
+       split superinstructions, whose second half would not be counted */
+    _Py_TracingPossible += enabled ? 1 : -1;
+    return 0;
 }
 
-PyObject *
-_Py_GetDXProfile(PyObject *self, PyObject *args)
+int
+_PyEval_GetOpcodeProfiling(void)
 {
-#ifndef DXPAIRS
-    return getarray(dxp);
-#else
-    int i;
-    PyObject *l = PyList_New(257);
-    if (l == NULL) return NULL;
-    for (i = 0; i < 257; i++) {
-        PyObject *x = getarray(dxpairs[i]);
-        if (x == NULL) {
-            Py_DECREF(l);
-            return NULL;
-        }
-        PyList_SetItem(l, i, x);
-    }
-    return l;
-#endif
+    return _Py_OpcodeProfiling;
 }
 
-#endif
-
 Py_ssize_t
 _PyEval_RequestCodeExtraIndex(freefunc free)
 {
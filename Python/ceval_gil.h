@@ -10,6 +10,8 @@
 
 #define INTERVAL (_PyRuntime.ceval.gil.interval >= 1 ? _PyRuntime.ceval.gil.interval : 1)
 
+#define IO_PRIORITY(gil) ((gil)->io_priority)
+
 
 /*
    Notes about the implementation:
@@ -50,6 +52,16 @@
      run and end up being the first to re-acquire it, making the "timeslices"
      much longer than expected.
      (Note: this mechanism is enabled with FORCE_SWITCHING above)
+
+   - Waiting `interval` before asking for the GIL causes a convoy effect
+     when a CPU-bound thread holds it: every time an I/O-bound thread comes
+     back from a blocking call, it has to wait up to `interval` to run
+     again, even for a very short time.  When `io_priority` is enabled
+     (sys._set_gil_io_priority()), a thread taking the GIL in
+     PyEval_RestoreThread() sets gil_drop_request at once, and counts
+     itself in `priority_requests` so that the GIL goes to it rather than
+     to another waiting (CPU-bound) thread.  The setting belongs to the
+     GIL: an interpreter with its own GIL has its own.
 */
 
 #include "condvar.h"
@@ -76,6 +88,9 @@
 #define COND_SIGNAL(cond) \
     if (PyCOND_SIGNAL(&(cond))) { \
         Py_FatalError("PyCOND_SIGNAL(" #cond ") failed"); };
+#define COND_BROADCAST(cond) \
+    if (PyCOND_BROADCAST(&(cond))) { \
+        Py_FatalError("PyCOND_BROADCAST(" #cond ") failed"); };
 #define COND_WAIT(cond, mut) \
     if (PyCOND_WAIT(&(cond), &(mut))) { \
         Py_FatalError("PyCOND_WAIT(" #cond ") failed"); };
@@ -100,151 +115,203 @@ static void _gil_initialize(struct _gil_runtime_state *state)
     state->interval = DEFAULT_INTERVAL;
 }
 
-static int gil_created(void)
+static int gil_created(struct _gil_runtime_state *gil)
 {
-    return (_Py_atomic_load_explicit(&_PyRuntime.ceval.gil.locked,
-                                     _Py_memory_order_acquire)
+    return (_Py_atomic_load_explicit(&gil->locked, _Py_memory_order_acquire)
             ) >= 0;
 }
 
-static void create_gil(void)
+static void create_gil(struct _gil_runtime_state *gil)
 {
-    MUTEX_INIT(_PyRuntime.ceval.gil.mutex);
+    MUTEX_INIT(gil->mutex);
 #ifdef FORCE_SWITCHING
-    MUTEX_INIT(_PyRuntime.ceval.gil.switch_mutex);
+    MUTEX_INIT(gil->switch_mutex);
 #endif
-    COND_INIT(_PyRuntime.ceval.gil.cond);
+    COND_INIT(gil->cond);
 #ifdef FORCE_SWITCHING
-    COND_INIT(_PyRuntime.ceval.gil.switch_cond);
+    COND_INIT(gil->switch_cond);
 #endif
-    _Py_atomic_store_relaxed(&_PyRuntime.ceval.gil.last_holder, 0);
-    _Py_ANNOTATE_RWLOCK_CREATE(&_PyRuntime.ceval.gil.locked);
-    _Py_atomic_store_explicit(&_PyRuntime.ceval.gil.locked, 0,
-                              _Py_memory_order_release);
+    _Py_atomic_store_relaxed(&gil->last_holder, 0);
+    gil->priority_requests = 0;
+    _Py_ANNOTATE_RWLOCK_CREATE(&gil->locked);
+    _Py_atomic_store_explicit(&gil->locked, 0, _Py_memory_order_release);
 }
 
-static void destroy_gil(void)
+static void destroy_gil(struct _gil_runtime_state *gil)
 {
     /* some pthread-like implementations tie the mutex to the cond
      * and must have the cond destroyed first.
      */
-    COND_FINI(_PyRuntime.ceval.gil.cond);
-    MUTEX_FINI(_PyRuntime.ceval.gil.mutex);
+    COND_FINI(gil->cond);
+    MUTEX_FINI(gil->mutex);
 #ifdef FORCE_SWITCHING
-    COND_FINI(_PyRuntime.ceval.gil.switch_cond);
-    MUTEX_FINI(_PyRuntime.ceval.gil.switch_mutex);
+    COND_FINI(gil->switch_cond);
+    MUTEX_FINI(gil->switch_mutex);
 #endif
-    _Py_atomic_store_explicit(&_PyRuntime.ceval.gil.locked, -1,
-                              _Py_memory_order_release);
-    _Py_ANNOTATE_RWLOCK_DESTROY(&_PyRuntime.ceval.gil.locked);
+    _Py_atomic_store_explicit(&gil->locked, -1, _Py_memory_order_release);
+    _Py_ANNOTATE_RWLOCK_DESTROY(&gil->locked);
 }
 
-static void recreate_gil(void)
+static void recreate_gil(struct _gil_runtime_state *gil)
 {
-    _Py_ANNOTATE_RWLOCK_DESTROY(&_PyRuntime.ceval.gil.locked);
+    _Py_ANNOTATE_RWLOCK_DESTROY(&gil->locked);
     /* XXX should we destroy the old OS resources here? */
-    create_gil();
+    create_gil(gil);
+}
+
+#ifdef Py_GIL_STATS
+static void
+gil_stats_event(PyThreadState *tstate, int event, _PyTime_t duration)
+{
+    _PyGILStatsHook hook = _PyRuntime.ceval.gil_stats_hook;
+    if (hook != NULL) {
+        hook(tstate, event, duration, _PyRuntime.ceval.gil_stats_hook_data);
+    }
 }
+#endif
 
-static void drop_gil(PyThreadState *tstate)
+/* forced is true if the GIL is dropped because another thread asked for
+   it (gil_drop_request). */
+static void drop_gil(struct _gil_runtime_state *gil, PyThreadState *tstate,
+                     int forced)
 {
-    if (!_Py_atomic_load_relaxed(&_PyRuntime.ceval.gil.locked))
+    if (!_Py_atomic_load_relaxed(&gil->locked))
         Py_FatalError("drop_gil: GIL is not locked");
     /* tstate is allowed to be NULL (early interpreter init) */
     if (tstate != NULL) {
         /* Sub-interpreter support: threads might have been switched
            under our feet using PyThreadState_Swap(). Fix the GIL last
            holder variable so that our heuristics work. */
-        _Py_atomic_store_relaxed(&_PyRuntime.ceval.gil.last_holder,
-                                 (uintptr_t)tstate);
+        _Py_atomic_store_relaxed(&gil->last_holder, (uintptr_t)tstate);
+#ifdef Py_GIL_STATS
+        _PyTime_t held = _PyTime_GetPerfCounter() - gil->hold_start;
+        tstate->gil_hold_time += held;
+        if (forced) {
+            tstate->gil_forced_drops++;
+        }
+        gil_stats_event(tstate,
+                        forced ? _PyGIL_EVENT_FORCED_DROP : _PyGIL_EVENT_DROP,
+                        held);
+#endif
     }
 
-    MUTEX_LOCK(_PyRuntime.ceval.gil.mutex);
-    _Py_ANNOTATE_RWLOCK_RELEASED(&_PyRuntime.ceval.gil.locked, /*is_write=*/1);
-    _Py_atomic_store_relaxed(&_PyRuntime.ceval.gil.locked, 0);
-    COND_SIGNAL(_PyRuntime.ceval.gil.cond);
-    MUTEX_UNLOCK(_PyRuntime.ceval.gil.mutex);
+    MUTEX_LOCK(gil->mutex);
+    _Py_ANNOTATE_RWLOCK_RELEASED(&gil->locked, /*is_write=*/1);
+    _Py_atomic_store_relaxed(&gil->locked, 0);
+    if (gil->priority_requests) {
+        /* Make sure that a priority thread is among the woken up ones */
+        COND_BROADCAST(gil->cond);
+    }
+    else {
+        COND_SIGNAL(gil->cond);
+    }
+    MUTEX_UNLOCK(gil->mutex);
 
 #ifdef FORCE_SWITCHING
-    if (_Py_atomic_load_relaxed(&_PyRuntime.ceval.gil_drop_request) &&
+    if (_Py_atomic_load_relaxed(&gil->gil_drop_request) &&
         tstate != NULL)
     {
-        MUTEX_LOCK(_PyRuntime.ceval.gil.switch_mutex);
+        MUTEX_LOCK(gil->switch_mutex);
         /* Not switched yet => wait */
-        if (((PyThreadState*)_Py_atomic_load_relaxed(
-                    &_PyRuntime.ceval.gil.last_holder)
+        if (((PyThreadState*)_Py_atomic_load_relaxed(&gil->last_holder)
             ) == tstate)
         {
-        RESET_GIL_DROP_REQUEST();
+        RESET_GIL_DROP_REQUEST(gil);
             /* NOTE: if COND_WAIT does not atomically start waiting when
                releasing the mutex, another thread can run through, take
                the GIL and drop it again, and reset the condition
                before we even had a chance to wait for it. */
-            COND_WAIT(_PyRuntime.ceval.gil.switch_cond,
-                      _PyRuntime.ceval.gil.switch_mutex);
+            COND_WAIT(gil->switch_cond, gil->switch_mutex);
     }
-        MUTEX_UNLOCK(_PyRuntime.ceval.gil.switch_mutex);
+        MUTEX_UNLOCK(gil->switch_mutex);
     }
 #endif
 }
 
-static void take_gil(PyThreadState *tstate)
+/* after_io is true if the thread is coming back from a blocking call. */
+static void take_gil(struct _gil_runtime_state *gil, PyThreadState *tstate,
+                     int after_io)
 {
     int err;
+    int priority = 0;
+    _PyTime_t waited = 0;
     if (tstate == NULL)
         Py_FatalError("take_gil: NULL tstate");
 
     err = errno;
-    MUTEX_LOCK(_PyRuntime.ceval.gil.mutex);
+    MUTEX_LOCK(gil->mutex);
 
-    if (!_Py_atomic_load_relaxed(&_PyRuntime.ceval.gil.locked))
+    if (!_Py_atomic_load_relaxed(&gil->locked) && !gil->priority_requests) {
         goto _ready;
+    }
 
-    while (_Py_atomic_load_relaxed(&_PyRuntime.ceval.gil.locked)) {
+    /* Only the contended path reads the clock */
+    _PyTime_t wait_start = _PyTime_GetPerfCounter();
+    if (after_io && IO_PRIORITY(gil)) {
+        priority = 1;
+        gil->priority_requests++;
+        if (_Py_atomic_load_relaxed(&gil->locked)) {
+            SET_GIL_DROP_REQUEST(gil);
+        }
+    }
+    while (_Py_atomic_load_relaxed(&gil->locked) ||
+           (!priority && gil->priority_requests)) {
         int timed_out = 0;
         unsigned long saved_switchnum;
 
-        saved_switchnum = _PyRuntime.ceval.gil.switch_number;
-        COND_TIMED_WAIT(_PyRuntime.ceval.gil.cond, _PyRuntime.ceval.gil.mutex,
-                        INTERVAL, timed_out);
+        saved_switchnum = gil->switch_number;
+        COND_TIMED_WAIT(gil->cond, gil->mutex, INTERVAL, timed_out);
         /* If we timed out and no switch occurred in the meantime, it is time
            to ask the GIL-holding thread to drop it. */
         if (timed_out &&
-            _Py_atomic_load_relaxed(&_PyRuntime.ceval.gil.locked) &&
-            _PyRuntime.ceval.gil.switch_number == saved_switchnum) {
-            SET_GIL_DROP_REQUEST();
+            _Py_atomic_load_relaxed(&gil->locked) &&
+            gil->switch_number == saved_switchnum) {
+            SET_GIL_DROP_REQUEST(gil);
         }
     }
+    if (priority) {
+        gil->priority_requests--;
+    }
+    waited = _PyTime_GetPerfCounter() - wait_start;
+    tstate->gil_wait_time += waited;
 _ready:
 #ifdef FORCE_SWITCHING
     /* This mutex must be taken before modifying
-       _PyRuntime.ceval.gil.last_holder (see drop_gil()). */
-    MUTEX_LOCK(_PyRuntime.ceval.gil.switch_mutex);
+       gil->last_holder (see drop_gil()). */
+    MUTEX_LOCK(gil->switch_mutex);
 #endif
     /* We now hold the GIL */
-    _Py_atomic_store_relaxed(&_PyRuntime.ceval.gil.locked, 1);
-    _Py_ANNOTATE_RWLOCK_ACQUIRED(&_PyRuntime.ceval.gil.locked, /*is_write=*/1);
+    _Py_atomic_store_relaxed(&gil->locked, 1);
+    _Py_ANNOTATE_RWLOCK_ACQUIRED(&gil->locked, /*is_write=*/1);
 
     if (tstate != (PyThreadState*)_Py_atomic_load_relaxed(
-                    &_PyRuntime.ceval.gil.last_holder))
+                    &gil->last_holder))
     {
-        _Py_atomic_store_relaxed(&_PyRuntime.ceval.gil.last_holder,
+        _Py_atomic_store_relaxed(&gil->last_holder,
                                  (uintptr_t)tstate);
-        ++_PyRuntime.ceval.gil.switch_number;
+        ++gil->switch_number;
+        ++tstate->gil_handoffs;
     }
+#ifdef Py_GIL_STATS
+    gil->hold_start = _PyTime_GetPerfCounter();
+#endif
 
 #ifdef FORCE_SWITCHING
-    COND_SIGNAL(_PyRuntime.ceval.gil.switch_cond);
-    MUTEX_UNLOCK(_PyRuntime.ceval.gil.switch_mutex);
+    COND_SIGNAL(gil->switch_cond);
+    MUTEX_UNLOCK(gil->switch_mutex);
 #endif
-    if (_Py_atomic_load_relaxed(&_PyRuntime.ceval.gil_drop_request)) {
-        RESET_GIL_DROP_REQUEST();
+    if (_Py_atomic_load_relaxed(&gil->gil_drop_request)) {
+        RESET_GIL_DROP_REQUEST(gil);
     }
     if (tstate->async_exc != NULL) {
-        _PyEval_SignalAsyncExc();
+        SIGNAL_ASYNC_EXC(gil);
     }
 
-    MUTEX_UNLOCK(_PyRuntime.ceval.gil.mutex);
+    MUTEX_UNLOCK(gil->mutex);
+#ifdef Py_GIL_STATS
+    tstate->gil_acquisitions++;
+    gil_stats_event(tstate, _PyGIL_EVENT_TAKE, waited);
+#endif
     errno = err;
 }
 
@@ -257,3 +324,30 @@ unsigned long _PyEval_GetSwitchInterval()
 {
     return _PyRuntime.ceval.gil.interval;
 }
+
+/* The I/O priority of the GIL of the current interpreter */
+void _PyEval_SetIOPriority(int enabled)
+{
+    PyThreadState_GET()->interp->gil->io_priority = enabled;
+}
+
+int _PyEval_GetIOPriority(void)
+{
+    return PyThreadState_GET()->interp->gil->io_priority;
+}
+
+#ifdef Py_GIL_STATS
+void _PyEval_SetGILStatsHook(_PyGILStatsHook hook, void *data)
+{
+    _PyRuntime.ceval.gil_stats_hook = hook;
+    _PyRuntime.ceval.gil_stats_hook_data = data;
+}
+
+_PyGILStatsHook _PyEval_GetGILStatsHook(void **data)
+{
+    if (data != NULL) {
+        *data = _PyRuntime.ceval.gil_stats_hook_data;
+    }
+    return _PyRuntime.ceval.gil_stats_hook;
+}
+#endif
@@ -1110,6 +1110,14 @@ stack_effect(int opcode, int oparg, int jump)
             return (oparg & FVS_MASK) == FVS_HAVE_SPEC ? -1 : 0;
         case LOAD_METHOD:
             return 1;
+        /* Superinstructions, emitted by the peephole optimizer: the second
+           instruction is kept after them, so only count the first one */
+        case LOAD_FAST__LOAD_FAST:
+        case LOAD_FAST__LOAD_ATTR:
+        case LOAD_CONST__RETURN:
+            return 1;
+        case COMPARE_AND_BRANCH:
+            return -1;
         default:
             return PY_INVALID_STACK_EFFECT;
     }
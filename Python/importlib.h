@@ -30,7 +30,7 @@ const unsigned char _Py_M__importlib[] = {
     132,2,90,44,100,83,100,84,132,0,90,45,100,99,100,86,
     100,87,132,1,90,46,100,88,100,89,132,0,90,47,100,90,
     100,91,132,0,90,48,100,92,100,93,132,0,90,49,100,94,
-    100,95,132,0,90,50,100,1,83,0,41,100,97,83,1,0,
+    100,95,132,0,90,50,168,1,83,0,41,100,97,83,1,0,
     0,67,111,114,101,32,105,109,112,108,101,109,101,110,116,97,
     116,105,111,110,32,111,102,32,105,109,112,111,114,116,46,10,
     10,84,104,105,115,32,109,111,100,117,108,101,32,105,115,32,
@@ -54,10 +54,10 @@ const unsigned char _Py_M__importlib[] = {
     111,110,32,111,102,32,116,104,105,115,32,109,111,100,117,108,
     101,46,10,10,78,99,2,0,0,0,0,0,0,0,3,0,
     0,0,7,0,0,0,67,0,0,0,115,56,0,0,0,100,
-    1,68,0,93,32,125,2,116,0,124,1,124,2,131,2,114,
-    4,116,1,124,0,124,2,116,2,124,1,124,2,131,2,131,
-    3,1,0,113,4,124,0,106,3,160,4,124,1,106,3,161,
-    1,1,0,100,2,83,0,41,3,122,47,83,105,109,112,108,
+    1,68,0,93,32,125,2,116,0,165,1,124,2,131,2,114,
+    4,116,1,165,0,124,2,116,2,165,1,124,2,131,2,131,
+    3,1,0,113,4,166,0,106,3,160,4,166,1,106,3,161,
+    1,1,0,168,2,83,0,41,3,122,47,83,105,109,112,108,
     101,32,115,117,98,115,116,105,116,117,116,101,32,102,111,114,
     32,102,117,110,99,116,111,111,108,115,46,117,112,100,97,116,
     101,95,119,114,97,112,112,101,114,46,41,4,218,10,95,95,
@@ -80,7 +80,7 @@ const unsigned char _Py_M__importlib[] = {
     95,110,101,119,95,109,111,100,117,108,101,35,0,0,0,115,
     2,0,0,0,0,1,114,16,0,0,0,99,0,0,0,0,
     0,0,0,0,0,0,0,0,1,0,0,0,64,0,0,0,
-    115,12,0,0,0,101,0,90,1,100,0,90,2,100,1,83,
+    115,12,0,0,0,101,0,90,1,100,0,90,2,168,1,83,
     0,41,2,218,14,95,68,101,97,100,108,111,99,107,69,114,
     114,111,114,78,41,3,114,1,0,0,0,114,0,0,0,0,
     114,2,0,0,0,114,10,0,0,0,114,10,0,0,0,114,
@@ -90,7 +90,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,115,56,0,0,0,101,0,90,1,100,0,90,2,
     100,1,90,3,100,2,100,3,132,0,90,4,100,4,100,5,
     132,0,90,5,100,6,100,7,132,0,90,6,100,8,100,9,
-    132,0,90,7,100,10,100,11,132,0,90,8,100,12,83,0,
+    132,0,90,7,100,10,100,11,132,0,90,8,168,12,83,0,
     41,13,218,11,95,77,111,100,117,108,101,76,111,99,107,122,
     169,65,32,114,101,99,117,114,115,105,118,101,32,108,111,99,
     107,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,
@@ -105,9 +105,9 @@ const unsigned char _Py_M__importlib[] = {
     110,32,65,41,46,10,32,32,32,32,99,2,0,0,0,0,
     0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,115,
     48,0,0,0,116,0,160,1,161,0,124,0,95,2,116,0,
-    160,1,161,0,124,0,95,3,124,1,124,0,95,4,100,0,
+    160,1,161,0,124,0,95,3,165,1,124,0,95,4,100,0,
     124,0,95,5,100,1,124,0,95,6,100,1,124,0,95,7,
-    100,0,83,0,41,2,78,233,0,0,0,0,41,8,218,7,
+    168,0,83,0,41,2,78,233,0,0,0,0,41,8,218,7,
     95,116,104,114,101,97,100,90,13,97,108,108,111,99,97,116,
     101,95,108,111,99,107,218,4,108,111,99,107,218,6,119,97,
     107,101,117,112,114,15,0,0,0,218,5,111,119,110,101,114,
@@ -119,10 +119,10 @@ const unsigned char _Py_M__importlib[] = {
     100,117,108,101,76,111,99,107,46,95,95,105,110,105,116,95,
     95,99,1,0,0,0,0,0,0,0,4,0,0,0,3,0,
     0,0,67,0,0,0,115,60,0,0,0,116,0,160,1,161,
-    0,125,1,124,0,106,2,125,2,116,3,160,4,124,2,161,
-    1,125,3,124,3,100,0,107,8,114,36,100,1,83,0,124,
-    3,106,2,125,2,124,2,124,1,107,2,114,14,100,2,83,
-    0,113,14,100,0,83,0,41,3,78,70,84,41,5,114,20,
+    0,125,1,166,0,106,2,125,2,116,3,160,4,124,2,161,
+    1,125,3,124,3,100,0,167,8,114,36,168,1,83,0,166,
+    3,106,2,125,2,165,2,124,1,167,2,114,14,168,2,83,
+    0,113,14,168,0,83,0,41,3,78,70,84,41,5,114,20,
     0,0,0,218,9,103,101,116,95,105,100,101,110,116,114,23,
     0,0,0,218,12,95,98,108,111,99,107,105,110,103,95,111,
     110,218,3,103,101,116,41,4,114,26,0,0,0,90,2,109,
@@ -134,17 +134,17 @@ const unsigned char _Py_M__importlib[] = {
     97,115,95,100,101,97,100,108,111,99,107,99,1,0,0,0,
     0,0,0,0,2,0,0,0,9,0,0,0,67,0,0,0,
     115,178,0,0,0,116,0,160,1,161,0,125,1,124,0,116,
-    2,124,1,60,0,122,148,124,0,106,3,143,110,1,0,124,
-    0,106,4,100,1,107,2,115,46,124,0,106,5,124,1,107,
-    2,114,84,124,1,124,0,95,5,124,0,4,0,106,4,100,
+    2,124,1,60,0,122,148,166,0,106,3,143,110,1,0,166,
+    0,106,4,100,1,107,2,115,46,166,0,106,5,124,1,167,
+    2,114,84,165,1,124,0,95,5,124,0,4,0,106,4,100,
     2,55,0,2,0,95,4,87,0,53,0,81,0,82,0,163,
-    0,87,0,162,86,100,3,83,0,124,0,160,6,161,0,114,
-    104,116,7,100,4,124,0,22,0,131,1,130,1,124,0,106,
+    0,87,0,162,86,168,3,83,0,124,0,160,6,161,0,114,
+    104,116,7,100,4,124,0,22,0,131,1,130,1,166,0,106,
     8,160,9,100,5,161,1,114,130,124,0,4,0,106,10,100,
     2,55,0,2,0,95,10,87,0,53,0,81,0,82,0,88,
-    0,124,0,106,8,160,9,161,0,1,0,124,0,106,8,160,
+    0,166,0,106,8,160,9,161,0,1,0,166,0,106,8,160,
     11,161,0,1,0,113,18,87,0,53,0,116,2,124,1,61,
-    0,88,0,100,6,83,0,41,7,122,185,10,32,32,32,32,
+    0,88,0,168,6,83,0,41,7,122,185,10,32,32,32,32,
     32,32,32,32,65,99,113,117,105,114,101,32,116,104,101,32,
     109,111,100,117,108,101,32,108,111,99,107,46,32,32,73,102,
     32,97,32,112,111,116,101,110,116,105,97,108,32,100,101,97,
@@ -170,14 +170,14 @@ const unsigned char _Py_M__importlib[] = {
     1,24,2,10,1,16,2,122,19,95,77,111,100,117,108,101,
     76,111,99,107,46,97,99,113,117,105,114,101,99,1,0,0,
     0,0,0,0,0,2,0,0,0,9,0,0,0,67,0,0,
-    0,115,122,0,0,0,116,0,160,1,161,0,125,1,124,0,
-    106,2,143,98,1,0,124,0,106,3,124,1,107,3,114,34,
-    116,4,100,1,131,1,130,1,124,0,106,5,100,2,107,4,
+    0,115,122,0,0,0,116,0,160,1,161,0,125,1,166,0,
+    106,2,143,98,1,0,166,0,106,3,124,1,167,3,114,34,
+    116,4,100,1,131,1,130,1,166,0,106,5,100,2,107,4,
     115,48,116,6,130,1,124,0,4,0,106,5,100,3,56,0,
-    2,0,95,5,124,0,106,5,100,2,107,2,114,108,100,0,
-    124,0,95,3,124,0,106,7,114,108,124,0,4,0,106,7,
-    100,3,56,0,2,0,95,7,124,0,106,8,160,9,161,0,
-    1,0,87,0,53,0,81,0,82,0,88,0,100,0,83,0,
+    2,0,95,5,166,0,106,5,100,2,167,2,114,108,100,0,
+    124,0,95,3,166,0,106,7,114,108,124,0,4,0,106,7,
+    100,3,56,0,2,0,95,7,166,0,106,8,160,9,161,0,
+    1,0,87,0,53,0,81,0,82,0,88,0,168,0,83,0,
     41,4,78,122,31,99,97,110,110,111,116,32,114,101,108,101,
     97,115,101,32,117,110,45,97,99,113,117,105,114,101,100,32,
     108,111,99,107,114,19,0,0,0,114,33,0,0,0,41,10,
@@ -192,7 +192,7 @@ const unsigned char _Py_M__importlib[] = {
     1,6,1,14,1,122,19,95,77,111,100,117,108,101,76,111,
     99,107,46,114,101,108,101,97,115,101,99,1,0,0,0,0,
     0,0,0,1,0,0,0,5,0,0,0,67,0,0,0,115,
-    18,0,0,0,100,1,160,0,124,0,106,1,116,2,124,0,
+    18,0,0,0,100,1,160,0,166,0,106,1,116,2,124,0,
     131,1,161,2,83,0,41,2,78,122,23,95,77,111,100,117,
     108,101,76,111,99,107,40,123,33,114,125,41,32,97,116,32,
     123,125,41,3,218,6,102,111,114,109,97,116,114,15,0,0,
@@ -210,7 +210,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,2,0,0,0,64,0,0,0,115,48,0,0,
     0,101,0,90,1,100,0,90,2,100,1,90,3,100,2,100,
     3,132,0,90,4,100,4,100,5,132,0,90,5,100,6,100,
-    7,132,0,90,6,100,8,100,9,132,0,90,7,100,10,83,
+    7,132,0,90,6,100,8,100,9,132,0,90,7,168,10,83,
     0,41,11,218,16,95,68,117,109,109,121,77,111,100,117,108,
     101,76,111,99,107,122,86,65,32,115,105,109,112,108,101,32,
     95,77,111,100,117,108,101,76,111,99,107,32,101,113,117,105,
@@ -219,8 +219,8 @@ const unsigned char _Py_M__importlib[] = {
     10,32,32,32,32,109,117,108,116,105,45,116,104,114,101,97,
     100,105,110,103,32,115,117,112,112,111,114,116,46,99,2,0,
     0,0,0,0,0,0,2,0,0,0,2,0,0,0,67,0,
-    0,0,115,16,0,0,0,124,1,124,0,95,0,100,1,124,
-    0,95,1,100,0,83,0,41,2,78,114,19,0,0,0,41,
+    0,0,115,16,0,0,0,165,1,124,0,95,0,100,1,124,
+    0,95,1,168,0,83,0,41,2,78,114,19,0,0,0,41,
     2,114,15,0,0,0,114,24,0,0,0,41,2,114,26,0,
     0,0,114,15,0,0,0,114,10,0,0,0,114,10,0,0,
     0,114,11,0,0,0,114,27,0,0,0,124,0,0,0,115,
@@ -228,16 +228,16 @@ const unsigned char _Py_M__importlib[] = {
     77,111,100,117,108,101,76,111,99,107,46,95,95,105,110,105,
     116,95,95,99,1,0,0,0,0,0,0,0,1,0,0,0,
     3,0,0,0,67,0,0,0,115,18,0,0,0,124,0,4,
-    0,106,0,100,1,55,0,2,0,95,0,100,2,83,0,41,
+    0,106,0,100,1,55,0,2,0,95,0,168,2,83,0,41,
     3,78,114,33,0,0,0,84,41,1,114,24,0,0,0,41,
     1,114,26,0,0,0,114,10,0,0,0,114,10,0,0,0,
     114,11,0,0,0,114,34,0,0,0,128,0,0,0,115,4,
     0,0,0,0,1,14,1,122,24,95,68,117,109,109,121,77,
     111,100,117,108,101,76,111,99,107,46,97,99,113,117,105,114,
     101,99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,
-    0,0,67,0,0,0,115,36,0,0,0,124,0,106,0,100,
-    1,107,2,114,18,116,1,100,2,131,1,130,1,124,0,4,
-    0,106,0,100,3,56,0,2,0,95,0,100,0,83,0,41,
+    0,0,67,0,0,0,115,36,0,0,0,166,0,106,0,100,
+    1,167,2,114,18,116,1,100,2,131,1,130,1,124,0,4,
+    0,106,0,100,3,56,0,2,0,95,0,168,0,83,0,41,
     4,78,114,19,0,0,0,122,31,99,97,110,110,111,116,32,
     114,101,108,101,97,115,101,32,117,110,45,97,99,113,117,105,
     114,101,100,32,108,111,99,107,114,33,0,0,0,41,2,114,
@@ -247,7 +247,7 @@ const unsigned char _Py_M__importlib[] = {
     1,8,1,122,24,95,68,117,109,109,121,77,111,100,117,108,
     101,76,111,99,107,46,114,101,108,101,97,115,101,99,1,0,
     0,0,0,0,0,0,1,0,0,0,5,0,0,0,67,0,
-    0,0,115,18,0,0,0,100,1,160,0,124,0,106,1,116,
+    0,0,115,18,0,0,0,100,1,160,0,166,0,106,1,116,
     2,124,0,131,1,161,2,83,0,41,2,78,122,28,95,68,
     117,109,109,121,77,111,100,117,108,101,76,111,99,107,40,123,
     33,114,125,41,32,97,116,32,123,125,41,3,114,38,0,0,
@@ -265,20 +265,20 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,2,0,0,0,64,0,0,0,115,36,0,0,0,
     101,0,90,1,100,0,90,2,100,1,100,2,132,0,90,3,
     100,3,100,4,132,0,90,4,100,5,100,6,132,0,90,5,
-    100,7,83,0,41,8,218,18,95,77,111,100,117,108,101,76,
+    168,7,83,0,41,8,218,18,95,77,111,100,117,108,101,76,
     111,99,107,77,97,110,97,103,101,114,99,2,0,0,0,0,
     0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,115,
-    16,0,0,0,124,1,124,0,95,0,100,0,124,0,95,1,
-    100,0,83,0,41,1,78,41,2,218,5,95,110,97,109,101,
+    16,0,0,0,165,1,124,0,95,0,100,0,124,0,95,1,
+    168,0,83,0,41,1,78,41,2,218,5,95,110,97,109,101,
     218,5,95,108,111,99,107,41,2,114,26,0,0,0,114,15,
     0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,
     0,0,114,27,0,0,0,143,0,0,0,115,4,0,0,0,
     0,1,6,1,122,27,95,77,111,100,117,108,101,76,111,99,
     107,77,97,110,97,103,101,114,46,95,95,105,110,105,116,95,
     95,99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,
-    0,0,67,0,0,0,115,26,0,0,0,116,0,124,0,106,
-    1,131,1,124,0,95,2,124,0,106,2,160,3,161,0,1,
-    0,100,0,83,0,41,1,78,41,4,218,16,95,103,101,116,
+    0,0,67,0,0,0,115,26,0,0,0,116,0,166,0,106,
+    1,131,1,124,0,95,2,166,0,106,2,160,3,161,0,1,
+    0,168,0,83,0,41,1,78,41,4,218,16,95,103,101,116,
     95,109,111,100,117,108,101,95,108,111,99,107,114,43,0,0,
     0,114,44,0,0,0,114,34,0,0,0,41,1,114,26,0,
     0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,0,
@@ -287,7 +287,7 @@ const unsigned char _Py_M__importlib[] = {
     108,101,76,111,99,107,77,97,110,97,103,101,114,46,95,95,
     101,110,116,101,114,95,95,99,1,0,0,0,0,0,0,0,
     3,0,0,0,2,0,0,0,79,0,0,0,115,14,0,0,
-    0,124,0,106,0,160,1,161,0,1,0,100,0,83,0,41,
+    0,166,0,106,0,160,1,161,0,1,0,168,0,83,0,41,
     1,78,41,2,114,44,0,0,0,114,35,0,0,0,41,3,
     114,26,0,0,0,218,4,97,114,103,115,90,6,107,119,97,
     114,103,115,114,10,0,0,0,114,10,0,0,0,114,11,0,
@@ -302,12 +302,12 @@ const unsigned char _Py_M__importlib[] = {
     0,0,99,1,0,0,0,0,0,0,0,3,0,0,0,8,
     0,0,0,67,0,0,0,115,130,0,0,0,116,0,160,1,
     161,0,1,0,122,106,122,14,116,2,124,0,25,0,131,0,
-    125,1,87,0,110,24,4,0,116,3,107,10,114,48,1,0,
+    125,1,87,0,110,24,4,0,116,3,167,10,114,48,1,0,
     1,0,1,0,100,1,125,1,89,0,110,2,88,0,124,1,
-    100,1,107,8,114,112,116,4,100,1,107,8,114,76,116,5,
+    100,1,167,8,114,112,116,4,100,1,167,8,114,76,116,5,
     124,0,131,1,125,1,110,8,116,6,124,0,131,1,125,1,
     124,0,102,1,100,2,100,3,132,1,125,2,116,7,160,8,
-    124,1,124,2,161,2,116,2,124,0,60,0,87,0,53,0,
+    165,1,124,2,161,2,116,2,124,0,60,0,87,0,53,0,
     116,0,160,9,161,0,1,0,88,0,124,1,83,0,41,4,
     122,139,71,101,116,32,111,114,32,99,114,101,97,116,101,32,
     116,104,101,32,109,111,100,117,108,101,32,108,111,99,107,32,
@@ -320,9 +320,9 @@ const unsigned char _Py_M__importlib[] = {
     109,111,100,117,108,101,95,108,111,99,107,115,46,78,99,2,
     0,0,0,0,0,0,0,2,0,0,0,8,0,0,0,83,
     0,0,0,115,48,0,0,0,116,0,160,1,161,0,1,0,
-    122,24,116,2,160,3,124,1,161,1,124,0,107,8,114,30,
+    122,24,116,2,160,3,124,1,161,1,124,0,167,8,114,30,
     116,2,124,1,61,0,87,0,53,0,116,0,160,4,161,0,
-    1,0,88,0,100,0,83,0,41,1,78,41,5,218,4,95,
+    1,0,88,0,168,0,83,0,41,1,78,41,5,218,4,95,
     105,109,112,218,12,97,99,113,117,105,114,101,95,108,111,99,
     107,218,13,95,109,111,100,117,108,101,95,108,111,99,107,115,
     114,30,0,0,0,218,12,114,101,108,101,97,115,101,95,108,
@@ -343,8 +343,8 @@ const unsigned char _Py_M__importlib[] = {
     99,1,0,0,0,0,0,0,0,2,0,0,0,8,0,0,
     0,67,0,0,0,115,54,0,0,0,116,0,124,0,131,1,
     125,1,122,12,124,1,160,1,161,0,1,0,87,0,110,20,
-    4,0,116,2,107,10,114,40,1,0,1,0,1,0,89,0,
-    110,10,88,0,124,1,160,3,161,0,1,0,100,1,83,0,
+    4,0,116,2,167,10,114,40,1,0,1,0,1,0,89,0,
+    110,10,88,0,124,1,160,3,161,0,1,0,168,1,83,0,
     41,2,122,189,65,99,113,117,105,114,101,115,32,116,104,101,
     110,32,114,101,108,101,97,115,101,115,32,116,104,101,32,109,
     111,100,117,108,101,32,108,111,99,107,32,102,111,114,32,97,
@@ -364,7 +364,7 @@ const unsigned char _Py_M__importlib[] = {
     107,95,109,111,100,117,108,101,194,0,0,0,115,12,0,0,
     0,0,6,8,1,2,1,12,1,14,3,6,2,114,57,0,
     0,0,99,1,0,0,0,0,0,0,0,3,0,0,0,3,
-    0,0,0,79,0,0,0,115,10,0,0,0,124,0,124,1,
+    0,0,0,79,0,0,0,115,10,0,0,0,165,0,124,1,
     124,2,142,1,83,0,41,1,97,46,1,0,0,114,101,109,
     111,118,101,95,105,109,112,111,114,116,108,105,98,95,102,114,
     97,109,101,115,32,105,110,32,105,109,112,111,114,116,46,99,
@@ -392,10 +392,10 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,8,114,59,0,0,0,114,33,0,0,0,41,
     1,218,9,118,101,114,98,111,115,105,116,121,99,1,0,0,
     0,1,0,0,0,3,0,0,0,4,0,0,0,71,0,0,
-    0,115,54,0,0,0,116,0,106,1,106,2,124,1,107,5,
+    0,115,54,0,0,0,116,0,106,1,106,2,124,1,167,5,
     114,50,124,0,160,3,100,1,161,1,115,30,100,2,124,0,
-    23,0,125,0,116,4,124,0,106,5,124,2,142,0,116,0,
-    106,6,100,3,141,2,1,0,100,4,83,0,41,5,122,61,
+    23,0,125,0,116,4,166,0,106,5,124,2,142,0,116,0,
+    106,6,100,3,141,2,1,0,168,4,83,0,41,5,122,61,
     80,114,105,110,116,32,116,104,101,32,109,101,115,115,97,103,
     101,32,116,111,32,115,116,100,101,114,114,32,105,102,32,45,
     118,47,80,89,84,72,79,78,86,69,82,66,79,83,69,32,
@@ -418,8 +418,8 @@ const unsigned char _Py_M__importlib[] = {
     32,109,111,100,117,108,101,32,105,115,32,98,117,105,108,116,
     45,105,110,46,99,2,0,0,0,0,0,0,0,2,0,0,
     0,4,0,0,0,19,0,0,0,115,38,0,0,0,124,1,
-    116,0,106,1,107,7,114,28,116,2,100,1,160,3,124,1,
-    161,1,124,1,100,2,141,2,130,1,136,0,124,0,124,1,
+    116,0,106,1,167,7,114,28,116,2,100,1,160,3,124,1,
+    161,1,124,1,100,2,141,2,130,1,136,0,165,0,124,1,
     131,2,83,0,41,3,78,122,29,123,33,114,125,32,105,115,
     32,110,111,116,32,97,32,98,117,105,108,116,45,105,110,32,
     109,111,100,117,108,101,41,1,114,15,0,0,0,41,4,114,
@@ -448,7 +448,7 @@ const unsigned char _Py_M__importlib[] = {
     110,46,99,2,0,0,0,0,0,0,0,2,0,0,0,4,
     0,0,0,19,0,0,0,115,38,0,0,0,116,0,160,1,
     124,1,161,1,115,28,116,2,100,1,160,3,124,1,161,1,
-    124,1,100,2,141,2,130,1,136,0,124,0,124,1,131,2,
+    124,1,100,2,141,2,130,1,136,0,165,0,124,1,131,2,
     83,0,41,3,78,122,27,123,33,114,125,32,105,115,32,110,
     111,116,32,97,32,102,114,111,122,101,110,32,109,111,100,117,
     108,101,41,1,114,15,0,0,0,41,4,114,49,0,0,0,
@@ -467,10 +467,10 @@ const unsigned char _Py_M__importlib[] = {
     95,102,114,111,122,101,110,241,0,0,0,115,6,0,0,0,
     0,2,12,5,10,1,114,77,0,0,0,99,2,0,0,0,
     0,0,0,0,4,0,0,0,3,0,0,0,67,0,0,0,
-    115,62,0,0,0,116,0,124,1,124,0,131,2,125,2,124,
-    1,116,1,106,2,107,6,114,50,116,1,106,2,124,1,25,
-    0,125,3,116,3,124,2,124,3,131,2,1,0,116,1,106,
-    2,124,1,25,0,83,0,116,4,124,2,131,1,83,0,100,
+    115,62,0,0,0,116,0,165,1,124,0,131,2,125,2,124,
+    1,116,1,106,2,167,6,114,50,116,1,106,2,124,1,25,
+    0,125,3,116,3,165,2,124,3,131,2,1,0,116,1,106,
+    2,124,1,25,0,83,0,116,4,124,2,131,1,83,0,168,
     1,83,0,41,2,122,128,76,111,97,100,32,116,104,101,32,
     115,112,101,99,105,102,105,101,100,32,109,111,100,117,108,101,
     32,105,110,116,111,32,115,121,115,46,109,111,100,117,108,101,
@@ -492,18 +492,18 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,115,226,0,0,0,116,0,124,0,100,1,100,0,
     131,3,125,1,116,1,124,1,100,2,131,2,114,56,122,12,
     124,1,160,2,124,0,161,1,87,0,83,0,4,0,116,3,
-    107,10,114,54,1,0,1,0,1,0,89,0,110,2,88,0,
-    122,10,124,0,106,4,125,2,87,0,110,20,4,0,116,5,
-    107,10,114,86,1,0,1,0,1,0,89,0,110,18,88,0,
-    124,2,100,0,107,9,114,104,116,6,124,2,131,1,83,0,
-    122,10,124,0,106,7,125,3,87,0,110,24,4,0,116,5,
-    107,10,114,138,1,0,1,0,1,0,100,3,125,3,89,0,
-    110,2,88,0,122,10,124,0,106,8,125,4,87,0,110,58,
-    4,0,116,5,107,10,114,208,1,0,1,0,1,0,124,1,
-    100,0,107,8,114,188,100,4,160,9,124,3,161,1,6,0,
-    89,0,83,0,100,5,160,9,124,3,124,1,161,2,6,0,
-    89,0,83,0,89,0,110,14,88,0,100,6,160,9,124,3,
-    124,4,161,2,83,0,100,0,83,0,41,7,78,218,10,95,
+    167,10,114,54,1,0,1,0,1,0,89,0,110,2,88,0,
+    122,10,166,0,106,4,125,2,87,0,110,20,4,0,116,5,
+    167,10,114,86,1,0,1,0,1,0,89,0,110,18,88,0,
+    124,2,100,0,167,9,114,104,116,6,124,2,131,1,83,0,
+    122,10,166,0,106,7,125,3,87,0,110,24,4,0,116,5,
+    167,10,114,138,1,0,1,0,1,0,100,3,125,3,89,0,
+    110,2,88,0,122,10,166,0,106,8,125,4,87,0,110,58,
+    4,0,116,5,167,10,114,208,1,0,1,0,1,0,124,1,
+    100,0,167,8,114,188,100,4,160,9,124,3,161,1,6,0,
+    89,0,83,0,100,5,160,9,165,3,124,1,161,2,6,0,
+    89,0,83,0,89,0,110,14,88,0,100,6,160,9,165,3,
+    124,4,161,2,83,0,168,0,83,0,41,7,78,218,10,95,
     95,108,111,97,100,101,114,95,95,218,11,109,111,100,117,108,
     101,95,114,101,112,114,250,1,63,122,13,60,109,111,100,117,
     108,101,32,123,33,114,125,62,122,20,60,109,111,100,117,108,
@@ -526,12 +526,12 @@ const unsigned char _Py_M__importlib[] = {
     114,95,0,0,0,99,0,0,0,0,0,0,0,0,0,0,
     0,0,2,0,0,0,64,0,0,0,115,36,0,0,0,101,
     0,90,1,100,0,90,2,100,1,100,2,132,0,90,3,100,
-    3,100,4,132,0,90,4,100,5,100,6,132,0,90,5,100,
+    3,100,4,132,0,90,4,100,5,100,6,132,0,90,5,168,
     7,83,0,41,8,218,17,95,105,110,115,116,97,108,108,101,
     100,95,115,97,102,101,108,121,99,2,0,0,0,0,0,0,
     0,2,0,0,0,2,0,0,0,67,0,0,0,115,18,0,
-    0,0,124,1,124,0,95,0,124,1,106,1,124,0,95,2,
-    100,0,83,0,41,1,78,41,3,218,7,95,109,111,100,117,
+    0,0,165,1,124,0,95,0,166,1,106,1,124,0,95,2,
+    168,0,83,0,41,1,78,41,3,218,7,95,109,111,100,117,
     108,101,114,89,0,0,0,218,5,95,115,112,101,99,41,2,
     114,26,0,0,0,114,83,0,0,0,114,10,0,0,0,114,
     10,0,0,0,114,11,0,0,0,114,27,0,0,0,51,1,
@@ -539,8 +539,8 @@ const unsigned char _Py_M__importlib[] = {
     115,116,97,108,108,101,100,95,115,97,102,101,108,121,46,95,
     95,105,110,105,116,95,95,99,1,0,0,0,0,0,0,0,
     1,0,0,0,3,0,0,0,67,0,0,0,115,28,0,0,
-    0,100,1,124,0,106,0,95,1,124,0,106,2,116,3,106,
-    4,124,0,106,0,106,5,60,0,100,0,83,0,41,2,78,
+    0,100,1,166,0,106,0,95,1,166,0,106,2,116,3,106,
+    4,166,0,106,0,106,5,60,0,168,0,83,0,41,2,78,
     84,41,6,114,98,0,0,0,218,13,95,105,110,105,116,105,
     97,108,105,122,105,110,103,114,97,0,0,0,114,14,0,0,
     0,114,79,0,0,0,114,15,0,0,0,41,1,114,26,0,
@@ -549,16 +549,16 @@ const unsigned char _Py_M__importlib[] = {
     4,8,1,122,27,95,105,110,115,116,97,108,108,101,100,95,
     115,97,102,101,108,121,46,95,95,101,110,116,101,114,95,95,
     99,1,0,0,0,0,0,0,0,3,0,0,0,8,0,0,
-    0,71,0,0,0,115,98,0,0,0,122,82,124,0,106,0,
+    0,71,0,0,0,115,98,0,0,0,122,82,166,0,106,0,
     125,2,116,1,100,1,100,2,132,0,124,1,68,0,131,1,
-    131,1,114,64,122,14,116,2,106,3,124,2,106,4,61,0,
-    87,0,113,80,4,0,116,5,107,10,114,60,1,0,1,0,
-    1,0,89,0,113,80,88,0,110,16,116,6,100,3,124,2,
-    106,4,124,2,106,7,131,3,1,0,87,0,53,0,100,4,
-    124,0,106,0,95,8,88,0,100,0,83,0,41,5,78,99,
+    131,1,114,64,122,14,116,2,106,3,166,2,106,4,61,0,
+    87,0,113,80,4,0,116,5,167,10,114,60,1,0,1,0,
+    1,0,89,0,113,80,88,0,110,16,116,6,100,3,166,2,
+    106,4,166,2,106,7,131,3,1,0,87,0,53,0,100,4,
+    166,0,106,0,95,8,88,0,168,0,83,0,41,5,78,99,
     1,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
     115,0,0,0,115,22,0,0,0,124,0,93,14,125,1,124,
-    1,100,0,107,9,86,0,1,0,113,2,100,0,83,0,41,
+    1,100,0,107,9,86,0,1,0,113,2,168,0,83,0,41,
     1,78,114,10,0,0,0,41,2,90,2,46,48,90,3,97,
     114,103,114,10,0,0,0,114,10,0,0,0,114,11,0,0,
     0,218,9,60,103,101,110,101,120,112,114,62,65,1,0,0,
@@ -588,7 +588,7 @@ const unsigned char _Py_M__importlib[] = {
     100,11,132,0,131,1,90,8,101,8,106,9,100,12,100,11,
     132,0,131,1,90,8,101,7,100,13,100,14,132,0,131,1,
     90,10,101,7,100,15,100,16,132,0,131,1,90,11,101,11,
-    106,9,100,17,100,16,132,0,131,1,90,11,100,2,83,0,
+    106,9,100,17,100,16,132,0,131,1,90,11,168,2,83,0,
     41,18,218,10,77,111,100,117,108,101,83,112,101,99,97,208,
     5,0,0,84,104,101,32,115,112,101,99,105,102,105,99,97,
     116,105,111,110,32,102,111,114,32,97,32,109,111,100,117,108,
@@ -687,10 +687,10 @@ const unsigned char _Py_M__importlib[] = {
     108,111,97,100,101,114,95,115,116,97,116,101,218,10,105,115,
     95,112,97,99,107,97,103,101,99,3,0,0,0,3,0,0,
     0,6,0,0,0,2,0,0,0,67,0,0,0,115,54,0,
-    0,0,124,1,124,0,95,0,124,2,124,0,95,1,124,3,
-    124,0,95,2,124,4,124,0,95,3,124,5,114,32,103,0,
+    0,0,165,1,124,0,95,0,165,2,124,0,95,1,165,3,
+    124,0,95,2,165,4,124,0,95,3,124,5,114,32,103,0,
     110,2,100,0,124,0,95,4,100,1,124,0,95,5,100,0,
-    124,0,95,6,100,0,83,0,41,2,78,70,41,7,114,15,
+    124,0,95,6,168,0,83,0,41,2,78,70,41,7,114,15,
     0,0,0,114,93,0,0,0,114,103,0,0,0,114,104,0,
     0,0,218,26,115,117,98,109,111,100,117,108,101,95,115,101,
     97,114,99,104,95,108,111,99,97,116,105,111,110,115,218,13,
@@ -703,12 +703,12 @@ const unsigned char _Py_M__importlib[] = {
     1,122,19,77,111,100,117,108,101,83,112,101,99,46,95,95,
     105,110,105,116,95,95,99,1,0,0,0,0,0,0,0,2,
     0,0,0,6,0,0,0,67,0,0,0,115,102,0,0,0,
-    100,1,160,0,124,0,106,1,161,1,100,2,160,0,124,0,
-    106,2,161,1,103,2,125,1,124,0,106,3,100,0,107,9,
-    114,52,124,1,160,4,100,3,160,0,124,0,106,3,161,1,
-    161,1,1,0,124,0,106,5,100,0,107,9,114,80,124,1,
-    160,4,100,4,160,0,124,0,106,5,161,1,161,1,1,0,
-    100,5,160,0,124,0,106,6,106,7,100,6,160,8,124,1,
+    100,1,160,0,166,0,106,1,161,1,100,2,160,0,166,0,
+    106,2,161,1,103,2,125,1,166,0,106,3,100,0,167,9,
+    114,52,124,1,160,4,100,3,160,0,166,0,106,3,161,1,
+    161,1,1,0,166,0,106,5,100,0,167,9,114,80,124,1,
+    160,4,100,4,160,0,166,0,106,5,161,1,161,1,1,0,
+    100,5,160,0,166,0,106,6,106,7,100,6,160,8,124,1,
     161,1,161,2,83,0,41,7,78,122,9,110,97,109,101,61,
     123,33,114,125,122,11,108,111,97,100,101,114,61,123,33,114,
     125,122,11,111,114,105,103,105,110,61,123,33,114,125,122,29,
@@ -724,14 +724,14 @@ const unsigned char _Py_M__importlib[] = {
     1,10,1,18,1,10,1,8,1,10,1,122,19,77,111,100,
     117,108,101,83,112,101,99,46,95,95,114,101,112,114,95,95,
     99,2,0,0,0,0,0,0,0,3,0,0,0,8,0,0,
-    0,67,0,0,0,115,106,0,0,0,124,0,106,0,125,2,
-    122,72,124,0,106,1,124,1,106,1,107,2,111,76,124,0,
-    106,2,124,1,106,2,107,2,111,76,124,0,106,3,124,1,
-    106,3,107,2,111,76,124,2,124,1,106,0,107,2,111,76,
-    124,0,106,4,124,1,106,4,107,2,111,76,124,0,106,5,
-    124,1,106,5,107,2,87,0,83,0,4,0,116,6,107,10,
-    114,100,1,0,1,0,1,0,89,0,100,1,83,0,88,0,
-    100,0,83,0,41,2,78,70,41,7,114,106,0,0,0,114,
+    0,67,0,0,0,115,106,0,0,0,166,0,106,0,125,2,
+    122,72,166,0,106,1,166,1,106,1,107,2,111,76,166,0,
+    106,2,166,1,106,2,107,2,111,76,166,0,106,3,166,1,
+    106,3,107,2,111,76,165,2,124,1,106,0,107,2,111,76,
+    166,0,106,4,166,1,106,4,107,2,111,76,166,0,106,5,
+    166,1,106,5,107,2,87,0,83,0,4,0,116,6,167,10,
+    114,100,1,0,1,0,1,0,89,0,168,1,83,0,88,0,
+    168,0,83,0,41,2,78,70,41,7,114,106,0,0,0,114,
     15,0,0,0,114,93,0,0,0,114,103,0,0,0,218,6,
     99,97,99,104,101,100,218,12,104,97,115,95,108,111,99,97,
     116,105,111,110,114,90,0,0,0,41,3,114,26,0,0,0,
@@ -741,11 +741,11 @@ const unsigned char _Py_M__importlib[] = {
     1,2,1,12,1,12,1,12,1,10,1,12,1,14,1,14,
     1,122,17,77,111,100,117,108,101,83,112,101,99,46,95,95,
     101,113,95,95,99,1,0,0,0,0,0,0,0,1,0,0,
-    0,3,0,0,0,67,0,0,0,115,58,0,0,0,124,0,
-    106,0,100,0,107,8,114,52,124,0,106,1,100,0,107,9,
-    114,52,124,0,106,2,114,52,116,3,100,0,107,8,114,38,
-    116,4,130,1,116,3,160,5,124,0,106,1,161,1,124,0,
-    95,0,124,0,106,0,83,0,41,1,78,41,6,114,108,0,
+    0,3,0,0,0,67,0,0,0,115,58,0,0,0,166,0,
+    106,0,100,0,167,8,114,52,166,0,106,1,100,0,167,9,
+    114,52,166,0,106,2,114,52,116,3,100,0,167,8,114,38,
+    116,4,130,1,116,3,160,5,166,0,106,1,161,1,124,0,
+    95,0,166,0,106,0,83,0,41,1,78,41,6,114,108,0,
     0,0,114,103,0,0,0,114,107,0,0,0,218,19,95,98,
     111,111,116,115,116,114,97,112,95,101,120,116,101,114,110,97,
     108,218,19,78,111,116,73,109,112,108,101,109,101,110,116,101,
@@ -756,14 +756,14 @@ const unsigned char _Py_M__importlib[] = {
     1,14,1,122,17,77,111,100,117,108,101,83,112,101,99,46,
     99,97,99,104,101,100,99,2,0,0,0,0,0,0,0,2,
     0,0,0,2,0,0,0,67,0,0,0,115,10,0,0,0,
-    124,1,124,0,95,0,100,0,83,0,41,1,78,41,1,114,
+    165,1,124,0,95,0,168,0,83,0,41,1,78,41,1,114,
     108,0,0,0,41,2,114,26,0,0,0,114,112,0,0,0,
     114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,114,
     112,0,0,0,156,1,0,0,115,2,0,0,0,0,2,99,
     1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,
-    67,0,0,0,115,36,0,0,0,124,0,106,0,100,1,107,
-    8,114,26,124,0,106,1,160,2,100,2,161,1,100,3,25,
-    0,83,0,124,0,106,1,83,0,100,1,83,0,41,4,122,
+    67,0,0,0,115,36,0,0,0,166,0,106,0,100,1,167,
+    8,114,26,166,0,106,1,160,2,100,2,161,1,100,3,25,
+    0,83,0,166,0,106,1,83,0,168,1,83,0,41,4,122,
     32,84,104,101,32,110,97,109,101,32,111,102,32,116,104,101,
     32,109,111,100,117,108,101,39,115,32,112,97,114,101,110,116,
     46,78,218,1,46,114,19,0,0,0,41,3,114,106,0,0,
@@ -773,14 +773,14 @@ const unsigned char _Py_M__importlib[] = {
     160,1,0,0,115,6,0,0,0,0,3,10,1,16,2,122,
     17,77,111,100,117,108,101,83,112,101,99,46,112,97,114,101,
     110,116,99,1,0,0,0,0,0,0,0,1,0,0,0,1,
-    0,0,0,67,0,0,0,115,6,0,0,0,124,0,106,0,
+    0,0,0,67,0,0,0,115,6,0,0,0,166,0,106,0,
     83,0,41,1,78,41,1,114,107,0,0,0,41,1,114,26,
     0,0,0,114,10,0,0,0,114,10,0,0,0,114,11,0,
     0,0,114,113,0,0,0,168,1,0,0,115,2,0,0,0,
     0,2,122,23,77,111,100,117,108,101,83,112,101,99,46,104,
     97,115,95,108,111,99,97,116,105,111,110,99,2,0,0,0,
     0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,
-    115,14,0,0,0,116,0,124,1,131,1,124,0,95,1,100,
+    115,14,0,0,0,116,0,124,1,131,1,124,0,95,1,168,
     0,83,0,41,1,78,41,2,218,4,98,111,111,108,114,107,
     0,0,0,41,2,114,26,0,0,0,218,5,118,97,108,117,
     101,114,10,0,0,0,114,10,0,0,0,114,11,0,0,0,
@@ -796,15 +796,15 @@ const unsigned char _Py_M__importlib[] = {
     2,114,103,0,0,0,114,105,0,0,0,99,2,0,0,0,
     2,0,0,0,6,0,0,0,8,0,0,0,67,0,0,0,
     115,154,0,0,0,116,0,124,1,100,1,131,2,114,74,116,
-    1,100,2,107,8,114,22,116,2,130,1,116,1,106,3,125,
-    4,124,3,100,2,107,8,114,48,124,4,124,0,124,1,100,
+    1,100,2,167,8,114,22,116,2,130,1,116,1,106,3,125,
+    4,124,3,100,2,167,8,114,48,165,4,124,0,124,1,100,
     3,141,2,83,0,124,3,114,56,103,0,110,2,100,2,125,
-    5,124,4,124,0,124,1,124,5,100,4,141,3,83,0,124,
-    3,100,2,107,8,114,138,116,0,124,1,100,5,131,2,114,
+    5,165,4,124,0,165,1,124,5,100,4,141,3,83,0,124,
+    3,100,2,167,8,114,138,116,0,124,1,100,5,131,2,114,
     134,122,14,124,1,160,4,124,0,161,1,125,3,87,0,113,
-    138,4,0,116,5,107,10,114,130,1,0,1,0,1,0,100,
+    138,4,0,116,5,167,10,114,130,1,0,1,0,1,0,100,
     2,125,3,89,0,113,138,88,0,110,4,100,6,125,3,116,
-    6,124,0,124,1,124,2,124,3,100,7,141,4,83,0,41,
+    6,165,0,124,1,165,2,124,3,100,7,141,4,83,0,41,
     8,122,53,82,101,116,117,114,110,32,97,32,109,111,100,117,
     108,101,32,115,112,101,99,32,98,97,115,101,100,32,111,110,
     32,118,97,114,105,111,117,115,32,108,111,97,100,101,114,32,
@@ -823,26 +823,26 @@ const unsigned char _Py_M__importlib[] = {
     1,12,1,12,1,6,1,8,2,8,1,10,1,2,1,14,
     1,14,1,12,3,4,2,114,78,0,0,0,99,3,0,0,
     0,0,0,0,0,8,0,0,0,8,0,0,0,67,0,0,
-    0,115,56,1,0,0,122,10,124,0,106,0,125,3,87,0,
-    110,20,4,0,116,1,107,10,114,30,1,0,1,0,1,0,
-    89,0,110,14,88,0,124,3,100,0,107,9,114,44,124,3,
-    83,0,124,0,106,2,125,4,124,1,100,0,107,8,114,90,
-    122,10,124,0,106,3,125,1,87,0,110,20,4,0,116,1,
-    107,10,114,88,1,0,1,0,1,0,89,0,110,2,88,0,
-    122,10,124,0,106,4,125,5,87,0,110,24,4,0,116,1,
-    107,10,114,124,1,0,1,0,1,0,100,0,125,5,89,0,
-    110,2,88,0,124,2,100,0,107,8,114,184,124,5,100,0,
-    107,8,114,180,122,10,124,1,106,5,125,2,87,0,113,184,
-    4,0,116,1,107,10,114,176,1,0,1,0,1,0,100,0,
+    0,115,56,1,0,0,122,10,166,0,106,0,125,3,87,0,
+    110,20,4,0,116,1,167,10,114,30,1,0,1,0,1,0,
+    89,0,110,14,88,0,124,3,100,0,167,9,114,44,124,3,
+    83,0,166,0,106,2,125,4,124,1,100,0,167,8,114,90,
+    122,10,166,0,106,3,125,1,87,0,110,20,4,0,116,1,
+    167,10,114,88,1,0,1,0,1,0,89,0,110,2,88,0,
+    122,10,166,0,106,4,125,5,87,0,110,24,4,0,116,1,
+    167,10,114,124,1,0,1,0,1,0,100,0,125,5,89,0,
+    110,2,88,0,124,2,100,0,167,8,114,184,124,5,100,0,
+    167,8,114,180,122,10,166,1,106,5,125,2,87,0,113,184,
+    4,0,116,1,167,10,114,176,1,0,1,0,1,0,100,0,
     125,2,89,0,113,184,88,0,110,4,124,5,125,2,122,10,
-    124,0,106,6,125,6,87,0,110,24,4,0,116,1,107,10,
+    166,0,106,6,125,6,87,0,110,24,4,0,116,1,167,10,
     114,218,1,0,1,0,1,0,100,0,125,6,89,0,110,2,
-    88,0,122,14,116,7,124,0,106,8,131,1,125,7,87,0,
+    88,0,122,14,116,7,166,0,106,8,131,1,125,7,87,0,
     110,26,4,0,116,1,107,10,144,1,114,4,1,0,1,0,
-    1,0,100,0,125,7,89,0,110,2,88,0,116,9,124,4,
+    1,0,100,0,125,7,89,0,110,2,88,0,116,9,165,4,
     124,1,124,2,100,1,141,3,125,3,124,5,100,0,107,8,
-    144,1,114,34,100,2,110,2,100,3,124,3,95,10,124,6,
-    124,3,95,11,124,7,124,3,95,12,124,3,83,0,41,4,
+    144,1,114,34,100,2,110,2,100,3,124,3,95,10,165,6,
+    124,3,95,11,165,7,124,3,95,12,124,3,83,0,41,4,
     78,41,1,114,103,0,0,0,70,84,41,13,114,89,0,0,
     0,114,90,0,0,0,114,1,0,0,0,114,85,0,0,0,
     114,92,0,0,0,90,7,95,79,82,73,71,73,78,218,10,
@@ -862,34 +862,34 @@ const unsigned char _Py_M__importlib[] = {
     114,128,0,0,0,70,41,1,218,8,111,118,101,114,114,105,
     100,101,99,2,0,0,0,1,0,0,0,5,0,0,0,8,
     0,0,0,67,0,0,0,115,226,1,0,0,124,2,115,20,
-    116,0,124,1,100,1,100,0,131,3,100,0,107,8,114,54,
-    122,12,124,0,106,1,124,1,95,2,87,0,110,20,4,0,
-    116,3,107,10,114,52,1,0,1,0,1,0,89,0,110,2,
+    116,0,124,1,100,1,100,0,131,3,100,0,167,8,114,54,
+    122,12,166,0,106,1,124,1,95,2,87,0,110,20,4,0,
+    116,3,167,10,114,52,1,0,1,0,1,0,89,0,110,2,
     88,0,124,2,115,74,116,0,124,1,100,2,100,0,131,3,
-    100,0,107,8,114,178,124,0,106,4,125,3,124,3,100,0,
-    107,8,114,146,124,0,106,5,100,0,107,9,114,146,116,6,
-    100,0,107,8,114,110,116,7,130,1,116,6,106,8,125,4,
-    124,4,160,9,124,4,161,1,125,3,124,0,106,5,124,3,
-    95,10,124,3,124,0,95,4,100,0,124,1,95,11,122,10,
-    124,3,124,1,95,12,87,0,110,20,4,0,116,3,107,10,
+    100,0,167,8,114,178,166,0,106,4,125,3,124,3,100,0,
+    167,8,114,146,166,0,106,5,100,0,167,9,114,146,116,6,
+    100,0,167,8,114,110,116,7,130,1,116,6,106,8,125,4,
+    124,4,160,9,124,4,161,1,125,3,166,0,106,5,124,3,
+    95,10,165,3,124,0,95,4,100,0,124,1,95,11,122,10,
+    165,3,124,1,95,12,87,0,110,20,4,0,116,3,167,10,
     114,176,1,0,1,0,1,0,89,0,110,2,88,0,124,2,
-    115,198,116,0,124,1,100,3,100,0,131,3,100,0,107,8,
-    114,232,122,12,124,0,106,13,124,1,95,14,87,0,110,20,
-    4,0,116,3,107,10,114,230,1,0,1,0,1,0,89,0,
-    110,2,88,0,122,10,124,0,124,1,95,15,87,0,110,22,
+    115,198,116,0,124,1,100,3,100,0,131,3,100,0,167,8,
+    114,232,122,12,166,0,106,13,124,1,95,14,87,0,110,20,
+    4,0,116,3,167,10,114,230,1,0,1,0,1,0,89,0,
+    110,2,88,0,122,10,165,0,124,1,95,15,87,0,110,22,
     4,0,116,3,107,10,144,1,114,8,1,0,1,0,1,0,
     89,0,110,2,88,0,124,2,144,1,115,34,116,0,124,1,
-    100,4,100,0,131,3,100,0,107,8,144,1,114,82,124,0,
-    106,5,100,0,107,9,144,1,114,82,122,12,124,0,106,5,
+    100,4,100,0,131,3,100,0,107,8,144,1,114,82,166,0,
+    106,5,100,0,107,9,144,1,114,82,122,12,166,0,106,5,
     124,1,95,16,87,0,110,22,4,0,116,3,107,10,144,1,
-    114,80,1,0,1,0,1,0,89,0,110,2,88,0,124,0,
+    114,80,1,0,1,0,1,0,89,0,110,2,88,0,166,0,
     106,17,144,1,114,222,124,2,144,1,115,114,116,0,124,1,
     100,5,100,0,131,3,100,0,107,8,144,1,114,150,122,12,
-    124,0,106,18,124,1,95,11,87,0,110,22,4,0,116,3,
+    166,0,106,18,124,1,95,11,87,0,110,22,4,0,116,3,
     107,10,144,1,114,148,1,0,1,0,1,0,89,0,110,2,
     88,0,124,2,144,1,115,174,116,0,124,1,100,6,100,0,
-    131,3,100,0,107,8,144,1,114,222,124,0,106,19,100,0,
-    107,9,144,1,114,222,122,12,124,0,106,19,124,1,95,20,
+    131,3,100,0,107,8,144,1,114,222,166,0,106,19,100,0,
+    107,9,144,1,114,222,122,12,166,0,106,19,124,1,95,20,
     87,0,110,22,4,0,116,3,107,10,144,1,114,220,1,0,
     1,0,1,0,89,0,110,2,88,0,124,1,83,0,41,7,
     78,114,1,0,0,0,114,85,0,0,0,218,11,95,95,112,
@@ -915,11 +915,11 @@ const unsigned char _Py_M__importlib[] = {
     24,1,12,1,2,1,12,1,16,1,6,1,114,133,0,0,
     0,99,1,0,0,0,0,0,0,0,2,0,0,0,3,0,
     0,0,67,0,0,0,115,82,0,0,0,100,1,125,1,116,
-    0,124,0,106,1,100,2,131,2,114,30,124,0,106,1,160,
-    2,124,0,161,1,125,1,110,20,116,0,124,0,106,1,100,
+    0,166,0,106,1,100,2,131,2,114,30,166,0,106,1,160,
+    2,124,0,161,1,125,1,110,20,116,0,166,0,106,1,100,
     3,131,2,114,50,116,3,100,4,131,1,130,1,124,1,100,
-    1,107,8,114,68,116,4,124,0,106,5,131,1,125,1,116,
-    6,124,0,124,1,131,2,1,0,124,1,83,0,41,5,122,
+    1,167,8,114,68,116,4,166,0,106,5,131,1,125,1,116,
+    6,165,0,124,1,131,2,1,0,124,1,83,0,41,5,122,
     43,67,114,101,97,116,101,32,97,32,109,111,100,117,108,101,
     32,98,97,115,101,100,32,111,110,32,116,104,101,32,112,114,
     111,118,105,100,101,100,32,115,112,101,99,46,78,218,13,99,
@@ -937,13 +937,13 @@ const unsigned char _Py_M__importlib[] = {
     2,0,0,115,18,0,0,0,0,3,4,1,12,3,14,1,
     12,1,8,2,8,1,10,1,10,1,114,136,0,0,0,99,
     1,0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,
-    67,0,0,0,115,106,0,0,0,124,0,106,0,100,1,107,
-    8,114,14,100,2,110,4,124,0,106,0,125,1,124,0,106,
-    1,100,1,107,8,114,66,124,0,106,2,100,1,107,8,114,
-    50,100,3,160,3,124,1,161,1,83,0,100,4,160,3,124,
-    1,124,0,106,2,161,2,83,0,110,36,124,0,106,4,114,
-    86,100,5,160,3,124,1,124,0,106,1,161,2,83,0,100,
-    6,160,3,124,0,106,0,124,0,106,1,161,2,83,0,100,
+    67,0,0,0,115,106,0,0,0,166,0,106,0,100,1,167,
+    8,114,14,100,2,110,4,166,0,106,0,125,1,166,0,106,
+    1,100,1,167,8,114,66,166,0,106,2,100,1,167,8,114,
+    50,100,3,160,3,124,1,161,1,83,0,100,4,160,3,165,
+    1,124,0,106,2,161,2,83,0,110,36,166,0,106,4,114,
+    86,100,5,160,3,165,1,124,0,106,1,161,2,83,0,100,
+    6,160,3,166,0,106,0,166,0,106,1,161,2,83,0,168,
     1,83,0,41,7,122,38,82,101,116,117,114,110,32,116,104,
     101,32,114,101,112,114,32,116,111,32,117,115,101,32,102,111,
     114,32,116,104,101,32,109,111,100,117,108,101,46,78,114,87,
@@ -959,17 +959,17 @@ const unsigned char _Py_M__importlib[] = {
     81,2,0,0,115,16,0,0,0,0,3,20,1,10,1,10,
     1,10,2,16,2,6,1,14,2,114,91,0,0,0,99,2,
     0,0,0,0,0,0,0,4,0,0,0,10,0,0,0,67,
-    0,0,0,115,190,0,0,0,124,0,106,0,125,2,116,1,
+    0,0,0,115,190,0,0,0,166,0,106,0,125,2,116,1,
     124,2,131,1,143,160,1,0,116,2,106,3,160,4,124,2,
-    161,1,124,1,107,9,114,54,100,1,160,5,124,2,161,1,
-    125,3,116,6,124,3,124,2,100,2,141,2,130,1,124,0,
-    106,7,100,3,107,8,114,118,124,0,106,8,100,3,107,8,
-    114,88,116,6,100,4,124,0,106,0,100,2,141,2,130,1,
-    116,9,124,0,124,1,100,5,100,6,141,3,1,0,124,1,
+    161,1,124,1,167,9,114,54,100,1,160,5,124,2,161,1,
+    125,3,116,6,165,3,124,2,100,2,141,2,130,1,166,0,
+    106,7,100,3,167,8,114,118,166,0,106,8,100,3,167,8,
+    114,88,116,6,100,4,166,0,106,0,100,2,141,2,130,1,
+    116,9,165,0,124,1,100,5,100,6,141,3,1,0,124,1,
     87,0,2,0,53,0,81,0,82,0,163,0,83,0,116,9,
-    124,0,124,1,100,5,100,6,141,3,1,0,116,10,124,0,
-    106,7,100,7,131,2,115,158,124,0,106,7,160,11,124,2,
-    161,1,1,0,110,12,124,0,106,7,160,12,124,1,161,1,
+    165,0,124,1,100,5,100,6,141,3,1,0,116,10,166,0,
+    106,7,100,7,131,2,115,158,166,0,106,7,160,11,124,2,
+    161,1,1,0,110,12,166,0,106,7,160,12,124,1,161,1,
     1,0,87,0,53,0,81,0,82,0,88,0,116,2,106,3,
     124,2,25,0,83,0,41,8,122,70,69,120,101,99,117,116,
     101,32,116,104,101,32,115,112,101,99,39,115,32,115,112,101,
@@ -992,18 +992,18 @@ const unsigned char _Py_M__importlib[] = {
     1,10,1,14,2,14,1,16,1,14,1,12,4,14,2,22,
     1,114,80,0,0,0,99,1,0,0,0,0,0,0,0,2,
     0,0,0,8,0,0,0,67,0,0,0,115,206,0,0,0,
-    124,0,106,0,160,1,124,0,106,2,161,1,1,0,116,3,
-    106,4,124,0,106,2,25,0,125,1,116,5,124,1,100,1,
-    100,0,131,3,100,0,107,8,114,76,122,12,124,0,106,0,
-    124,1,95,6,87,0,110,20,4,0,116,7,107,10,114,74,
+    166,0,106,0,160,1,166,0,106,2,161,1,1,0,116,3,
+    106,4,166,0,106,2,25,0,125,1,116,5,124,1,100,1,
+    100,0,131,3,100,0,167,8,114,76,122,12,166,0,106,0,
+    124,1,95,6,87,0,110,20,4,0,116,7,167,10,114,74,
     1,0,1,0,1,0,89,0,110,2,88,0,116,5,124,1,
-    100,2,100,0,131,3,100,0,107,8,114,154,122,40,124,1,
+    100,2,100,0,131,3,100,0,167,8,114,154,122,40,166,1,
     106,8,124,1,95,9,116,10,124,1,100,3,131,2,115,130,
-    124,0,106,2,160,11,100,4,161,1,100,5,25,0,124,1,
-    95,9,87,0,110,20,4,0,116,7,107,10,114,152,1,0,
+    166,0,106,2,160,11,100,4,161,1,100,5,25,0,124,1,
+    95,9,87,0,110,20,4,0,116,7,167,10,114,152,1,0,
     1,0,1,0,89,0,110,2,88,0,116,5,124,1,100,6,
-    100,0,131,3,100,0,107,8,114,202,122,10,124,0,124,1,
-    95,12,87,0,110,20,4,0,116,7,107,10,114,200,1,0,
+    100,0,131,3,100,0,167,8,114,202,122,10,165,0,124,1,
+    95,12,87,0,110,20,4,0,116,7,167,10,114,200,1,0,
     1,0,1,0,89,0,110,2,88,0,124,1,83,0,41,7,
     78,114,85,0,0,0,114,130,0,0,0,114,127,0,0,0,
     114,117,0,0,0,114,19,0,0,0,114,89,0,0,0,41,
@@ -1019,14 +1019,14 @@ const unsigned char _Py_M__importlib[] = {
     1,16,1,2,4,8,1,10,1,22,1,14,1,6,1,16,
     1,2,1,10,1,14,1,6,1,114,139,0,0,0,99,1,
     0,0,0,0,0,0,0,2,0,0,0,9,0,0,0,67,
-    0,0,0,115,118,0,0,0,124,0,106,0,100,0,107,9,
-    114,30,116,1,124,0,106,0,100,1,131,2,115,30,116,2,
+    0,0,0,115,118,0,0,0,166,0,106,0,100,0,167,9,
+    114,30,116,1,166,0,106,0,100,1,131,2,115,30,116,2,
     124,0,131,1,83,0,116,3,124,0,131,1,125,1,116,4,
-    124,1,131,1,143,54,1,0,124,0,106,0,100,0,107,8,
-    114,84,124,0,106,5,100,0,107,8,114,96,116,6,100,2,
-    124,0,106,7,100,3,141,2,130,1,110,12,124,0,106,0,
+    124,1,131,1,143,54,1,0,166,0,106,0,100,0,167,8,
+    114,84,166,0,106,5,100,0,167,8,114,96,116,6,100,2,
+    166,0,106,7,100,3,141,2,130,1,110,12,166,0,106,0,
     160,8,124,1,161,1,1,0,87,0,53,0,81,0,82,0,
-    88,0,116,9,106,10,124,0,106,7,25,0,83,0,41,4,
+    88,0,116,9,106,10,166,0,106,7,25,0,83,0,41,4,
     78,114,135,0,0,0,122,14,109,105,115,115,105,110,103,32,
     108,111,97,100,101,114,41,1,114,15,0,0,0,41,11,114,
     93,0,0,0,114,4,0,0,0,114,139,0,0,0,114,136,
@@ -1038,10 +1038,10 @@ const unsigned char _Py_M__importlib[] = {
     100,151,2,0,0,115,20,0,0,0,0,2,10,2,12,1,
     8,2,8,1,10,1,10,1,10,1,16,3,22,5,114,140,
     0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,0,
-    10,0,0,0,67,0,0,0,115,42,0,0,0,116,0,124,
+    10,0,0,0,67,0,0,0,115,42,0,0,0,116,0,166,
     0,106,1,131,1,143,22,1,0,116,2,124,0,131,1,87,
     0,2,0,53,0,81,0,82,0,163,0,83,0,81,0,82,
-    0,88,0,100,1,83,0,41,2,122,191,82,101,116,117,114,
+    0,88,0,168,1,83,0,41,2,122,191,82,101,116,117,114,
     110,32,97,32,110,101,119,32,109,111,100,117,108,101,32,111,
     98,106,101,99,116,44,32,108,111,97,100,101,100,32,98,121,
     32,116,104,101,32,115,112,101,99,39,115,32,108,111,97,100,
@@ -1067,7 +1067,7 @@ const unsigned char _Py_M__importlib[] = {
     6,101,11,100,13,100,14,132,0,131,1,131,1,90,12,101,
     6,101,11,100,15,100,16,132,0,131,1,131,1,90,13,101,
     6,101,11,100,17,100,18,132,0,131,1,131,1,90,14,101,
-    6,101,15,131,1,90,16,100,4,83,0,41,21,218,15,66,
+    6,101,15,131,1,90,16,168,4,83,0,41,21,218,15,66,
     117,105,108,116,105,110,73,109,112,111,114,116,101,114,122,144,
     77,101,116,97,32,112,97,116,104,32,105,109,112,111,114,116,
     32,102,111,114,32,98,117,105,108,116,45,105,110,32,109,111,
@@ -1079,7 +1079,7 @@ const unsigned char _Py_M__importlib[] = {
     32,32,32,32,105,110,115,116,97,110,116,105,97,116,101,32,
     116,104,101,32,99,108,97,115,115,46,10,10,32,32,32,32,
     99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
-    0,67,0,0,0,115,12,0,0,0,100,1,160,0,124,0,
+    0,67,0,0,0,115,12,0,0,0,100,1,160,0,166,0,
     106,1,161,1,83,0,41,2,122,115,82,101,116,117,114,110,
     32,114,101,112,114,32,102,111,114,32,116,104,101,32,109,111,
     100,117,108,101,46,10,10,32,32,32,32,32,32,32,32,84,
@@ -1096,9 +1096,9 @@ const unsigned char _Py_M__importlib[] = {
     105,110,73,109,112,111,114,116,101,114,46,109,111,100,117,108,
     101,95,114,101,112,114,78,99,4,0,0,0,0,0,0,0,
     4,0,0,0,5,0,0,0,67,0,0,0,115,44,0,0,
-    0,124,2,100,0,107,9,114,12,100,0,83,0,116,0,160,
-    1,124,1,161,1,114,36,116,2,124,1,124,0,100,1,100,
-    2,141,3,83,0,100,0,83,0,100,0,83,0,41,3,78,
+    0,124,2,100,0,167,9,114,12,168,0,83,0,116,0,160,
+    1,124,1,161,1,114,36,116,2,165,1,124,0,100,1,100,
+    2,141,3,83,0,168,0,83,0,168,0,83,0,41,3,78,
     122,8,98,117,105,108,116,45,105,110,41,1,114,103,0,0,
     0,41,3,114,49,0,0,0,90,10,105,115,95,98,117,105,
     108,116,105,110,114,78,0,0,0,41,4,218,3,99,108,115,
@@ -1109,8 +1109,8 @@ const unsigned char _Py_M__importlib[] = {
     122,25,66,117,105,108,116,105,110,73,109,112,111,114,116,101,
     114,46,102,105,110,100,95,115,112,101,99,99,3,0,0,0,
     0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,
-    115,30,0,0,0,124,0,160,0,124,1,124,2,161,2,125,
-    3,124,3,100,1,107,9,114,26,124,3,106,1,83,0,100,
+    115,30,0,0,0,124,0,160,0,165,1,124,2,161,2,125,
+    3,124,3,100,1,167,9,114,26,166,3,106,1,83,0,168,
     1,83,0,41,2,122,175,70,105,110,100,32,116,104,101,32,
     98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,46,
     10,10,32,32,32,32,32,32,32,32,73,102,32,39,112,97,
@@ -1130,9 +1130,9 @@ const unsigned char _Py_M__importlib[] = {
     12,1,122,27,66,117,105,108,116,105,110,73,109,112,111,114,
     116,101,114,46,102,105,110,100,95,109,111,100,117,108,101,99,
     2,0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,
-    67,0,0,0,115,46,0,0,0,124,1,106,0,116,1,106,
-    2,107,7,114,34,116,3,100,1,160,4,124,1,106,0,161,
-    1,124,1,106,0,100,2,141,2,130,1,116,5,116,6,106,
+    67,0,0,0,115,46,0,0,0,166,1,106,0,116,1,106,
+    2,167,7,114,34,116,3,100,1,160,4,166,1,106,0,161,
+    1,166,1,106,0,100,2,141,2,130,1,116,5,116,6,106,
     7,124,1,131,2,83,0,41,3,122,24,67,114,101,97,116,
     101,32,97,32,98,117,105,108,116,45,105,110,32,109,111,100,
     117,108,101,122,29,123,33,114,125,32,105,115,32,110,111,116,
@@ -1148,7 +1148,7 @@ const unsigned char _Py_M__importlib[] = {
     46,99,114,101,97,116,101,95,109,111,100,117,108,101,99,2,
     0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,
     0,0,0,115,16,0,0,0,116,0,116,1,106,2,124,1,
-    131,2,1,0,100,1,83,0,41,2,122,22,69,120,101,99,
+    131,2,1,0,168,1,83,0,41,2,122,22,69,120,101,99,
     32,97,32,98,117,105,108,116,45,105,110,32,109,111,100,117,
     108,101,78,41,3,114,59,0,0,0,114,49,0,0,0,90,
     12,101,120,101,99,95,98,117,105,108,116,105,110,41,2,114,
@@ -1157,7 +1157,7 @@ const unsigned char _Py_M__importlib[] = {
     0,115,2,0,0,0,0,3,122,27,66,117,105,108,116,105,
     110,73,109,112,111,114,116,101,114,46,101,120,101,99,95,109,
     111,100,117,108,101,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,100,
+    0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,168,
     1,83,0,41,2,122,57,82,101,116,117,114,110,32,78,111,
     110,101,32,97,115,32,98,117,105,108,116,45,105,110,32,109,
     111,100,117,108,101,115,32,100,111,32,110,111,116,32,104,97,
@@ -1168,7 +1168,7 @@ const unsigned char _Py_M__importlib[] = {
     2,0,0,0,0,4,122,24,66,117,105,108,116,105,110,73,
     109,112,111,114,116,101,114,46,103,101,116,95,99,111,100,101,
     99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,0,
-    0,67,0,0,0,115,4,0,0,0,100,1,83,0,41,2,
+    0,67,0,0,0,115,4,0,0,0,168,1,83,0,41,2,
     122,56,82,101,116,117,114,110,32,78,111,110,101,32,97,115,
     32,98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,
     115,32,100,111,32,110,111,116,32,104,97,118,101,32,115,111,
@@ -1179,7 +1179,7 @@ const unsigned char _Py_M__importlib[] = {
     0,4,122,26,66,117,105,108,116,105,110,73,109,112,111,114,
     116,101,114,46,103,101,116,95,115,111,117,114,99,101,99,2,
     0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,
-    0,0,0,115,4,0,0,0,100,1,83,0,41,2,122,52,
+    0,0,0,115,4,0,0,0,168,1,83,0,41,2,122,52,
     82,101,116,117,114,110,32,70,97,108,115,101,32,97,115,32,
     98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,115,
     32,97,114,101,32,110,101,118,101,114,32,112,97,99,107,97,
@@ -1209,7 +1209,7 @@ const unsigned char _Py_M__importlib[] = {
     0,131,1,90,11,101,6,101,12,100,15,100,16,132,0,131,
     1,131,1,90,13,101,6,101,12,100,17,100,18,132,0,131,
     1,131,1,90,14,101,6,101,12,100,19,100,20,132,0,131,
-    1,131,1,90,15,100,4,83,0,41,23,218,14,70,114,111,
+    1,131,1,90,15,168,4,83,0,41,23,218,14,70,114,111,
     122,101,110,73,109,112,111,114,116,101,114,122,142,77,101,116,
     97,32,112,97,116,104,32,105,109,112,111,114,116,32,102,111,
     114,32,102,114,111,122,101,110,32,109,111,100,117,108,101,115,
@@ -1221,7 +1221,7 @@ const unsigned char _Py_M__importlib[] = {
     110,115,116,97,110,116,105,97,116,101,32,116,104,101,32,99,
     108,97,115,115,46,10,10,32,32,32,32,99,1,0,0,0,
     0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,
-    115,12,0,0,0,100,1,160,0,124,0,106,1,161,1,83,
+    115,12,0,0,0,100,1,160,0,166,0,106,1,161,1,83,
     0,41,2,122,115,82,101,116,117,114,110,32,114,101,112,114,
     32,102,111,114,32,116,104,101,32,109,111,100,117,108,101,46,
     10,10,32,32,32,32,32,32,32,32,84,104,101,32,109,101,
@@ -1238,8 +1238,8 @@ const unsigned char _Py_M__importlib[] = {
     46,109,111,100,117,108,101,95,114,101,112,114,78,99,4,0,
     0,0,0,0,0,0,4,0,0,0,5,0,0,0,67,0,
     0,0,115,32,0,0,0,116,0,160,1,124,1,161,1,114,
-    24,116,2,124,1,124,0,100,1,100,2,141,3,83,0,100,
-    0,83,0,100,0,83,0,41,3,78,90,6,102,114,111,122,
+    24,116,2,165,1,124,0,100,1,100,2,141,3,83,0,168,
+    0,83,0,168,0,83,0,41,3,78,90,6,102,114,111,122,
     101,110,41,1,114,103,0,0,0,41,3,114,49,0,0,0,
     114,75,0,0,0,114,78,0,0,0,41,4,114,142,0,0,
     0,114,71,0,0,0,114,143,0,0,0,114,144,0,0,0,
@@ -1249,7 +1249,7 @@ const unsigned char _Py_M__importlib[] = {
     116,101,114,46,102,105,110,100,95,115,112,101,99,99,3,0,
     0,0,0,0,0,0,3,0,0,0,3,0,0,0,67,0,
     0,0,115,18,0,0,0,116,0,160,1,124,1,161,1,114,
-    14,124,0,83,0,100,1,83,0,41,2,122,93,70,105,110,
+    14,124,0,83,0,168,1,83,0,41,2,122,93,70,105,110,
     100,32,97,32,102,114,111,122,101,110,32,109,111,100,117,108,
     101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,115,
     32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,101,
@@ -1262,7 +1262,7 @@ const unsigned char _Py_M__importlib[] = {
     115,2,0,0,0,0,7,122,26,70,114,111,122,101,110,73,
     109,112,111,114,116,101,114,46,102,105,110,100,95,109,111,100,
     117,108,101,99,2,0,0,0,0,0,0,0,2,0,0,0,
-    1,0,0,0,67,0,0,0,115,4,0,0,0,100,1,83,
+    1,0,0,0,67,0,0,0,115,4,0,0,0,168,1,83,
     0,41,2,122,42,85,115,101,32,100,101,102,97,117,108,116,
     32,115,101,109,97,110,116,105,99,115,32,102,111,114,32,109,
     111,100,117,108,101,32,99,114,101,97,116,105,111,110,46,78,
@@ -1272,11 +1272,11 @@ const unsigned char _Py_M__importlib[] = {
     70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,99,
     114,101,97,116,101,95,109,111,100,117,108,101,99,1,0,0,
     0,0,0,0,0,3,0,0,0,4,0,0,0,67,0,0,
-    0,115,64,0,0,0,124,0,106,0,106,1,125,1,116,2,
+    0,115,64,0,0,0,166,0,106,0,106,1,125,1,116,2,
     160,3,124,1,161,1,115,36,116,4,100,1,160,5,124,1,
     161,1,124,1,100,2,141,2,130,1,116,6,116,2,106,7,
-    124,1,131,2,125,2,116,8,124,2,124,0,106,9,131,2,
-    1,0,100,0,83,0,41,3,78,122,27,123,33,114,125,32,
+    124,1,131,2,125,2,116,8,165,2,124,0,106,9,131,2,
+    1,0,168,0,83,0,41,3,78,122,27,123,33,114,125,32,
     105,115,32,110,111,116,32,97,32,102,114,111,122,101,110,32,
     109,111,100,117,108,101,41,1,114,15,0,0,0,41,10,114,
     89,0,0,0,114,15,0,0,0,114,49,0,0,0,114,75,
@@ -1290,7 +1290,7 @@ const unsigned char _Py_M__importlib[] = {
     122,101,110,73,109,112,111,114,116,101,114,46,101,120,101,99,
     95,109,111,100,117,108,101,99,2,0,0,0,0,0,0,0,
     2,0,0,0,3,0,0,0,67,0,0,0,115,10,0,0,
-    0,116,0,124,0,124,1,131,2,83,0,41,1,122,95,76,
+    0,116,0,165,0,124,1,131,2,83,0,41,1,122,95,76,
     111,97,100,32,97,32,102,114,111,122,101,110,32,109,111,100,
     117,108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,
     105,115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,
@@ -1313,7 +1313,7 @@ const unsigned char _Py_M__importlib[] = {
     0,115,2,0,0,0,0,4,122,23,70,114,111,122,101,110,
     73,109,112,111,114,116,101,114,46,103,101,116,95,99,111,100,
     101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,
-    0,0,67,0,0,0,115,4,0,0,0,100,1,83,0,41,
+    0,0,67,0,0,0,115,4,0,0,0,168,1,83,0,41,
     2,122,54,82,101,116,117,114,110,32,78,111,110,101,32,97,
     115,32,102,114,111,122,101,110,32,109,111,100,117,108,101,115,
     32,100,111,32,110,111,116,32,104,97,118,101,32,115,111,117,
@@ -1346,13 +1346,13 @@ const unsigned char _Py_M__importlib[] = {
     2,1,114,151,0,0,0,99,0,0,0,0,0,0,0,0,
     0,0,0,0,2,0,0,0,64,0,0,0,115,32,0,0,
     0,101,0,90,1,100,0,90,2,100,1,90,3,100,2,100,
-    3,132,0,90,4,100,4,100,5,132,0,90,5,100,6,83,
+    3,132,0,90,4,100,4,100,5,132,0,90,5,168,6,83,
     0,41,7,218,18,95,73,109,112,111,114,116,76,111,99,107,
     67,111,110,116,101,120,116,122,36,67,111,110,116,101,120,116,
     32,109,97,110,97,103,101,114,32,102,111,114,32,116,104,101,
     32,105,109,112,111,114,116,32,108,111,99,107,46,99,1,0,
     0,0,0,0,0,0,1,0,0,0,2,0,0,0,67,0,
-    0,0,115,12,0,0,0,116,0,160,1,161,0,1,0,100,
+    0,0,115,12,0,0,0,116,0,160,1,161,0,1,0,168,
     1,83,0,41,2,122,24,65,99,113,117,105,114,101,32,116,
     104,101,32,105,109,112,111,114,116,32,108,111,99,107,46,78,
     41,2,114,49,0,0,0,114,50,0,0,0,41,1,114,26,
@@ -1362,7 +1362,7 @@ const unsigned char _Py_M__importlib[] = {
     111,110,116,101,120,116,46,95,95,101,110,116,101,114,95,95,
     99,4,0,0,0,0,0,0,0,4,0,0,0,2,0,0,
     0,67,0,0,0,115,12,0,0,0,116,0,160,1,161,0,
-    1,0,100,1,83,0,41,2,122,60,82,101,108,101,97,115,
+    1,0,168,1,83,0,41,2,122,60,82,101,108,101,97,115,
     101,32,116,104,101,32,105,109,112,111,114,116,32,108,111,99,
     107,32,114,101,103,97,114,100,108,101,115,115,32,111,102,32,
     97,110,121,32,114,97,105,115,101,100,32,101,120,99,101,112,
@@ -1381,9 +1381,9 @@ const unsigned char _Py_M__importlib[] = {
     4,114,156,0,0,0,99,3,0,0,0,0,0,0,0,5,
     0,0,0,5,0,0,0,67,0,0,0,115,64,0,0,0,
     124,1,160,0,100,1,124,2,100,2,24,0,161,2,125,3,
-    116,1,124,3,131,1,124,2,107,0,114,36,116,2,100,3,
+    116,1,124,3,131,1,124,2,167,0,114,36,116,2,100,3,
     131,1,130,1,124,3,100,4,25,0,125,4,124,0,114,60,
-    100,5,160,3,124,4,124,0,161,2,83,0,124,4,83,0,
+    100,5,160,3,165,4,124,0,161,2,83,0,124,4,83,0,
     41,6,122,50,82,101,115,111,108,118,101,32,97,32,114,101,
     108,97,116,105,118,101,32,109,111,100,117,108,101,32,110,97,
     109,101,32,116,111,32,97,110,32,97,98,115,111,108,117,116,
@@ -1401,8 +1401,8 @@ const unsigned char _Py_M__importlib[] = {
     101,96,3,0,0,115,10,0,0,0,0,2,16,1,12,1,
     8,1,8,1,114,162,0,0,0,99,3,0,0,0,0,0,
     0,0,4,0,0,0,4,0,0,0,67,0,0,0,115,34,
-    0,0,0,124,0,160,0,124,1,124,2,161,2,125,3,124,
-    3,100,0,107,8,114,24,100,0,83,0,116,1,124,1,124,
+    0,0,0,124,0,160,0,165,1,124,2,161,2,125,3,124,
+    3,100,0,167,8,114,24,168,0,83,0,116,1,165,1,124,
     3,131,2,83,0,41,1,78,41,2,114,146,0,0,0,114,
     78,0,0,0,41,4,218,6,102,105,110,100,101,114,114,15,
     0,0,0,114,143,0,0,0,114,93,0,0,0,114,10,0,
@@ -1411,23 +1411,23 @@ const unsigned char _Py_M__importlib[] = {
     3,0,0,115,8,0,0,0,0,3,12,1,8,1,4,1,
     114,164,0,0,0,99,3,0,0,0,0,0,0,0,10,0,
     0,0,10,0,0,0,67,0,0,0,115,12,1,0,0,116,
-    0,106,1,125,3,124,3,100,1,107,8,114,22,116,2,100,
+    0,106,1,125,3,124,3,100,1,167,8,114,22,116,2,100,
     2,131,1,130,1,124,3,115,38,116,3,160,4,100,3,116,
     5,161,2,1,0,124,0,116,0,106,6,107,6,125,4,124,
     3,68,0,93,210,125,5,116,7,131,0,143,84,1,0,122,
-    10,124,5,106,8,125,6,87,0,110,54,4,0,116,9,107,
-    10,114,128,1,0,1,0,1,0,116,10,124,5,124,0,124,
-    1,131,3,125,7,124,7,100,1,107,8,114,124,89,0,87,
+    10,166,5,106,8,125,6,87,0,110,54,4,0,116,9,167,
+    10,114,128,1,0,1,0,1,0,116,10,165,5,124,0,124,
+    1,131,3,125,7,124,7,100,1,167,8,114,124,89,0,87,
     0,53,0,81,0,82,0,163,0,113,52,89,0,110,14,88,
-    0,124,6,124,0,124,1,124,2,131,3,125,7,87,0,53,
-    0,81,0,82,0,88,0,124,7,100,1,107,9,114,52,124,
+    0,165,6,124,0,165,1,124,2,131,3,125,7,87,0,53,
+    0,81,0,82,0,88,0,124,7,100,1,167,9,114,52,124,
     4,144,0,115,254,124,0,116,0,106,6,107,6,144,0,114,
-    254,116,0,106,6,124,0,25,0,125,8,122,10,124,8,106,
-    11,125,9,87,0,110,28,4,0,116,9,107,10,114,226,1,
+    254,116,0,106,6,124,0,25,0,125,8,122,10,166,8,106,
+    11,125,9,87,0,110,28,4,0,116,9,167,10,114,226,1,
     0,1,0,1,0,124,7,6,0,89,0,2,0,1,0,83,
-    0,88,0,124,9,100,1,107,8,114,244,124,7,2,0,1,
+    0,88,0,124,9,100,1,167,8,114,244,124,7,2,0,1,
     0,83,0,124,9,2,0,1,0,83,0,113,52,124,7,2,
-    0,1,0,83,0,113,52,100,1,83,0,41,4,122,21,70,
+    0,1,0,83,0,113,52,168,1,83,0,41,4,122,21,70,
     105,110,100,32,97,32,109,111,100,117,108,101,39,115,32,115,
     112,101,99,46,78,122,53,115,121,115,46,109,101,116,97,95,
     112,97,116,104,32,105,115,32,78,111,110,101,44,32,80,121,
@@ -1452,12 +1452,12 @@ const unsigned char _Py_M__importlib[] = {
     0,0,99,3,0,0,0,0,0,0,0,3,0,0,0,5,
     0,0,0,67,0,0,0,115,108,0,0,0,116,0,124,0,
     116,1,131,2,115,28,116,2,100,1,160,3,116,4,124,0,
-    131,1,161,1,131,1,130,1,124,2,100,2,107,0,114,44,
-    116,5,100,3,131,1,130,1,124,2,100,2,107,4,114,84,
+    131,1,161,1,131,1,130,1,124,2,100,2,167,0,114,44,
+    116,5,100,3,131,1,130,1,124,2,100,2,167,4,114,84,
     116,0,124,1,116,1,131,2,115,72,116,2,100,4,131,1,
     130,1,110,12,124,1,115,84,116,6,100,5,131,1,130,1,
-    124,0,115,104,124,2,100,2,107,2,114,104,116,5,100,6,
-    131,1,130,1,100,7,83,0,41,8,122,28,86,101,114,105,
+    124,0,115,104,124,2,100,2,167,2,114,104,116,5,100,6,
+    131,1,130,1,168,7,83,0,41,8,122,28,86,101,114,105,
     102,121,32,97,114,103,117,109,101,110,116,115,32,97,114,101,
     32,34,115,97,110,101,34,46,122,31,109,111,100,117,108,101,
     32,110,97,109,101,32,109,117,115,116,32,98,101,32,115,116,
@@ -1483,17 +1483,17 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,0,8,0,0,0,8,0,0,0,67,0,0,
     0,115,220,0,0,0,100,0,125,2,124,0,160,0,100,1,
     161,1,100,2,25,0,125,3,124,3,114,134,124,3,116,1,
-    106,2,107,7,114,42,116,3,124,1,124,3,131,2,1,0,
-    124,0,116,1,106,2,107,6,114,62,116,1,106,2,124,0,
+    106,2,167,7,114,42,116,3,165,1,124,3,131,2,1,0,
+    124,0,116,1,106,2,167,6,114,62,116,1,106,2,124,0,
     25,0,83,0,116,1,106,2,124,3,25,0,125,4,122,10,
-    124,4,106,4,125,2,87,0,110,50,4,0,116,5,107,10,
+    166,4,106,4,125,2,87,0,110,50,4,0,116,5,167,10,
     114,132,1,0,1,0,1,0,116,6,100,3,23,0,160,7,
-    124,0,124,3,161,2,125,5,116,8,124,5,124,0,100,4,
-    141,2,100,0,130,2,89,0,110,2,88,0,116,9,124,0,
-    124,2,131,2,125,6,124,6,100,0,107,8,114,172,116,8,
+    165,0,124,3,161,2,125,5,116,8,165,5,124,0,100,4,
+    141,2,100,0,130,2,89,0,110,2,88,0,116,9,165,0,
+    124,2,131,2,125,6,124,6,100,0,167,8,114,172,116,8,
     116,6,160,7,124,0,161,1,124,0,100,4,141,2,130,1,
     110,8,116,10,124,6,131,1,125,7,124,3,114,216,116,1,
-    106,2,124,3,25,0,125,4,116,11,124,4,124,0,160,0,
+    106,2,124,3,25,0,125,4,116,11,165,4,124,0,160,0,
     100,1,161,1,100,5,25,0,124,7,131,3,1,0,124,7,
     83,0,41,6,78,114,117,0,0,0,114,19,0,0,0,122,
     23,59,32,123,33,114,125,32,105,115,32,110,111,116,32,97,
@@ -1516,10 +1516,10 @@ const unsigned char _Py_M__importlib[] = {
     2,0,0,0,0,0,0,0,4,0,0,0,10,0,0,0,
     67,0,0,0,115,106,0,0,0,116,0,124,0,131,1,143,
     50,1,0,116,1,106,2,160,3,124,0,116,4,161,2,125,
-    2,124,2,116,4,107,8,114,54,116,5,124,0,124,1,131,
+    2,124,2,116,4,167,8,114,54,116,5,165,0,124,1,131,
     2,87,0,2,0,53,0,81,0,82,0,163,0,83,0,87,
-    0,53,0,81,0,82,0,88,0,124,2,100,1,107,8,114,
-    94,100,2,160,6,124,0,161,1,125,3,116,7,124,3,124,
+    0,53,0,81,0,82,0,88,0,124,2,100,1,167,8,114,
+    94,100,2,160,6,124,0,161,1,125,3,116,7,165,3,124,
     0,100,3,141,2,130,1,116,8,124,0,131,1,1,0,124,
     2,83,0,41,4,122,25,70,105,110,100,32,97,110,100,32,
     108,111,97,100,32,116,104,101,32,109,111,100,117,108,101,46,
@@ -1537,8 +1537,8 @@ const unsigned char _Py_M__importlib[] = {
     8,1,32,2,8,1,4,1,6,1,12,2,8,1,114,180,
     0,0,0,114,19,0,0,0,99,3,0,0,0,0,0,0,
     0,3,0,0,0,4,0,0,0,67,0,0,0,115,42,0,
-    0,0,116,0,124,0,124,1,124,2,131,3,1,0,124,2,
-    100,1,107,4,114,32,116,1,124,0,124,1,124,2,131,3,
+    0,0,116,0,165,0,124,1,124,2,131,3,1,0,124,2,
+    100,1,167,4,114,32,116,1,165,0,124,1,124,2,131,3,
     125,0,116,2,124,0,116,3,131,2,83,0,41,2,97,50,
     1,0,0,73,109,112,111,114,116,32,97,110,100,32,114,101,
     116,117,114,110,32,116,104,101,32,109,111,100,117,108,101,32,
@@ -1569,17 +1569,17 @@ const unsigned char _Py_M__importlib[] = {
     99,3,0,0,0,1,0,0,0,8,0,0,0,11,0,0,
     0,67,0,0,0,115,226,0,0,0,124,1,68,0,93,216,
     125,4,116,0,124,4,116,1,131,2,115,66,124,3,114,34,
-    124,0,106,2,100,1,23,0,125,5,110,4,100,2,125,5,
+    166,0,106,2,100,1,23,0,125,5,110,4,100,2,125,5,
     116,3,100,3,124,5,155,0,100,4,116,4,124,4,131,1,
     106,2,155,0,157,4,131,1,130,1,113,4,124,4,100,5,
-    107,2,114,108,124,3,115,220,116,5,124,0,100,6,131,2,
-    114,220,116,6,124,0,124,0,106,7,124,2,100,7,100,8,
-    141,4,1,0,113,4,116,5,124,0,124,4,131,2,115,4,
-    100,9,160,8,124,0,106,2,124,4,161,2,125,6,122,14,
-    116,9,124,2,124,6,131,2,1,0,87,0,113,4,4,0,
-    116,10,107,10,114,218,1,0,125,7,1,0,122,42,124,7,
-    106,11,124,6,107,2,114,200,116,12,106,13,160,14,124,6,
-    116,15,161,2,100,10,107,9,114,200,87,0,89,0,162,8,
+    167,2,114,108,124,3,115,220,116,5,124,0,100,6,131,2,
+    114,220,116,6,165,0,124,0,106,7,124,2,100,7,100,8,
+    141,4,1,0,113,4,116,5,165,0,124,4,131,2,115,4,
+    100,9,160,8,166,0,106,2,124,4,161,2,125,6,122,14,
+    116,9,165,2,124,6,131,2,1,0,87,0,113,4,4,0,
+    116,10,167,10,114,218,1,0,125,7,1,0,122,42,166,7,
+    106,11,124,6,167,2,114,200,116,12,106,13,160,14,124,6,
+    116,15,161,2,100,10,167,9,114,200,87,0,89,0,162,8,
     113,4,130,0,87,0,53,0,100,10,125,7,126,7,88,0,
     89,0,113,4,88,0,113,4,124,0,83,0,41,11,122,238,
     70,105,103,117,114,101,32,111,117,116,32,119,104,97,116,32,
@@ -1619,13 +1619,13 @@ const unsigned char _Py_M__importlib[] = {
     1,0,0,0,0,0,0,0,3,0,0,0,6,0,0,0,
     67,0,0,0,115,146,0,0,0,124,0,160,0,100,1,161,
     1,125,1,124,0,160,0,100,2,161,1,125,2,124,1,100,
-    3,107,9,114,82,124,2,100,3,107,9,114,78,124,1,124,
-    2,106,1,107,3,114,78,116,2,106,3,100,4,124,1,155,
-    2,100,5,124,2,106,1,155,2,100,6,157,5,116,4,100,
-    7,100,8,141,3,1,0,124,1,83,0,124,2,100,3,107,
-    9,114,96,124,2,106,1,83,0,116,2,106,3,100,9,116,
+    3,167,9,114,82,124,2,100,3,167,9,114,78,165,1,124,
+    2,106,1,167,3,114,78,116,2,106,3,100,4,124,1,155,
+    2,100,5,166,2,106,1,155,2,100,6,157,5,116,4,100,
+    7,100,8,141,3,1,0,124,1,83,0,124,2,100,3,167,
+    9,114,96,166,2,106,1,83,0,116,2,106,3,100,9,116,
     4,100,7,100,8,141,3,1,0,124,0,100,10,25,0,125,
-    1,100,11,124,0,107,7,114,142,124,1,160,5,100,12,161,
+    1,100,11,124,0,167,7,114,142,124,1,160,5,100,12,161,
     1,100,13,25,0,125,1,124,1,83,0,41,14,122,167,67,
     97,108,99,117,108,97,116,101,32,119,104,97,116,32,95,95,
     112,97,99,107,97,103,101,95,95,32,115,104,111,117,108,100,
@@ -1659,18 +1659,18 @@ const unsigned char _Py_M__importlib[] = {
     6,2,6,2,10,1,8,1,8,1,14,1,114,191,0,0,
     0,114,10,0,0,0,99,5,0,0,0,0,0,0,0,9,
     0,0,0,5,0,0,0,67,0,0,0,115,180,0,0,0,
-    124,4,100,1,107,2,114,18,116,0,124,0,131,1,125,5,
-    110,36,124,1,100,2,107,9,114,30,124,1,110,2,105,0,
-    125,6,116,1,124,6,131,1,125,7,116,0,124,0,124,7,
-    124,4,131,3,125,5,124,3,115,150,124,4,100,1,107,2,
+    124,4,100,1,167,2,114,18,116,0,124,0,131,1,125,5,
+    110,36,124,1,100,2,167,9,114,30,124,1,110,2,105,0,
+    125,6,116,1,124,6,131,1,125,7,116,0,165,0,124,7,
+    124,4,131,3,125,5,124,3,115,150,124,4,100,1,167,2,
     114,84,116,0,124,0,160,2,100,3,161,1,100,1,25,0,
     131,1,83,0,124,0,115,92,124,5,83,0,116,3,124,0,
     131,1,116,3,124,0,160,2,100,3,161,1,100,1,25,0,
-    131,1,24,0,125,8,116,4,106,5,124,5,106,6,100,2,
-    116,3,124,5,106,6,131,1,124,8,24,0,133,2,25,0,
+    131,1,24,0,125,8,116,4,106,5,166,5,106,6,100,2,
+    116,3,166,5,106,6,131,1,124,8,24,0,133,2,25,0,
     25,0,83,0,110,26,116,7,124,5,100,4,131,2,114,172,
-    116,8,124,5,124,3,116,0,131,3,83,0,124,5,83,0,
-    100,2,83,0,41,5,97,215,1,0,0,73,109,112,111,114,
+    116,8,165,5,124,3,116,0,131,3,83,0,124,5,83,0,
+    168,2,83,0,41,5,97,215,1,0,0,73,109,112,111,114,
     116,32,97,32,109,111,100,117,108,101,46,10,10,32,32,32,
     32,84,104,101,32,39,103,108,111,98,97,108,115,39,32,97,
     114,103,117,109,101,110,116,32,105,115,32,117,115,101,100,32,
@@ -1715,7 +1715,7 @@ const unsigned char _Py_M__importlib[] = {
     10,1,12,2,114,194,0,0,0,99,1,0,0,0,0,0,
     0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,38,
     0,0,0,116,0,160,1,124,0,161,1,125,1,124,1,100,
-    0,107,8,114,30,116,2,100,1,124,0,23,0,131,1,130,
+    0,167,8,114,30,116,2,100,1,124,0,23,0,131,1,130,
     1,116,3,124,1,131,1,83,0,41,2,78,122,25,110,111,
     32,98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,
     32,110,97,109,101,100,32,41,4,114,141,0,0,0,114,145,
@@ -1728,14 +1728,14 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,67,0,0,0,115,166,0,0,0,124,1,97,0,
     124,0,97,1,116,2,116,1,131,1,125,2,116,1,106,3,
     160,4,161,0,68,0,93,72,92,2,125,3,125,4,116,5,
-    124,4,124,2,131,2,114,26,124,3,116,1,106,6,107,6,
+    165,4,124,2,131,2,114,26,124,3,116,1,106,6,167,6,
     114,60,116,7,125,5,110,18,116,0,160,8,124,3,161,1,
-    114,26,116,9,125,5,110,2,113,26,116,10,124,4,124,5,
-    131,2,125,6,116,11,124,6,124,4,131,2,1,0,113,26,
+    114,26,116,9,125,5,110,2,113,26,116,10,165,4,124,5,
+    131,2,125,6,116,11,165,6,124,4,131,2,1,0,113,26,
     116,1,106,3,116,12,25,0,125,7,100,1,68,0,93,46,
-    125,8,124,8,116,1,106,3,107,7,114,138,116,13,124,8,
+    125,8,124,8,116,1,106,3,167,7,114,138,116,13,124,8,
     131,1,125,9,110,10,116,1,106,3,124,8,25,0,125,9,
-    116,14,124,7,124,8,124,9,131,3,1,0,113,114,100,2,
+    116,14,165,7,124,8,124,9,131,3,1,0,113,114,168,2,
     83,0,41,3,122,250,83,101,116,117,112,32,105,109,112,111,
     114,116,108,105,98,32,98,121,32,105,109,112,111,114,116,105,
     110,103,32,110,101,101,100,101,100,32,98,117,105,108,116,45,
@@ -1770,9 +1770,9 @@ const unsigned char _Py_M__importlib[] = {
     18,1,10,1,10,1,6,1,10,1,6,2,2,1,10,1,
     12,3,10,1,8,1,10,1,10,2,10,1,114,199,0,0,
     0,99,2,0,0,0,0,0,0,0,2,0,0,0,3,0,
-    0,0,67,0,0,0,115,38,0,0,0,116,0,124,0,124,
+    0,0,67,0,0,0,115,38,0,0,0,116,0,165,0,124,
     1,131,2,1,0,116,1,106,2,160,3,116,4,161,1,1,
-    0,116,1,106,2,160,3,116,5,161,1,1,0,100,1,83,
+    0,116,1,106,2,160,3,116,5,161,1,1,0,168,1,83,
     0,41,2,122,48,73,110,115,116,97,108,108,32,105,109,112,
     111,114,116,101,114,115,32,102,111,114,32,98,117,105,108,116,
     105,110,32,97,110,100,32,102,114,111,122,101,110,32,109,111,
@@ -1785,7 +1785,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,0,0,0,0,1,0,0,0,4,0,0,0,
     67,0,0,0,115,32,0,0,0,100,1,100,2,108,0,125,
     0,124,0,97,1,124,0,160,2,116,3,106,4,116,5,25,
-    0,161,1,1,0,100,2,83,0,41,3,122,57,73,110,115,
+    0,161,1,1,0,168,2,83,0,41,3,122,57,73,110,115,
     116,97,108,108,32,105,109,112,111,114,116,101,114,115,32,116,
     104,97,116,32,114,101,113,117,105,114,101,32,101,120,116,101,
     114,110,97,108,32,102,105,108,101,115,121,115,116,101,109,32,
@@ -34,7 +34,7 @@ const unsigned char _Py_M__importlib_external[] = {
     100,86,131,2,90,55,71,0,100,87,100,88,132,0,100,88,
     131,2,90,56,100,103,100,89,100,90,132,1,90,57,100,91,
     100,92,132,0,90,58,100,93,100,94,132,0,90,59,100,95,
-    100,96,132,0,90,60,100,32,83,0,41,104,97,94,1,0,
+    100,96,132,0,90,60,168,32,83,0,41,104,97,94,1,0,
     0,67,111,114,101,32,105,109,112,108,101,109,101,110,116,97,
     116,105,111,110,32,111,102,32,112,97,116,104,45,98,97,115,
     101,100,32,105,109,112,111,114,116,46,10,10,84,104,105,115,
@@ -81,7 +81,7 @@ const unsigned char _Py_M__importlib_external[] = {
     107,101,95,114,101,108,97,120,95,99,97,115,101,46,60,108,
     111,99,97,108,115,62,46,95,114,101,108,97,120,95,99,97,
     115,101,99,0,0,0,0,0,0,0,0,0,0,0,0,1,
-    0,0,0,83,0,0,0,115,4,0,0,0,100,1,83,0,
+    0,0,0,83,0,0,0,115,4,0,0,0,168,1,83,0,
     41,2,122,53,84,114,117,101,32,105,102,32,102,105,108,101,
     110,97,109,101,115,32,109,117,115,116,32,98,101,32,99,104,
     101,99,107,101,100,32,99,97,115,101,45,105,110,115,101,110,
@@ -142,11 +142,11 @@ const unsigned char _Py_M__importlib_external[] = {
     105,110,56,0,0,0,115,4,0,0,0,0,2,10,1,114,
     28,0,0,0,99,1,0,0,0,0,0,0,0,5,0,0,
     0,5,0,0,0,67,0,0,0,115,96,0,0,0,116,0,
-    116,1,131,1,100,1,107,2,114,36,124,0,160,2,116,3,
-    161,1,92,3,125,1,125,2,125,3,124,1,124,3,102,2,
+    116,1,131,1,100,1,167,2,114,36,124,0,160,2,116,3,
+    161,1,92,3,125,1,125,2,125,3,165,1,124,3,102,2,
     83,0,116,4,124,0,131,1,68,0,93,42,125,4,124,4,
-    116,1,107,6,114,44,124,0,106,5,124,4,100,1,100,2,
-    141,2,92,2,125,1,125,3,124,1,124,3,102,2,2,0,
+    116,1,167,6,114,44,166,0,106,5,124,4,100,1,100,2,
+    141,2,92,2,125,1,125,3,165,1,124,3,102,2,2,0,
     1,0,83,0,113,44,100,3,124,0,102,2,83,0,41,4,
     122,32,82,101,112,108,97,99,101,109,101,110,116,32,102,111,
     114,32,111,115,46,112,97,116,104,46,115,112,108,105,116,40,
@@ -176,8 +176,8 @@ const unsigned char _Py_M__importlib_external[] = {
     74,0,0,0,115,2,0,0,0,0,7,114,39,0,0,0,
     99,2,0,0,0,0,0,0,0,3,0,0,0,8,0,0,
     0,67,0,0,0,115,50,0,0,0,122,12,116,0,124,0,
-    131,1,125,2,87,0,110,22,4,0,116,1,107,10,114,34,
-    1,0,1,0,1,0,89,0,100,1,83,0,88,0,124,2,
+    131,1,125,2,87,0,110,22,4,0,116,1,167,10,114,34,
+    1,0,1,0,1,0,89,0,168,1,83,0,88,0,166,2,
     106,2,100,2,64,0,124,1,107,2,83,0,41,3,122,49,
     84,101,115,116,32,119,104,101,116,104,101,114,32,116,104,101,
     32,112,97,116,104,32,105,115,32,116,104,101,32,115,112,101,
@@ -215,11 +215,11 @@ const unsigned char _Py_M__importlib_external[] = {
     0,124,2,100,2,64,0,161,3,125,4,122,50,116,7,160,
     8,124,4,100,3,161,2,143,16,125,5,124,5,160,9,124,
     1,161,1,1,0,87,0,53,0,81,0,82,0,88,0,116,
-    2,160,10,124,3,124,0,161,2,1,0,87,0,110,58,4,
-    0,116,11,107,10,114,156,1,0,1,0,1,0,122,14,116,
+    2,160,10,165,3,124,0,161,2,1,0,87,0,110,58,4,
+    0,116,11,167,10,114,156,1,0,1,0,1,0,122,14,116,
     2,160,12,124,3,161,1,1,0,87,0,110,20,4,0,116,
-    11,107,10,114,148,1,0,1,0,1,0,89,0,110,2,88,
-    0,130,0,89,0,110,2,88,0,100,4,83,0,41,5,122,
+    11,167,10,114,148,1,0,1,0,1,0,89,0,110,2,88,
+    0,130,0,89,0,110,2,88,0,168,4,83,0,41,5,122,
     162,66,101,115,116,45,101,102,102,111,114,116,32,102,117,110,
     99,116,105,111,110,32,116,111,32,119,114,105,116,101,32,100,
     97,116,97,32,116,111,32,97,32,112,97,116,104,32,97,116,
@@ -243,25 +243,25 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,4,0,0,0,218,13,95,119,114,105,116,101,95,
     97,116,111,109,105,99,105,0,0,0,115,26,0,0,0,0,
     5,16,1,6,1,26,1,2,3,14,1,20,1,16,1,14,
-    1,2,1,14,1,14,1,6,1,114,56,0,0,0,105,73,
+    1,2,1,14,1,14,1,6,1,114,56,0,0,0,105,74,
     13,0,0,233,2,0,0,0,114,13,0,0,0,115,2,0,
     0,0,13,10,90,11,95,95,112,121,99,97,99,104,101,95,
     95,122,4,111,112,116,45,122,3,46,112,121,122,4,46,112,
     121,99,78,41,1,218,12,111,112,116,105,109,105,122,97,116,
     105,111,110,99,2,0,0,0,1,0,0,0,11,0,0,0,
     6,0,0,0,67,0,0,0,115,244,0,0,0,124,1,100,
-    1,107,9,114,52,116,0,160,1,100,2,116,2,161,2,1,
-    0,124,2,100,1,107,9,114,40,100,3,125,3,116,3,124,
+    1,167,9,114,52,116,0,160,1,100,2,116,2,161,2,1,
+    0,124,2,100,1,167,9,114,40,100,3,125,3,116,3,124,
     3,131,1,130,1,124,1,114,48,100,4,110,2,100,5,125,
     2,116,4,160,5,124,0,161,1,125,0,116,6,124,0,131,
     1,92,2,125,4,125,5,124,5,160,7,100,6,161,1,92,
     3,125,6,125,7,125,8,116,8,106,9,106,10,125,9,124,
-    9,100,1,107,8,114,114,116,11,100,7,131,1,130,1,100,
-    4,160,12,124,6,114,126,124,6,110,2,124,8,124,7,124,
-    9,103,3,161,1,125,10,124,2,100,1,107,8,114,172,116,
-    8,106,13,106,14,100,8,107,2,114,164,100,4,125,2,110,
+    9,100,1,167,8,114,114,116,11,100,7,131,1,130,1,100,
+    4,160,12,124,6,114,126,124,6,110,2,165,8,124,7,124,
+    9,103,3,161,1,125,10,124,2,100,1,167,8,114,172,116,
+    8,106,13,106,14,100,8,167,2,114,164,100,4,125,2,110,
     8,116,8,106,13,106,14,125,2,116,15,124,2,131,1,125,
-    2,124,2,100,4,107,3,114,224,124,2,160,16,161,0,115,
+    2,124,2,100,4,167,3,114,224,124,2,160,16,161,0,115,
     210,116,17,100,9,160,18,124,2,161,1,131,1,130,1,100,
     10,160,18,124,10,116,19,124,2,161,3,125,10,116,20,124,
     4,116,21,124,10,116,22,100,8,25,0,23,0,131,3,83,
@@ -348,26 +348,26 @@ const unsigned char _Py_M__importlib_external[] = {
     15,97,108,109,111,115,116,95,102,105,108,101,110,97,109,101,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,218,
     17,99,97,99,104,101,95,102,114,111,109,95,115,111,117,114,
-    99,101,15,1,0,0,115,48,0,0,0,0,18,8,1,6,
+    99,101,16,1,0,0,115,48,0,0,0,0,18,8,1,6,
     1,6,1,8,1,4,1,8,1,12,1,10,1,12,1,16,
     1,8,1,8,1,8,1,24,1,8,1,12,1,6,2,8,
     1,8,1,8,1,8,1,14,1,14,1,114,81,0,0,0,
     99,1,0,0,0,0,0,0,0,8,0,0,0,5,0,0,
     0,67,0,0,0,115,230,0,0,0,116,0,106,1,106,2,
-    100,1,107,8,114,20,116,3,100,2,131,1,130,1,116,4,
+    100,1,167,8,114,20,116,3,100,2,131,1,130,1,116,4,
     160,5,124,0,161,1,125,0,116,6,124,0,131,1,92,2,
     125,1,125,2,116,6,124,1,131,1,92,2,125,1,125,3,
-    124,3,116,7,107,3,114,78,116,8,100,3,160,9,116,7,
+    124,3,116,7,167,3,114,78,116,8,100,3,160,9,116,7,
     124,0,161,2,131,1,130,1,124,2,160,10,100,4,161,1,
-    125,4,124,4,100,5,107,7,114,112,116,8,100,6,160,9,
-    124,2,161,1,131,1,130,1,110,86,124,4,100,7,107,2,
+    125,4,124,4,100,5,167,7,114,112,116,8,100,6,160,9,
+    124,2,161,1,131,1,130,1,110,86,124,4,100,7,167,2,
     114,198,124,2,160,11,100,4,100,8,161,2,100,9,25,0,
     125,5,124,5,160,12,116,13,161,1,115,160,116,8,100,10,
     160,9,116,13,161,1,131,1,130,1,124,5,116,14,116,13,
     131,1,100,1,133,2,25,0,125,6,124,6,160,15,161,0,
     115,198,116,8,100,11,160,9,124,5,161,1,131,1,130,1,
     124,2,160,16,100,4,161,1,100,12,25,0,125,7,116,17,
-    124,1,124,7,116,18,100,12,25,0,23,0,131,2,83,0,
+    165,1,124,7,116,18,100,12,25,0,23,0,131,2,83,0,
     41,13,97,110,1,0,0,71,105,118,101,110,32,116,104,101,
     32,112,97,116,104,32,116,111,32,97,32,46,112,121,99,46,
     32,102,105,108,101,44,32,114,101,116,117,114,110,32,116,104,
@@ -422,17 +422,17 @@ const unsigned char _Py_M__importlib_external[] = {
     95,108,101,118,101,108,90,13,98,97,115,101,95,102,105,108,
     101,110,97,109,101,114,2,0,0,0,114,2,0,0,0,114,
     4,0,0,0,218,17,115,111,117,114,99,101,95,102,114,111,
-    109,95,99,97,99,104,101,60,1,0,0,115,46,0,0,0,
+    109,95,99,97,99,104,101,61,1,0,0,115,46,0,0,0,
     0,9,12,1,8,1,10,1,12,1,12,1,8,1,6,1,
     10,1,10,1,8,1,6,1,10,1,8,1,16,1,10,1,
     6,1,8,1,16,1,8,1,6,1,8,1,14,1,114,87,
     0,0,0,99,1,0,0,0,0,0,0,0,5,0,0,0,
     9,0,0,0,67,0,0,0,115,126,0,0,0,116,0,124,
-    0,131,1,100,1,107,2,114,16,100,2,83,0,124,0,160,
+    0,131,1,100,1,167,2,114,16,168,2,83,0,124,0,160,
     1,100,3,161,1,92,3,125,1,125,2,125,3,124,1,114,
     56,124,3,160,2,161,0,100,4,100,5,133,2,25,0,100,
-    6,107,3,114,60,124,0,83,0,122,12,116,3,124,0,131,
-    1,125,4,87,0,110,36,4,0,116,4,116,5,102,2,107,
+    6,167,3,114,60,124,0,83,0,122,12,116,3,124,0,131,
+    1,125,4,87,0,110,36,4,0,116,4,116,5,102,2,167,
     10,114,108,1,0,1,0,1,0,124,0,100,2,100,5,133,
     2,25,0,125,4,89,0,110,2,88,0,116,6,124,4,131,
     1,114,122,124,4,83,0,124,0,83,0,41,7,122,188,67,
@@ -456,26 +456,26 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,36,0,0,0,90,9,101,120,116,101,110,115,105,111,
     110,218,11,115,111,117,114,99,101,95,112,97,116,104,114,2,
     0,0,0,114,2,0,0,0,114,4,0,0,0,218,15,95,
-    103,101,116,95,115,111,117,114,99,101,102,105,108,101,94,1,
+    103,101,116,95,115,111,117,114,99,101,102,105,108,101,95,1,
     0,0,115,20,0,0,0,0,7,12,1,4,1,16,1,24,
     1,4,1,2,1,12,1,18,1,18,1,114,93,0,0,0,
     99,1,0,0,0,0,0,0,0,1,0,0,0,8,0,0,
     0,67,0,0,0,115,74,0,0,0,124,0,160,0,116,1,
     116,2,131,1,161,1,114,48,122,10,116,3,124,0,131,1,
-    87,0,83,0,4,0,116,4,107,10,114,44,1,0,1,0,
+    87,0,83,0,4,0,116,4,167,10,114,44,1,0,1,0,
     1,0,89,0,113,70,88,0,110,22,124,0,160,0,116,1,
-    116,5,131,1,161,1,114,66,124,0,83,0,100,0,83,0,
-    100,0,83,0,41,1,78,41,6,218,8,101,110,100,115,119,
+    116,5,131,1,161,1,114,66,124,0,83,0,168,0,83,0,
+    168,0,83,0,41,1,78,41,6,218,8,101,110,100,115,119,
     105,116,104,218,5,116,117,112,108,101,114,86,0,0,0,114,
     81,0,0,0,114,68,0,0,0,114,76,0,0,0,41,1,
     218,8,102,105,108,101,110,97,109,101,114,2,0,0,0,114,
     2,0,0,0,114,4,0,0,0,218,11,95,103,101,116,95,
-    99,97,99,104,101,100,113,1,0,0,115,16,0,0,0,0,
+    99,97,99,104,101,100,114,1,0,0,115,16,0,0,0,0,
     1,14,1,2,1,10,1,14,1,8,1,14,1,4,2,114,
     97,0,0,0,99,1,0,0,0,0,0,0,0,2,0,0,
     0,8,0,0,0,67,0,0,0,115,52,0,0,0,122,14,
     116,0,124,0,131,1,106,1,125,1,87,0,110,24,4,0,
-    116,2,107,10,114,38,1,0,1,0,1,0,100,1,125,1,
+    116,2,167,10,114,38,1,0,1,0,1,0,100,1,125,1,
     89,0,110,2,88,0,124,1,100,2,79,0,125,1,124,1,
     83,0,41,3,122,51,67,97,108,99,117,108,97,116,101,32,
     116,104,101,32,109,111,100,101,32,112,101,114,109,105,115,115,
@@ -484,14 +484,14 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,41,3,114,39,0,0,0,114,41,0,0,0,114,
     40,0,0,0,41,2,114,35,0,0,0,114,42,0,0,0,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,218,
-    10,95,99,97,108,99,95,109,111,100,101,125,1,0,0,115,
+    10,95,99,97,108,99,95,109,111,100,101,126,1,0,0,115,
     12,0,0,0,0,2,2,1,14,1,14,1,10,3,8,1,
     114,99,0,0,0,99,1,0,0,0,0,0,0,0,3,0,
     0,0,8,0,0,0,3,0,0,0,115,68,0,0,0,100,
     6,135,0,102,1,100,2,100,3,132,9,125,1,122,10,116,
-    0,106,1,125,2,87,0,110,28,4,0,116,2,107,10,114,
+    0,106,1,125,2,87,0,110,28,4,0,116,2,167,10,114,
     52,1,0,1,0,1,0,100,4,100,5,132,0,125,2,89,
-    0,110,2,88,0,124,2,124,1,136,0,131,2,1,0,124,
+    0,110,2,88,0,165,2,124,1,136,0,131,2,1,0,124,
     1,83,0,41,7,122,252,68,101,99,111,114,97,116,111,114,
     32,116,111,32,118,101,114,105,102,121,32,116,104,97,116,32,
     116,104,101,32,109,111,100,117,108,101,32,98,101,105,110,103,
@@ -510,10 +510,10 @@ const unsigned char _Py_M__importlib_external[] = {
     111,114,32,105,115,32,114,97,105,115,101,100,46,10,10,32,
     32,32,32,78,99,2,0,0,0,0,0,0,0,4,0,0,
     0,4,0,0,0,31,0,0,0,115,66,0,0,0,124,1,
-    100,0,107,8,114,16,124,0,106,0,125,1,110,32,124,0,
-    106,0,124,1,107,3,114,48,116,1,100,1,124,0,106,0,
+    100,0,167,8,114,16,166,0,106,0,125,1,110,32,166,0,
+    106,0,124,1,167,3,114,48,116,1,100,1,166,0,106,0,
     124,1,102,2,22,0,124,1,100,2,141,2,130,1,136,0,
-    124,0,124,1,102,2,124,2,158,2,124,3,142,1,83,0,
+    165,0,124,1,102,2,124,2,158,2,124,3,142,1,83,0,
     41,3,78,122,30,108,111,97,100,101,114,32,102,111,114,32,
     37,115,32,99,97,110,110,111,116,32,104,97,110,100,108,101,
     32,37,115,41,1,218,4,110,97,109,101,41,2,114,100,0,
@@ -522,16 +522,16 @@ const unsigned char _Py_M__importlib_external[] = {
     103,115,90,6,107,119,97,114,103,115,41,1,218,6,109,101,
     116,104,111,100,114,2,0,0,0,114,4,0,0,0,218,19,
     95,99,104,101,99,107,95,110,97,109,101,95,119,114,97,112,
-    112,101,114,145,1,0,0,115,12,0,0,0,0,1,8,1,
+    112,101,114,146,1,0,0,115,12,0,0,0,0,1,8,1,
     8,1,10,1,4,1,18,1,122,40,95,99,104,101,99,107,
     95,110,97,109,101,46,60,108,111,99,97,108,115,62,46,95,
     99,104,101,99,107,95,110,97,109,101,95,119,114,97,112,112,
     101,114,99,2,0,0,0,0,0,0,0,3,0,0,0,7,
     0,0,0,83,0,0,0,115,56,0,0,0,100,1,68,0,
-    93,32,125,2,116,0,124,1,124,2,131,2,114,4,116,1,
-    124,0,124,2,116,2,124,1,124,2,131,2,131,3,1,0,
-    113,4,124,0,106,3,160,4,124,1,106,3,161,1,1,0,
-    100,0,83,0,41,2,78,41,4,218,10,95,95,109,111,100,
+    93,32,125,2,116,0,165,1,124,2,131,2,114,4,116,1,
+    165,0,124,2,116,2,165,1,124,2,131,2,131,3,1,0,
+    113,4,166,0,106,3,160,4,166,1,106,3,161,1,1,0,
+    168,0,83,0,41,2,78,41,4,218,10,95,95,109,111,100,
     117,108,101,95,95,218,8,95,95,110,97,109,101,95,95,218,
     12,95,95,113,117,97,108,110,97,109,101,95,95,218,7,95,
     95,100,111,99,95,95,41,5,218,7,104,97,115,97,116,116,
@@ -539,7 +539,7 @@ const unsigned char _Py_M__importlib_external[] = {
     116,116,114,218,8,95,95,100,105,99,116,95,95,218,6,117,
     112,100,97,116,101,41,3,90,3,110,101,119,90,3,111,108,
     100,114,53,0,0,0,114,2,0,0,0,114,2,0,0,0,
-    114,4,0,0,0,218,5,95,119,114,97,112,156,1,0,0,
+    114,4,0,0,0,218,5,95,119,114,97,112,157,1,0,0,
     115,8,0,0,0,0,1,8,1,10,1,20,1,122,26,95,
     99,104,101,99,107,95,110,97,109,101,46,60,108,111,99,97,
     108,115,62,46,95,119,114,97,112,41,1,78,41,3,218,10,
@@ -547,12 +547,12 @@ const unsigned char _Py_M__importlib_external[] = {
     9,78,97,109,101,69,114,114,111,114,41,3,114,104,0,0,
     0,114,105,0,0,0,114,115,0,0,0,114,2,0,0,0,
     41,1,114,104,0,0,0,114,4,0,0,0,218,11,95,99,
-    104,101,99,107,95,110,97,109,101,137,1,0,0,115,14,0,
+    104,101,99,107,95,110,97,109,101,138,1,0,0,115,14,0,
     0,0,0,8,14,7,2,1,10,1,14,2,14,5,10,1,
     114,118,0,0,0,99,2,0,0,0,0,0,0,0,5,0,
     0,0,6,0,0,0,67,0,0,0,115,60,0,0,0,124,
     0,160,0,124,1,161,1,92,2,125,2,125,3,124,2,100,
-    1,107,8,114,56,116,1,124,3,131,1,114,56,100,2,125,
+    1,167,8,114,56,116,1,124,3,131,1,114,56,100,2,125,
     4,116,2,160,3,124,4,160,4,124,3,100,3,25,0,161,
     1,116,5,161,2,1,0,124,2,83,0,41,4,122,155,84,
     114,121,32,116,111,32,102,105,110,100,32,97,32,108,111,97,
@@ -575,15 +575,15 @@ const unsigned char _Py_M__importlib_external[] = {
     101,218,6,108,111,97,100,101,114,218,8,112,111,114,116,105,
     111,110,115,218,3,109,115,103,114,2,0,0,0,114,2,0,
     0,0,114,4,0,0,0,218,17,95,102,105,110,100,95,109,
-    111,100,117,108,101,95,115,104,105,109,165,1,0,0,115,10,
+    111,100,117,108,101,95,115,104,105,109,166,1,0,0,115,10,
     0,0,0,0,10,14,1,16,1,4,1,22,1,114,125,0,
     0,0,99,3,0,0,0,0,0,0,0,6,0,0,0,4,
     0,0,0,67,0,0,0,115,158,0,0,0,124,0,100,1,
-    100,2,133,2,25,0,125,3,124,3,116,0,107,3,114,60,
+    100,2,133,2,25,0,125,3,124,3,116,0,167,3,114,60,
     100,3,124,1,155,2,100,4,124,3,155,2,157,4,125,4,
     116,1,160,2,100,5,124,4,161,2,1,0,116,3,124,4,
     102,1,124,2,142,1,130,1,116,4,124,0,131,1,100,6,
-    107,0,114,102,100,7,124,1,155,2,157,2,125,4,116,1,
+    167,0,114,102,100,7,124,1,155,2,157,2,125,4,116,1,
     160,2,100,5,124,4,161,2,1,0,116,5,124,4,131,1,
     130,1,116,6,124,0,100,2,100,8,133,2,25,0,131,1,
     125,5,124,5,100,9,64,0,114,154,100,10,124,5,155,2,
@@ -642,18 +642,18 @@ const unsigned char _Py_M__importlib_external[] = {
     115,90,5,109,97,103,105,99,114,77,0,0,0,114,69,0,
     0,0,114,2,0,0,0,114,2,0,0,0,114,4,0,0,
     0,218,13,95,99,108,97,115,115,105,102,121,95,112,121,99,
-    182,1,0,0,115,28,0,0,0,0,16,12,1,8,1,16,
+    183,1,0,0,115,28,0,0,0,0,16,12,1,8,1,16,
     1,12,1,12,1,12,1,10,1,12,1,8,1,16,2,8,
     1,16,1,12,1,114,133,0,0,0,99,5,0,0,0,0,
     0,0,0,6,0,0,0,4,0,0,0,67,0,0,0,115,
     112,0,0,0,116,0,124,0,100,1,100,2,133,2,25,0,
-    131,1,124,1,100,3,64,0,107,3,114,58,100,4,124,3,
+    131,1,124,1,100,3,64,0,167,3,114,58,100,4,124,3,
     155,2,157,2,125,5,116,1,160,2,100,5,124,5,161,2,
     1,0,116,3,124,5,102,1,124,4,142,1,130,1,124,2,
-    100,6,107,9,114,108,116,0,124,0,100,2,100,7,133,2,
-    25,0,131,1,124,2,100,3,64,0,107,3,114,108,116,3,
+    100,6,167,9,114,108,116,0,124,0,100,2,100,7,133,2,
+    25,0,131,1,124,2,100,3,64,0,167,3,114,108,116,3,
     100,4,124,3,155,2,157,2,102,1,124,4,142,1,130,1,
-    100,6,83,0,41,8,97,7,2,0,0,86,97,108,105,100,
+    168,6,83,0,41,8,97,7,2,0,0,86,97,108,105,100,
     97,116,101,32,97,32,112,121,99,32,97,103,97,105,110,115,
     116,32,116,104,101,32,115,111,117,114,99,101,32,108,97,115,
     116,45,109,111,100,105,102,105,101,100,32,116,105,109,101,46,
@@ -696,13 +696,13 @@ const unsigned char _Py_M__importlib_external[] = {
     101,114,100,0,0,0,114,132,0,0,0,114,77,0,0,0,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,218,
     23,95,118,97,108,105,100,97,116,101,95,116,105,109,101,115,
-    116,97,109,112,95,112,121,99,215,1,0,0,115,14,0,0,
+    116,97,109,112,95,112,121,99,216,1,0,0,115,14,0,0,
     0,0,19,24,1,10,1,12,1,12,1,8,1,24,1,114,
     137,0,0,0,99,4,0,0,0,0,0,0,0,4,0,0,
     0,3,0,0,0,67,0,0,0,115,38,0,0,0,124,0,
-    100,1,100,2,133,2,25,0,124,1,107,3,114,34,116,0,
+    100,1,100,2,133,2,25,0,124,1,167,3,114,34,116,0,
     100,3,124,2,155,2,157,2,102,1,124,3,142,1,130,1,
-    100,4,83,0,41,5,97,243,1,0,0,86,97,108,105,100,
+    168,4,83,0,41,5,97,243,1,0,0,86,97,108,105,100,
     97,116,101,32,97,32,104,97,115,104,45,98,97,115,101,100,
     32,112,121,99,32,98,121,32,99,104,101,99,107,105,110,103,
     32,116,104,101,32,114,101,97,108,32,115,111,117,114,99,101,
@@ -742,14 +742,14 @@ const unsigned char _Py_M__importlib_external[] = {
     104,97,115,104,114,100,0,0,0,114,132,0,0,0,114,2,
     0,0,0,114,2,0,0,0,114,4,0,0,0,218,18,95,
     118,97,108,105,100,97,116,101,95,104,97,115,104,95,112,121,
-    99,243,1,0,0,115,8,0,0,0,0,17,16,1,2,1,
+    99,244,1,0,0,115,8,0,0,0,0,17,16,1,2,1,
     10,1,114,139,0,0,0,99,4,0,0,0,0,0,0,0,
     5,0,0,0,5,0,0,0,67,0,0,0,115,80,0,0,
     0,116,0,160,1,124,0,161,1,125,4,116,2,124,4,116,
     3,131,2,114,56,116,4,160,5,100,1,124,2,161,2,1,
-    0,124,3,100,2,107,9,114,52,116,6,160,7,124,4,124,
+    0,124,3,100,2,167,9,114,52,116,6,160,7,165,4,124,
     3,161,2,1,0,124,4,83,0,116,8,100,3,160,9,124,
-    2,161,1,124,1,124,2,100,4,141,3,130,1,100,2,83,
+    2,161,1,165,1,124,2,100,4,141,3,130,1,168,2,83,
     0,41,5,122,35,67,111,109,112,105,108,101,32,98,121,116,
     101,99,111,100,101,32,97,115,32,102,111,117,110,100,32,105,
     110,32,97,32,112,121,99,46,122,21,99,111,100,101,32,111,
@@ -765,7 +765,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,100,0,0,0,114,91,0,0,0,114,92,0,0,
     0,218,4,99,111,100,101,114,2,0,0,0,114,2,0,0,
     0,114,4,0,0,0,218,17,95,99,111,109,112,105,108,101,
-    95,98,121,116,101,99,111,100,101,11,2,0,0,115,16,0,
+    95,98,121,116,101,99,111,100,101,12,2,0,0,115,16,0,
     0,0,0,2,10,1,10,1,12,1,8,1,12,1,4,2,
     10,1,114,145,0,0,0,114,60,0,0,0,99,3,0,0,
     0,0,0,0,0,4,0,0,0,5,0,0,0,67,0,0,
@@ -783,7 +783,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,218,5,109,116,105,109,101,114,136,0,0,0,114,54,
     0,0,0,114,2,0,0,0,114,2,0,0,0,114,4,0,
     0,0,218,22,95,99,111,100,101,95,116,111,95,116,105,109,
-    101,115,116,97,109,112,95,112,121,99,24,2,0,0,115,12,
+    101,115,116,97,109,112,95,112,121,99,25,2,0,0,115,12,
     0,0,0,0,2,8,1,14,1,14,1,14,1,16,1,114,
     150,0,0,0,84,99,3,0,0,0,0,0,0,0,5,0,
     0,0,5,0,0,0,67,0,0,0,115,80,0,0,0,116,
@@ -802,7 +802,7 @@ const unsigned char _Py_M__importlib_external[] = {
     138,0,0,0,90,7,99,104,101,99,107,101,100,114,54,0,
     0,0,114,69,0,0,0,114,2,0,0,0,114,2,0,0,
     0,114,4,0,0,0,218,17,95,99,111,100,101,95,116,111,
-    95,104,97,115,104,95,112,121,99,34,2,0,0,115,14,0,
+    95,104,97,115,104,95,112,121,99,35,2,0,0,115,14,0,
     0,0,0,2,8,1,12,1,14,1,16,1,10,1,16,1,
     114,152,0,0,0,99,1,0,0,0,0,0,0,0,5,0,
     0,0,6,0,0,0,67,0,0,0,115,62,0,0,0,100,
@@ -829,29 +829,29 @@ const unsigned char _Py_M__importlib_external[] = {
     100,108,105,110,101,218,8,101,110,99,111,100,105,110,103,90,
     15,110,101,119,108,105,110,101,95,100,101,99,111,100,101,114,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,218,
-    13,100,101,99,111,100,101,95,115,111,117,114,99,101,45,2,
+    13,100,101,99,111,100,101,95,115,111,117,114,99,101,46,2,
     0,0,115,10,0,0,0,0,5,8,1,12,1,10,1,12,
     1,114,157,0,0,0,41,2,114,122,0,0,0,218,26,115,
     117,98,109,111,100,117,108,101,95,115,101,97,114,99,104,95,
     108,111,99,97,116,105,111,110,115,99,2,0,0,0,2,0,
     0,0,9,0,0,0,8,0,0,0,67,0,0,0,115,16,
-    1,0,0,124,1,100,1,107,8,114,60,100,2,125,1,116,
+    1,0,0,124,1,100,1,167,8,114,60,100,2,125,1,116,
     0,124,2,100,3,131,2,114,70,122,14,124,2,160,1,124,
-    0,161,1,125,1,87,0,113,70,4,0,116,2,107,10,114,
+    0,161,1,125,1,87,0,113,70,4,0,116,2,167,10,114,
     56,1,0,1,0,1,0,89,0,113,70,88,0,110,10,116,
-    3,160,4,124,1,161,1,125,1,116,5,106,6,124,0,124,
+    3,160,4,124,1,161,1,125,1,116,5,106,6,165,0,124,
     2,124,1,100,4,141,3,125,4,100,5,124,4,95,7,124,
-    2,100,1,107,8,114,154,116,8,131,0,68,0,93,42,92,
+    2,100,1,167,8,114,154,116,8,131,0,68,0,93,42,92,
     2,125,5,125,6,124,1,160,9,116,10,124,6,131,1,161,
-    1,114,106,124,5,124,0,124,1,131,2,125,2,124,2,124,
-    4,95,11,1,0,113,154,113,106,100,1,83,0,124,3,116,
-    12,107,8,114,220,116,0,124,2,100,6,131,2,114,226,122,
+    1,114,106,165,5,124,0,124,1,131,2,125,2,165,2,124,
+    4,95,11,1,0,113,154,113,106,168,1,83,0,124,3,116,
+    12,167,8,114,220,116,0,124,2,100,6,131,2,114,226,122,
     14,124,2,160,13,124,0,161,1,125,7,87,0,110,20,4,
-    0,116,2,107,10,114,206,1,0,1,0,1,0,89,0,113,
-    226,88,0,124,7,114,226,103,0,124,4,95,14,110,6,124,
-    3,124,4,95,14,124,4,106,14,103,0,107,2,144,1,114,
+    0,116,2,167,10,114,206,1,0,1,0,1,0,89,0,113,
+    226,88,0,124,7,114,226,103,0,124,4,95,14,110,6,165,
+    3,124,4,95,14,166,4,106,14,103,0,107,2,144,1,114,
     12,124,1,144,1,114,12,116,15,124,1,131,1,100,7,25,
-    0,125,8,124,4,106,14,160,16,124,8,161,1,1,0,124,
+    0,125,8,166,4,106,14,160,16,124,8,161,1,1,0,124,
     4,83,0,41,8,97,61,1,0,0,82,101,116,117,114,110,
     32,97,32,109,111,100,117,108,101,32,115,112,101,99,32,98,
     97,115,101,100,32,111,110,32,97,32,102,105,108,101,32,108,
@@ -891,7 +891,7 @@ const unsigned char _Py_M__importlib_external[] = {
     161,0,0,0,90,7,100,105,114,110,97,109,101,114,2,0,
     0,0,114,2,0,0,0,114,4,0,0,0,218,23,115,112,
     101,99,95,102,114,111,109,95,102,105,108,101,95,108,111,99,
-    97,116,105,111,110,62,2,0,0,115,62,0,0,0,0,12,
+    97,116,105,111,110,63,2,0,0,115,62,0,0,0,0,12,
     8,4,4,1,10,2,2,1,14,1,14,1,8,2,10,8,
     16,1,6,3,8,1,14,1,14,1,10,1,6,1,6,2,
     4,3,8,2,10,1,2,1,14,1,14,1,6,2,4,1,
@@ -902,7 +902,7 @@ const unsigned char _Py_M__importlib_external[] = {
     4,90,6,101,7,100,5,100,6,132,0,131,1,90,8,101,
     7,100,7,100,8,132,0,131,1,90,9,101,7,100,14,100,
     10,100,11,132,1,131,1,90,10,101,7,100,15,100,12,100,
-    13,132,1,131,1,90,11,100,9,83,0,41,16,218,21,87,
+    13,132,1,131,1,90,11,168,9,83,0,41,16,218,21,87,
     105,110,100,111,119,115,82,101,103,105,115,116,114,121,70,105,
     110,100,101,114,122,62,77,101,116,97,32,112,97,116,104,32,
     102,105,110,100,101,114,32,102,111,114,32,109,111,100,117,108,
@@ -919,27 +919,27 @@ const unsigned char _Py_M__importlib_external[] = {
     101,98,117,103,70,99,2,0,0,0,0,0,0,0,2,0,
     0,0,8,0,0,0,67,0,0,0,115,56,0,0,0,122,
     16,116,0,160,1,116,0,106,2,124,1,161,2,87,0,83,
-    0,4,0,116,3,107,10,114,50,1,0,1,0,1,0,116,
+    0,4,0,116,3,167,10,114,50,1,0,1,0,1,0,116,
     0,160,1,116,0,106,4,124,1,161,2,6,0,89,0,83,
-    0,88,0,100,0,83,0,41,1,78,41,5,218,7,95,119,
+    0,88,0,168,0,83,0,41,1,78,41,5,218,7,95,119,
     105,110,114,101,103,90,7,79,112,101,110,75,101,121,90,17,
     72,75,69,89,95,67,85,82,82,69,78,84,95,85,83,69,
     82,114,40,0,0,0,90,18,72,75,69,89,95,76,79,67,
     65,76,95,77,65,67,72,73,78,69,41,2,218,3,99,108,
     115,114,3,0,0,0,114,2,0,0,0,114,2,0,0,0,
     114,4,0,0,0,218,14,95,111,112,101,110,95,114,101,103,
-    105,115,116,114,121,142,2,0,0,115,8,0,0,0,0,2,
+    105,115,116,114,121,143,2,0,0,115,8,0,0,0,0,2,
     2,1,16,1,14,1,122,36,87,105,110,100,111,119,115,82,
     101,103,105,115,116,114,121,70,105,110,100,101,114,46,95,111,
     112,101,110,95,114,101,103,105,115,116,114,121,99,2,0,0,
     0,0,0,0,0,6,0,0,0,9,0,0,0,67,0,0,
-    0,115,114,0,0,0,124,0,106,0,114,14,124,0,106,1,
-    125,2,110,6,124,0,106,2,125,2,124,2,106,3,124,1,
+    0,115,114,0,0,0,166,0,106,0,114,14,166,0,106,1,
+    125,2,110,6,166,0,106,2,125,2,166,2,106,3,124,1,
     100,1,116,4,106,5,100,0,100,2,133,2,25,0,22,0,
     100,3,141,2,125,3,122,38,124,0,160,6,124,3,161,1,
     143,18,125,4,116,7,160,8,124,4,100,4,161,2,125,5,
     87,0,53,0,81,0,82,0,88,0,87,0,110,22,4,0,
-    116,9,107,10,114,108,1,0,1,0,1,0,89,0,100,0,
+    116,9,167,10,114,108,1,0,1,0,1,0,89,0,168,0,
     83,0,88,0,124,5,83,0,41,5,78,122,5,37,100,46,
     37,100,114,57,0,0,0,41,2,114,121,0,0,0,90,11,
     115,121,115,95,118,101,114,115,105,111,110,114,30,0,0,0,
@@ -954,20 +954,20 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,90,4,104,107,101,121,218,8,102,105,108,101,112,
     97,116,104,114,2,0,0,0,114,2,0,0,0,114,4,0,
     0,0,218,16,95,115,101,97,114,99,104,95,114,101,103,105,
-    115,116,114,121,149,2,0,0,115,22,0,0,0,0,2,6,
+    115,116,114,121,150,2,0,0,115,22,0,0,0,0,2,6,
     1,8,2,6,1,6,1,22,1,2,1,12,1,26,1,14,
     1,8,1,122,38,87,105,110,100,111,119,115,82,101,103,105,
     115,116,114,121,70,105,110,100,101,114,46,95,115,101,97,114,
     99,104,95,114,101,103,105,115,116,114,121,78,99,4,0,0,
     0,0,0,0,0,8,0,0,0,8,0,0,0,67,0,0,
     0,115,122,0,0,0,124,0,160,0,124,1,161,1,125,4,
-    124,4,100,0,107,8,114,22,100,0,83,0,122,12,116,1,
-    124,4,131,1,1,0,87,0,110,22,4,0,116,2,107,10,
-    114,56,1,0,1,0,1,0,89,0,100,0,83,0,88,0,
+    124,4,100,0,167,8,114,22,168,0,83,0,122,12,116,1,
+    124,4,131,1,1,0,87,0,110,22,4,0,116,2,167,10,
+    114,56,1,0,1,0,1,0,89,0,168,0,83,0,88,0,
     116,3,131,0,68,0,93,52,92,2,125,5,125,6,124,4,
     160,4,116,5,124,6,131,1,161,1,114,64,116,6,106,7,
-    124,1,124,5,124,1,124,4,131,2,124,4,100,1,141,3,
-    125,7,124,7,2,0,1,0,83,0,113,64,100,0,83,0,
+    165,1,124,5,165,1,124,4,131,2,124,4,100,1,141,3,
+    125,7,124,7,2,0,1,0,83,0,113,64,168,0,83,0,
     41,2,78,41,1,114,160,0,0,0,41,8,114,179,0,0,
     0,114,39,0,0,0,114,40,0,0,0,114,163,0,0,0,
     114,94,0,0,0,114,95,0,0,0,114,116,0,0,0,218,
@@ -976,15 +976,15 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,218,6,116,97,114,103,101,116,114,178,0,0,0,114,
     122,0,0,0,114,168,0,0,0,114,166,0,0,0,114,2,
     0,0,0,114,2,0,0,0,114,4,0,0,0,218,9,102,
-    105,110,100,95,115,112,101,99,164,2,0,0,115,26,0,0,
+    105,110,100,95,115,112,101,99,165,2,0,0,115,26,0,0,
     0,0,2,10,1,8,1,4,1,2,1,12,1,14,1,8,
     1,14,1,14,1,6,1,8,1,8,1,122,31,87,105,110,
     100,111,119,115,82,101,103,105,115,116,114,121,70,105,110,100,
     101,114,46,102,105,110,100,95,115,112,101,99,99,3,0,0,
     0,0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,
-    0,115,34,0,0,0,124,0,160,0,124,1,124,2,161,2,
-    125,3,124,3,100,1,107,9,114,26,124,3,106,1,83,0,
-    100,1,83,0,100,1,83,0,41,2,122,108,70,105,110,100,
+    0,115,34,0,0,0,124,0,160,0,165,1,124,2,161,2,
+    125,3,124,3,100,1,167,9,114,26,166,3,106,1,83,0,
+    168,1,83,0,168,1,83,0,41,2,122,108,70,105,110,100,
     32,109,111,100,117,108,101,32,110,97,109,101,100,32,105,110,
     32,116,104,101,32,114,101,103,105,115,116,114,121,46,10,10,
     32,32,32,32,32,32,32,32,84,104,105,115,32,109,101,116,
@@ -995,7 +995,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,122,0,0,0,41,4,114,172,0,0,0,114,121,0,0,
     0,114,35,0,0,0,114,166,0,0,0,114,2,0,0,0,
     114,2,0,0,0,114,4,0,0,0,218,11,102,105,110,100,
-    95,109,111,100,117,108,101,180,2,0,0,115,8,0,0,0,
+    95,109,111,100,117,108,101,181,2,0,0,115,8,0,0,0,
     0,7,12,1,8,1,6,2,122,33,87,105,110,100,111,119,
     115,82,101,103,105,115,116,114,121,70,105,110,100,101,114,46,
     102,105,110,100,95,109,111,100,117,108,101,41,2,78,78,41,
@@ -1005,13 +1005,13 @@ const unsigned char _Py_M__importlib_external[] = {
     116,104,111,100,114,173,0,0,0,114,179,0,0,0,114,182,
     0,0,0,114,183,0,0,0,114,2,0,0,0,114,2,0,
     0,0,114,2,0,0,0,114,4,0,0,0,114,170,0,0,
-    0,130,2,0,0,115,18,0,0,0,12,5,4,3,4,2,
+    0,131,2,0,0,115,18,0,0,0,12,5,4,3,4,2,
     4,2,12,7,12,15,2,1,12,15,2,1,114,170,0,0,
     0,99,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
     0,0,64,0,0,0,115,48,0,0,0,101,0,90,1,100,
     0,90,2,100,1,90,3,100,2,100,3,132,0,90,4,100,
     4,100,5,132,0,90,5,100,6,100,7,132,0,90,6,100,
-    8,100,9,132,0,90,7,100,10,83,0,41,11,218,13,95,
+    8,100,9,132,0,90,7,168,10,83,0,41,11,218,13,95,
     76,111,97,100,101,114,66,97,115,105,99,115,122,83,66,97,
     115,101,32,99,108,97,115,115,32,111,102,32,99,111,109,109,
     111,110,32,99,111,100,101,32,110,101,101,100,101,100,32,98,
@@ -1039,25 +1039,25 @@ const unsigned char _Py_M__importlib_external[] = {
     41,5,114,102,0,0,0,114,121,0,0,0,114,96,0,0,
     0,90,13,102,105,108,101,110,97,109,101,95,98,97,115,101,
     90,9,116,97,105,108,95,110,97,109,101,114,2,0,0,0,
-    114,2,0,0,0,114,4,0,0,0,114,161,0,0,0,199,
+    114,2,0,0,0,114,4,0,0,0,114,161,0,0,0,200,
     2,0,0,115,8,0,0,0,0,3,18,1,16,1,14,1,
     122,24,95,76,111,97,100,101,114,66,97,115,105,99,115,46,
     105,115,95,112,97,99,107,97,103,101,99,2,0,0,0,0,
     0,0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,
-    4,0,0,0,100,1,83,0,41,2,122,42,85,115,101,32,
+    4,0,0,0,168,1,83,0,41,2,122,42,85,115,101,32,
     100,101,102,97,117,108,116,32,115,101,109,97,110,116,105,99,
     115,32,102,111,114,32,109,111,100,117,108,101,32,99,114,101,
     97,116,105,111,110,46,78,114,2,0,0,0,41,2,114,102,
     0,0,0,114,166,0,0,0,114,2,0,0,0,114,2,0,
     0,0,114,4,0,0,0,218,13,99,114,101,97,116,101,95,
-    109,111,100,117,108,101,207,2,0,0,115,0,0,0,0,122,
+    109,111,100,117,108,101,208,2,0,0,115,0,0,0,0,122,
     27,95,76,111,97,100,101,114,66,97,115,105,99,115,46,99,
     114,101,97,116,101,95,109,111,100,117,108,101,99,2,0,0,
     0,0,0,0,0,3,0,0,0,5,0,0,0,67,0,0,
-    0,115,56,0,0,0,124,0,160,0,124,1,106,1,161,1,
-    125,2,124,2,100,1,107,8,114,36,116,2,100,2,160,3,
-    124,1,106,1,161,1,131,1,130,1,116,4,160,5,116,6,
-    124,2,124,1,106,7,161,3,1,0,100,1,83,0,41,3,
+    0,115,56,0,0,0,124,0,160,0,166,1,106,1,161,1,
+    125,2,124,2,100,1,167,8,114,36,116,2,100,2,160,3,
+    166,1,106,1,161,1,131,1,130,1,116,4,160,5,116,6,
+    165,2,124,1,106,7,161,3,1,0,168,1,83,0,41,3,
     122,19,69,120,101,99,117,116,101,32,116,104,101,32,109,111,
     100,117,108,101,46,78,122,52,99,97,110,110,111,116,32,108,
     111,97,100,32,109,111,100,117,108,101,32,123,33,114,125,32,
@@ -1070,35 +1070,35 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,41,3,114,102,0,0,0,218,6,109,111,100,117,108,
     101,114,144,0,0,0,114,2,0,0,0,114,2,0,0,0,
     114,4,0,0,0,218,11,101,120,101,99,95,109,111,100,117,
-    108,101,210,2,0,0,115,10,0,0,0,0,2,12,1,8,
+    108,101,211,2,0,0,115,10,0,0,0,0,2,12,1,8,
     1,6,1,10,1,122,25,95,76,111,97,100,101,114,66,97,
     115,105,99,115,46,101,120,101,99,95,109,111,100,117,108,101,
     99,2,0,0,0,0,0,0,0,2,0,0,0,4,0,0,
-    0,67,0,0,0,115,12,0,0,0,116,0,160,1,124,0,
+    0,67,0,0,0,115,12,0,0,0,116,0,160,1,165,0,
     124,1,161,2,83,0,41,1,122,26,84,104,105,115,32,109,
     111,100,117,108,101,32,105,115,32,100,101,112,114,101,99,97,
     116,101,100,46,41,2,114,116,0,0,0,218,17,95,108,111,
     97,100,95,109,111,100,117,108,101,95,115,104,105,109,41,2,
     114,102,0,0,0,114,121,0,0,0,114,2,0,0,0,114,
     2,0,0,0,114,4,0,0,0,218,11,108,111,97,100,95,
-    109,111,100,117,108,101,218,2,0,0,115,2,0,0,0,0,
+    109,111,100,117,108,101,219,2,0,0,115,2,0,0,0,0,
     2,122,25,95,76,111,97,100,101,114,66,97,115,105,99,115,
     46,108,111,97,100,95,109,111,100,117,108,101,78,41,8,114,
     107,0,0,0,114,106,0,0,0,114,108,0,0,0,114,109,
     0,0,0,114,161,0,0,0,114,187,0,0,0,114,192,0,
     0,0,114,194,0,0,0,114,2,0,0,0,114,2,0,0,
     0,114,2,0,0,0,114,4,0,0,0,114,185,0,0,0,
-    194,2,0,0,115,8,0,0,0,12,5,8,8,8,3,8,
+    195,2,0,0,115,8,0,0,0,12,5,8,8,8,3,8,
     8,114,185,0,0,0,99,0,0,0,0,0,0,0,0,0,
     0,0,0,3,0,0,0,64,0,0,0,115,74,0,0,0,
     101,0,90,1,100,0,90,2,100,1,100,2,132,0,90,3,
     100,3,100,4,132,0,90,4,100,5,100,6,132,0,90,5,
     100,7,100,8,132,0,90,6,100,9,100,10,132,0,90,7,
     100,11,100,12,156,1,100,13,100,14,132,2,90,8,100,15,
-    100,16,132,0,90,9,100,17,83,0,41,18,218,12,83,111,
+    100,16,132,0,90,9,168,17,83,0,41,18,218,12,83,111,
     117,114,99,101,76,111,97,100,101,114,99,2,0,0,0,0,
     0,0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,
-    8,0,0,0,116,0,130,1,100,1,83,0,41,2,122,178,
+    8,0,0,0,116,0,130,1,168,1,83,0,41,2,122,178,
     79,112,116,105,111,110,97,108,32,109,101,116,104,111,100,32,
     116,104,97,116,32,114,101,116,117,114,110,115,32,116,104,101,
     32,109,111,100,105,102,105,99,97,116,105,111,110,32,116,105,
@@ -1113,7 +1113,7 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,78,41,1,114,40,0,0,0,41,2,114,102,0,0,
     0,114,35,0,0,0,114,2,0,0,0,114,2,0,0,0,
     114,4,0,0,0,218,10,112,97,116,104,95,109,116,105,109,
-    101,225,2,0,0,115,2,0,0,0,0,6,122,23,83,111,
+    101,226,2,0,0,115,2,0,0,0,0,6,122,23,83,111,
     117,114,99,101,76,111,97,100,101,114,46,112,97,116,104,95,
     109,116,105,109,101,99,2,0,0,0,0,0,0,0,2,0,
     0,0,4,0,0,0,67,0,0,0,115,14,0,0,0,100,
@@ -1148,11 +1148,11 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,41,1,114,196,0,0,0,41,2,114,102,0,0,
     0,114,35,0,0,0,114,2,0,0,0,114,2,0,0,0,
     114,4,0,0,0,218,10,112,97,116,104,95,115,116,97,116,
-    115,233,2,0,0,115,2,0,0,0,0,11,122,23,83,111,
+    115,234,2,0,0,115,2,0,0,0,0,11,122,23,83,111,
     117,114,99,101,76,111,97,100,101,114,46,112,97,116,104,95,
     115,116,97,116,115,99,4,0,0,0,0,0,0,0,4,0,
     0,0,4,0,0,0,67,0,0,0,115,12,0,0,0,124,
-    0,160,0,124,2,124,3,161,2,83,0,41,1,122,228,79,
+    0,160,0,165,2,124,3,161,2,83,0,41,1,122,228,79,
     112,116,105,111,110,97,108,32,109,101,116,104,111,100,32,119,
     104,105,99,104,32,119,114,105,116,101,115,32,100,97,116,97,
     32,40,98,121,116,101,115,41,32,116,111,32,97,32,102,105,
@@ -1171,11 +1171,11 @@ const unsigned char _Py_M__importlib_external[] = {
     4,114,102,0,0,0,114,92,0,0,0,90,10,99,97,99,
     104,101,95,112,97,116,104,114,54,0,0,0,114,2,0,0,
     0,114,2,0,0,0,114,4,0,0,0,218,15,95,99,97,
-    99,104,101,95,98,121,116,101,99,111,100,101,246,2,0,0,
+    99,104,101,95,98,121,116,101,99,111,100,101,247,2,0,0,
     115,2,0,0,0,0,8,122,28,83,111,117,114,99,101,76,
     111,97,100,101,114,46,95,99,97,99,104,101,95,98,121,116,
     101,99,111,100,101,99,3,0,0,0,0,0,0,0,3,0,
-    0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,100,
+    0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,168,
     1,83,0,41,2,122,150,79,112,116,105,111,110,97,108,32,
     109,101,116,104,111,100,32,119,104,105,99,104,32,119,114,105,
     116,101,115,32,100,97,116,97,32,40,98,121,116,101,115,41,
@@ -1188,13 +1188,13 @@ const unsigned char _Py_M__importlib_external[] = {
     108,101,115,46,10,32,32,32,32,32,32,32,32,78,114,2,
     0,0,0,41,3,114,102,0,0,0,114,35,0,0,0,114,
     54,0,0,0,114,2,0,0,0,114,2,0,0,0,114,4,
-    0,0,0,114,198,0,0,0,0,3,0,0,115,0,0,0,
+    0,0,0,114,198,0,0,0,1,3,0,0,115,0,0,0,
     0,122,21,83,111,117,114,99,101,76,111,97,100,101,114,46,
     115,101,116,95,100,97,116,97,99,2,0,0,0,0,0,0,
     0,5,0,0,0,10,0,0,0,67,0,0,0,115,82,0,
     0,0,124,0,160,0,124,1,161,1,125,2,122,14,124,0,
     160,1,124,2,161,1,125,3,87,0,110,48,4,0,116,2,
-    107,10,114,72,1,0,125,4,1,0,122,18,116,3,100,1,
+    167,10,114,72,1,0,125,4,1,0,122,18,116,3,100,1,
     124,1,100,2,141,2,124,4,130,2,87,0,53,0,100,3,
     125,4,126,4,88,0,89,0,110,2,88,0,116,4,124,3,
     131,1,83,0,41,4,122,52,67,111,110,99,114,101,116,101,
@@ -1209,13 +1209,13 @@ const unsigned char _Py_M__importlib_external[] = {
     102,0,0,0,114,121,0,0,0,114,35,0,0,0,114,155,
     0,0,0,218,3,101,120,99,114,2,0,0,0,114,2,0,
     0,0,114,4,0,0,0,218,10,103,101,116,95,115,111,117,
-    114,99,101,7,3,0,0,115,14,0,0,0,0,2,10,1,
+    114,99,101,8,3,0,0,115,14,0,0,0,0,2,10,1,
     2,1,14,1,16,1,4,1,28,1,122,23,83,111,117,114,
     99,101,76,111,97,100,101,114,46,103,101,116,95,115,111,117,
     114,99,101,114,89,0,0,0,41,1,218,9,95,111,112,116,
     105,109,105,122,101,99,3,0,0,0,1,0,0,0,4,0,
     0,0,8,0,0,0,67,0,0,0,115,22,0,0,0,116,
-    0,106,1,116,2,124,1,124,2,100,1,100,2,124,3,100,
+    0,106,1,116,2,165,1,124,2,100,1,100,2,124,3,100,
     3,141,6,83,0,41,4,122,130,82,101,116,117,114,110,32,
     116,104,101,32,99,111,100,101,32,111,98,106,101,99,116,32,
     99,111,109,112,105,108,101,100,32,102,114,111,109,32,115,111,
@@ -1231,42 +1231,42 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,54,0,0,0,114,35,0,0,0,114,203,0,0,
     0,114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,
     218,14,115,111,117,114,99,101,95,116,111,95,99,111,100,101,
-    17,3,0,0,115,4,0,0,0,0,5,12,1,122,27,83,
+    18,3,0,0,115,4,0,0,0,0,5,12,1,122,27,83,
     111,117,114,99,101,76,111,97,100,101,114,46,115,111,117,114,
     99,101,95,116,111,95,99,111,100,101,99,2,0,0,0,0,
     0,0,0,15,0,0,0,9,0,0,0,67,0,0,0,115,
     46,2,0,0,124,0,160,0,124,1,161,1,125,2,100,1,
     125,3,100,1,125,4,100,1,125,5,100,2,125,6,100,3,
     125,7,122,12,116,1,124,2,131,1,125,8,87,0,110,26,
-    4,0,116,2,107,10,114,68,1,0,1,0,1,0,100,1,
+    4,0,116,2,167,10,114,68,1,0,1,0,1,0,100,1,
     125,8,89,0,144,1,110,48,88,0,122,14,124,0,160,3,
-    124,2,161,1,125,9,87,0,110,22,4,0,116,4,107,10,
+    124,2,161,1,125,9,87,0,110,22,4,0,116,4,167,10,
     114,106,1,0,1,0,1,0,89,0,144,1,110,10,88,0,
     116,5,124,9,100,4,25,0,131,1,125,3,122,14,124,0,
     160,6,124,8,161,1,125,10,87,0,110,20,4,0,116,4,
-    107,10,114,154,1,0,1,0,1,0,89,0,110,218,88,0,
-    124,1,124,8,100,5,156,2,125,11,122,148,116,7,124,10,
+    167,10,114,154,1,0,1,0,1,0,89,0,110,218,88,0,
+    165,1,124,8,100,5,156,2,125,11,122,148,116,7,165,10,
     124,1,124,11,131,3,125,12,116,8,124,10,131,1,100,6,
     100,1,133,2,25,0,125,13,124,12,100,7,64,0,100,8,
     107,3,125,6,124,6,144,1,114,36,124,12,100,9,64,0,
     100,8,107,3,125,7,116,9,106,10,100,10,107,3,144,1,
     114,56,124,7,115,254,116,9,106,10,100,11,107,2,144,1,
     114,56,124,0,160,6,124,2,161,1,125,4,116,9,160,11,
-    116,12,124,4,161,2,125,5,116,13,124,10,124,5,124,1,
-    124,11,131,4,1,0,110,20,116,14,124,10,124,3,124,9,
-    100,12,25,0,124,1,124,11,131,5,1,0,87,0,110,26,
+    116,12,124,4,161,2,125,5,116,13,165,10,124,5,165,1,
+    124,11,131,4,1,0,110,20,116,14,165,10,124,3,124,9,
+    100,12,25,0,165,1,124,11,131,5,1,0,87,0,110,26,
     4,0,116,15,116,16,102,2,107,10,144,1,114,84,1,0,
     1,0,1,0,89,0,110,32,88,0,116,17,160,18,100,13,
-    124,8,124,2,161,3,1,0,116,19,124,13,124,1,124,8,
+    165,8,124,2,161,3,1,0,116,19,165,13,124,1,165,8,
     124,2,100,14,141,4,83,0,124,4,100,1,107,8,144,1,
     114,136,124,0,160,6,124,2,161,1,125,4,124,0,160,20,
-    124,4,124,2,161,2,125,14,116,17,160,18,100,15,124,2,
+    165,4,124,2,161,2,125,14,116,17,160,18,100,15,124,2,
     161,2,1,0,116,21,106,22,144,2,115,42,124,8,100,1,
     107,9,144,2,114,42,124,3,100,1,107,9,144,2,114,42,
     124,6,144,1,114,228,124,5,100,1,107,8,144,1,114,214,
-    116,9,160,11,124,4,161,1,125,5,116,23,124,14,124,5,
-    124,7,131,3,125,10,110,16,116,24,124,14,124,3,116,25,
-    124,4,131,1,131,3,125,10,122,30,124,0,160,26,124,2,
+    116,9,160,11,124,4,161,1,125,5,116,23,165,14,124,5,
+    124,7,131,3,125,10,110,16,116,24,165,14,124,3,116,25,
+    124,4,131,1,131,3,125,10,122,30,124,0,160,26,165,2,
     124,8,124,10,161,3,1,0,116,17,160,18,100,16,124,8,
     161,2,1,0,87,0,110,22,4,0,116,2,107,10,144,2,
     114,40,1,0,1,0,1,0,89,0,110,2,88,0,124,14,
@@ -1310,7 +1310,7 @@ const unsigned char _Py_M__importlib_external[] = {
     69,0,0,0,90,10,98,121,116,101,115,95,100,97,116,97,
     90,11,99,111,100,101,95,111,98,106,101,99,116,114,2,0,
     0,0,114,2,0,0,0,114,4,0,0,0,114,188,0,0,
-    0,25,3,0,0,115,134,0,0,0,0,7,10,1,4,1,
+    0,26,3,0,0,115,134,0,0,0,0,7,10,1,4,1,
     4,1,4,1,4,1,4,1,2,1,12,1,14,1,12,2,
     2,1,14,1,14,1,8,2,12,1,2,1,14,1,14,1,
     6,3,2,1,8,2,2,1,12,1,16,1,12,1,6,1,
@@ -1325,7 +1325,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,114,199,0,0,0,114,198,0,0,0,114,202,0,
     0,0,114,206,0,0,0,114,188,0,0,0,114,2,0,0,
     0,114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,
-    114,195,0,0,0,223,2,0,0,115,14,0,0,0,8,2,
+    114,195,0,0,0,224,2,0,0,115,14,0,0,0,8,2,
     8,8,8,13,8,10,8,7,8,10,14,8,114,195,0,0,
     0,99,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
     0,0,0,0,0,0,115,124,0,0,0,101,0,90,1,100,
@@ -1345,8 +1345,8 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,114,101,113,117,105,114,101,32,102,105,108,101,
     32,115,121,115,116,101,109,32,117,115,97,103,101,46,99,3,
     0,0,0,0,0,0,0,3,0,0,0,2,0,0,0,67,
-    0,0,0,115,16,0,0,0,124,1,124,0,95,0,124,2,
-    124,0,95,1,100,1,83,0,41,2,122,75,67,97,99,104,
+    0,0,0,115,16,0,0,0,165,1,124,0,95,0,165,2,
+    124,0,95,1,168,1,83,0,41,2,122,75,67,97,99,104,
     101,32,116,104,101,32,109,111,100,117,108,101,32,110,97,109,
     101,32,97,110,100,32,116,104,101,32,112,97,116,104,32,116,
     111,32,116,104,101,32,102,105,108,101,32,102,111,117,110,100,
@@ -1354,24 +1354,24 @@ const unsigned char _Py_M__importlib_external[] = {
     102,105,110,100,101,114,46,78,41,2,114,100,0,0,0,114,
     35,0,0,0,41,3,114,102,0,0,0,114,121,0,0,0,
     114,35,0,0,0,114,2,0,0,0,114,2,0,0,0,114,
-    4,0,0,0,114,186,0,0,0,116,3,0,0,115,4,0,
+    4,0,0,0,114,186,0,0,0,117,3,0,0,115,4,0,
     0,0,0,3,6,1,122,19,70,105,108,101,76,111,97,100,
     101,114,46,95,95,105,110,105,116,95,95,99,2,0,0,0,
     0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,
-    115,24,0,0,0,124,0,106,0,124,1,106,0,107,2,111,
-    22,124,0,106,1,124,1,106,1,107,2,83,0,41,1,78,
+    115,24,0,0,0,166,0,106,0,166,1,106,0,107,2,111,
+    22,166,0,106,1,166,1,106,1,107,2,83,0,41,1,78,
     41,2,218,9,95,95,99,108,97,115,115,95,95,114,113,0,
     0,0,41,2,114,102,0,0,0,218,5,111,116,104,101,114,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,218,
-    6,95,95,101,113,95,95,122,3,0,0,115,4,0,0,0,
+    6,95,95,101,113,95,95,123,3,0,0,115,4,0,0,0,
     0,1,12,1,122,17,70,105,108,101,76,111,97,100,101,114,
     46,95,95,101,113,95,95,99,1,0,0,0,0,0,0,0,
     1,0,0,0,3,0,0,0,67,0,0,0,115,20,0,0,
-    0,116,0,124,0,106,1,131,1,116,0,124,0,106,2,131,
+    0,116,0,166,0,106,1,131,1,116,0,166,0,106,2,131,
     1,65,0,83,0,41,1,78,41,3,218,4,104,97,115,104,
     114,100,0,0,0,114,35,0,0,0,41,1,114,102,0,0,
     0,114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,
-    218,8,95,95,104,97,115,104,95,95,126,3,0,0,115,2,
+    218,8,95,95,104,97,115,104,95,95,127,3,0,0,115,2,
     0,0,0,0,1,122,19,70,105,108,101,76,111,97,100,101,
     114,46,95,95,104,97,115,104,95,95,99,2,0,0,0,0,
     0,0,0,2,0,0,0,3,0,0,0,3,0,0,0,115,
@@ -1386,43 +1386,43 @@ const unsigned char _Py_M__importlib_external[] = {
     115,117,112,101,114,114,212,0,0,0,114,194,0,0,0,41,
     2,114,102,0,0,0,114,121,0,0,0,41,1,114,213,0,
     0,0,114,2,0,0,0,114,4,0,0,0,114,194,0,0,
-    0,129,3,0,0,115,2,0,0,0,0,10,122,22,70,105,
+    0,130,3,0,0,115,2,0,0,0,0,10,122,22,70,105,
     108,101,76,111,97,100,101,114,46,108,111,97,100,95,109,111,
     100,117,108,101,99,2,0,0,0,0,0,0,0,2,0,0,
-    0,1,0,0,0,67,0,0,0,115,6,0,0,0,124,0,
+    0,1,0,0,0,67,0,0,0,115,6,0,0,0,166,0,
     106,0,83,0,41,1,122,58,82,101,116,117,114,110,32,116,
     104,101,32,112,97,116,104,32,116,111,32,116,104,101,32,115,
     111,117,114,99,101,32,102,105,108,101,32,97,115,32,102,111,
     117,110,100,32,98,121,32,116,104,101,32,102,105,110,100,101,
     114,46,41,1,114,35,0,0,0,41,2,114,102,0,0,0,
     114,121,0,0,0,114,2,0,0,0,114,2,0,0,0,114,
-    4,0,0,0,114,159,0,0,0,141,3,0,0,115,2,0,
+    4,0,0,0,114,159,0,0,0,142,3,0,0,115,2,0,
     0,0,0,3,122,23,70,105,108,101,76,111,97,100,101,114,
     46,103,101,116,95,102,105,108,101,110,97,109,101,99,2,0,
     0,0,0,0,0,0,3,0,0,0,10,0,0,0,67,0,
     0,0,115,44,0,0,0,116,0,160,1,124,1,100,1,161,
     2,143,22,125,2,124,2,160,2,161,0,87,0,2,0,53,
-    0,81,0,82,0,163,0,83,0,81,0,82,0,88,0,100,
+    0,81,0,82,0,163,0,83,0,81,0,82,0,88,0,168,
     2,83,0,41,3,122,39,82,101,116,117,114,110,32,116,104,
     101,32,100,97,116,97,32,102,114,111,109,32,112,97,116,104,
     32,97,115,32,114,97,119,32,98,121,116,101,115,46,218,1,
     114,78,41,3,114,50,0,0,0,114,51,0,0,0,90,4,
     114,101,97,100,41,3,114,102,0,0,0,114,35,0,0,0,
     114,55,0,0,0,114,2,0,0,0,114,2,0,0,0,114,
-    4,0,0,0,114,200,0,0,0,146,3,0,0,115,4,0,
+    4,0,0,0,114,200,0,0,0,147,3,0,0,115,4,0,
     0,0,0,2,14,1,122,19,70,105,108,101,76,111,97,100,
     101,114,46,103,101,116,95,100,97,116,97,99,2,0,0,0,
     0,0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,
     115,18,0,0,0,124,0,160,0,124,1,161,1,114,14,124,
-    0,83,0,100,0,83,0,41,1,78,41,1,114,161,0,0,
+    0,83,0,168,0,83,0,41,1,78,41,1,114,161,0,0,
     0,41,2,114,102,0,0,0,114,191,0,0,0,114,2,0,
     0,0,114,2,0,0,0,114,4,0,0,0,218,19,103,101,
     116,95,114,101,115,111,117,114,99,101,95,114,101,97,100,101,
-    114,153,3,0,0,115,6,0,0,0,0,2,10,1,4,1,
+    114,154,3,0,0,115,6,0,0,0,0,2,10,1,4,1,
     122,30,70,105,108,101,76,111,97,100,101,114,46,103,101,116,
     95,114,101,115,111,117,114,99,101,95,114,101,97,100,101,114,
     99,2,0,0,0,0,0,0,0,3,0,0,0,4,0,0,
-    0,67,0,0,0,115,32,0,0,0,116,0,116,1,124,0,
+    0,67,0,0,0,115,32,0,0,0,116,0,116,1,166,0,
     106,2,131,1,100,1,25,0,124,1,131,2,125,2,116,3,
     160,4,124,2,100,2,161,2,83,0,41,3,78,114,60,0,
     0,0,114,219,0,0,0,41,5,114,28,0,0,0,114,38,
@@ -1430,12 +1430,12 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,41,3,114,102,0,0,0,218,8,114,101,115,111,117,
     114,99,101,114,35,0,0,0,114,2,0,0,0,114,2,0,
     0,0,114,4,0,0,0,218,13,111,112,101,110,95,114,101,
-    115,111,117,114,99,101,159,3,0,0,115,4,0,0,0,0,
+    115,111,117,114,99,101,160,3,0,0,115,4,0,0,0,0,
     1,20,1,122,24,70,105,108,101,76,111,97,100,101,114,46,
     111,112,101,110,95,114,101,115,111,117,114,99,101,99,2,0,
     0,0,0,0,0,0,3,0,0,0,3,0,0,0,67,0,
     0,0,115,38,0,0,0,124,0,160,0,124,1,161,1,115,
-    14,116,1,130,1,116,2,116,3,124,0,106,4,131,1,100,
+    14,116,1,130,1,116,2,116,3,166,0,106,4,131,1,100,
     1,25,0,124,1,131,2,125,2,124,2,83,0,41,2,78,
     114,60,0,0,0,41,5,218,11,105,115,95,114,101,115,111,
     117,114,99,101,218,17,70,105,108,101,78,111,116,70,111,117,
@@ -1443,28 +1443,28 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,35,0,0,0,41,3,114,102,0,0,0,114,221,0,
     0,0,114,35,0,0,0,114,2,0,0,0,114,2,0,0,
     0,114,4,0,0,0,218,13,114,101,115,111,117,114,99,101,
-    95,112,97,116,104,163,3,0,0,115,8,0,0,0,0,1,
+    95,112,97,116,104,164,3,0,0,115,8,0,0,0,0,1,
     10,1,4,1,20,1,122,24,70,105,108,101,76,111,97,100,
     101,114,46,114,101,115,111,117,114,99,101,95,112,97,116,104,
     99,2,0,0,0,0,0,0,0,3,0,0,0,3,0,0,
-    0,67,0,0,0,115,40,0,0,0,116,0,124,1,107,6,
-    114,12,100,1,83,0,116,1,116,2,124,0,106,3,131,1,
+    0,67,0,0,0,115,40,0,0,0,116,0,124,1,167,6,
+    114,12,168,1,83,0,116,1,116,2,166,0,106,3,131,1,
     100,2,25,0,124,1,131,2,125,2,116,4,124,2,131,1,
     83,0,41,3,78,70,114,60,0,0,0,41,5,114,25,0,
     0,0,114,28,0,0,0,114,38,0,0,0,114,35,0,0,
     0,114,44,0,0,0,41,3,114,102,0,0,0,114,100,0,
     0,0,114,35,0,0,0,114,2,0,0,0,114,2,0,0,
-    0,114,4,0,0,0,114,223,0,0,0,169,3,0,0,115,
+    0,114,4,0,0,0,114,223,0,0,0,170,3,0,0,115,
     8,0,0,0,0,1,8,1,4,1,20,1,122,22,70,105,
     108,101,76,111,97,100,101,114,46,105,115,95,114,101,115,111,
     117,114,99,101,99,1,0,0,0,0,0,0,0,1,0,0,
     0,5,0,0,0,67,0,0,0,115,24,0,0,0,116,0,
-    116,1,160,2,116,3,124,0,106,4,131,1,100,1,25,0,
+    116,1,160,2,116,3,166,0,106,4,131,1,100,1,25,0,
     161,1,131,1,83,0,41,2,78,114,60,0,0,0,41,5,
     218,4,105,116,101,114,114,1,0,0,0,218,7,108,105,115,
     116,100,105,114,114,38,0,0,0,114,35,0,0,0,41,1,
     114,102,0,0,0,114,2,0,0,0,114,2,0,0,0,114,
-    4,0,0,0,218,8,99,111,110,116,101,110,116,115,175,3,
+    4,0,0,0,218,8,99,111,110,116,101,110,116,115,176,3,
     0,0,115,2,0,0,0,0,1,122,19,70,105,108,101,76,
     111,97,100,101,114,46,99,111,110,116,101,110,116,115,41,17,
     114,107,0,0,0,114,106,0,0,0,114,108,0,0,0,114,
@@ -1474,39 +1474,39 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,225,0,0,0,114,223,0,0,0,114,228,0,0,0,
     90,13,95,95,99,108,97,115,115,99,101,108,108,95,95,114,
     2,0,0,0,114,2,0,0,0,41,1,114,213,0,0,0,
-    114,4,0,0,0,114,212,0,0,0,111,3,0,0,115,22,
+    114,4,0,0,0,114,212,0,0,0,112,3,0,0,115,22,
     0,0,0,12,5,8,6,8,4,8,3,16,12,12,5,8,
     7,12,6,8,4,8,6,8,6,114,212,0,0,0,99,0,
     0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,
     0,0,0,115,46,0,0,0,101,0,90,1,100,0,90,2,
     100,1,90,3,100,2,100,3,132,0,90,4,100,4,100,5,
     132,0,90,5,100,6,100,7,156,1,100,8,100,9,132,2,
-    90,6,100,10,83,0,41,11,218,16,83,111,117,114,99,101,
+    90,6,168,10,83,0,41,11,218,16,83,111,117,114,99,101,
     70,105,108,101,76,111,97,100,101,114,122,62,67,111,110,99,
     114,101,116,101,32,105,109,112,108,101,109,101,110,116,97,116,
     105,111,110,32,111,102,32,83,111,117,114,99,101,76,111,97,
     100,101,114,32,117,115,105,110,103,32,116,104,101,32,102,105,
     108,101,32,115,121,115,116,101,109,46,99,2,0,0,0,0,
     0,0,0,3,0,0,0,3,0,0,0,67,0,0,0,115,
-    22,0,0,0,116,0,124,1,131,1,125,2,124,2,106,1,
-    124,2,106,2,100,1,156,2,83,0,41,2,122,33,82,101,
+    22,0,0,0,116,0,124,1,131,1,125,2,166,2,106,1,
+    166,2,106,2,100,1,156,2,83,0,41,2,122,33,82,101,
     116,117,114,110,32,116,104,101,32,109,101,116,97,100,97,116,
     97,32,102,111,114,32,116,104,101,32,112,97,116,104,46,41,
     2,114,149,0,0,0,114,207,0,0,0,41,3,114,39,0,
     0,0,218,8,115,116,95,109,116,105,109,101,90,7,115,116,
     95,115,105,122,101,41,3,114,102,0,0,0,114,35,0,0,
     0,114,211,0,0,0,114,2,0,0,0,114,2,0,0,0,
-    114,4,0,0,0,114,197,0,0,0,183,3,0,0,115,4,
+    114,4,0,0,0,114,197,0,0,0,184,3,0,0,115,4,
     0,0,0,0,2,8,1,122,27,83,111,117,114,99,101,70,
     105,108,101,76,111,97,100,101,114,46,112,97,116,104,95,115,
     116,97,116,115,99,4,0,0,0,0,0,0,0,5,0,0,
     0,5,0,0,0,67,0,0,0,115,24,0,0,0,116,0,
-    124,1,131,1,125,4,124,0,106,1,124,2,124,3,124,4,
+    124,1,131,1,125,4,166,0,106,1,165,2,124,3,124,4,
     100,1,141,3,83,0,41,2,78,41,1,218,5,95,109,111,
     100,101,41,2,114,99,0,0,0,114,198,0,0,0,41,5,
     114,102,0,0,0,114,92,0,0,0,114,91,0,0,0,114,
     54,0,0,0,114,42,0,0,0,114,2,0,0,0,114,2,
-    0,0,0,114,4,0,0,0,114,199,0,0,0,188,3,0,
+    0,0,0,114,4,0,0,0,114,199,0,0,0,189,3,0,
     0,115,4,0,0,0,0,2,8,1,122,32,83,111,117,114,
     99,101,70,105,108,101,76,111,97,100,101,114,46,95,99,97,
     99,104,101,95,98,121,116,101,99,111,100,101,105,182,1,0,
@@ -1516,18 +1516,18 @@ const unsigned char _Py_M__importlib_external[] = {
     125,6,124,4,114,52,116,1,124,4,131,1,115,52,116,0,
     124,4,131,1,92,2,125,4,125,7,124,6,160,2,124,7,
     161,1,1,0,113,16,116,3,124,6,131,1,68,0,93,108,
-    125,7,116,4,124,4,124,7,131,2,125,4,122,14,116,5,
+    125,7,116,4,165,4,124,7,131,2,125,4,122,14,116,5,
     160,6,124,4,161,1,1,0,87,0,113,60,4,0,116,7,
-    107,10,114,112,1,0,1,0,1,0,89,0,113,60,89,0,
-    113,60,4,0,116,8,107,10,114,166,1,0,125,8,1,0,
-    122,26,116,9,160,10,100,1,124,4,124,8,161,3,1,0,
-    87,0,89,0,162,6,1,0,100,2,83,0,100,2,125,8,
+    167,10,114,112,1,0,1,0,1,0,89,0,113,60,89,0,
+    113,60,4,0,116,8,167,10,114,166,1,0,125,8,1,0,
+    122,26,116,9,160,10,100,1,165,4,124,8,161,3,1,0,
+    87,0,89,0,162,6,1,0,168,2,83,0,100,2,125,8,
     126,8,88,0,89,0,113,60,88,0,113,60,122,28,116,11,
-    124,1,124,2,124,3,131,3,1,0,116,9,160,10,100,3,
-    124,1,161,2,1,0,87,0,110,48,4,0,116,8,107,10,
+    165,1,124,2,124,3,131,3,1,0,116,9,160,10,100,3,
+    124,1,161,2,1,0,87,0,110,48,4,0,116,8,167,10,
     114,246,1,0,125,8,1,0,122,18,116,9,160,10,100,1,
-    124,1,124,8,161,3,1,0,87,0,53,0,100,2,125,8,
-    126,8,88,0,89,0,110,2,88,0,100,2,83,0,41,4,
+    165,1,124,8,161,3,1,0,87,0,53,0,100,2,125,8,
+    126,8,88,0,89,0,110,2,88,0,168,2,83,0,41,4,
     122,27,87,114,105,116,101,32,98,121,116,101,115,32,100,97,
     116,97,32,116,111,32,97,32,102,105,108,101,46,122,27,99,
     111,117,108,100,32,110,111,116,32,99,114,101,97,116,101,32,
@@ -1541,7 +1541,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,54,0,0,0,114,231,0,0,0,218,6,112,97,114,
     101,110,116,114,96,0,0,0,114,27,0,0,0,114,23,0,
     0,0,114,201,0,0,0,114,2,0,0,0,114,2,0,0,
-    0,114,4,0,0,0,114,198,0,0,0,193,3,0,0,115,
+    0,114,4,0,0,0,114,198,0,0,0,194,3,0,0,115,
     42,0,0,0,0,2,12,1,4,2,12,1,12,1,12,2,
     12,1,10,1,2,1,14,1,14,2,8,1,16,3,6,1,
     8,1,28,1,2,1,12,1,16,1,16,2,8,1,122,25,
@@ -1550,46 +1550,46 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,106,0,0,0,114,108,0,0,0,114,109,0,0,0,
     114,197,0,0,0,114,199,0,0,0,114,198,0,0,0,114,
     2,0,0,0,114,2,0,0,0,114,2,0,0,0,114,4,
-    0,0,0,114,229,0,0,0,179,3,0,0,115,6,0,0,
+    0,0,0,114,229,0,0,0,180,3,0,0,115,6,0,0,
     0,12,4,8,5,8,5,114,229,0,0,0,99,0,0,0,
     0,0,0,0,0,0,0,0,0,2,0,0,0,64,0,0,
     0,115,32,0,0,0,101,0,90,1,100,0,90,2,100,1,
     90,3,100,2,100,3,132,0,90,4,100,4,100,5,132,0,
-    90,5,100,6,83,0,41,7,218,20,83,111,117,114,99,101,
+    90,5,168,6,83,0,41,7,218,20,83,111,117,114,99,101,
     108,101,115,115,70,105,108,101,76,111,97,100,101,114,122,45,
     76,111,97,100,101,114,32,119,104,105,99,104,32,104,97,110,
     100,108,101,115,32,115,111,117,114,99,101,108,101,115,115,32,
     102,105,108,101,32,105,109,112,111,114,116,115,46,99,2,0,
     0,0,0,0,0,0,5,0,0,0,5,0,0,0,67,0,
     0,0,115,68,0,0,0,124,0,160,0,124,1,161,1,125,
-    2,124,0,160,1,124,2,161,1,125,3,124,1,124,2,100,
-    1,156,2,125,4,116,2,124,3,124,1,124,4,131,3,1,
+    2,124,0,160,1,124,2,161,1,125,3,165,1,124,2,100,
+    1,156,2,125,4,116,2,165,3,124,1,124,4,131,3,1,
     0,116,3,116,4,124,3,131,1,100,2,100,0,133,2,25,
-    0,124,1,124,2,100,3,141,3,83,0,41,4,78,41,2,
+    0,165,1,124,2,100,3,141,3,83,0,41,4,78,41,2,
     114,100,0,0,0,114,35,0,0,0,114,126,0,0,0,41,
     2,114,100,0,0,0,114,91,0,0,0,41,5,114,159,0,
     0,0,114,200,0,0,0,114,133,0,0,0,114,145,0,0,
     0,114,208,0,0,0,41,5,114,102,0,0,0,114,121,0,
     0,0,114,35,0,0,0,114,54,0,0,0,114,132,0,0,
     0,114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,
-    114,188,0,0,0,228,3,0,0,115,18,0,0,0,0,1,
+    114,188,0,0,0,229,3,0,0,115,18,0,0,0,0,1,
     10,1,10,4,2,1,8,2,12,1,2,1,14,1,2,1,
     122,29,83,111,117,114,99,101,108,101,115,115,70,105,108,101,
     76,111,97,100,101,114,46,103,101,116,95,99,111,100,101,99,
     2,0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,
-    67,0,0,0,115,4,0,0,0,100,1,83,0,41,2,122,
+    67,0,0,0,115,4,0,0,0,168,1,83,0,41,2,122,
     39,82,101,116,117,114,110,32,78,111,110,101,32,97,115,32,
     116,104,101,114,101,32,105,115,32,110,111,32,115,111,117,114,
     99,101,32,99,111,100,101,46,78,114,2,0,0,0,41,2,
     114,102,0,0,0,114,121,0,0,0,114,2,0,0,0,114,
-    2,0,0,0,114,4,0,0,0,114,202,0,0,0,244,3,
+    2,0,0,0,114,4,0,0,0,114,202,0,0,0,245,3,
     0,0,115,2,0,0,0,0,2,122,31,83,111,117,114,99,
     101,108,101,115,115,70,105,108,101,76,111,97,100,101,114,46,
     103,101,116,95,115,111,117,114,99,101,78,41,6,114,107,0,
     0,0,114,106,0,0,0,114,108,0,0,0,114,109,0,0,
     0,114,188,0,0,0,114,202,0,0,0,114,2,0,0,0,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,114,
-    234,0,0,0,224,3,0,0,115,4,0,0,0,12,4,8,
+    234,0,0,0,225,3,0,0,115,4,0,0,0,12,4,8,
     16,114,234,0,0,0,99,0,0,0,0,0,0,0,0,0,
     0,0,0,3,0,0,0,64,0,0,0,115,92,0,0,0,
     101,0,90,1,100,0,90,2,100,1,90,3,100,2,100,3,
@@ -1597,7 +1597,7 @@ const unsigned char _Py_M__importlib_external[] = {
     132,0,90,6,100,8,100,9,132,0,90,7,100,10,100,11,
     132,0,90,8,100,12,100,13,132,0,90,9,100,14,100,15,
     132,0,90,10,100,16,100,17,132,0,90,11,101,12,100,18,
-    100,19,132,0,131,1,90,13,100,20,83,0,41,21,218,19,
+    100,19,132,0,131,1,90,13,168,20,83,0,41,21,218,19,
     69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,
     100,101,114,122,93,76,111,97,100,101,114,32,102,111,114,32,
     101,120,116,101,110,115,105,111,110,32,109,111,100,117,108,101,
@@ -1606,34 +1606,34 @@ const unsigned char _Py_M__importlib_external[] = {
     110,101,100,32,116,111,32,119,111,114,107,32,119,105,116,104,
     32,70,105,108,101,70,105,110,100,101,114,46,10,10,32,32,
     32,32,99,3,0,0,0,0,0,0,0,3,0,0,0,2,
-    0,0,0,67,0,0,0,115,16,0,0,0,124,1,124,0,
-    95,0,124,2,124,0,95,1,100,0,83,0,41,1,78,41,
+    0,0,0,67,0,0,0,115,16,0,0,0,165,1,124,0,
+    95,0,165,2,124,0,95,1,168,0,83,0,41,1,78,41,
     2,114,100,0,0,0,114,35,0,0,0,41,3,114,102,0,
     0,0,114,100,0,0,0,114,35,0,0,0,114,2,0,0,
     0,114,2,0,0,0,114,4,0,0,0,114,186,0,0,0,
-    5,4,0,0,115,4,0,0,0,0,1,6,1,122,28,69,
+    6,4,0,0,115,4,0,0,0,0,1,6,1,122,28,69,
     120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
     101,114,46,95,95,105,110,105,116,95,95,99,2,0,0,0,
     0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,
-    115,24,0,0,0,124,0,106,0,124,1,106,0,107,2,111,
-    22,124,0,106,1,124,1,106,1,107,2,83,0,41,1,78,
+    115,24,0,0,0,166,0,106,0,166,1,106,0,107,2,111,
+    22,166,0,106,1,166,1,106,1,107,2,83,0,41,1,78,
     41,2,114,213,0,0,0,114,113,0,0,0,41,2,114,102,
     0,0,0,114,214,0,0,0,114,2,0,0,0,114,2,0,
-    0,0,114,4,0,0,0,114,215,0,0,0,9,4,0,0,
+    0,0,114,4,0,0,0,114,215,0,0,0,10,4,0,0,
     115,4,0,0,0,0,1,12,1,122,26,69,120,116,101,110,
     115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,95,
     95,101,113,95,95,99,1,0,0,0,0,0,0,0,1,0,
     0,0,3,0,0,0,67,0,0,0,115,20,0,0,0,116,
-    0,124,0,106,1,131,1,116,0,124,0,106,2,131,1,65,
+    0,166,0,106,1,131,1,116,0,166,0,106,2,131,1,65,
     0,83,0,41,1,78,41,3,114,216,0,0,0,114,100,0,
     0,0,114,35,0,0,0,41,1,114,102,0,0,0,114,2,
     0,0,0,114,2,0,0,0,114,4,0,0,0,114,217,0,
-    0,0,13,4,0,0,115,2,0,0,0,0,1,122,28,69,
+    0,0,14,4,0,0,115,2,0,0,0,0,1,122,28,69,
     120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
     101,114,46,95,95,104,97,115,104,95,95,99,2,0,0,0,
     0,0,0,0,3,0,0,0,5,0,0,0,67,0,0,0,
     115,36,0,0,0,116,0,160,1,116,2,106,3,124,1,161,
-    2,125,2,116,0,160,4,100,1,124,1,106,5,124,0,106,
+    2,125,2,116,0,160,4,100,1,166,1,106,5,166,0,106,
     6,161,3,1,0,124,2,83,0,41,2,122,38,67,114,101,
     97,116,101,32,97,110,32,117,110,105,116,105,97,108,105,122,
     101,100,32,101,120,116,101,110,115,105,111,110,32,109,111,100,
@@ -1645,14 +1645,14 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,100,0,0,0,114,35,0,0,0,41,3,114,102,0,
     0,0,114,166,0,0,0,114,191,0,0,0,114,2,0,0,
     0,114,2,0,0,0,114,4,0,0,0,114,187,0,0,0,
-    16,4,0,0,115,10,0,0,0,0,2,4,1,10,1,6,
+    17,4,0,0,115,10,0,0,0,0,2,4,1,10,1,6,
     1,12,1,122,33,69,120,116,101,110,115,105,111,110,70,105,
     108,101,76,111,97,100,101,114,46,99,114,101,97,116,101,95,
     109,111,100,117,108,101,99,2,0,0,0,0,0,0,0,2,
     0,0,0,5,0,0,0,67,0,0,0,115,36,0,0,0,
     116,0,160,1,116,2,106,3,124,1,161,2,1,0,116,0,
-    160,4,100,1,124,0,106,5,124,0,106,6,161,3,1,0,
-    100,2,83,0,41,3,122,30,73,110,105,116,105,97,108,105,
+    160,4,100,1,166,0,106,5,166,0,106,6,161,3,1,0,
+    168,2,83,0,41,3,122,30,73,110,105,116,105,97,108,105,
     122,101,32,97,110,32,101,120,116,101,110,115,105,111,110,32,
     109,111,100,117,108,101,122,40,101,120,116,101,110,115,105,111,
     110,32,109,111,100,117,108,101,32,123,33,114,125,32,101,120,
@@ -1661,12 +1661,12 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,90,12,101,120,101,99,95,100,121,110,97,109,105,99,
     114,130,0,0,0,114,100,0,0,0,114,35,0,0,0,41,
     2,114,102,0,0,0,114,191,0,0,0,114,2,0,0,0,
-    114,2,0,0,0,114,4,0,0,0,114,192,0,0,0,24,
+    114,2,0,0,0,114,4,0,0,0,114,192,0,0,0,25,
     4,0,0,115,6,0,0,0,0,2,14,1,6,1,122,31,
     69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,
     100,101,114,46,101,120,101,99,95,109,111,100,117,108,101,99,
     2,0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,
-    3,0,0,0,115,36,0,0,0,116,0,124,0,106,1,131,
+    3,0,0,0,115,36,0,0,0,116,0,166,0,106,1,131,
     1,100,1,25,0,137,0,116,2,135,0,102,1,100,2,100,
     3,132,8,116,3,68,0,131,1,131,1,83,0,41,4,122,
     49,82,101,116,117,114,110,32,84,114,117,101,32,105,102,32,
@@ -1675,11 +1675,11 @@ const unsigned char _Py_M__importlib_external[] = {
     101,46,114,29,0,0,0,99,1,0,0,0,0,0,0,0,
     2,0,0,0,4,0,0,0,51,0,0,0,115,26,0,0,
     0,124,0,93,18,125,1,136,0,100,0,124,1,23,0,107,
-    2,86,0,1,0,113,2,100,1,83,0,41,2,114,186,0,
+    2,86,0,1,0,113,2,168,1,83,0,41,2,114,186,0,
     0,0,78,114,2,0,0,0,41,2,114,22,0,0,0,218,
     6,115,117,102,102,105,120,41,1,218,9,102,105,108,101,95,
     110,97,109,101,114,2,0,0,0,114,4,0,0,0,218,9,
-    60,103,101,110,101,120,112,114,62,33,4,0,0,115,2,0,
+    60,103,101,110,101,120,112,114,62,34,4,0,0,115,2,0,
     0,0,4,1,122,49,69,120,116,101,110,115,105,111,110,70,
     105,108,101,76,111,97,100,101,114,46,105,115,95,112,97,99,
     107,97,103,101,46,60,108,111,99,97,108,115,62,46,60,103,
@@ -1687,40 +1687,40 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,218,3,97,110,121,218,18,69,88,84,69,78,83,
     73,79,78,95,83,85,70,70,73,88,69,83,41,2,114,102,
     0,0,0,114,121,0,0,0,114,2,0,0,0,41,1,114,
-    237,0,0,0,114,4,0,0,0,114,161,0,0,0,30,4,
+    237,0,0,0,114,4,0,0,0,114,161,0,0,0,31,4,
     0,0,115,6,0,0,0,0,2,14,1,12,1,122,30,69,
     120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
     101,114,46,105,115,95,112,97,99,107,97,103,101,99,2,0,
     0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,0,
-    0,0,115,4,0,0,0,100,1,83,0,41,2,122,63,82,
+    0,0,115,4,0,0,0,168,1,83,0,41,2,122,63,82,
     101,116,117,114,110,32,78,111,110,101,32,97,115,32,97,110,
     32,101,120,116,101,110,115,105,111,110,32,109,111,100,117,108,
     101,32,99,97,110,110,111,116,32,99,114,101,97,116,101,32,
     97,32,99,111,100,101,32,111,98,106,101,99,116,46,78,114,
     2,0,0,0,41,2,114,102,0,0,0,114,121,0,0,0,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,114,
-    188,0,0,0,36,4,0,0,115,2,0,0,0,0,2,122,
+    188,0,0,0,37,4,0,0,115,2,0,0,0,0,2,122,
     28,69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,
     97,100,101,114,46,103,101,116,95,99,111,100,101,99,2,0,
     0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,0,
-    0,0,115,4,0,0,0,100,1,83,0,41,2,122,53,82,
+    0,0,115,4,0,0,0,168,1,83,0,41,2,122,53,82,
     101,116,117,114,110,32,78,111,110,101,32,97,115,32,101,120,
     116,101,110,115,105,111,110,32,109,111,100,117,108,101,115,32,
     104,97,118,101,32,110,111,32,115,111,117,114,99,101,32,99,
     111,100,101,46,78,114,2,0,0,0,41,2,114,102,0,0,
     0,114,121,0,0,0,114,2,0,0,0,114,2,0,0,0,
-    114,4,0,0,0,114,202,0,0,0,40,4,0,0,115,2,
+    114,4,0,0,0,114,202,0,0,0,41,4,0,0,115,2,
     0,0,0,0,2,122,30,69,120,116,101,110,115,105,111,110,
     70,105,108,101,76,111,97,100,101,114,46,103,101,116,95,115,
     111,117,114,99,101,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,1,0,0,0,67,0,0,0,115,6,0,0,0,124,
+    0,0,1,0,0,0,67,0,0,0,115,6,0,0,0,166,
     0,106,0,83,0,41,1,122,58,82,101,116,117,114,110,32,
     116,104,101,32,112,97,116,104,32,116,111,32,116,104,101,32,
     115,111,117,114,99,101,32,102,105,108,101,32,97,115,32,102,
     111,117,110,100,32,98,121,32,116,104,101,32,102,105,110,100,
     101,114,46,41,1,114,35,0,0,0,41,2,114,102,0,0,
     0,114,121,0,0,0,114,2,0,0,0,114,2,0,0,0,
-    114,4,0,0,0,114,159,0,0,0,44,4,0,0,115,2,
+    114,4,0,0,0,114,159,0,0,0,45,4,0,0,115,2,
     0,0,0,0,3,122,32,69,120,116,101,110,115,105,111,110,
     70,105,108,101,76,111,97,100,101,114,46,103,101,116,95,102,
     105,108,101,110,97,109,101,78,41,14,114,107,0,0,0,114,
@@ -1729,7 +1729,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,192,0,0,0,114,161,0,0,0,114,188,0,0,
     0,114,202,0,0,0,114,118,0,0,0,114,159,0,0,0,
     114,2,0,0,0,114,2,0,0,0,114,2,0,0,0,114,
-    4,0,0,0,114,235,0,0,0,253,3,0,0,115,18,0,
+    4,0,0,0,114,235,0,0,0,254,3,0,0,115,18,0,
     0,0,12,8,8,4,8,4,8,3,8,8,8,6,8,6,
     8,4,8,4,114,235,0,0,0,99,0,0,0,0,0,0,
     0,0,0,0,0,0,2,0,0,0,64,0,0,0,115,96,
@@ -1738,7 +1738,7 @@ const unsigned char _Py_M__importlib_external[] = {
     6,100,7,132,0,90,6,100,8,100,9,132,0,90,7,100,
     10,100,11,132,0,90,8,100,12,100,13,132,0,90,9,100,
     14,100,15,132,0,90,10,100,16,100,17,132,0,90,11,100,
-    18,100,19,132,0,90,12,100,20,100,21,132,0,90,13,100,
+    18,100,19,132,0,90,12,100,20,100,21,132,0,90,13,168,
     22,83,0,41,23,218,14,95,78,97,109,101,115,112,97,99,
     101,80,97,116,104,97,38,1,0,0,82,101,112,114,101,115,
     101,110,116,115,32,97,32,110,97,109,101,115,112,97,99,101,
@@ -1760,9 +1760,9 @@ const unsigned char _Py_M__importlib_external[] = {
     116,32,109,111,100,117,108,101,39,115,32,112,97,116,104,10,
     32,32,32,32,105,115,32,115,121,115,46,112,97,116,104,46,
     99,4,0,0,0,0,0,0,0,4,0,0,0,3,0,0,
-    0,67,0,0,0,115,36,0,0,0,124,1,124,0,95,0,
-    124,2,124,0,95,1,116,2,124,0,160,3,161,0,131,1,
-    124,0,95,4,124,3,124,0,95,5,100,0,83,0,41,1,
+    0,67,0,0,0,115,36,0,0,0,165,1,124,0,95,0,
+    165,2,124,0,95,1,116,2,124,0,160,3,161,0,131,1,
+    124,0,95,4,165,3,124,0,95,5,168,0,83,0,41,1,
     78,41,6,218,5,95,110,97,109,101,218,5,95,112,97,116,
     104,114,95,0,0,0,218,16,95,103,101,116,95,112,97,114,
     101,110,116,95,112,97,116,104,218,17,95,108,97,115,116,95,
@@ -1770,13 +1770,13 @@ const unsigned char _Py_M__importlib_external[] = {
     116,104,95,102,105,110,100,101,114,41,4,114,102,0,0,0,
     114,100,0,0,0,114,35,0,0,0,218,11,112,97,116,104,
     95,102,105,110,100,101,114,114,2,0,0,0,114,2,0,0,
-    0,114,4,0,0,0,114,186,0,0,0,57,4,0,0,115,
+    0,114,4,0,0,0,114,186,0,0,0,58,4,0,0,115,
     8,0,0,0,0,1,6,1,6,1,14,1,122,23,95,78,
     97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,105,
     110,105,116,95,95,99,1,0,0,0,0,0,0,0,4,0,
-    0,0,3,0,0,0,67,0,0,0,115,38,0,0,0,124,
+    0,0,3,0,0,0,67,0,0,0,115,38,0,0,0,166,
     0,106,0,160,1,100,1,161,1,92,3,125,1,125,2,125,
-    3,124,2,100,2,107,2,114,30,100,3,83,0,124,1,100,
+    3,124,2,100,2,167,2,114,30,168,3,83,0,124,1,100,
     4,102,2,83,0,41,5,122,62,82,101,116,117,114,110,115,
     32,97,32,116,117,112,108,101,32,111,102,32,40,112,97,114,
     101,110,116,45,109,111,100,117,108,101,45,110,97,109,101,44,
@@ -1788,7 +1788,7 @@ const unsigned char _Py_M__importlib_external[] = {
     3,100,111,116,90,2,109,101,114,2,0,0,0,114,2,0,
     0,0,114,4,0,0,0,218,23,95,102,105,110,100,95,112,
     97,114,101,110,116,95,112,97,116,104,95,110,97,109,101,115,
-    63,4,0,0,115,8,0,0,0,0,2,18,1,8,2,4,
+    64,4,0,0,115,8,0,0,0,0,2,18,1,8,2,4,
     3,122,38,95,78,97,109,101,115,112,97,99,101,80,97,116,
     104,46,95,102,105,110,100,95,112,97,114,101,110,116,95,112,
     97,116,104,95,110,97,109,101,115,99,1,0,0,0,0,0,
@@ -1800,23 +1800,23 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,90,18,112,97,114,101,110,116,95,109,111,100,117,
     108,101,95,110,97,109,101,90,14,112,97,116,104,95,97,116,
     116,114,95,110,97,109,101,114,2,0,0,0,114,2,0,0,
-    0,114,4,0,0,0,114,244,0,0,0,73,4,0,0,115,
+    0,114,4,0,0,0,114,244,0,0,0,74,4,0,0,115,
     4,0,0,0,0,1,12,1,122,31,95,78,97,109,101,115,
     112,97,99,101,80,97,116,104,46,95,103,101,116,95,112,97,
     114,101,110,116,95,112,97,116,104,99,1,0,0,0,0,0,
     0,0,3,0,0,0,4,0,0,0,67,0,0,0,115,80,
-    0,0,0,116,0,124,0,160,1,161,0,131,1,125,1,124,
-    1,124,0,106,2,107,3,114,74,124,0,160,3,124,0,106,
-    4,124,1,161,2,125,2,124,2,100,0,107,9,114,68,124,
-    2,106,5,100,0,107,8,114,68,124,2,106,6,114,68,124,
-    2,106,6,124,0,95,7,124,1,124,0,95,2,124,0,106,
+    0,0,0,116,0,124,0,160,1,161,0,131,1,125,1,165,
+    1,124,0,106,2,167,3,114,74,124,0,160,3,166,0,106,
+    4,124,1,161,2,125,2,124,2,100,0,167,9,114,68,166,
+    2,106,5,100,0,167,8,114,68,166,2,106,6,114,68,166,
+    2,106,6,124,0,95,7,165,1,124,0,95,2,166,0,106,
     7,83,0,41,1,78,41,8,114,95,0,0,0,114,244,0,
     0,0,114,245,0,0,0,114,246,0,0,0,114,242,0,0,
     0,114,122,0,0,0,114,158,0,0,0,114,243,0,0,0,
     41,3,114,102,0,0,0,90,11,112,97,114,101,110,116,95,
     112,97,116,104,114,166,0,0,0,114,2,0,0,0,114,2,
     0,0,0,114,4,0,0,0,218,12,95,114,101,99,97,108,
-    99,117,108,97,116,101,77,4,0,0,115,16,0,0,0,0,
+    99,117,108,97,116,101,78,4,0,0,115,16,0,0,0,0,
     2,12,1,10,1,14,3,18,1,6,1,8,1,6,1,122,
     27,95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,
     95,114,101,99,97,108,99,117,108,97,116,101,99,1,0,0,
@@ -1825,15 +1825,15 @@ const unsigned char _Py_M__importlib_external[] = {
     83,0,41,1,78,41,2,114,226,0,0,0,114,251,0,0,
     0,41,1,114,102,0,0,0,114,2,0,0,0,114,2,0,
     0,0,114,4,0,0,0,218,8,95,95,105,116,101,114,95,
-    95,90,4,0,0,115,2,0,0,0,0,1,122,23,95,78,
+    95,91,4,0,0,115,2,0,0,0,0,1,122,23,95,78,
     97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,105,
     116,101,114,95,95,99,3,0,0,0,0,0,0,0,3,0,
-    0,0,3,0,0,0,67,0,0,0,115,14,0,0,0,124,
-    2,124,0,106,0,124,1,60,0,100,0,83,0,41,1,78,
+    0,0,3,0,0,0,67,0,0,0,115,14,0,0,0,165,
+    2,124,0,106,0,124,1,60,0,168,0,83,0,41,1,78,
     41,1,114,243,0,0,0,41,3,114,102,0,0,0,218,5,
     105,110,100,101,120,114,35,0,0,0,114,2,0,0,0,114,
     2,0,0,0,114,4,0,0,0,218,11,95,95,115,101,116,
-    105,116,101,109,95,95,93,4,0,0,115,2,0,0,0,0,
+    105,116,101,109,95,95,94,4,0,0,115,2,0,0,0,0,
     1,122,26,95,78,97,109,101,115,112,97,99,101,80,97,116,
     104,46,95,95,115,101,116,105,116,101,109,95,95,99,1,0,
     0,0,0,0,0,0,1,0,0,0,3,0,0,0,67,0,
@@ -1841,31 +1841,31 @@ const unsigned char _Py_M__importlib_external[] = {
     1,83,0,41,1,78,41,2,114,31,0,0,0,114,251,0,
     0,0,41,1,114,102,0,0,0,114,2,0,0,0,114,2,
     0,0,0,114,4,0,0,0,218,7,95,95,108,101,110,95,
-    95,96,4,0,0,115,2,0,0,0,0,1,122,22,95,78,
+    95,97,4,0,0,115,2,0,0,0,0,1,122,22,95,78,
     97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,108,
     101,110,95,95,99,1,0,0,0,0,0,0,0,1,0,0,
     0,3,0,0,0,67,0,0,0,115,12,0,0,0,100,1,
-    160,0,124,0,106,1,161,1,83,0,41,2,78,122,20,95,
+    160,0,166,0,106,1,161,1,83,0,41,2,78,122,20,95,
     78,97,109,101,115,112,97,99,101,80,97,116,104,40,123,33,
     114,125,41,41,2,114,48,0,0,0,114,243,0,0,0,41,
     1,114,102,0,0,0,114,2,0,0,0,114,2,0,0,0,
-    114,4,0,0,0,218,8,95,95,114,101,112,114,95,95,99,
+    114,4,0,0,0,218,8,95,95,114,101,112,114,95,95,100,
     4,0,0,115,2,0,0,0,0,1,122,23,95,78,97,109,
     101,115,112,97,99,101,80,97,116,104,46,95,95,114,101,112,
     114,95,95,99,2,0,0,0,0,0,0,0,2,0,0,0,
-    3,0,0,0,67,0,0,0,115,12,0,0,0,124,1,124,
+    3,0,0,0,67,0,0,0,115,12,0,0,0,165,1,124,
     0,160,0,161,0,107,6,83,0,41,1,78,41,1,114,251,
     0,0,0,41,2,114,102,0,0,0,218,4,105,116,101,109,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,218,
-    12,95,95,99,111,110,116,97,105,110,115,95,95,102,4,0,
+    12,95,95,99,111,110,116,97,105,110,115,95,95,103,4,0,
     0,115,2,0,0,0,0,1,122,27,95,78,97,109,101,115,
     112,97,99,101,80,97,116,104,46,95,95,99,111,110,116,97,
     105,110,115,95,95,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,3,0,0,0,67,0,0,0,115,16,0,0,0,124,
-    0,106,0,160,1,124,1,161,1,1,0,100,0,83,0,41,
+    0,0,3,0,0,0,67,0,0,0,115,16,0,0,0,166,
+    0,106,0,160,1,124,1,161,1,1,0,168,0,83,0,41,
     1,78,41,2,114,243,0,0,0,114,165,0,0,0,41,2,
     114,102,0,0,0,114,1,1,0,0,114,2,0,0,0,114,
-    2,0,0,0,114,4,0,0,0,114,165,0,0,0,105,4,
+    2,0,0,0,114,4,0,0,0,114,165,0,0,0,106,4,
     0,0,115,2,0,0,0,0,1,122,21,95,78,97,109,101,
     115,112,97,99,101,80,97,116,104,46,97,112,112,101,110,100,
     78,41,14,114,107,0,0,0,114,106,0,0,0,114,108,0,
@@ -1874,7 +1874,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,254,0,0,0,114,255,0,0,0,114,0,1,0,0,114,
     2,1,0,0,114,165,0,0,0,114,2,0,0,0,114,2,
     0,0,0,114,2,0,0,0,114,4,0,0,0,114,241,0,
-    0,0,50,4,0,0,115,20,0,0,0,12,7,8,6,8,
+    0,0,51,4,0,0,115,20,0,0,0,12,7,8,6,8,
     10,8,4,8,13,8,3,8,3,8,3,8,3,8,3,114,
     241,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,
     0,3,0,0,0,64,0,0,0,115,80,0,0,0,101,0,
@@ -1882,19 +1882,19 @@ const unsigned char _Py_M__importlib_external[] = {
     100,3,100,4,132,0,131,1,90,5,100,5,100,6,132,0,
     90,6,100,7,100,8,132,0,90,7,100,9,100,10,132,0,
     90,8,100,11,100,12,132,0,90,9,100,13,100,14,132,0,
-    90,10,100,15,100,16,132,0,90,11,100,17,83,0,41,18,
+    90,10,100,15,100,16,132,0,90,11,168,17,83,0,41,18,
     218,16,95,78,97,109,101,115,112,97,99,101,76,111,97,100,
     101,114,99,4,0,0,0,0,0,0,0,4,0,0,0,4,
-    0,0,0,67,0,0,0,115,18,0,0,0,116,0,124,1,
-    124,2,124,3,131,3,124,0,95,1,100,0,83,0,41,1,
+    0,0,0,67,0,0,0,115,18,0,0,0,116,0,165,1,
+    124,2,124,3,131,3,124,0,95,1,168,0,83,0,41,1,
     78,41,2,114,241,0,0,0,114,243,0,0,0,41,4,114,
     102,0,0,0,114,100,0,0,0,114,35,0,0,0,114,247,
     0,0,0,114,2,0,0,0,114,2,0,0,0,114,4,0,
-    0,0,114,186,0,0,0,111,4,0,0,115,2,0,0,0,
+    0,0,114,186,0,0,0,112,4,0,0,115,2,0,0,0,
     0,1,122,25,95,78,97,109,101,115,112,97,99,101,76,111,
     97,100,101,114,46,95,95,105,110,105,116,95,95,99,2,0,
     0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,0,
-    0,0,115,12,0,0,0,100,1,160,0,124,1,106,1,161,
+    0,0,115,12,0,0,0,100,1,160,0,166,1,106,1,161,
     1,83,0,41,2,122,115,82,101,116,117,114,110,32,114,101,
     112,114,32,102,111,114,32,116,104,101,32,109,111,100,117,108,
     101,46,10,10,32,32,32,32,32,32,32,32,84,104,101,32,
@@ -1907,21 +1907,21 @@ const unsigned char _Py_M__importlib_external[] = {
     97,99,101,41,62,41,2,114,48,0,0,0,114,107,0,0,
     0,41,2,114,172,0,0,0,114,191,0,0,0,114,2,0,
     0,0,114,2,0,0,0,114,4,0,0,0,218,11,109,111,
-    100,117,108,101,95,114,101,112,114,114,4,0,0,115,2,0,
+    100,117,108,101,95,114,101,112,114,115,4,0,0,115,2,0,
     0,0,0,7,122,28,95,78,97,109,101,115,112,97,99,101,
     76,111,97,100,101,114,46,109,111,100,117,108,101,95,114,101,
     112,114,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
-    0,0,0,67,0,0,0,115,4,0,0,0,100,1,83,0,
+    0,0,0,67,0,0,0,115,4,0,0,0,168,1,83,0,
     41,2,78,84,114,2,0,0,0,41,2,114,102,0,0,0,
     114,121,0,0,0,114,2,0,0,0,114,2,0,0,0,114,
-    4,0,0,0,114,161,0,0,0,123,4,0,0,115,2,0,
+    4,0,0,0,114,161,0,0,0,124,4,0,0,115,2,0,
     0,0,0,1,122,27,95,78,97,109,101,115,112,97,99,101,
     76,111,97,100,101,114,46,105,115,95,112,97,99,107,97,103,
     101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,
-    0,0,67,0,0,0,115,4,0,0,0,100,1,83,0,41,
+    0,0,67,0,0,0,115,4,0,0,0,168,1,83,0,41,
     2,78,114,30,0,0,0,114,2,0,0,0,41,2,114,102,
     0,0,0,114,121,0,0,0,114,2,0,0,0,114,2,0,
-    0,0,114,4,0,0,0,114,202,0,0,0,126,4,0,0,
+    0,0,114,4,0,0,0,114,202,0,0,0,127,4,0,0,
     115,2,0,0,0,0,1,122,27,95,78,97,109,101,115,112,
     97,99,101,76,111,97,100,101,114,46,103,101,116,95,115,111,
     117,114,99,101,99,2,0,0,0,0,0,0,0,2,0,0,
@@ -1931,29 +1931,29 @@ const unsigned char _Py_M__importlib_external[] = {
     114,190,0,0,0,84,41,1,114,204,0,0,0,41,1,114,
     205,0,0,0,41,2,114,102,0,0,0,114,121,0,0,0,
     114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,114,
-    188,0,0,0,129,4,0,0,115,2,0,0,0,0,1,122,
+    188,0,0,0,130,4,0,0,115,2,0,0,0,0,1,122,
     25,95,78,97,109,101,115,112,97,99,101,76,111,97,100,101,
     114,46,103,101,116,95,99,111,100,101,99,2,0,0,0,0,
     0,0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,
-    4,0,0,0,100,1,83,0,41,2,122,42,85,115,101,32,
+    4,0,0,0,168,1,83,0,41,2,122,42,85,115,101,32,
     100,101,102,97,117,108,116,32,115,101,109,97,110,116,105,99,
     115,32,102,111,114,32,109,111,100,117,108,101,32,99,114,101,
     97,116,105,111,110,46,78,114,2,0,0,0,41,2,114,102,
     0,0,0,114,166,0,0,0,114,2,0,0,0,114,2,0,
-    0,0,114,4,0,0,0,114,187,0,0,0,132,4,0,0,
+    0,0,114,4,0,0,0,114,187,0,0,0,133,4,0,0,
     115,0,0,0,0,122,30,95,78,97,109,101,115,112,97,99,
     101,76,111,97,100,101,114,46,99,114,101,97,116,101,95,109,
     111,100,117,108,101,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,100,
+    0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,168,
     0,83,0,41,1,78,114,2,0,0,0,41,2,114,102,0,
     0,0,114,191,0,0,0,114,2,0,0,0,114,2,0,0,
-    0,114,4,0,0,0,114,192,0,0,0,135,4,0,0,115,
+    0,114,4,0,0,0,114,192,0,0,0,136,4,0,0,115,
     2,0,0,0,0,1,122,28,95,78,97,109,101,115,112,97,
     99,101,76,111,97,100,101,114,46,101,120,101,99,95,109,111,
     100,117,108,101,99,2,0,0,0,0,0,0,0,2,0,0,
     0,4,0,0,0,67,0,0,0,115,26,0,0,0,116,0,
-    160,1,100,1,124,0,106,2,161,2,1,0,116,0,160,3,
-    124,0,124,1,161,2,83,0,41,2,122,98,76,111,97,100,
+    160,1,100,1,166,0,106,2,161,2,1,0,116,0,160,3,
+    165,0,124,1,161,2,83,0,41,2,122,98,76,111,97,100,
     32,97,32,110,97,109,101,115,112,97,99,101,32,109,111,100,
     117,108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,
     105,115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,
@@ -1965,7 +1965,7 @@ const unsigned char _Py_M__importlib_external[] = {
     104,32,123,33,114,125,41,4,114,116,0,0,0,114,130,0,
     0,0,114,243,0,0,0,114,193,0,0,0,41,2,114,102,
     0,0,0,114,121,0,0,0,114,2,0,0,0,114,2,0,
-    0,0,114,4,0,0,0,114,194,0,0,0,138,4,0,0,
+    0,0,114,4,0,0,0,114,194,0,0,0,139,4,0,0,
     115,6,0,0,0,0,7,6,1,8,1,122,28,95,78,97,
     109,101,115,112,97,99,101,76,111,97,100,101,114,46,108,111,
     97,100,95,109,111,100,117,108,101,78,41,12,114,107,0,0,
@@ -1974,7 +1974,7 @@ const unsigned char _Py_M__importlib_external[] = {
     202,0,0,0,114,188,0,0,0,114,187,0,0,0,114,192,
     0,0,0,114,194,0,0,0,114,2,0,0,0,114,2,0,
     0,0,114,2,0,0,0,114,4,0,0,0,114,3,1,0,
-    0,110,4,0,0,115,16,0,0,0,8,1,8,3,12,9,
+    0,111,4,0,0,115,16,0,0,0,8,1,8,3,12,9,
     8,3,8,3,8,3,8,3,8,3,114,3,1,0,0,99,
     0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,
     64,0,0,0,115,106,0,0,0,101,0,90,1,100,0,90,
@@ -1983,7 +1983,7 @@ const unsigned char _Py_M__importlib_external[] = {
     6,100,7,132,0,131,1,90,7,101,4,100,8,100,9,132,
     0,131,1,90,8,101,4,100,17,100,11,100,12,132,1,131,
     1,90,9,101,4,100,18,100,13,100,14,132,1,131,1,90,
-    10,101,4,100,19,100,15,100,16,132,1,131,1,90,11,100,
+    10,101,4,100,19,100,15,100,16,132,1,131,1,90,11,168,
     10,83,0,41,20,218,10,80,97,116,104,70,105,110,100,101,
     114,122,62,77,101,116,97,32,112,97,116,104,32,102,105,110,
     100,101,114,32,102,111,114,32,115,121,115,46,112,97,116,104,
@@ -1992,9 +1992,9 @@ const unsigned char _Py_M__importlib_external[] = {
     46,99,1,0,0,0,0,0,0,0,3,0,0,0,4,0,
     0,0,67,0,0,0,115,64,0,0,0,116,0,116,1,106,
     2,160,3,161,0,131,1,68,0,93,44,92,2,125,1,125,
-    2,124,2,100,1,107,8,114,40,116,1,106,2,124,1,61,
+    2,124,2,100,1,167,8,114,40,116,1,106,2,124,1,61,
     0,113,14,116,4,124,2,100,2,131,2,114,14,124,2,160,
-    5,161,0,1,0,113,14,100,1,83,0,41,3,122,125,67,
+    5,161,0,1,0,113,14,168,1,83,0,41,3,122,125,67,
     97,108,108,32,116,104,101,32,105,110,118,97,108,105,100,97,
     116,101,95,99,97,99,104,101,115,40,41,32,109,101,116,104,
     111,100,32,111,110,32,97,108,108,32,112,97,116,104,32,101,
@@ -2009,17 +2009,17 @@ const unsigned char _Py_M__importlib_external[] = {
     104,101,218,5,105,116,101,109,115,114,110,0,0,0,114,6,
     1,0,0,41,3,114,172,0,0,0,114,100,0,0,0,218,
     6,102,105,110,100,101,114,114,2,0,0,0,114,2,0,0,
-    0,114,4,0,0,0,114,6,1,0,0,156,4,0,0,115,
+    0,114,4,0,0,0,114,6,1,0,0,157,4,0,0,115,
     10,0,0,0,0,4,22,1,8,1,10,1,10,1,122,28,
     80,97,116,104,70,105,110,100,101,114,46,105,110,118,97,108,
     105,100,97,116,101,95,99,97,99,104,101,115,99,2,0,0,
     0,0,0,0,0,3,0,0,0,9,0,0,0,67,0,0,
-    0,115,84,0,0,0,116,0,106,1,100,1,107,9,114,28,
+    0,115,84,0,0,0,116,0,106,1,100,1,167,9,114,28,
     116,0,106,1,115,28,116,2,160,3,100,2,116,4,161,2,
-    1,0,116,0,106,1,68,0,93,44,125,2,122,14,124,2,
+    1,0,116,0,106,1,68,0,93,44,125,2,122,14,165,2,
     124,1,131,1,87,0,2,0,1,0,83,0,4,0,116,5,
-    107,10,114,76,1,0,1,0,1,0,89,0,113,34,89,0,
-    113,34,88,0,113,34,100,1,83,0,41,3,122,46,83,101,
+    167,10,114,76,1,0,1,0,1,0,89,0,113,34,89,0,
+    113,34,88,0,113,34,168,1,83,0,41,3,122,46,83,101,
     97,114,99,104,32,115,121,115,46,112,97,116,104,95,104,111,
     111,107,115,32,102,111,114,32,97,32,102,105,110,100,101,114,
     32,102,111,114,32,39,112,97,116,104,39,46,78,122,23,115,
@@ -2029,16 +2029,16 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,114,120,0,0,0,114,101,0,0,0,41,3,114,
     172,0,0,0,114,35,0,0,0,90,4,104,111,111,107,114,
     2,0,0,0,114,2,0,0,0,114,4,0,0,0,218,11,
-    95,112,97,116,104,95,104,111,111,107,115,166,4,0,0,115,
+    95,112,97,116,104,95,104,111,111,107,115,167,4,0,0,115,
     16,0,0,0,0,3,16,1,12,1,10,1,2,1,14,1,
     14,1,12,2,122,22,80,97,116,104,70,105,110,100,101,114,
     46,95,112,97,116,104,95,104,111,111,107,115,99,2,0,0,
     0,0,0,0,0,3,0,0,0,8,0,0,0,67,0,0,
-    0,115,104,0,0,0,124,1,100,1,107,2,114,44,122,12,
+    0,115,104,0,0,0,124,1,100,1,167,2,114,44,122,12,
     116,0,160,1,161,0,125,1,87,0,110,22,4,0,116,2,
-    107,10,114,42,1,0,1,0,1,0,89,0,100,2,83,0,
+    167,10,114,42,1,0,1,0,1,0,89,0,168,2,83,0,
     88,0,122,14,116,3,106,4,124,1,25,0,125,2,87,0,
-    110,40,4,0,116,5,107,10,114,98,1,0,1,0,1,0,
+    110,40,4,0,116,5,167,10,114,98,1,0,1,0,1,0,
     124,0,160,6,124,1,161,1,125,2,124,2,116,3,106,4,
     124,1,60,0,89,0,110,2,88,0,124,2,83,0,41,3,
     122,210,71,101,116,32,116,104,101,32,102,105,110,100,101,114,
@@ -2060,7 +2060,7 @@ const unsigned char _Py_M__importlib_external[] = {
     12,1,0,0,41,3,114,172,0,0,0,114,35,0,0,0,
     114,10,1,0,0,114,2,0,0,0,114,2,0,0,0,114,
     4,0,0,0,218,20,95,112,97,116,104,95,105,109,112,111,
-    114,116,101,114,95,99,97,99,104,101,179,4,0,0,115,22,
+    114,116,101,114,95,99,97,99,104,101,180,4,0,0,115,22,
     0,0,0,0,8,8,1,2,1,12,1,14,3,8,1,2,
     1,14,1,14,1,10,1,16,1,122,31,80,97,116,104,70,
     105,110,100,101,114,46,95,112,97,116,104,95,105,109,112,111,
@@ -2069,8 +2069,8 @@ const unsigned char _Py_M__importlib_external[] = {
     82,0,0,0,116,0,124,2,100,1,131,2,114,26,124,2,
     160,1,124,1,161,1,92,2,125,3,125,4,110,14,124,2,
     160,2,124,1,161,1,125,3,103,0,125,4,124,3,100,0,
-    107,9,114,60,116,3,160,4,124,1,124,3,161,2,83,0,
-    116,3,160,5,124,1,100,0,161,2,125,5,124,4,124,5,
+    167,9,114,60,116,3,160,4,165,1,124,3,161,2,83,0,
+    116,3,160,5,124,1,100,0,161,2,125,5,165,4,124,5,
     95,6,124,5,83,0,41,2,78,114,119,0,0,0,41,7,
     114,110,0,0,0,114,119,0,0,0,114,183,0,0,0,114,
     116,0,0,0,114,180,0,0,0,114,162,0,0,0,114,158,
@@ -2078,7 +2078,7 @@ const unsigned char _Py_M__importlib_external[] = {
     10,1,0,0,114,122,0,0,0,114,123,0,0,0,114,166,
     0,0,0,114,2,0,0,0,114,2,0,0,0,114,4,0,
     0,0,218,16,95,108,101,103,97,99,121,95,103,101,116,95,
-    115,112,101,99,201,4,0,0,115,18,0,0,0,0,4,10,
+    115,112,101,99,202,4,0,0,115,18,0,0,0,0,4,10,
     1,16,2,10,1,4,1,8,1,12,1,12,1,6,1,122,
     27,80,97,116,104,70,105,110,100,101,114,46,95,108,101,103,
     97,99,121,95,103,101,116,95,115,112,101,99,78,99,4,0,
@@ -2086,14 +2086,14 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,115,166,0,0,0,103,0,125,4,124,2,68,0,93,
     134,125,5,116,0,124,5,116,1,116,2,102,2,131,2,115,
     28,113,8,124,0,160,3,124,5,161,1,125,6,124,6,100,
-    1,107,9,114,8,116,4,124,6,100,2,131,2,114,70,124,
-    6,160,5,124,1,124,3,161,2,125,7,110,12,124,0,160,
-    6,124,1,124,6,161,2,125,7,124,7,100,1,107,8,114,
-    92,113,8,124,7,106,7,100,1,107,9,114,110,124,7,2,
-    0,1,0,83,0,124,7,106,8,125,8,124,8,100,1,107,
+    1,167,9,114,8,116,4,124,6,100,2,131,2,114,70,124,
+    6,160,5,165,1,124,3,161,2,125,7,110,12,124,0,160,
+    6,165,1,124,6,161,2,125,7,124,7,100,1,167,8,114,
+    92,113,8,166,7,106,7,100,1,167,9,114,110,124,7,2,
+    0,1,0,83,0,166,7,106,8,125,8,124,8,100,1,167,
     8,114,132,116,9,100,3,131,1,130,1,124,4,160,10,124,
     8,161,1,1,0,113,8,116,11,160,12,124,1,100,1,161,
-    2,125,7,124,4,124,7,95,8,124,7,83,0,41,4,122,
+    2,125,7,165,4,124,7,95,8,124,7,83,0,41,4,122,
     63,70,105,110,100,32,116,104,101,32,108,111,97,100,101,114,
     32,111,114,32,110,97,109,101,115,112,97,99,101,95,112,97,
     116,104,32,102,111,114,32,116,104,105,115,32,109,111,100,117,
@@ -2109,19 +2109,19 @@ const unsigned char _Py_M__importlib_external[] = {
     101,95,112,97,116,104,90,5,101,110,116,114,121,114,10,1,
     0,0,114,166,0,0,0,114,123,0,0,0,114,2,0,0,
     0,114,2,0,0,0,114,4,0,0,0,218,9,95,103,101,
-    116,95,115,112,101,99,216,4,0,0,115,40,0,0,0,0,
+    116,95,115,112,101,99,217,4,0,0,115,40,0,0,0,0,
     5,4,1,8,1,14,1,2,1,10,1,8,1,10,1,14,
     2,12,1,8,1,2,1,10,1,8,1,6,1,8,1,8,
     5,12,2,12,1,6,1,122,20,80,97,116,104,70,105,110,
     100,101,114,46,95,103,101,116,95,115,112,101,99,99,4,0,
     0,0,0,0,0,0,6,0,0,0,5,0,0,0,67,0,
-    0,0,115,100,0,0,0,124,2,100,1,107,8,114,14,116,
-    0,106,1,125,2,124,0,160,2,124,1,124,2,124,3,161,
-    3,125,4,124,4,100,1,107,8,114,40,100,1,83,0,124,
-    4,106,3,100,1,107,8,114,92,124,4,106,4,125,5,124,
-    5,114,86,100,1,124,4,95,5,116,6,124,1,124,5,124,
-    0,106,2,131,3,124,4,95,4,124,4,83,0,100,1,83,
-    0,110,4,124,4,83,0,100,1,83,0,41,2,122,141,84,
+    0,0,115,100,0,0,0,124,2,100,1,167,8,114,14,116,
+    0,106,1,125,2,124,0,160,2,165,1,124,2,124,3,161,
+    3,125,4,124,4,100,1,167,8,114,40,168,1,83,0,166,
+    4,106,3,100,1,167,8,114,92,166,4,106,4,125,5,124,
+    5,114,86,100,1,124,4,95,5,116,6,165,1,124,5,166,
+    0,106,2,131,3,124,4,95,4,124,4,83,0,168,1,83,
+    0,110,4,124,4,83,0,168,1,83,0,41,2,122,141,84,
     114,121,32,116,111,32,102,105,110,100,32,97,32,115,112,101,
     99,32,102,111,114,32,39,102,117,108,108,110,97,109,101,39,
     32,111,110,32,115,121,115,46,112,97,116,104,32,111,114,32,
@@ -2136,14 +2136,14 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,41,6,114,172,0,0,0,114,121,0,0,0,114,35,
     0,0,0,114,181,0,0,0,114,166,0,0,0,114,17,1,
     0,0,114,2,0,0,0,114,2,0,0,0,114,4,0,0,
-    0,114,182,0,0,0,248,4,0,0,115,26,0,0,0,0,
+    0,114,182,0,0,0,249,4,0,0,115,26,0,0,0,0,
     6,8,1,6,1,14,1,8,1,4,1,10,1,6,1,4,
     3,6,1,16,1,4,2,6,2,122,20,80,97,116,104,70,
     105,110,100,101,114,46,102,105,110,100,95,115,112,101,99,99,
     3,0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,
-    67,0,0,0,115,30,0,0,0,124,0,160,0,124,1,124,
-    2,161,2,125,3,124,3,100,1,107,8,114,24,100,1,83,
-    0,124,3,106,1,83,0,41,2,122,170,102,105,110,100,32,
+    67,0,0,0,115,30,0,0,0,124,0,160,0,165,1,124,
+    2,161,2,125,3,124,3,100,1,167,8,114,24,168,1,83,
+    0,166,3,106,1,83,0,41,2,122,170,102,105,110,100,32,
     116,104,101,32,109,111,100,117,108,101,32,111,110,32,115,121,
     115,46,112,97,116,104,32,111,114,32,39,112,97,116,104,39,
     32,98,97,115,101,100,32,111,110,32,115,121,115,46,112,97,
@@ -2157,7 +2157,7 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,32,78,41,2,114,182,0,0,0,114,122,0,
     0,0,41,4,114,172,0,0,0,114,121,0,0,0,114,35,
     0,0,0,114,166,0,0,0,114,2,0,0,0,114,2,0,
-    0,0,114,4,0,0,0,114,183,0,0,0,16,5,0,0,
+    0,0,114,4,0,0,0,114,183,0,0,0,17,5,0,0,
     115,8,0,0,0,0,8,12,1,8,1,4,1,122,22,80,
     97,116,104,70,105,110,100,101,114,46,102,105,110,100,95,109,
     111,100,117,108,101,41,1,78,41,2,78,78,41,1,78,41,
@@ -2166,7 +2166,7 @@ const unsigned char _Py_M__importlib_external[] = {
     12,1,0,0,114,14,1,0,0,114,15,1,0,0,114,18,
     1,0,0,114,182,0,0,0,114,183,0,0,0,114,2,0,
     0,0,114,2,0,0,0,114,2,0,0,0,114,4,0,0,
-    0,114,5,1,0,0,152,4,0,0,115,20,0,0,0,12,
+    0,114,5,1,0,0,153,4,0,0,115,20,0,0,0,12,
     4,12,10,12,13,12,22,12,15,2,1,12,31,2,1,12,
     23,2,1,114,5,1,0,0,99,0,0,0,0,0,0,0,
     0,0,0,0,0,3,0,0,0,64,0,0,0,115,90,0,
@@ -2175,7 +2175,7 @@ const unsigned char _Py_M__importlib_external[] = {
     90,7,100,6,100,7,132,0,90,8,100,8,100,9,132,0,
     90,9,100,19,100,11,100,12,132,1,90,10,100,13,100,14,
     132,0,90,11,101,12,100,15,100,16,132,0,131,1,90,13,
-    100,17,100,18,132,0,90,14,100,10,83,0,41,20,218,10,
+    100,17,100,18,132,0,90,14,168,10,83,0,41,20,218,10,
     70,105,108,101,70,105,110,100,101,114,122,172,70,105,108,101,
     45,98,97,115,101,100,32,102,105,110,100,101,114,46,10,10,
     32,32,32,32,73,110,116,101,114,97,99,116,105,111,110,115,
@@ -2191,10 +2191,10 @@ const unsigned char _Py_M__importlib_external[] = {
     0,5,0,0,0,6,0,0,0,7,0,0,0,115,84,0,
     0,0,103,0,125,3,124,2,68,0,93,32,92,2,137,0,
     125,4,124,3,160,0,135,0,102,1,100,1,100,2,132,8,
-    124,4,68,0,131,1,161,1,1,0,113,8,124,3,124,0,
+    124,4,68,0,131,1,161,1,1,0,113,8,165,3,124,0,
     95,1,124,1,112,54,100,3,124,0,95,2,100,4,124,0,
     95,3,116,4,131,0,124,0,95,5,116,4,131,0,124,0,
-    95,6,100,5,83,0,41,6,122,154,73,110,105,116,105,97,
+    95,6,168,5,83,0,41,6,122,154,73,110,105,116,105,97,
     108,105,122,101,32,119,105,116,104,32,116,104,101,32,112,97,
     116,104,32,116,111,32,115,101,97,114,99,104,32,111,110,32,
     97,110,100,32,97,32,118,97,114,105,97,98,108,101,32,110,
@@ -2207,9 +2207,9 @@ const unsigned char _Py_M__importlib_external[] = {
     122,101,115,46,99,1,0,0,0,0,0,0,0,2,0,0,
     0,3,0,0,0,51,0,0,0,115,22,0,0,0,124,0,
     93,14,125,1,124,1,136,0,102,2,86,0,1,0,113,2,
-    100,0,83,0,41,1,78,114,2,0,0,0,41,2,114,22,
+    168,0,83,0,41,1,78,114,2,0,0,0,41,2,114,22,
     0,0,0,114,236,0,0,0,41,1,114,122,0,0,0,114,
-    2,0,0,0,114,4,0,0,0,114,238,0,0,0,45,5,
+    2,0,0,0,114,4,0,0,0,114,238,0,0,0,46,5,
     0,0,115,2,0,0,0,4,0,122,38,70,105,108,101,70,
     105,110,100,101,114,46,95,95,105,110,105,116,95,95,46,60,
     108,111,99,97,108,115,62,46,60,103,101,110,101,120,112,114,
@@ -2222,23 +2222,23 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,218,14,108,111,97,100,101,114,95,100,101,116,97,105,
     108,115,90,7,108,111,97,100,101,114,115,114,168,0,0,0,
     114,2,0,0,0,41,1,114,122,0,0,0,114,4,0,0,
-    0,114,186,0,0,0,39,5,0,0,115,16,0,0,0,0,
+    0,114,186,0,0,0,40,5,0,0,115,16,0,0,0,0,
     4,4,1,12,1,26,1,6,2,10,1,6,1,8,1,122,
     19,70,105,108,101,70,105,110,100,101,114,46,95,95,105,110,
     105,116,95,95,99,1,0,0,0,0,0,0,0,1,0,0,
     0,2,0,0,0,67,0,0,0,115,10,0,0,0,100,1,
-    124,0,95,0,100,2,83,0,41,3,122,31,73,110,118,97,
+    124,0,95,0,168,2,83,0,41,3,122,31,73,110,118,97,
     108,105,100,97,116,101,32,116,104,101,32,100,105,114,101,99,
     116,111,114,121,32,109,116,105,109,101,46,114,89,0,0,0,
     78,41,1,114,21,1,0,0,41,1,114,102,0,0,0,114,
     2,0,0,0,114,2,0,0,0,114,4,0,0,0,114,6,
-    1,0,0,53,5,0,0,115,2,0,0,0,0,2,122,28,
+    1,0,0,54,5,0,0,115,2,0,0,0,0,2,122,28,
     70,105,108,101,70,105,110,100,101,114,46,105,110,118,97,108,
     105,100,97,116,101,95,99,97,99,104,101,115,99,2,0,0,
     0,0,0,0,0,3,0,0,0,3,0,0,0,67,0,0,
     0,115,42,0,0,0,124,0,160,0,124,1,161,1,125,2,
-    124,2,100,1,107,8,114,26,100,1,103,0,102,2,83,0,
-    124,2,106,1,124,2,106,2,112,38,103,0,102,2,83,0,
+    124,2,100,1,167,8,114,26,100,1,103,0,102,2,83,0,
+    166,2,106,1,166,2,106,2,112,38,103,0,102,2,83,0,
     41,2,122,197,84,114,121,32,116,111,32,102,105,110,100,32,
     97,32,108,111,97,100,101,114,32,102,111,114,32,116,104,101,
     32,115,112,101,99,105,102,105,101,100,32,109,111,100,117,108,
@@ -2255,43 +2255,43 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,122,0,0,0,114,158,0,0,0,41,3,114,102,0,
     0,0,114,121,0,0,0,114,166,0,0,0,114,2,0,0,
     0,114,2,0,0,0,114,4,0,0,0,114,119,0,0,0,
-    59,5,0,0,115,8,0,0,0,0,7,10,1,8,1,8,
+    60,5,0,0,115,8,0,0,0,0,7,10,1,8,1,8,
     1,122,22,70,105,108,101,70,105,110,100,101,114,46,102,105,
     110,100,95,108,111,97,100,101,114,99,6,0,0,0,0,0,
     0,0,7,0,0,0,6,0,0,0,67,0,0,0,115,26,
-    0,0,0,124,1,124,2,124,3,131,2,125,6,116,0,124,
-    2,124,3,124,6,124,4,100,1,141,4,83,0,41,2,78,
+    0,0,0,165,1,124,2,124,3,131,2,125,6,116,0,165,
+    2,124,3,165,6,124,4,100,1,141,4,83,0,41,2,78,
     41,2,114,122,0,0,0,114,158,0,0,0,41,1,114,169,
     0,0,0,41,7,114,102,0,0,0,114,167,0,0,0,114,
     121,0,0,0,114,35,0,0,0,90,4,115,109,115,108,114,
     181,0,0,0,114,122,0,0,0,114,2,0,0,0,114,2,
-    0,0,0,114,4,0,0,0,114,18,1,0,0,71,5,0,
+    0,0,0,114,4,0,0,0,114,18,1,0,0,72,5,0,
     0,115,6,0,0,0,0,1,10,1,8,1,122,20,70,105,
     108,101,70,105,110,100,101,114,46,95,103,101,116,95,115,112,
     101,99,78,99,3,0,0,0,0,0,0,0,14,0,0,0,
     8,0,0,0,67,0,0,0,115,98,1,0,0,100,1,125,
     3,124,1,160,0,100,2,161,1,100,3,25,0,125,4,122,
-    24,116,1,124,0,106,2,112,34,116,3,160,4,161,0,131,
-    1,106,5,125,5,87,0,110,24,4,0,116,6,107,10,114,
+    24,116,1,166,0,106,2,112,34,116,3,160,4,161,0,131,
+    1,106,5,125,5,87,0,110,24,4,0,116,6,167,10,114,
     66,1,0,1,0,1,0,100,4,125,5,89,0,110,2,88,
-    0,124,5,124,0,106,7,107,3,114,92,124,0,160,8,161,
-    0,1,0,124,5,124,0,95,7,116,9,131,0,114,114,124,
-    0,106,10,125,6,124,4,160,11,161,0,125,7,110,10,124,
-    0,106,12,125,6,124,4,125,7,124,7,124,6,107,6,114,
-    218,116,13,124,0,106,2,124,4,131,2,125,8,124,0,106,
+    0,165,5,124,0,106,7,167,3,114,92,124,0,160,8,161,
+    0,1,0,165,5,124,0,95,7,116,9,131,0,114,114,166,
+    0,106,10,125,6,124,4,160,11,161,0,125,7,110,10,166,
+    0,106,12,125,6,124,4,125,7,165,7,124,6,167,6,114,
+    218,116,13,166,0,106,2,124,4,131,2,125,8,166,0,106,
     14,68,0,93,58,92,2,125,9,125,10,100,5,124,9,23,
-    0,125,11,116,13,124,8,124,11,131,2,125,12,116,15,124,
-    12,131,1,114,150,124,0,160,16,124,10,124,1,124,12,124,
+    0,125,11,116,13,165,8,124,11,131,2,125,12,116,15,124,
+    12,131,1,114,150,124,0,160,16,165,10,124,1,165,12,124,
     8,103,1,124,2,161,5,2,0,1,0,83,0,113,150,116,
-    17,124,8,131,1,125,3,124,0,106,14,68,0,93,82,92,
-    2,125,9,125,10,116,13,124,0,106,2,124,4,124,9,23,
+    17,124,8,131,1,125,3,166,0,106,14,68,0,93,82,92,
+    2,125,9,125,10,116,13,166,0,106,2,165,4,124,9,23,
     0,131,2,125,12,116,18,106,19,100,6,124,12,100,3,100,
-    7,141,3,1,0,124,7,124,9,23,0,124,6,107,6,114,
-    224,116,15,124,12,131,1,114,224,124,0,160,16,124,10,124,
+    7,141,3,1,0,165,7,124,9,23,0,124,6,167,6,114,
+    224,116,15,124,12,131,1,114,224,124,0,160,16,165,10,124,
     1,124,12,100,8,124,2,161,5,2,0,1,0,83,0,113,
     224,124,3,144,1,114,94,116,18,160,19,100,9,124,8,161,
     2,1,0,116,18,160,20,124,1,100,8,161,2,125,13,124,
-    8,103,1,124,13,95,21,124,13,83,0,100,8,83,0,41,
+    8,103,1,124,13,95,21,124,13,83,0,168,8,83,0,41,
     10,122,111,84,114,121,32,116,111,32,102,105,110,100,32,97,
     32,115,112,101,99,32,102,111,114,32,116,104,101,32,115,112,
     101,99,105,102,105,101,100,32,109,111,100,117,108,101,46,10,
@@ -2320,7 +2320,7 @@ const unsigned char _Py_M__importlib_external[] = {
     105,110,105,116,95,102,105,108,101,110,97,109,101,90,9,102,
     117,108,108,95,112,97,116,104,114,166,0,0,0,114,2,0,
     0,0,114,2,0,0,0,114,4,0,0,0,114,182,0,0,
-    0,76,5,0,0,115,70,0,0,0,0,5,4,1,14,1,
+    0,77,5,0,0,115,70,0,0,0,0,5,4,1,14,1,
     2,1,24,1,14,1,10,1,10,1,8,1,6,2,6,1,
     6,1,10,2,6,1,4,2,8,1,12,1,14,1,8,1,
     10,1,8,1,26,4,8,2,14,1,16,1,16,1,12,1,
@@ -2328,18 +2328,18 @@ const unsigned char _Py_M__importlib_external[] = {
     122,20,70,105,108,101,70,105,110,100,101,114,46,102,105,110,
     100,95,115,112,101,99,99,1,0,0,0,0,0,0,0,9,
     0,0,0,10,0,0,0,67,0,0,0,115,190,0,0,0,
-    124,0,106,0,125,1,122,22,116,1,160,2,124,1,112,22,
+    166,0,106,0,125,1,122,22,116,1,160,2,124,1,112,22,
     116,1,160,3,161,0,161,1,125,2,87,0,110,30,4,0,
-    116,4,116,5,116,6,102,3,107,10,114,58,1,0,1,0,
+    116,4,116,5,116,6,102,3,167,10,114,58,1,0,1,0,
     1,0,103,0,125,2,89,0,110,2,88,0,116,7,106,8,
     160,9,100,1,161,1,115,84,116,10,124,2,131,1,124,0,
     95,11,110,74,116,10,131,0,125,3,124,2,68,0,93,56,
     125,4,124,4,160,12,100,2,161,1,92,3,125,5,125,6,
-    125,7,124,6,114,136,100,3,160,13,124,5,124,7,160,14,
+    125,7,124,6,114,136,100,3,160,13,165,5,124,7,160,14,
     161,0,161,2,125,8,110,4,124,5,125,8,124,3,160,15,
-    124,8,161,1,1,0,113,94,124,3,124,0,95,11,116,7,
+    124,8,161,1,1,0,113,94,165,3,124,0,95,11,116,7,
     106,8,160,9,116,16,161,1,114,186,100,4,100,5,132,0,
-    124,2,68,0,131,1,124,0,95,17,100,6,83,0,41,7,
+    124,2,68,0,131,1,124,0,95,17,168,6,83,0,41,7,
     122,68,70,105,108,108,32,116,104,101,32,99,97,99,104,101,
     32,111,102,32,112,111,116,101,110,116,105,97,108,32,109,111,
     100,117,108,101,115,32,97,110,100,32,112,97,99,107,97,103,
@@ -2351,7 +2351,7 @@ const unsigned char _Py_M__importlib_external[] = {
     2,113,4,83,0,114,2,0,0,0,41,1,114,90,0,0,
     0,41,2,114,22,0,0,0,90,2,102,110,114,2,0,0,
     0,114,2,0,0,0,114,4,0,0,0,218,9,60,115,101,
-    116,99,111,109,112,62,153,5,0,0,115,2,0,0,0,6,
+    116,99,111,109,112,62,154,5,0,0,115,2,0,0,0,6,
     0,122,41,70,105,108,101,70,105,110,100,101,114,46,95,102,
     105,108,108,95,99,97,99,104,101,46,60,108,111,99,97,108,
     115,62,46,60,115,101,116,99,111,109,112,62,78,41,18,114,
@@ -2367,7 +2367,7 @@ const unsigned char _Py_M__importlib_external[] = {
     102,105,120,95,99,111,110,116,101,110,116,115,114,1,1,0,
     0,114,100,0,0,0,114,248,0,0,0,114,236,0,0,0,
     90,8,110,101,119,95,110,97,109,101,114,2,0,0,0,114,
-    2,0,0,0,114,4,0,0,0,114,26,1,0,0,124,5,
+    2,0,0,0,114,4,0,0,0,114,26,1,0,0,125,5,
     0,0,115,34,0,0,0,0,2,6,1,2,1,22,1,20,
     3,10,3,12,1,12,7,6,1,8,1,16,1,4,1,18,
     2,4,1,12,1,6,1,12,1,122,22,70,105,108,101,70,
@@ -2405,7 +2405,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,114,101,0,0,0,41,1,114,35,0,0,0,41,
     2,114,172,0,0,0,114,25,1,0,0,114,2,0,0,0,
     114,4,0,0,0,218,24,112,97,116,104,95,104,111,111,107,
-    95,102,111,114,95,70,105,108,101,70,105,110,100,101,114,165,
+    95,102,111,114,95,70,105,108,101,70,105,110,100,101,114,166,
     5,0,0,115,6,0,0,0,0,2,8,1,12,1,122,54,
     70,105,108,101,70,105,110,100,101,114,46,112,97,116,104,95,
     104,111,111,107,46,60,108,111,99,97,108,115,62,46,112,97,
@@ -2413,16 +2413,16 @@ const unsigned char _Py_M__importlib_external[] = {
     70,105,110,100,101,114,114,2,0,0,0,41,3,114,172,0,
     0,0,114,25,1,0,0,114,31,1,0,0,114,2,0,0,
     0,41,2,114,172,0,0,0,114,25,1,0,0,114,4,0,
-    0,0,218,9,112,97,116,104,95,104,111,111,107,155,5,0,
+    0,0,218,9,112,97,116,104,95,104,111,111,107,156,5,0,
     0,115,4,0,0,0,0,10,14,6,122,20,70,105,108,101,
     70,105,110,100,101,114,46,112,97,116,104,95,104,111,111,107,
     99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
-    0,67,0,0,0,115,12,0,0,0,100,1,160,0,124,0,
+    0,67,0,0,0,115,12,0,0,0,100,1,160,0,166,0,
     106,1,161,1,83,0,41,2,78,122,16,70,105,108,101,70,
     105,110,100,101,114,40,123,33,114,125,41,41,2,114,48,0,
     0,0,114,35,0,0,0,41,1,114,102,0,0,0,114,2,
     0,0,0,114,2,0,0,0,114,4,0,0,0,114,0,1,
-    0,0,173,5,0,0,115,2,0,0,0,0,1,122,19,70,
+    0,0,174,5,0,0,115,2,0,0,0,0,1,122,19,70,
     105,108,101,70,105,110,100,101,114,46,95,95,114,101,112,114,
     95,95,41,1,78,41,15,114,107,0,0,0,114,106,0,0,
     0,114,108,0,0,0,114,109,0,0,0,114,186,0,0,0,
@@ -2430,20 +2430,20 @@ const unsigned char _Py_M__importlib_external[] = {
     119,0,0,0,114,18,1,0,0,114,182,0,0,0,114,26,
     1,0,0,114,184,0,0,0,114,32,1,0,0,114,0,1,
     0,0,114,2,0,0,0,114,2,0,0,0,114,2,0,0,
-    0,114,4,0,0,0,114,19,1,0,0,30,5,0,0,115,
+    0,114,4,0,0,0,114,19,1,0,0,31,5,0,0,115,
     18,0,0,0,12,9,8,14,8,4,4,2,8,12,8,5,
     10,48,8,31,12,18,114,19,1,0,0,99,4,0,0,0,
     0,0,0,0,6,0,0,0,8,0,0,0,67,0,0,0,
     115,146,0,0,0,124,0,160,0,100,1,161,1,125,4,124,
     0,160,0,100,2,161,1,125,5,124,4,115,66,124,5,114,
-    36,124,5,106,1,125,4,110,30,124,2,124,3,107,2,114,
-    56,116,2,124,1,124,2,131,2,125,4,110,10,116,3,124,
-    1,124,2,131,2,125,4,124,5,115,84,116,4,124,1,124,
-    2,124,4,100,3,141,3,125,5,122,36,124,5,124,0,100,
-    2,60,0,124,4,124,0,100,1,60,0,124,2,124,0,100,
-    4,60,0,124,3,124,0,100,5,60,0,87,0,110,20,4,
-    0,116,5,107,10,114,140,1,0,1,0,1,0,89,0,110,
-    2,88,0,100,0,83,0,41,6,78,218,10,95,95,108,111,
+    36,166,5,106,1,125,4,110,30,165,2,124,3,167,2,114,
+    56,116,2,165,1,124,2,131,2,125,4,110,10,116,3,165,
+    1,124,2,131,2,125,4,124,5,115,84,116,4,165,1,124,
+    2,124,4,100,3,141,3,125,5,122,36,165,5,124,0,100,
+    2,60,0,165,4,124,0,100,1,60,0,165,2,124,0,100,
+    4,60,0,165,3,124,0,100,5,60,0,87,0,110,20,4,
+    0,116,5,167,10,114,140,1,0,1,0,1,0,89,0,110,
+    2,88,0,168,0,83,0,41,6,78,218,10,95,95,108,111,
     97,100,101,114,95,95,218,8,95,95,115,112,101,99,95,95,
     41,1,114,122,0,0,0,90,8,95,95,102,105,108,101,95,
     95,90,10,95,95,99,97,99,104,101,100,95,95,41,6,218,
@@ -2453,14 +2453,14 @@ const unsigned char _Py_M__importlib_external[] = {
     112,97,116,104,110,97,109,101,90,9,99,112,97,116,104,110,
     97,109,101,114,122,0,0,0,114,166,0,0,0,114,2,0,
     0,0,114,2,0,0,0,114,4,0,0,0,218,14,95,102,
-    105,120,95,117,112,95,109,111,100,117,108,101,179,5,0,0,
+    105,120,95,117,112,95,109,111,100,117,108,101,180,5,0,0,
     115,34,0,0,0,0,2,10,1,10,1,4,1,4,1,8,
     1,8,1,12,2,10,1,4,1,14,1,2,1,8,1,8,
     1,8,1,12,1,14,2,114,37,1,0,0,99,0,0,0,
     0,0,0,0,0,3,0,0,0,3,0,0,0,67,0,0,
     0,115,38,0,0,0,116,0,116,1,160,2,161,0,102,2,
     125,0,116,3,116,4,102,2,125,1,116,5,116,6,102,2,
-    125,2,124,0,124,1,124,2,103,3,83,0,41,1,122,95,
+    125,2,165,0,124,1,124,2,103,3,83,0,41,1,122,95,
     82,101,116,117,114,110,115,32,97,32,108,105,115,116,32,111,
     102,32,102,105,108,101,45,98,97,115,101,100,32,109,111,100,
     117,108,101,32,108,111,97,100,101,114,115,46,10,10,32,32,
@@ -2473,22 +2473,22 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,41,3,90,10,101,120,116,101,110,115,105,111,110,
     115,90,6,115,111,117,114,99,101,90,8,98,121,116,101,99,
     111,100,101,114,2,0,0,0,114,2,0,0,0,114,4,0,
-    0,0,114,163,0,0,0,202,5,0,0,115,8,0,0,0,
+    0,0,114,163,0,0,0,203,5,0,0,115,8,0,0,0,
     0,5,12,1,8,1,8,1,114,163,0,0,0,99,1,0,
     0,0,0,0,0,0,12,0,0,0,9,0,0,0,67,0,
     0,0,115,156,1,0,0,124,0,97,0,116,0,106,1,97,
     1,116,0,106,2,97,2,116,1,106,3,116,4,25,0,125,
-    1,100,1,68,0,93,48,125,2,124,2,116,1,106,3,107,
+    1,100,1,68,0,93,48,125,2,124,2,116,1,106,3,167,
     7,114,56,116,0,160,5,124,2,161,1,125,3,110,10,116,
-    1,106,3,124,2,25,0,125,3,116,6,124,1,124,2,124,
+    1,106,3,124,2,25,0,125,3,116,6,165,1,124,2,124,
     3,131,3,1,0,113,30,100,2,100,3,103,1,102,2,100,
     4,100,5,100,3,103,2,102,2,102,2,125,4,124,4,68,
     0,93,110,92,2,125,5,125,6,116,7,100,6,100,7,132,
     0,124,6,68,0,131,1,131,1,115,136,116,8,130,1,124,
-    6,100,8,25,0,125,7,124,5,116,1,106,3,107,6,114,
+    6,100,8,25,0,125,7,124,5,116,1,106,3,167,6,114,
     170,116,1,106,3,124,5,25,0,125,8,1,0,113,226,113,
     106,122,20,116,0,160,5,124,5,161,1,125,8,87,0,1,
-    0,113,226,87,0,113,106,4,0,116,9,107,10,114,214,1,
+    0,113,226,87,0,113,106,4,0,116,9,167,10,114,214,1,
     0,1,0,1,0,89,0,113,106,89,0,113,106,88,0,113,
     106,116,9,100,9,131,1,130,1,116,6,124,1,100,10,124,
     8,131,3,1,0,116,6,124,1,100,11,124,7,131,3,1,
@@ -2501,7 +2501,7 @@ const unsigned char _Py_M__importlib_external[] = {
     6,124,1,100,18,116,11,131,0,131,3,1,0,116,12,160,
     13,116,2,160,14,161,0,161,1,1,0,124,5,100,4,107,
     2,144,1,114,152,116,15,160,16,100,19,161,1,1,0,100,
-    20,116,12,107,6,144,1,114,152,100,21,116,17,95,18,100,
+    20,116,12,107,6,144,1,114,152,100,21,116,17,95,18,168,
     22,83,0,41,23,122,205,83,101,116,117,112,32,116,104,101,
     32,112,97,116,104,45,98,97,115,101,100,32,105,109,112,111,
     114,116,101,114,115,32,102,111,114,32,105,109,112,111,114,116,
@@ -2521,10 +2521,10 @@ const unsigned char _Py_M__importlib_external[] = {
     99,1,0,0,0,0,0,0,0,2,0,0,0,3,0,0,
     0,115,0,0,0,115,26,0,0,0,124,0,93,18,125,1,
     116,0,124,1,131,1,100,0,107,2,86,0,1,0,113,2,
-    100,1,83,0,41,2,114,29,0,0,0,78,41,1,114,31,
+    168,1,83,0,41,2,114,29,0,0,0,78,41,1,114,31,
     0,0,0,41,2,114,22,0,0,0,114,79,0,0,0,114,
     2,0,0,0,114,2,0,0,0,114,4,0,0,0,114,238,
-    0,0,0,238,5,0,0,115,2,0,0,0,4,0,122,25,
+    0,0,0,239,5,0,0,115,2,0,0,0,4,0,122,25,
     95,115,101,116,117,112,46,60,108,111,99,97,108,115,62,46,
     60,103,101,110,101,120,112,114,62,114,60,0,0,0,122,30,
     105,109,112,111,114,116,108,105,98,32,114,101,113,117,105,114,
@@ -2551,7 +2551,7 @@ const unsigned char _Py_M__importlib_external[] = {
     117,108,101,90,14,119,101,97,107,114,101,102,95,109,111,100,
     117,108,101,90,13,119,105,110,114,101,103,95,109,111,100,117,
     108,101,114,2,0,0,0,114,2,0,0,0,114,4,0,0,
-    0,218,6,95,115,101,116,117,112,213,5,0,0,115,76,0,
+    0,218,6,95,115,101,116,117,112,214,5,0,0,115,76,0,
     0,0,0,8,4,1,6,1,6,3,10,1,8,1,10,1,
     12,2,10,1,14,3,22,1,12,2,22,1,8,1,10,1,
     10,1,6,2,2,1,10,1,10,1,14,1,12,2,8,1,
@@ -2561,7 +2561,7 @@ const unsigned char _Py_M__importlib_external[] = {
     4,0,0,0,67,0,0,0,115,50,0,0,0,116,0,124,
     0,131,1,1,0,116,1,131,0,125,1,116,2,106,3,160,
     4,116,5,106,6,124,1,142,0,103,1,161,1,1,0,116,
-    2,106,7,160,8,116,9,161,1,1,0,100,1,83,0,41,
+    2,106,7,160,8,116,9,161,1,1,0,168,1,83,0,41,
     2,122,41,73,110,115,116,97,108,108,32,116,104,101,32,112,
     97,116,104,45,98,97,115,101,100,32,105,109,112,111,114,116,
     32,99,111,109,112,111,110,101,110,116,115,46,78,41,10,114,
@@ -2571,7 +2571,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,5,1,0,0,41,2,114,43,1,0,0,90,17,
     115,117,112,112,111,114,116,101,100,95,108,111,97,100,101,114,
     115,114,2,0,0,0,114,2,0,0,0,114,4,0,0,0,
-    218,8,95,105,110,115,116,97,108,108,21,6,0,0,115,8,
+    218,8,95,105,110,115,116,97,108,108,22,6,0,0,115,8,
     0,0,0,0,2,8,1,6,1,20,1,114,46,1,0,0,
     41,1,114,47,0,0,0,41,1,78,41,3,78,78,78,41,
     2,114,60,0,0,0,114,60,0,0,0,41,1,84,41,1,
@@ -2604,7 +2604,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,218,8,60,109,111,100,117,108,101,62,23,0,0,0,
     115,118,0,0,0,4,0,4,1,4,1,2,1,6,3,8,
     17,8,5,8,5,8,6,8,12,8,10,8,9,8,5,8,
-    7,10,22,10,127,0,5,16,1,12,2,4,1,4,2,6,
+    7,10,22,10,127,0,6,16,1,12,2,4,1,4,2,6,
     2,6,2,8,2,16,45,8,34,8,19,8,12,8,12,8,
     28,8,17,8,33,8,28,8,24,10,13,10,10,10,11,8,
     14,6,3,4,1,14,67,14,64,14,29,16,127,0,17,14,
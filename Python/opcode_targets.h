@@ -164,10 +164,10 @@ static void *opcode_targets[256] = {
     &&TARGET_CALL_FINALLY,
     &&TARGET_POP_FINALLY,
     &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
+    &&TARGET_LOAD_FAST__LOAD_FAST,
+    &&TARGET_LOAD_FAST__LOAD_ATTR,
+    &&TARGET_COMPARE_AND_BRANCH,
+    &&TARGET_LOAD_CONST__RETURN,
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
@@ -203,6 +203,53 @@ markblocks(_Py_CODEUNIT *code, Py_ssize_t len)
     return blocks;
 }
 
+/* Replace the first instruction of common pairs with a superinstruction.
+   The second instruction is kept, so jumps to it, line numbers and the
+   code size are unchanged: the superinstruction executes both in ceval.c.
+   Its second instruction must directly follow it (no EXTENDED_ARG prefix)
+   and is never itself turned into a superinstruction. */
+static void
+insert_superinstructions(_Py_CODEUNIT *codestr, Py_ssize_t codelen)
+{
+    Py_ssize_t i;
+    unsigned char opcode, nextop, superop;
+
+    for (i = 0; i + 1 < codelen; i++) {
+        opcode = _Py_OPCODE(codestr[i]);
+        nextop = _Py_OPCODE(codestr[i + 1]);
+        switch (opcode) {
+            case LOAD_FAST:
+                if (nextop == LOAD_FAST) {
+                    superop = LOAD_FAST__LOAD_FAST;
+                }
+                else if (nextop == LOAD_ATTR) {
+                    superop = LOAD_FAST__LOAD_ATTR;
+                }
+                else {
+                    continue;
+                }
+                break;
+            case COMPARE_OP:
+                if (nextop != POP_JUMP_IF_FALSE) {
+                    continue;
+                }
+                superop = COMPARE_AND_BRANCH;
+                break;
+            case LOAD_CONST:
+                if (nextop != RETURN_VALUE) {
+                    continue;
+                }
+                superop = LOAD_CONST__RETURN;
+                break;
+            default:
+                continue;
+        }
+        codestr[i] = PACKOPARG(superop, _Py_OPARG(codestr[i]));
+        /* Skip the second instruction */
+        i++;
+    }
+}
+
 /* Perform basic peephole optimizations to components of a code object.
    The consts object should still be in list form to allow new constants
    to be appended.
@@ -483,6 +530,8 @@ PyCode_Optimize(PyObject *code, PyObject* consts, PyObject *names,
     }
     assert(h + (Py_ssize_t)nops == codelen);
 
+    insert_superinstructions(codestr, h);
+
     PyMem_Free(blocks);
     code = PyBytes_FromStringAndSize((char *)codestr, h * sizeof(_Py_CODEUNIT));
     PyMem_Free(codestr);
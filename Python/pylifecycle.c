@@ -4,6 +4,8 @@
 
 #include "Python-ast.h"
 #undef Yield /* undefine macro conflicting with winbase.h */
+#include "code.h"
+#include "internal/code.h"
 #include "internal/context.h"
 #include "internal/hamt.h"
 #include "internal/pystate.h"
@@ -614,6 +616,13 @@ _Py_InitializeCore(const _PyCoreConfig *core_config)
             return _Py_INIT_USER_ERR("Unknown PYTHONMALLOC allocator");
         }
     }
+    if (core_config->arena_size != NULL) {
+        if (_PyObject_SetArenaSize(core_config->arena_size) < 0) {
+            return _Py_INIT_USER_ERR("PYTHONMALLOCARENASIZE: arena size "
+                                     "must be a power of 2 between 256K "
+                                     "and 256M");
+        }
+    }
 
     if (_PyRuntime.initialized) {
         return _Py_INIT_ERR("main interpreter already initialized");
@@ -1116,6 +1125,10 @@ Py_FinalizeEx(void)
        so it is possible to use tracemalloc in objects destructor. */
     _PyTraceMalloc_Fini();
 
+    /* Free the opcode counts of the code objects */
+    _PyEval_SetOpcodeProfiling(0);
+    _PyCode_ClearOpcodeProfiles();
+
     /* Destroy the database used by _PyImport_{Fixup,Find}Extension */
     _PyImport_Fini();
 
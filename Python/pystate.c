@@ -4,10 +4,22 @@
 #include "Python.h"
 #include "internal/pystate.h"
 
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+/* Threads of interpreters with their own GIL run in parallel, so the
+   current thread state can't be a process-wide variable. */
+#ifdef MS_WINDOWS
+static __declspec(thread) PyThreadState *_tstate_current = NULL;
+#else
+static __thread PyThreadState *_tstate_current = NULL;
+#endif
+#define GET_TSTATE() _tstate_current
+#define SET_TSTATE(value) _tstate_current = (value)
+#else
 #define GET_TSTATE() \
     ((PyThreadState*)_Py_atomic_load_relaxed(&_PyThreadState_Current))
 #define SET_TSTATE(value) \
     _Py_atomic_store_relaxed(&_PyThreadState_Current, (uintptr_t)(value))
+#endif
 #define GET_INTERP_STATE() \
     (GET_TSTATE()->interp)
 
@@ -170,6 +182,19 @@ PyInterpreterState_New(void)
 #endif
     interp->pyexitfunc = NULL;
     interp->pyexitmodule = NULL;
+    interp->gil = &_PyRuntime.ceval.gil;
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+    if (_PyRuntime.interpreters.main == NULL) {
+        interp->gc = &_PyRuntime.gc;
+    }
+    else {
+        interp->gc = _PyGC_NewState();
+        if (interp->gc == NULL) {
+            PyMem_RawFree(interp);
+            return NULL;
+        }
+    }
+#endif
 
     HEAD_LOCK();
     interp->next = _PyRuntime.interpreters.head;
@@ -260,6 +285,11 @@ PyInterpreterState_Delete(PyInterpreterState *interp)
     if (interp->id_mutex != NULL) {
         PyThread_free_lock(interp->id_mutex);
     }
+#ifdef EXPERIMENTAL_ISOLATED_SUBINTERPRETERS
+    if (interp->gc != &_PyRuntime.gc) {
+        _PyGC_DeleteState(interp->gc);
+    }
+#endif
     PyMem_RawFree(interp);
 }
 
@@ -340,6 +370,7 @@ _PyInterpreterState_IDDecref(PyInterpreterState *interp)
     PyThread_release_lock(interp->id_mutex);
 
     if (refcount == 0) {
+        _PyEval_FiniInterpreterGIL(interp);
         // XXX Using the "head" thread isn't strictly correct.
         PyThreadState *tstate = PyInterpreterState_ThreadHead(interp);
         // XXX Possible GILState issues?
@@ -414,6 +445,19 @@ new_threadstate(PyInterpreterState *interp, int init)
 
         tstate->id = ++interp->tstate_next_unique_id;
 
+        tstate->gil_wait_time = 0;
+        tstate->gil_handoffs = 0;
+#ifdef Py_GIL_STATS
+        tstate->gil_hold_time = 0;
+        tstate->gil_acquisitions = 0;
+        tstate->gil_forced_drops = 0;
+#endif
+
+#ifdef WITH_PYMALLOC_THREAD_CACHE
+        tstate->obmalloc_cache = NULL;
+#endif
+        tstate->pylong_active = 0;
+
         if (init)
             _PyThreadState_Init(tstate);
 
@@ -602,6 +646,10 @@ PyThreadState_Clear(PyThreadState *tstate)
     Py_CLEAR(tstate->async_gen_finalizer);
 
     Py_CLEAR(tstate->context);
+
+    /* Give the cached blocks back while the GIL is held: the thread state
+       may be deleted without it */
+    _PyObject_ClearThreadCache(tstate);
 }
 
 
@@ -648,9 +696,11 @@ void
 PyThreadState_DeleteCurrent()
 {
     PyThreadState *tstate = GET_TSTATE();
+    PyInterpreterState *interp;
     if (tstate == NULL)
         Py_FatalError(
             "PyThreadState_DeleteCurrent: no current tstate");
+    interp = tstate->interp;
     tstate_delete_common(tstate);
     if (_PyRuntime.gilstate.autoInterpreterState &&
         PyThread_tss_get(&_PyRuntime.gilstate.autoTSSkey) == tstate)
@@ -658,7 +708,9 @@ PyThreadState_DeleteCurrent()
         PyThread_tss_set(&_PyRuntime.gilstate.autoTSSkey, NULL);
     }
     SET_TSTATE(NULL);
-    PyEval_ReleaseLock();
+    /* The interpreter may have its own GIL: PyEval_ReleaseLock() would
+       release the main one, without a current thread state. */
+    _PyEval_ReleaseInterpreterLock(interp);
 }
 
 
@@ -887,6 +939,159 @@ _PyThread_CurrentFrames(void)
     return NULL;
 }
 
+/* The list of the current frames of the threads of interp, for the sampling
+   profiler (Modules/_sampleprof.c).  The frames are collected in a list
+   preallocated before taking head_mutex, so that no object is allocated
+   while the lock is held: the threads of the interpreter are waiting for
+   the GIL and can't change their frames.
+*/
+PyObject *
+_PyInterpreterState_GetFrames(PyInterpreterState *interp)
+{
+    PyObject *result;
+    PyThreadState *t;
+    Py_ssize_t n, i;
+
+    for (;;) {
+        HEAD_LOCK();
+        n = 0;
+        for (t = interp->tstate_head; t != NULL; t = t->next) {
+            if (t->frame != NULL)
+                n++;
+        }
+        HEAD_UNLOCK();
+
+        result = PyList_New(n);
+        if (result == NULL)
+            return NULL;
+
+        HEAD_LOCK();
+        i = 0;
+        for (t = interp->tstate_head; t != NULL; t = t->next) {
+            struct _frame *frame = t->frame;
+            if (frame == NULL)
+                continue;
+            if (i == n)
+                break;
+            Py_INCREF(frame);
+            PyList_SET_ITEM(result, i, (PyObject *)frame);
+            i++;
+        }
+        HEAD_UNLOCK();
+        if (i == n && t == NULL)
+            return result;
+        /* A thread was created or started running Python code while the
+           list was allocated (its allocation may have run a finalizer):
+           retry */
+        Py_DECREF(result);
+    }
+}
+
+PyObject *
+_PyThread_GILStats(void)
+{
+    PyObject *result;
+    PyObject *key, *value;
+    Py_ssize_t pos;
+    PyInterpreterState *i;
+
+    result = PyDict_New();
+    if (result == NULL)
+        return NULL;
+
+    /* for i in all interpreters:
+     *     for t in all of i's thread states:
+     *          add t's statistics to those of t's id
+     * A thread which ran in several interpreters has one thread state
+     * per interpreter.  The statistics are first gathered as tuples of
+     * integers, which are then converted to dicts.
+     */
+    HEAD_LOCK();
+    for (i = _PyRuntime.interpreters.head; i != NULL; i = i->next) {
+        PyThreadState *t;
+        for (t = i->tstate_head; t != NULL; t = t->next) {
+            long long wait_time = t->gil_wait_time;
+            unsigned long long handoffs = t->gil_handoffs;
+#ifdef Py_GIL_STATS
+            long long hold_time = t->gil_hold_time;
+            unsigned long long acquisitions = t->gil_acquisitions;
+            unsigned long long forced_drops = t->gil_forced_drops;
+#endif
+            PyObject *id;
+            int stat;
+            id = PyLong_FromUnsignedLong(t->thread_id);
+            if (id == NULL)
+                goto Fail;
+            value = PyDict_GetItem(result, id);
+            if (value != NULL) {
+                wait_time += PyLong_AsLongLong(PyTuple_GET_ITEM(value, 0));
+                handoffs += PyLong_AsUnsignedLongLong(
+                    PyTuple_GET_ITEM(value, 1));
+#ifdef Py_GIL_STATS
+                hold_time += PyLong_AsLongLong(PyTuple_GET_ITEM(value, 2));
+                acquisitions += PyLong_AsUnsignedLongLong(
+                    PyTuple_GET_ITEM(value, 3));
+                forced_drops += PyLong_AsUnsignedLongLong(
+                    PyTuple_GET_ITEM(value, 4));
+#endif
+            }
+#ifdef Py_GIL_STATS
+            value = Py_BuildValue("LKLKK", wait_time, handoffs, hold_time,
+                                  acquisitions, forced_drops);
+#else
+            value = Py_BuildValue("LK", wait_time, handoffs);
+#endif
+            if (value == NULL) {
+                Py_DECREF(id);
+                goto Fail;
+            }
+            stat = PyDict_SetItem(result, id, value);
+            Py_DECREF(id);
+            Py_DECREF(value);
+            if (stat < 0)
+                goto Fail;
+        }
+    }
+    HEAD_UNLOCK();
+
+    pos = 0;
+    while (PyDict_Next(result, &pos, &key, &value)) {
+        PyObject *stats = Py_BuildValue(
+#ifdef Py_GIL_STATS
+            "{sdsOsdsOsO}",
+#else
+            "{sdsO}",
+#endif
+            "wait_time", _PyTime_AsSecondsDouble(
+                PyLong_AsLongLong(PyTuple_GET_ITEM(value, 0))),
+            "handoffs", PyTuple_GET_ITEM(value, 1)
+#ifdef Py_GIL_STATS
+            , "hold_time", _PyTime_AsSecondsDouble(
+                PyLong_AsLongLong(PyTuple_GET_ITEM(value, 2))),
+            "acquisitions", PyTuple_GET_ITEM(value, 3),
+            "forced_drops", PyTuple_GET_ITEM(value, 4)
+#endif
+            );
+        if (stats == NULL) {
+            Py_DECREF(result);
+            return NULL;
+        }
+        /* Replacing the value of an existing key doesn't resize the dict */
+        if (PyDict_SetItem(result, key, stats) < 0) {
+            Py_DECREF(stats);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(stats);
+    }
+    return result;
+
+ Fail:
+    HEAD_UNLOCK();
+    Py_DECREF(result);
+    return NULL;
+}
+
 /* Python "auto thread state" API. */
 
 /* Keep this as a static, as it is not reliable!  It can only
@@ -1239,7 +1444,7 @@ _PyCrossInterpreterData_Release(_PyCrossInterpreterData *data)
         // XXX Using the "head" thread isn't strictly correct.
         PyThreadState *tstate = PyInterpreterState_ThreadHead(interp);
         // XXX Possible GILState issues?
-        save_tstate = PyThreadState_Swap(tstate);
+        save_tstate = _PyEval_SwitchThreadState(tstate);
     }
 
     // "Release" the data and/or the object.
@@ -1250,7 +1455,7 @@ _PyCrossInterpreterData_Release(_PyCrossInterpreterData *data)
 
     // Switch back.
     if (save_tstate != NULL) {
-        PyThreadState_Swap(save_tstate);
+        _PyEval_SwitchThreadState(save_tstate);
     }
 }
 
@@ -17,6 +17,7 @@ Data members:
 #include "Python.h"
 #include "internal/pystate.h"
 #include "code.h"
+#include "internal/code.h"
 #include "frameobject.h"
 #include "pythread.h"
 
@@ -679,6 +680,180 @@ PyDoc_STRVAR(getswitchinterval_doc,
 "getswitchinterval() -> current thread switch interval; see setswitchinterval()."
 );
 
+static PyObject *
+sys_set_gil_io_priority(PyObject *self, PyObject *arg)
+{
+    int enabled = PyObject_IsTrue(arg);
+    if (enabled < 0)
+        return NULL;
+    _PyEval_SetIOPriority(enabled);
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(set_gil_io_priority_doc,
+"_set_gil_io_priority(enabled)\n\
+\n\
+Enable or disable the I/O priority of the GIL.  When enabled, a thread\n\
+coming back from a blocking call, such as a read from a socket, asks the\n\
+thread holding the GIL to drop it at once instead of waiting for the\n\
+switch interval, and gets it before threads which are waiting for it\n\
+otherwise.  This reduces the latency of I/O-bound threads running\n\
+alongside CPU-bound ones, at the cost of more thread switches.\n\
+\n\
+The setting applies to the GIL of the current interpreter, which is\n\
+shared by all the interpreters except those created with their own GIL."
+);
+
+static PyObject *
+sys_get_gil_io_priority(PyObject *self, PyObject *args)
+{
+    return PyBool_FromLong(_PyEval_GetIOPriority());
+}
+
+PyDoc_STRVAR(get_gil_io_priority_doc,
+"_get_gil_io_priority() -> whether the GIL I/O priority is enabled; see\n\
+_set_gil_io_priority()."
+);
+
+static PyObject *
+sys_set_sort_threads(PyObject *self, PyObject *args)
+{
+    int n;
+    if (!PyArg_ParseTuple(args, "i:_set_sort_threads", &n))
+        return NULL;
+    if (n < 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "the number of threads must be at least 1");
+        return NULL;
+    }
+    _PyList_SetSortThreads(n);
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(set_sort_threads_doc,
+"_set_sort_threads(n)\n\
+\n\
+Set the number of threads sorting large lists.  list.sort() and sorted()\n\
+split the sort of a list of ints, floats or latin-1 strings between n\n\
+threads, but a thread is only used for every 100000 items.  1 means that\n\
+only the calling thread sorts."
+);
+
+static PyObject *
+sys_get_sort_threads(PyObject *self, PyObject *args)
+{
+    return PyLong_FromLong(_PyList_GetSortThreads());
+}
+
+PyDoc_STRVAR(get_sort_threads_doc,
+"_get_sort_threads() -> number of threads sorting large lists; see\n\
+_set_sort_threads()."
+);
+
+static PyObject *
+sys_gil_stats(PyObject *self, PyObject *noargs)
+{
+    return _PyThread_GILStats();
+}
+
+PyDoc_STRVAR(gil_stats_doc,
+"_gil_stats() -> dictionary\n\
+\n\
+Return a dictionary mapping each current thread T's thread id to the GIL\n\
+statistics of T: a dictionary with the total time in seconds T waited for\n\
+the GIL ('wait_time'), and the number of times the GIL was handed over to\n\
+T from another thread ('handoffs').  Builds configured with\n\
+--with-gil-stats also report the total time T held the GIL ('hold_time'),\n\
+the number of times T took the GIL ('acquisitions') and dropped it\n\
+because another thread asked for it ('forced_drops').\n\
+\n\
+This function should be used for specialized purposes only."
+);
+
+static PyObject *
+sys_shared_keys_stats(PyObject *self, PyObject *noargs)
+{
+    return _PyDict_SharedKeysStats();
+}
+
+PyDoc_STRVAR(shared_keys_stats_doc,
+"_shared_keys_stats() -> dictionary\n\
+\n\
+Return a dictionary with statistics on the keys shared by the instance\n\
+dictionaries of classes: the number of key layouts created for instances\n\
+which set their attributes in another order ('variants') and the number of\n\
+classes which stopped sharing keys because their instances needed too many\n\
+layouts ('types_lost').\n\
+\n\
+This function should be used for specialized purposes only."
+);
+
+static PyObject *
+sys_set_opcode_profiling(PyObject *self, PyObject *arg)
+{
+    int enabled = PyObject_IsTrue(arg);
+    if (enabled < 0)
+        return NULL;
+    if (_PyEval_SetOpcodeProfiling(enabled) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(set_opcode_profiling_doc,
+"_set_opcode_profiling(enabled)\n\
+\n\
+Enable or disable opcode profiling.  When enabled, every code object\n\
+counts the opcodes it runs, and the pairs of opcodes run one after the\n\
+other in the same frame.  See _opcode_profile().  Profiling slows down\n\
+the interpreter: it makes every instruction take the slow path of the\n\
+eval loop."
+);
+
+static PyObject *
+sys_get_opcode_profiling(PyObject *self, PyObject *args)
+{
+    return PyBool_FromLong(_PyEval_GetOpcodeProfiling());
+}
+
+PyDoc_STRVAR(get_opcode_profiling_doc,
+"_get_opcode_profiling() -> whether opcode profiling is enabled; see\n\
+_set_opcode_profiling()."
+);
+
+static PyObject *
+sys_opcode_profile(PyObject *self, PyObject *noargs)
+{
+    return _PyCode_GetOpcodeProfiles();
+}
+
+PyDoc_STRVAR(opcode_profile_doc,
+"_opcode_profile() -> list\n\
+\n\
+Return the opcode counts of the code objects which ran while opcode\n\
+profiling was enabled, as a list of (filename, firstlineno, name, counts,\n\
+pairs) tuples.  counts maps an opcode to the number of times the code\n\
+object ran it, and pairs maps an (opcode, next opcode) tuple to the\n\
+number of times the second opcode ran right after the first one.\n\
+\n\
+The counts of deleted code objects are kept: several items can have\n\
+the same filename, first line number and name.\n\
+\n\
+This function should be used for specialized purposes only."
+);
+
+static PyObject *
+sys_clear_opcode_profile(PyObject *self, PyObject *noargs)
+{
+    _PyCode_ClearOpcodeProfiles();
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(clear_opcode_profile_doc,
+"_clear_opcode_profile()\n\
+\n\
+Clear the opcode counts of all code objects."
+);
+
 static PyObject *
 sys_setrecursionlimit(PyObject *self, PyObject *args)
 {
@@ -1444,11 +1619,6 @@ checks.\n\
 extern PyObject *_Py_GetObjects(PyObject *, PyObject *);
 #endif
 
-#ifdef DYNAMIC_EXECUTION_PROFILE
-/* Defined in ceval.c because it uses static globals if that file */
-extern PyObject *_Py_GetDXProfile(PyObject *,  PyObject *);
-#endif
-
 #ifdef __cplusplus
 }
 #endif
@@ -1513,9 +1683,6 @@ static PyMethodDef sys_methods[] = {
       getallocatedblocks_doc},
 #ifdef COUNT_ALLOCS
     {"getcounts",       (PyCFunction)sys_getcounts, METH_NOARGS},
-#endif
-#ifdef DYNAMIC_EXECUTION_PROFILE
-    {"getdxp",          _Py_GetDXProfile, METH_VARARGS},
 #endif
     {"getfilesystemencoding", sys_getfilesystemencoding,
      METH_NOARGS, getfilesystemencoding_doc},
@@ -1552,6 +1719,25 @@ static PyMethodDef sys_methods[] = {
      setswitchinterval_doc},
     {"getswitchinterval",       sys_getswitchinterval, METH_NOARGS,
      getswitchinterval_doc},
+    {"_set_gil_io_priority",    sys_set_gil_io_priority, METH_O,
+     set_gil_io_priority_doc},
+    {"_get_gil_io_priority",    sys_get_gil_io_priority, METH_NOARGS,
+     get_gil_io_priority_doc},
+    {"_set_sort_threads",       sys_set_sort_threads, METH_VARARGS,
+     set_sort_threads_doc},
+    {"_get_sort_threads",       sys_get_sort_threads, METH_NOARGS,
+     get_sort_threads_doc},
+    {"_gil_stats",              sys_gil_stats, METH_NOARGS, gil_stats_doc},
+    {"_shared_keys_stats",      sys_shared_keys_stats, METH_NOARGS,
+     shared_keys_stats_doc},
+    {"_set_opcode_profiling",   sys_set_opcode_profiling, METH_O,
+     set_opcode_profiling_doc},
+    {"_get_opcode_profiling",   sys_get_opcode_profiling, METH_NOARGS,
+     get_opcode_profiling_doc},
+    {"_opcode_profile",         sys_opcode_profile, METH_NOARGS,
+     opcode_profile_doc},
+    {"_clear_opcode_profile",   sys_clear_opcode_profile, METH_NOARGS,
+     clear_opcode_profile_doc},
 #ifdef HAVE_DLOPEN
     {"setdlopenflags", sys_setdlopenflags, METH_VARARGS,
      setdlopenflags_doc},
@@ -17,6 +17,11 @@ import socket
 from optparse import OptionParser, SUPPRESS_HELP
 import platform
 
+try:
+    import _xxsubinterpreters
+except ImportError:
+    _xxsubinterpreters = None
+
 # Compatibility
 try:
     xrange
@@ -37,6 +42,8 @@ LATENCY_DURATION = 2.0
 BANDWIDTH_PACKET_SIZE = 1024
 BANDWIDTH_DURATION = 2.0
 
+SCALING_DURATION = 2.0
+
 
 def task_pidigits():
     """Pi calculation (Python)"""
@@ -527,6 +534,122 @@ def run_bandwidth_tests(max_threads):
         print()
 
 
+# The same pure Python task is run by every kind of worker, so it must be
+# self-contained: subinterpreters and child processes compile it again.
+SCALING_WORKER = """if 1:
+    import time
+    def work():
+        n = 0
+        for i in range(10000):
+            n += i * i
+        return n
+    def run(start_time, duration):
+        while time.time() < start_time:
+            time.sleep(0.001)
+        end_time = start_time + duration
+        count = 0
+        while time.time() < end_time:
+            work()
+            count += 1
+        return count
+"""
+
+def _scaling_start_time(nworkers):
+    # Leave the workers time to start before they all begin together.
+    return time.time() + 0.5 + 0.1 * nworkers
+
+def run_scaling_threads(nworkers):
+    ns = {}
+    exec(SCALING_WORKER, ns)
+    start_time = _scaling_start_time(nworkers)
+    results = []
+    def run():
+        results.append(ns['run'](start_time, SCALING_DURATION))
+    threads = [threading.Thread(target=run) for i in range(nworkers)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return sum(results)
+
+def run_scaling_processes(nworkers):
+    start_time = _scaling_start_time(nworkers) + 0.5
+    code = SCALING_WORKER + "print(run(%r, %r))\n" % (start_time,
+                                                     SCALING_DURATION)
+    procs = [subprocess.Popen([sys.executable, '-E', '-c', code],
+                              stdout=subprocess.PIPE)
+             for i in range(nworkers)]
+    total = 0
+    for p in procs:
+        out = p.communicate()[0]
+        total += int(out)
+    return total
+
+def run_scaling_subinterpreters(nworkers, isolated):
+    interps = []
+    for i in range(nworkers):
+        if isolated:
+            interps.append(_xxsubinterpreters.create(isolated=True))
+        else:
+            interps.append(_xxsubinterpreters.create())
+    cid = _xxsubinterpreters.channel_create()
+    start_time = _scaling_start_time(nworkers)
+    code = SCALING_WORKER + (
+        "import _xxsubinterpreters\n"
+        "_xxsubinterpreters.channel_send(%d, str(run(%r, %r)).encode())\n"
+        % (int(cid), start_time, SCALING_DURATION))
+    threads = [threading.Thread(target=_xxsubinterpreters.run_string,
+                                args=(interp, code))
+               for interp in interps]
+    try:
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        return sum(int(_xxsubinterpreters.channel_recv(cid))
+                   for i in range(nworkers))
+    finally:
+        _xxsubinterpreters.channel_destroy(cid)
+        for interp in interps:
+            _xxsubinterpreters.destroy(interp)
+
+def _isolated_subinterpreters_supported():
+    try:
+        interp = _xxsubinterpreters.create(isolated=True)
+    except RuntimeError:
+        return False
+    _xxsubinterpreters.destroy(interp)
+    return True
+
+def run_scaling_tests(max_workers):
+    models = [("threads", run_scaling_threads),
+              ("processes", run_scaling_processes)]
+    if _xxsubinterpreters is not None:
+        if _isolated_subinterpreters_supported():
+            name = "subinterpreters (own GIL)"
+            isolated = True
+        else:
+            name = "subinterpreters (shared GIL)"
+            isolated = False
+        models.append((name, lambda n: run_scaling_subinterpreters(n, isolated)))
+    print("Pure Python loop")
+    print()
+    for name, func in models:
+        print(name + ":")
+        nworkers = 1
+        baseline_speed = None
+        while nworkers <= max_workers:
+            speed = func(nworkers) / SCALING_DURATION
+            print("workers=%d: %d" % (nworkers, speed), end="")
+            if baseline_speed is None:
+                print(" iterations/s.")
+                baseline_speed = speed
+            else:
+                print(" ( %d %%)" % (speed / baseline_speed * 100))
+            nworkers += 1
+        print()
+
+
 def main():
     usage = "usage: %prog [-h|--help] [options]"
     parser = OptionParser(usage=usage)
@@ -539,6 +662,10 @@ def main():
     parser.add_option("-b", "--bandwidth",
                       action="store_true", dest="bandwidth", default=False,
                       help="run I/O bandwidth tests")
+    parser.add_option("-s", "--scaling",
+                      action="store_true", dest="scaling", default=False,
+                      help="run CPU scaling tests of threads, processes "
+                           "and subinterpreters")
     parser.add_option("-i", "--interval",
                       action="store", type="int", dest="check_interval", default=None,
                       help="sys.setcheckinterval() value")
@@ -571,8 +698,10 @@ def main():
         bandwidth_client(**kwargs)
         return
 
-    if not options.throughput and not options.latency and not options.bandwidth:
+    if (not options.throughput and not options.latency and
+        not options.bandwidth and not options.scaling):
         options.throughput = options.latency = options.bandwidth = True
+        options.scaling = True
     if options.check_interval:
         sys.setcheckinterval(options.check_interval)
     if options.switch_interval:
@@ -607,5 +736,10 @@ def main():
         print()
         run_bandwidth_tests(options.nthreads)
 
+    if options.scaling:
+        print("--- CPU scaling ---")
+        print()
+        run_scaling_tests(options.nthreads)
+
 if __name__ == "__main__":
     main()
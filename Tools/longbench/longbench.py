@@ -0,0 +1,138 @@
+"""
+longbench, a benchmark of the arithmetic of very large ints.
+
+It measures multiplication, squaring, division with remainder, and the
+conversions to and from decimal strings of ints of 10**3 to 10**7 decimal
+digits, keeping the best of a few runs.  These operations use the
+Toom-Cook multiplication of Objects/longobject.c and the divide-and-conquer
+algorithms of the _pylong module above some size.
+
+An operation which took more than --timeout seconds on a size is skipped
+for the larger sizes, so that the benchmark can also be run on builds where
+these operations are quadratic.
+"""
+
+import sys
+import time
+from optparse import OptionParser
+
+
+# log10(7) and log10(3)
+LOG10_7 = 0.8450980400142568
+LOG10_3 = 0.47712125471966244
+
+
+def make_int(digits, base=7):
+    """Return an int of about the given number of decimal digits, with
+    digits which look random."""
+    log10 = LOG10_7 if base == 7 else LOG10_3
+    return base ** int(digits / log10)
+
+
+def bench_mul(digits):
+    a = make_int(digits)
+    b = make_int(digits, 3)
+    return lambda: a * b
+
+def bench_square(digits):
+    a = make_int(digits)
+    return lambda: a * a
+
+def bench_divmod(digits):
+    # A quotient and a divisor of digits/2 decimal digits each.
+    a = make_int(digits)
+    b = make_int(digits // 2, 3)
+    return lambda: divmod(a, b)
+
+def bench_str(digits):
+    a = make_int(digits)
+    return lambda: str(a)
+
+def bench_int(digits):
+    # Don't call str(): it may be slow on the build being measured.
+    s = ("31415926535897932384626433832795" * (digits // 32 + 1))[:digits]
+    return lambda: int(s)
+
+BENCHMARKS = [
+    ("mul", bench_mul),
+    ("square", bench_square),
+    ("divmod", bench_divmod),
+    ("str", bench_str),
+    ("int", bench_int),
+]
+
+
+def time_func(func, repeat):
+    best = None
+    for i in range(repeat):
+        start = time.perf_counter()
+        func()
+        duration = time.perf_counter() - start
+        if best is None or duration < best:
+            best = duration
+    return best
+
+def format_duration(duration):
+    if duration is None:
+        return "-"
+    if duration < 1e-3:
+        return "%.1f us" % (duration * 1e6)
+    if duration < 1.0:
+        return "%.1f ms" % (duration * 1e3)
+    return "%.2f s" % duration
+
+
+def main():
+    usage = "usage: %prog [options] [benchmark ...]"
+    parser = OptionParser(usage=usage)
+    parser.add_option("-s", "--size", action="append", type="int",
+                      dest="sizes", default=[], metavar="DIGITS",
+                      help="number of decimal digits of the operands (can "
+                           "be given several times; default: 10**3 to "
+                           "10**7)")
+    parser.add_option("-r", "--repeat", type="int", dest="repeat", default=3,
+                      help="number of runs of each measurement (the best "
+                           "one is kept); operations which take more than "
+                           "a second are run once")
+    parser.add_option("-t", "--timeout", type="float", dest="timeout",
+                      default=60.0, metavar="SECONDS",
+                      help="skip the larger sizes of an operation once it "
+                           "took more than SECONDS (default: 60)")
+    options, args = parser.parse_args()
+
+    names = [name for name, func in BENCHMARKS]
+    for arg in args:
+        if arg not in names:
+            parser.error("unknown benchmark %r (choose from %s)"
+                         % (arg, ", ".join(names)))
+    benchmarks = [(name, func) for name, func in BENCHMARKS
+                  if not args or name in args]
+    sizes = sorted(options.sizes) or [10 ** n for n in range(3, 8)]
+
+    print("Python %s" % sys.version)
+    print()
+    print("== Operations on large ints (lower is better) ==")
+    print()
+    print("%10s" % "digits"
+          + "".join("%12s" % name for name, func in benchmarks))
+    skipped = set()
+    for size in sizes:
+        results = []
+        for name, func in benchmarks:
+            if name in skipped:
+                results.append(None)
+                continue
+            func = func(size)
+            duration = time_func(func, 1)
+            if duration < 1.0 and options.repeat > 1:
+                duration = min(duration, time_func(func, options.repeat - 1))
+            if duration > options.timeout:
+                skipped.add(name)
+            results.append(duration)
+        print("%10d" % size
+              + "".join("%12s" % format_duration(t) for t in results))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
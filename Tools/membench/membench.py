@@ -0,0 +1,316 @@
+"""
+membench, a benchmark of the small object allocator (pymalloc).
+
+It measures the allocation throughput of a few object churn workloads and
+the resident memory of the process once most of a large number of objects
+have been freed, for one or more Python executables and arena sizes (see the
+PYTHONMALLOCARENASIZE environment variable).
+
+It also measures how much of the memory a forked worker shares with its
+parent once it has read all the objects of the parent, with and without
+gc.freeze() (which makes the frozen objects immortal in a Python built
+--with-immortal-objects).
+
+Finally, it measures the memory used by small dicts built in various ways
+(literals, keyword arguments, records decoded from JSON, ...): small dicts
+are compact, without a hash table.
+
+Every measurement runs in a new process, so that the allocator starts from a
+clean state.  The memory measurements need Linux (/proc/self/status and
+/proc/self/smaps_rollup).
+"""
+
+import gc
+import json
+import os
+import subprocess
+import sys
+import time
+from optparse import OptionParser, SUPPRESS_HELP
+
+
+THROUGHPUT_DURATION = 1.0
+
+RSS_OBJECTS = 300000
+RSS_KEEP_ONE_IN = 256
+
+FORK_OBJECTS = 300000
+
+DICT_OBJECTS = 100000
+
+
+def task_tuples():
+    """Tuple churn"""
+    for i in range(1000):
+        t = (i, i, i)
+        t = (t, i)
+        t = (t, t, t, t, t)
+
+def task_dicts():
+    """Dict churn"""
+    for i in range(1000):
+        d = {'a': i, 'b': i}
+        d = {'a': d}
+
+def task_lists():
+    """List churn"""
+    for i in range(1000):
+        l = [i] * 8
+        l.append(l)
+        l = l[:4]
+
+def task_mixed():
+    """Live set of mixed objects"""
+    live = [None] * 256
+    for i in range(1000):
+        live[(i * 7) & 255] = (i, [i], {'i': i}, str(i))
+
+throughput_tasks = [task_tuples, task_dicts, task_lists, task_mixed]
+
+
+class Record:
+    def __init__(self, i):
+        self.id = i
+        self.name = 'x'
+        self.parent = None
+        self.children = ()
+
+def kwargs(**kw):
+    return kw
+
+def dict_empty(i):
+    """Empty dict"""
+    return {}
+
+def dict_literal1(i):
+    """Literal, 1 key"""
+    return {'id': i}
+
+def dict_literal3(i):
+    """Literal, 3 keys"""
+    return {'id': i, 'name': 'x', 'parent': None}
+
+def dict_kwargs2(i):
+    """Keyword arguments, 2 keys"""
+    return kwargs(id=i, name='x')
+
+def dict_json5(i, doc='{"id": 1, "name": "x", "tags": [], "x": 1.5, "y": 2}'):
+    """JSON record, 5 keys"""
+    return json.loads(doc)
+
+def dict_setitem8(i):
+    """Filled key by key, 8 keys"""
+    d = {}
+    for key in 'abcdefgh':
+        d[key] = i
+    return d
+
+def dict_setitem12(i):
+    """Filled key by key, 12 keys"""
+    d = {}
+    for key in 'abcdefghijkl':
+        d[key] = i
+    return d
+
+def dict_instance4(i):
+    """Instance __dict__, 4 attributes"""
+    return Record(i).__dict__
+
+dict_tasks = [dict_empty, dict_literal1, dict_literal3, dict_kwargs2,
+              dict_json5, dict_setitem8, dict_setitem12, dict_instance4]
+
+
+def get_rss():
+    """Return the resident set size of the process in KiB, or None."""
+    try:
+        with open('/proc/self/status') as f:
+            for line in f:
+                if line.startswith('VmRSS:'):
+                    return int(line.split()[1])
+    except OSError:
+        return None
+    return None
+
+
+def get_private_dirty():
+    """Return the memory of the process which isn't shared with another one
+    and was written to, in KiB, or None."""
+    try:
+        with open('/proc/self/smaps_rollup') as f:
+            for line in f:
+                if line.startswith('Private_Dirty:'):
+                    return int(line.split()[1])
+    except OSError:
+        return None
+    return None
+
+
+def run_throughput(name):
+    func = globals()[name]
+    loops = 0
+    start = time.perf_counter()
+    end = start + THROUGHPUT_DURATION
+    while True:
+        func()
+        loops += 1
+        now = time.perf_counter()
+        if now >= end:
+            break
+    return loops * 1000 / (now - start)
+
+def run_rss():
+    base = get_rss()
+    objs = [{'i': i, 's': str(i)} for i in range(RSS_OBJECTS)]
+    peak = get_rss()
+    keep = objs[::RSS_KEEP_ONE_IN]
+    del objs
+    after = get_rss()
+    return base, peak, after
+
+def run_fork(freeze):
+    data = [{'key': str(i), 'value': (i, float(i))}
+            for i in range(FORK_OBJECTS)]
+    if freeze:
+        gc.freeze()
+    rfd, wfd = os.pipe()
+    pid = os.fork()
+    if pid == 0:
+        # The worker reads all the objects, as a request handler would
+        before = get_private_dirty()
+        for d in data:
+            for key, value in d.items():
+                pass
+        after = get_private_dirty()
+        os.write(wfd, ('%s %s' % (before, after)).encode())
+        os._exit(0)
+    os.close(wfd)
+    with open(rfd, 'rb') as f:
+        result = f.read().decode()
+    os.waitpid(pid, 0)
+    return result
+
+
+def run_dicts(name):
+    """Return the size of a dict built by the name task, as reported by
+    sys.getsizeof(), and the resident memory used per dict, in bytes."""
+    func = globals()[name]
+    size = sys.getsizeof(func(0))
+    objs = [None] * DICT_OBJECTS
+    base = get_rss()
+    for i in range(DICT_OBJECTS):
+        objs[i] = func(i)
+    after = get_rss()
+    if base is None:
+        return size, None
+    return size, (after - base) * 1024 // DICT_OBJECTS
+
+
+def child(args):
+    """Run one measurement and print its result: called in the child."""
+    if args[0] == 'rss':
+        print(' '.join(str(x) for x in run_rss()))
+    elif args[0] == 'dicts':
+        print(' '.join(str(x) for x in run_dicts(args[1])))
+    elif args[0] == 'fork':
+        print(run_fork(args[1] == 'freeze'))
+    else:
+        print(run_throughput(args[0]))
+
+def measure(python, arena_size, args):
+    env = dict(os.environ)
+    env.pop('PYTHONMALLOC', None)
+    if arena_size:
+        env['PYTHONMALLOCARENASIZE'] = arena_size
+    else:
+        env.pop('PYTHONMALLOCARENASIZE', None)
+    out = subprocess.check_output(
+        [python, os.path.abspath(__file__), '--child'] + args,
+        env=env, universal_newlines=True)
+    return out.split()
+
+
+def main():
+    usage = "usage: %prog [options]"
+    parser = OptionParser(usage=usage)
+    parser.add_option("-p", "--python", action="append", dest="pythons",
+                      default=[], metavar="PATH",
+                      help="Python executable to benchmark (can be given "
+                           "several times; default: the running one)")
+    parser.add_option("-a", "--arena-size", action="append",
+                      dest="arena_sizes", default=[], metavar="SIZE",
+                      help="value of PYTHONMALLOCARENASIZE (can be given "
+                           "several times; default: unset)")
+    parser.add_option("-r", "--repeat", type="int", dest="repeat", default=3,
+                      help="number of runs of each throughput measurement "
+                           "(the best one is kept)")
+    parser.add_option("--child", action="store_true", dest="child",
+                      help=SUPPRESS_HELP)
+    options, args = parser.parse_args()
+
+    if options.child:
+        child(args)
+        return
+
+    pythons = options.pythons or [sys.executable]
+    arena_sizes = options.arena_sizes or ['']
+    configs = [(python, size) for python in pythons for size in arena_sizes]
+
+    print("== Allocation throughput (iterations/s, higher is better) ==")
+    print()
+    for python, size in configs:
+        print("%s, arena size %s:" % (python, size or 'default'))
+        for task in throughput_tasks:
+            best = max(float(measure(python, size, [task.__name__])[0])
+                       for i in range(options.repeat))
+            print("  %-30s %12.0f" % (task.__doc__, best))
+        print()
+
+    print("== Resident memory (KiB, lower is better) ==")
+    print()
+    print("%d dicts allocated, then all but one in %d freed"
+          % (RSS_OBJECTS, RSS_KEEP_ONE_IN))
+    print()
+    for python, size in configs:
+        base, peak, after = measure(python, size, ['rss'])
+        if base == 'None':
+            print("RSS is not available on this platform")
+            break
+        print("%s, arena size %s:" % (python, size or 'default'))
+        print("  %-30s %12s" % ("at startup", base))
+        print("  %-30s %12s" % ("peak", peak))
+        print("  %-30s %12s" % ("after freeing", after))
+        print()
+
+    print("== Memory of small dicts (bytes per dict, lower is better) ==")
+    print()
+    print("%d dicts built; sys.getsizeof() and resident memory per dict"
+          % DICT_OBJECTS)
+    print()
+    for python in pythons:
+        print("%s:" % python)
+        for task in dict_tasks:
+            size, rss = measure(python, '', ['dicts', task.__name__])
+            print("  %-34s %8s %8s" % (task.__doc__, size, rss))
+        print()
+
+    if not hasattr(os, 'fork'):
+        return
+    print("== Memory copied by a forked worker (KiB, lower is better) ==")
+    print()
+    print("%d dicts allocated, then read by a forked worker"
+          % FORK_OBJECTS)
+    print()
+    for python in pythons:
+        print("%s:" % python)
+        for mode, title in (('', 'without gc.freeze()'),
+                            ('freeze', 'with gc.freeze()')):
+            before, after = measure(python, '', ['fork', mode])
+            if before == 'None':
+                print("Private_Dirty is not available on this platform")
+                return
+            print("  %-30s %12d" % (title, int(after) - int(before)))
+        print()
+
+
+if __name__ == "__main__":
+    main()
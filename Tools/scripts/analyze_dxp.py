@@ -1,13 +1,12 @@
 """
-Some helper functions to analyze the output of sys.getdxp() (which is
-only available if Python was built with -DDYNAMIC_EXECUTION_PROFILE).
+Some helper functions to analyze the opcode counts of sys._opcode_profile().
 These will tell you which opcodes have been executed most frequently
-in the current process, and, if Python was also built with -DDXPAIRS,
-will tell you which instruction _pairs_ were executed most frequently,
-which may help in choosing new instructions.
+in the current process, and which instruction _pairs_ were executed most
+frequently, which may help in choosing new instructions.
 
-If Python was built without -DDYNAMIC_EXECUTION_PROFILE, importing
-this module will raise a RuntimeError.
+Importing this module enables opcode profiling (see
+sys._set_opcode_profiling()).  To rank the code objects rather than the
+opcodes, see opcode_profile.py.
 
 If you're running a script you want to profile, a simple way to get
 the common pairs is:
@@ -26,19 +25,33 @@ import operator
 import sys
 import threading
 
-if not hasattr(sys, "getdxp"):
-    raise RuntimeError("Can't import analyze_dxp: Python built without"
-                       " -DDYNAMIC_EXECUTION_PROFILE.")
+
+def getdxp():
+    """Returns the opcode counts of all code objects and clears them.
+
+    The result is a list of 257 lists of 256 ints: the counts of the pairs
+    of opcodes indexed by first opcode, then the counts of the opcodes, in
+    the format of the former sys.getdxp()."""
+
+    profile = [[0] * 256 for i in range(257)]
+    for *label, counts, pairs in sys._opcode_profile():
+        for op, count in counts.items():
+            profile[256][op] += count
+        for (op1, op2), count in pairs.items():
+            profile[op1][op2] += count
+    sys._clear_opcode_profile()
+    return profile
 
 
 _profile_lock = threading.RLock()
-_cumulative_profile = sys.getdxp()
+_cumulative_profile = getdxp()
+sys._set_opcode_profiling(True)
 
-# If Python was built with -DDXPAIRS, sys.getdxp() returns a list of
-# lists of ints.  Otherwise it returns just a list of ints.
+# getdxp() always returns a list of lists of ints; the former sys.getdxp()
+# returned just a list of ints if Python was built without -DDXPAIRS.
 def has_pairs(profile):
-    """Returns True if the Python that produced the argument profile
-    was built with -DDXPAIRS."""
+    """Returns True if the argument profile includes the counts of the
+    pairs of opcodes."""
 
     return len(profile) > 0 and isinstance(profile[0], list)
 
@@ -46,18 +59,18 @@ def has_pairs(profile):
 def reset_profile():
     """Forgets any execution profile that has been gathered so far."""
     with _profile_lock:
-        sys.getdxp()  # Resets the internal profile
+        getdxp()  # Resets the internal profile
         global _cumulative_profile
-        _cumulative_profile = sys.getdxp()  # 0s out our copy.
+        _cumulative_profile = getdxp()  # 0s out our copy.
 
 
 def merge_profile():
-    """Reads sys.getdxp() and merges it into this module's cached copy.
+    """Reads getdxp() and merges it into this module's cached copy.
 
-    We need this because sys.getdxp() 0s itself every time it's called."""
+    We need this because getdxp() 0s itself every time it's called."""
 
     with _profile_lock:
-        new_profile = sys.getdxp()
+        new_profile = getdxp()
         if has_pairs(new_profile):
             for first_inst in range(len(_cumulative_profile)):
                 for second_inst in range(len(_cumulative_profile[first_inst])):
@@ -0,0 +1,142 @@
+#! /usr/bin/env python3
+
+"""Run a script with opcode profiling and rank hot code objects and pairs.
+
+Usage: opcode_profile.py [-n count] [-m module | script] [arg] ...
+
+The script runs with opcode profiling enabled (see
+sys._set_opcode_profiling()): every code object counts the opcodes it runs.
+Then the code objects which ran the most instructions are listed with their
+most frequent opcodes, followed by the most frequent pairs of consecutive
+opcodes.  Code objects are identified by filename, first line number and
+name: the counts of code objects sharing them are added up.
+
+The functions of this module can also rank the profile of the current
+process, for example:
+
+    sys._set_opcode_profiling(True)
+    work()
+    sys._set_opcode_profiling(False)
+    opcode_profile.report(opcode_profile.collect())
+"""
+
+import argparse
+import opcode
+import os
+import runpy
+import sys
+
+
+def collect():
+    """Return the opcode profile of the current process.
+
+    The result maps (filename, firstlineno, name) to a (counts, pairs)
+    tuple of dicts, as returned by sys._opcode_profile().
+    """
+    profile = {}
+    for filename, firstlineno, name, counts, pairs in sys._opcode_profile():
+        label = (filename, firstlineno, name)
+        if label not in profile:
+            profile[label] = ({}, {})
+        total_counts, total_pairs = profile[label]
+        for op, count in counts.items():
+            total_counts[op] = total_counts.get(op, 0) + count
+        for pair, count in pairs.items():
+            total_pairs[pair] = total_pairs.get(pair, 0) + count
+    return profile
+
+
+def hot_code(profile, limit=None):
+    """Return the code objects of profile by decreasing number of
+    instructions run, as a list of (instructions, label, counts) tuples.
+    """
+    result = [(sum(counts.values()), label, counts)
+              for label, (counts, pairs) in profile.items()]
+    result.sort(key=lambda item: (-item[0], item[1]))
+    return result[:limit]
+
+
+def hot_pairs(profile, limit=None):
+    """Return the pairs of opcodes of profile by decreasing frequency, as a
+    list of ((opname, next opname), count) tuples.
+    """
+    totals = {}
+    for counts, pairs in profile.values():
+        for pair, count in pairs.items():
+            totals[pair] = totals.get(pair, 0) + count
+    result = [((opcode.opname[op1], opcode.opname[op2]), count)
+              for (op1, op2), count in totals.items()]
+    result.sort(key=lambda item: (-item[1], item[0]))
+    return result[:limit]
+
+
+def format_label(label):
+    filename, firstlineno, name = label
+    return '%s:%d(%s)' % (filename, firstlineno, name)
+
+
+def report(profile, limit=20, file=None):
+    """Write the limit hottest code objects and pairs of profile to file
+    (default: sys.stdout)."""
+    if file is None:
+        file = sys.stdout
+    total = sum(sum(counts.values()) for counts, pairs in profile.values())
+    if not total:
+        print("No instruction was counted.", file=file)
+        return
+
+    print("%d instructions run by %d code objects" % (total, len(profile)),
+          file=file)
+    print(file=file)
+    print("Hot code objects:", file=file)
+    for instructions, label, counts in hot_code(profile, limit):
+        ops = sorted(counts.items(), key=lambda item: -item[1])[:3]
+        ops = ', '.join('%s %.0f%%' % (opcode.opname[op],
+                                       count * 100.0 / instructions)
+                        for op, count in ops)
+        print("%12d %5.1f%%  %s" % (instructions, instructions * 100.0 / total,
+                                    format_label(label)), file=file)
+        print("%21s%s" % ('', ops), file=file)
+
+    print(file=file)
+    print("Hot pairs:", file=file)
+    for (opname1, opname2), count in hot_pairs(profile, limit):
+        print("%12d %5.1f%%  %s %s" % (count, count * 100.0 / total,
+                                       opname1, opname2), file=file)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run a script with opcode profiling and rank hot code "
+                    "objects and hot pairs of opcodes.")
+    parser.add_argument('-n', '--count', type=int, default=20,
+                        help="number of code objects and pairs to list "
+                             "(default: 20)")
+    parser.add_argument('-m', dest='module', action='store_true',
+                        help="profile a library module")
+    parser.add_argument('target', help="script or module to profile")
+    parser.add_argument('args', nargs=argparse.REMAINDER,
+                        help="arguments of the script")
+    options = parser.parse_args()
+
+    sys.argv[:] = [options.target] + options.args
+    if not options.module:
+        sys.path.insert(0, os.path.dirname(options.target))
+
+    sys._clear_opcode_profile()
+    sys._set_opcode_profiling(True)
+    try:
+        if options.module:
+            runpy.run_module(options.target, run_name='__main__',
+                             alter_sys=True)
+        else:
+            runpy.run_path(options.target, run_name='__main__')
+    except SystemExit:
+        pass
+    finally:
+        sys._set_opcode_profiling(False)
+    report(collect(), options.count)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,155 @@
+"""
+sortbench, a benchmark of list.sort() on large lists.
+
+It sorts lists of random ints, floats and latin-1 strings of several sizes
+with one or more sorting threads (see sys._set_sort_threads()), keeping the
+best of a few runs.  The lists are copied before every run, and the copy
+isn't timed.
+
+Random lists of ints which fit in 63 bits and of floats are sorted by a
+radix sort; the "runs" lists, made of sorted runs, are sorted by timsort.
+To compare the radix sort with the comparison sort of a Python which
+doesn't have it, give both executables with --python: every measurement
+runs in a new process of each executable, on the same lists.
+"""
+
+import os
+import random
+import subprocess
+import sys
+import time
+from optparse import OptionParser, SUPPRESS_HELP
+
+
+def make_ints(size):
+    # Ints of one digit, which timsort compares with unsafe_long_compare()
+    return [random.randrange(-2**29, 2**29) for i in range(size)]
+
+def make_int64s(size):
+    return [random.randrange(-2**62, 2**62) for i in range(size)]
+
+def make_floats(size):
+    return [random.random() for i in range(size)]
+
+def make_strings(size):
+    return ["%016x" % random.getrandbits(64) for i in range(size)]
+
+def make_partly_sorted(size):
+    # Sorted runs of 1000 floats
+    data = make_floats(size)
+    return [x for i in range(0, size, 1000) for x in sorted(data[i:i+1000])]
+
+DATA = [
+    ("int", make_ints),
+    ("int64", make_int64s),
+    ("float", make_floats),
+    ("str", make_strings),
+    ("runs", make_partly_sorted),
+]
+
+
+def time_sort(data, threads, repeat):
+    best = None
+    if threads > 1:
+        sys._set_sort_threads(threads)
+    try:
+        for i in range(repeat):
+            copy = data[:]
+            start = time.perf_counter()
+            copy.sort()
+            duration = time.perf_counter() - start
+            if best is None or duration < best:
+                best = duration
+            del copy
+    finally:
+        if threads > 1:
+            sys._set_sort_threads(1)
+    return best
+
+def child(args):
+    name, size, repeat = args[0], int(args[1]), int(args[2])
+    threads = [int(arg) for arg in args[3:]]
+    random.seed(5)
+    items = dict(DATA)[name](size)
+    results = []
+    for n in threads:
+        if n > 1 and not hasattr(sys, "_set_sort_threads"):
+            results.append("-")
+        else:
+            results.append("%.1f" % (time_sort(items, n, repeat) * 1e3))
+    print(" ".join(results))
+
+def measure(python, name, size, threads, repeat):
+    out = subprocess.check_output(
+        [python, os.path.abspath(__file__), '--child', name, str(size),
+         str(repeat)] + [str(n) for n in threads],
+        universal_newlines=True)
+    return [None if t == "-" else float(t) for t in out.split()]
+
+
+def main():
+    usage = "usage: %prog [options] [data ...]"
+    parser = OptionParser(usage=usage)
+    parser.add_option("-p", "--python", action="append", dest="pythons",
+                      default=[], metavar="PATH",
+                      help="Python executable to benchmark (can be given "
+                           "several times; default: the running one)")
+    parser.add_option("-t", "--threads", action="append", type="int",
+                      dest="threads", default=[], metavar="N",
+                      help="number of sorting threads (can be given several "
+                           "times; default: 1, 2, 4 and the CPU count)")
+    parser.add_option("-s", "--size", action="append", type="int",
+                      dest="sizes", default=[], metavar="COUNT",
+                      help="number of items of the lists (can be given "
+                           "several times; default: 100000, 1000000 and "
+                           "10000000)")
+    parser.add_option("-r", "--repeat", type="int", dest="repeat", default=3,
+                      help="number of runs of each measurement (the best "
+                           "one is kept)")
+    parser.add_option("--child", action="store_true", dest="child",
+                      help=SUPPRESS_HELP)
+    options, args = parser.parse_args()
+
+    if options.child:
+        child(args)
+        return
+
+    names = [name for name, func in DATA]
+    for arg in args:
+        if arg not in names:
+            parser.error("unknown data %r (choose from %s)"
+                         % (arg, ", ".join(names)))
+    data = [name for name in names if not args or name in args]
+    pythons = options.pythons or [sys.executable]
+    threads = options.threads
+    if not threads:
+        threads = sorted({1, 2, 4, os.cpu_count() or 1})
+    sizes = options.sizes or [100000, 1000000, 10000000]
+
+    print("%s CPUs" % os.cpu_count())
+    print("Speedups are relative to the first executable with 1 thread.")
+    for name in data:
+        print()
+        print("== Sort of %s lists (ms, lower is better) ==" % name)
+        reference = {}
+        for python in pythons:
+            print()
+            print("%s:" % python)
+            print("%12s" % "items"
+                  + "".join("%12s" % ("%d threads" % n) for n in threads))
+            for size in sizes:
+                results = measure(python, name, size, threads,
+                                  options.repeat)
+                reference.setdefault(size, results[0])
+                print("%12d" % size
+                      + "".join("%12s" % ("-" if t is None else "%.1f" % t)
+                                for t in results))
+                print("%12s" % "speedup"
+                      + "".join("%12s" % ("-" if t is None else
+                                          "%.2f" % (reference[size] / t))
+                                for t in results))
+                sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
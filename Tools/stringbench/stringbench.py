@@ -5,6 +5,7 @@
 import timeit
 import itertools
 import operator
+import random
 import re
 import sys
 import datetime
@@ -1390,6 +1391,96 @@ def upper_conversion_dense(STR):
         s_upper()
 
 
+#### UTF-8 codec
+
+# Text in several scripts: the decoding benchmarks only run with bytes, the
+# encoding ones only with unicode.
+
+if sys.version_info >= (3,):
+    _unichr = chr
+else:
+    _unichr = unichr
+
+def _make_words(rng, first, last, count, min_len=2, max_len=9, sep=" "):
+    return sep.join("".join(_unichr(rng.randint(first, last))
+                            for i in range(rng.randint(min_len, max_len)))
+                    for i in range(count))
+
+def _make_utf8_texts():
+    rng = random.Random(5)
+    latin1 = "".join(c if rng.random() > 0.06 else rng.choice(u"\xe0\xe7\xe8\xe9\xf4\xfb")
+                     for c in _make_words(rng, ord("a"), ord("z"), 2000))
+    cyrillic = _make_words(rng, 0x430, 0x44F, 2000)
+    cjk = _make_words(rng, 0x4E00, 0x9FA5, 200, 10, 60, u"\u3002")
+    mixed = u" ".join(rng.choice([_make_words(rng, ord("a"), ord("z"), 1),
+                                  _make_words(rng, 0x430, 0x44F, 1),
+                                  _make_words(rng, 0x4E00, 0x9FA5, 1),
+                                  b"\\U0001F600".decode("unicode_escape")])
+                      for i in range(2000))
+    return {"latin-1": latin1, "cyrillic": cyrillic, "cjk": cjk,
+            "mixed": mixed}
+
+_utf8_texts = _make_utf8_texts()
+
+def _get_utf8_text(STR, script):
+    if STR is not UNICODE:
+        raise UnsupportedType
+    return _utf8_texts[script]
+
+def _get_utf8_bytes(STR, script):
+    if STR is not BYTES:
+        raise UnsupportedType
+    return _utf8_texts[script].encode("utf-8")
+
+@bench('latin1_text.encode("utf-8")', "UTF-8 encode", 100)
+def utf8_encode_latin1(STR):
+    s_encode = _get_utf8_text(STR, "latin-1").encode
+    for x in _RANGE_100:
+        s_encode("utf-8")
+
+@bench('cyrillic_text.encode("utf-8")', "UTF-8 encode", 100)
+def utf8_encode_cyrillic(STR):
+    s_encode = _get_utf8_text(STR, "cyrillic").encode
+    for x in _RANGE_100:
+        s_encode("utf-8")
+
+@bench('cjk_text.encode("utf-8")', "UTF-8 encode", 100)
+def utf8_encode_cjk(STR):
+    s_encode = _get_utf8_text(STR, "cjk").encode
+    for x in _RANGE_100:
+        s_encode("utf-8")
+
+@bench('mixed_scripts_text.encode("utf-8")', "UTF-8 encode", 100)
+def utf8_encode_mixed(STR):
+    s_encode = _get_utf8_text(STR, "mixed").encode
+    for x in _RANGE_100:
+        s_encode("utf-8")
+
+@bench('latin1_text_utf8.decode("utf-8")', "UTF-8 decode", 100)
+def utf8_decode_latin1(STR):
+    s_decode = _get_utf8_bytes(STR, "latin-1").decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+@bench('cyrillic_text_utf8.decode("utf-8")', "UTF-8 decode", 100)
+def utf8_decode_cyrillic(STR):
+    s_decode = _get_utf8_bytes(STR, "cyrillic").decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+@bench('cjk_text_utf8.decode("utf-8")', "UTF-8 decode", 100)
+def utf8_decode_cjk(STR):
+    s_decode = _get_utf8_bytes(STR, "cjk").decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+@bench('mixed_scripts_text_utf8.decode("utf-8")', "UTF-8 decode", 100)
+def utf8_decode_mixed(STR):
+    s_decode = _get_utf8_bytes(STR, "mixed").decode
+    for x in _RANGE_100:
+        s_decode("utf-8")
+
+
 # end of benchmarks
 
 #################